@@ -28,6 +28,7 @@ from pyzymap import PINYIN_ZHUYIN_MAP, ZHUYIN_SPECIAL_INITIAL_SET_IN_PINYIN_FORM
 from fullpinyin import PINYIN_LIST, SHENGMU_LIST
 from options import *
 from utils import shuffle_all
+from perfecthash import gen_perfect_hash
 
 
 #pinyins
@@ -314,34 +315,70 @@ def gen_secondary_zhuyin_index():
         entries.append(entry)
     return ',\n'.join(entries)
 
-def gen_zhuyin_index():
+def gen_zhuyin_index_entries():
     entries = []
     for (shuffle, flags, correct) in shuffle_zhuyin_index:
         pinyin = ZHUYIN_PINYIN_MAP[correct]
         index = [x[0] for x in content_table].index(pinyin)
         entry = '{{"{0}", {1}, {2}}}'.format(shuffle, flags, index)
-        entries.append(entry)
-    return ',\n'.join(entries)
+        entries.append((shuffle, entry))
+    return entries
 
-def gen_hsu_zhuyin_index():
+def gen_corrected_zhuyin_index_entries(zhuyin_index):
     entries = []
-    for (wrong, flags, correct) in hsu_zhuyin_index:
+    for (wrong, flags, correct) in zhuyin_index:
         pinyin = ZHUYIN_PINYIN_MAP[correct]
         index = [x[0] for x in content_table].index(pinyin)
         entry = '{{"{0}" /* "{1}" */, {2}, {3}}}'.format \
                 (wrong, pinyin, flags, index)
-        entries.append(entry)
-    return ',\n'.join(entries)
+        entries.append((wrong, entry))
+    return entries
+
+def gen_zhuyin_index():
+    entries = gen_zhuyin_index_entries()
+    return ',\n'.join([entry for (key, entry) in entries])
+
+def gen_hsu_zhuyin_index():
+    entries = gen_corrected_zhuyin_index_entries(hsu_zhuyin_index)
+    return ',\n'.join([entry for (key, entry) in entries])
 
 def gen_eten26_zhuyin_index():
-    entries = []
-    for (wrong, flags, correct) in eten26_zhuyin_index:
-        pinyin = ZHUYIN_PINYIN_MAP[correct]
-        index = [x[0] for x in content_table].index(pinyin)
-        entry = '{{"{0}" /* "{1}" */, {2}, {3}}}'.format \
-                (wrong, pinyin, flags, index)
-        entries.append(entry)
-    return ',\n'.join(entries)
+    entries = gen_corrected_zhuyin_index_entries(eten26_zhuyin_index)
+    return ',\n'.join([entry for (key, entry) in entries])
+
+#the index items in the perfect hash slot order
+def gen_index_hash(entries):
+    slots, displacements = gen_perfect_hash([key for (key, entry) in entries])
+    hashed = [None] * len(entries)
+    for (key, entry) in entries:
+        hashed[slots[key]] = entry
+    return ',\n'.join(hashed)
+
+def gen_index_displacements(entries):
+    slots, displacements = gen_perfect_hash([key for (key, entry) in entries])
+    return ',\n'.join([str(displacement) for displacement in displacements])
+
+def gen_zhuyin_index_hash():
+    return gen_index_hash(gen_zhuyin_index_entries())
+
+def gen_zhuyin_index_displacements():
+    return gen_index_displacements(gen_zhuyin_index_entries())
+
+def gen_hsu_zhuyin_index_hash():
+    return gen_index_hash \
+        (gen_corrected_zhuyin_index_entries(hsu_zhuyin_index))
+
+def gen_hsu_zhuyin_index_displacements():
+    return gen_index_displacements \
+        (gen_corrected_zhuyin_index_entries(hsu_zhuyin_index))
+
+def gen_eten26_zhuyin_index_hash():
+    return gen_index_hash \
+        (gen_corrected_zhuyin_index_entries(eten26_zhuyin_index))
+
+def gen_eten26_zhuyin_index_displacements():
+    return gen_index_displacements \
+        (gen_corrected_zhuyin_index_entries(eten26_zhuyin_index))
 
 def check_rule(correct, wrong):
     if '*' not in correct:
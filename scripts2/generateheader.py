@@ -24,6 +24,7 @@ import os
 from argparse import ArgumentParser
 from chewing import gen_initials, gen_middles, gen_finals, gen_tones
 from fullpinyintable import gen_content_table, gen_pinyin_index, gen_luoma_pinyin_index, gen_secondary_zhuyin_index, gen_zhuyin_index, gen_hsu_zhuyin_index, gen_eten26_zhuyin_index, gen_table_index_for_chewing_key
+from fullpinyintable import gen_zhuyin_index_hash, gen_zhuyin_index_displacements, gen_hsu_zhuyin_index_hash, gen_hsu_zhuyin_index_displacements, gen_eten26_zhuyin_index_hash, gen_eten26_zhuyin_index_displacements
 from specialtable import gen_divided_table, gen_resplit_table
 from doublepinyintable import gen_shengmu_table, gen_yunmu_table, gen_fallback_table2, gen_fallback_table3
 from bopomofotable import gen_chewing_symbols, gen_chewing_initials, gen_chewing_middles, gen_chewing_finals, gen_chewing_tones
@@ -60,6 +61,18 @@ def get_table_content(tablename):
         return gen_hsu_zhuyin_index()
     if tablename == 'ETEN26_ZHUYIN_INDEX':
         return gen_eten26_zhuyin_index()
+    if tablename == 'ZHUYIN_INDEX_HASH':
+        return gen_zhuyin_index_hash()
+    if tablename == 'ZHUYIN_INDEX_DISPLACEMENTS':
+        return gen_zhuyin_index_displacements()
+    if tablename == 'HSU_ZHUYIN_INDEX_HASH':
+        return gen_hsu_zhuyin_index_hash()
+    if tablename == 'HSU_ZHUYIN_INDEX_DISPLACEMENTS':
+        return gen_hsu_zhuyin_index_displacements()
+    if tablename == 'ETEN26_ZHUYIN_INDEX_HASH':
+        return gen_eten26_zhuyin_index_hash()
+    if tablename == 'ETEN26_ZHUYIN_INDEX_DISPLACEMENTS':
+        return gen_eten26_zhuyin_index_displacements()
     if tablename == 'DIVIDED_TABLE':
         return gen_divided_table()
     if tablename == 'RESPLIT_TABLE':
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+# vim:set et sts=4 sw=4:
+#
+# libpinyin - Library to deal with pinyin.
+#
+# Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2, or (at your option)
+# any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston,
+# MA  02110-1301, USA.
+
+
+# the minimal perfect hash by hash and displace,
+# keep the hash function in sync with chewing_index_hash
+# in src/storage/pinyin_parser2.h.
+
+def fnv_hash(seed, key):
+    value = (2166136261 ^ seed) & 0xffffffff
+    for ch in key.encode('utf-8'):
+        value = ((value ^ ch) * 16777619) & 0xffffffff
+    return value
+
+
+def gen_perfect_hash(keys):
+    '''returns the slot of each key and the displacement of each bucket.'''
+    size = len(keys)
+    assert size == len(set(keys)), "duplicated keys."
+
+    buckets = [[] for i in range(size)]
+    for key in keys:
+        buckets[fnv_hash(0, key) % size].append(key)
+
+    slots = {}
+    used = set()
+    displacements = [0] * size
+
+    order = sorted(range(size), key=lambda i: len(buckets[i]), reverse=True)
+
+    #place the buckets with more keys by displacement
+    for bucket in order:
+        if len(buckets[bucket]) <= 1:
+            break
+
+        seed = 1
+        while True:
+            placed = set()
+            for key in buckets[bucket]:
+                slot = fnv_hash(seed, key) % size
+                if slot in used or slot in placed:
+                    break
+                placed.add(slot)
+
+            if len(placed) == len(buckets[bucket]):
+                break
+            seed += 1
+
+        displacements[bucket] = seed
+        for key in buckets[bucket]:
+            slots[key] = fnv_hash(seed, key) % size
+        used |= placed
+
+    #place the single key buckets into the free slots directly
+    free = [slot for slot in range(size) if slot not in used]
+    for bucket in order:
+        if len(buckets[bucket]) != 1:
+            continue
+
+        slot = free.pop()
+        displacements[bucket] = - slot - 1
+        slots[buckets[bucket][0]] = slot
+
+    assert not free
+    return slots, displacements
+
+
+def search_perfect_hash(displacements, key):
+    size = len(displacements)
+    displacement = displacements[fnv_hash(0, key) % size]
+    if displacement < 0:
+        return - displacement - 1
+    return fnv_hash(displacement, key) % size
+
+
+### main function ###
+if __name__ == "__main__":
+    keys = ["ㄅ", "ㄅㄚ", "ㄅㄛ", "ㄆ", "ㄆㄚ", "ㄇ"]
+    slots, displacements = gen_perfect_hash(keys)
+    for key in keys:
+        assert search_perfect_hash(displacements, key) == slots[key]
+    print(slots, displacements)
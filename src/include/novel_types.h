@@ -117,6 +117,12 @@ struct BigramPhraseItemWithCount{
 typedef GArray * BigramPhraseArray; /* Array of BigramPhraseItem */
 typedef GArray * BigramPhraseWithCountArray; /* Array of BigramPhraseItemWithCount */
 
+struct TrigramKey{
+    phrase_token_t m_tokens[2]; /* W1 and W2 in P(W3|W1,W2) */
+};
+
+typedef GArray * TrigramKeyArray; /* Array of TrigramKey */
+
 #define MAX_PHRASE_LENGTH 16
 
 const phrase_token_t null_token = 0;
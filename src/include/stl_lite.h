@@ -41,5 +41,11 @@ namespace std_lite{
     using std::pop_heap;
 
 
+    using std::nth_element;
+
+
+    using std::sort;
+
+
 }
 #endif
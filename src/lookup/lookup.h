@@ -33,6 +33,8 @@
 namespace pinyin{
 
 typedef phrase_token_t lookup_key_t;
+/* the key of the viterbi state, the last two tokens for the tri-gram. */
+typedef guint64 lookup_state_key_t;
 
 struct lookup_value_t{
     /* previous and current tokens of the node */
@@ -43,6 +45,8 @@ struct lookup_value_t{
     gfloat m_poss;
     /* trace back information for final step */
     gint32 m_last_step;
+    /* the index of the previous node in the step m_last_step */
+    gint32 m_last_index;
 
     lookup_value_t(gfloat poss = FLT_MAX){
         m_handles[0] = null_token;
@@ -50,6 +54,7 @@ struct lookup_value_t{
         m_length = 0;
         m_poss = poss;
         m_last_step = -1;
+        m_last_index = -1;
     }
 };
 
@@ -0,0 +1,119 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <string.h>
+#include "lookup_lattice.h"
+
+using namespace pinyin;
+
+/* the initial number of slots in one column, must be power of two. */
+static const size_t initial_capacity = 64;
+
+LookupLattice::LookupLattice(){
+    m_columns = g_ptr_array_new();
+    m_size = 0;
+}
+
+LookupLattice::~LookupLattice(){
+    for (size_t i = 0; i < m_columns->len; ++i) {
+        LookupColumn * column = (LookupColumn *)
+            g_ptr_array_index(m_columns, i);
+
+        g_array_free(column->m_slots, TRUE);
+        g_array_free(column->m_values, TRUE);
+        g_array_free(column->m_keys, TRUE);
+        delete column;
+    }
+
+    g_ptr_array_free(m_columns, TRUE);
+    m_columns = NULL;
+    m_size = 0;
+}
+
+bool LookupLattice::set_size(size_t size){
+    /* only allocate the new columns. */
+    for (size_t i = m_columns->len; i < size; ++i) {
+        LookupColumn * column = new LookupColumn;
+
+        column->m_slots = g_array_new(FALSE, TRUE, sizeof(lookup_slot_t));
+        g_array_set_size(column->m_slots, initial_capacity);
+        column->m_values = g_array_new(FALSE, FALSE, sizeof(lookup_value_t));
+        column->m_keys = g_array_new(FALSE, FALSE, sizeof(lookup_state_key_t));
+        /* the zeroed slots are in epoch zero. */
+        column->m_epoch = 1;
+
+        g_ptr_array_add(m_columns, column);
+    }
+
+    const size_t old_size = m_size;
+    m_size = size;
+
+    for (size_t i = old_size; i < m_size; ++i)
+        clear_column(i);
+
+    return true;
+}
+
+bool LookupLattice::clear_column(size_t index){
+    LookupColumn * column = get_lookup_column(index);
+
+    g_array_set_size(column->m_values, 0);
+    g_array_set_size(column->m_keys, 0);
+
+    ++column->m_epoch;
+
+    /* wrap around, invalidate all slots. */
+    if (0 == column->m_epoch) {
+        memset(column->m_slots->data, 0,
+               column->m_slots->len * sizeof(lookup_slot_t));
+        column->m_epoch = 1;
+    }
+
+    return true;
+}
+
+void LookupLattice::rehash(LookupColumn * column, size_t capacity){
+    /* grow the slots, and re-insert all the keys. */
+    g_array_set_size(column->m_slots, capacity);
+    memset(column->m_slots->data, 0, capacity * sizeof(lookup_slot_t));
+    column->m_epoch = 1;
+
+    const guint32 mask = capacity - 1;
+    for (size_t i = 0; i < column->m_keys->len; ++i) {
+        lookup_state_key_t key = g_array_index
+            (column->m_keys, lookup_state_key_t, i);
+        guint32 pos = hash_key(key) & mask;
+
+        while (true) {
+            lookup_slot_t * slot = &g_array_index
+                (column->m_slots, lookup_slot_t, pos);
+
+            if (slot->m_epoch != column->m_epoch) {
+                slot->m_key = key;
+                slot->m_epoch = column->m_epoch;
+                slot->m_index = i;
+                break;
+            }
+
+            pos = (pos + 1) & mask;
+        }
+    }
+}
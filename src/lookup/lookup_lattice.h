@@ -0,0 +1,250 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef LOOKUP_LATTICE_H
+#define LOOKUP_LATTICE_H
+
+#include <assert.h>
+#include <glib.h>
+#include "novel_types.h"
+#include "lookup.h"
+
+namespace pinyin{
+
+/**
+ * lookup_slot_t:
+ *
+ * The slot of the open addressing table in one lattice column.
+ *
+ */
+struct lookup_slot_t{
+    /* the key of the lookup value. */
+    lookup_state_key_t m_key;
+    /* the slot is only valid when it equals to the column epoch. */
+    guint32 m_epoch;
+    /* index to the lookup values of the column. */
+    guint32 m_index;
+};
+
+/**
+ * LookupColumn:
+ *
+ * One column of the lookup lattice.
+ *
+ */
+struct LookupColumn{
+    /* the open addressing table, the size is power of two. */
+    GArray * m_slots;    /* Array of lookup_slot_t */
+    /* the contiguous lookup values, in the insertion order. */
+    GArray * m_values;   /* Array of lookup_value_t */
+    GArray * m_keys;     /* Array of lookup_state_key_t, parallel to m_values */
+    guint32 m_epoch;
+};
+
+/**
+ * LookupLattice:
+ *
+ * The lattice of the Viterbi beam search, one column per step.
+ *
+ * Note:
+ *   Each column owns a flat open addressing table, which maps
+ *   lookup_state_key_t to the index of the contiguous lookup values,
+ *   then the same node with different possibilities can be merged
+ *   quickly, and only the highest value of the node is kept.
+ *   The columns are kept across calls, clear_column just bumps the
+ *   epoch of the column, so no memory is allocated in steady state.
+ *
+ */
+class LookupLattice{
+private:
+    /* Pointer Array of LookupColumn, never shrinks. */
+    GPtrArray * m_columns;
+    /* the number of used columns. */
+    size_t m_size;
+
+    static guint32 hash_key(lookup_state_key_t key) {
+        /* fold the previous token, then Fibonacci hashing. */
+        return ((guint32) key ^ (guint32) (key >> 32)) * 2654435761U;
+    }
+
+    LookupColumn * get_lookup_column(size_t index) const {
+        assert(index < m_size);
+        return (LookupColumn *) g_ptr_array_index(m_columns, index);
+    }
+
+    static void rehash(LookupColumn * column, size_t capacity);
+
+public:
+    /**
+     * LookupLattice::LookupLattice:
+     *
+     * The constructor of the LookupLattice.
+     *
+     */
+    LookupLattice();
+
+    /**
+     * LookupLattice::~LookupLattice:
+     *
+     * The destructor of the LookupLattice.
+     *
+     */
+    ~LookupLattice();
+
+    /**
+     * LookupLattice::size:
+     * @returns: the number of columns in the lattice.
+     *
+     * Get the number of columns in the lattice.
+     *
+     */
+    size_t size() const {
+        return m_size;
+    }
+
+    /**
+     * LookupLattice::set_size:
+     * @size: the number of columns.
+     * @returns: whether the set operation is successful.
+     *
+     * Resize the lattice to the number of columns,
+     * the existing columns are kept, and the new columns are cleared.
+     *
+     */
+    bool set_size(size_t size);
+
+    /**
+     * LookupLattice::clear_column:
+     * @index: the column index.
+     * @returns: whether the clear operation is successful.
+     *
+     * Clear all lookup values in the column.
+     *
+     */
+    bool clear_column(size_t index);
+
+    /**
+     * LookupLattice::get_column:
+     * @index: the column index.
+     * @returns: the lookup values of the column.
+     *
+     * Get the contiguous lookup values of the column.
+     *
+     * Note: the returned array is owned by the lattice.
+     *
+     */
+    LookupStepContent get_column(size_t index) const {
+        return get_lookup_column(index)->m_values;
+    }
+
+    /**
+     * LookupLattice::find:
+     * @index: the column index.
+     * @key: the lookup key.
+     * @returns: the lookup value of the key, NULL if not found.
+     *
+     * Find the lookup value of the key in the column.
+     *
+     */
+    lookup_value_t * find(size_t index, lookup_state_key_t key) const {
+        LookupColumn * column = get_lookup_column(index);
+
+        const guint32 mask = column->m_slots->len - 1;
+        guint32 pos = hash_key(key) & mask;
+
+        while (true) {
+            lookup_slot_t * slot = &g_array_index
+                (column->m_slots, lookup_slot_t, pos);
+
+            if (slot->m_epoch != column->m_epoch)
+                return NULL;
+
+            if (slot->m_key == key)
+                return &g_array_index
+                    (column->m_values, lookup_value_t, slot->m_index);
+
+            pos = (pos + 1) & mask;
+        }
+
+        assert(FALSE);
+        return NULL;
+    }
+
+    /**
+     * LookupLattice::insert:
+     * @index: the column index.
+     * @key: the lookup key.
+     * @value: the lookup value to be inserted.
+     * @orig_value: the existing lookup value of the key.
+     * @returns: whether the lookup value is inserted.
+     *
+     * Insert the lookup value into the column, if the key is not found;
+     * otherwise return the existing lookup value in orig_value.
+     *
+     * Note: the pointers to the lookup values of the column are
+     * invalidated after the insertion.
+     *
+     */
+    bool insert(size_t index, lookup_state_key_t key,
+                const lookup_value_t & value,
+                /* out */ lookup_value_t * & orig_value) {
+        LookupColumn * column = get_lookup_column(index);
+        orig_value = NULL;
+
+        /* keep the load factor under one half. */
+        if ((column->m_values->len + 1) * 2 > column->m_slots->len)
+            rehash(column, column->m_slots->len * 2);
+
+        const guint32 mask = column->m_slots->len - 1;
+        guint32 pos = hash_key(key) & mask;
+
+        while (true) {
+            lookup_slot_t * slot = &g_array_index
+                (column->m_slots, lookup_slot_t, pos);
+
+            if (slot->m_epoch != column->m_epoch) {
+                /* found the empty slot. */
+                slot->m_key = key;
+                slot->m_epoch = column->m_epoch;
+                slot->m_index = column->m_values->len;
+
+                g_array_append_val(column->m_values, value);
+                g_array_append_val(column->m_keys, key);
+                return true;
+            }
+
+            if (slot->m_key == key) {
+                orig_value = &g_array_index
+                    (column->m_values, lookup_value_t, slot->m_index);
+                return false;
+            }
+
+            pos = (pos + 1) & mask;
+        }
+
+        assert(FALSE);
+        return false;
+    }
+};
+
+};
+
+#endif
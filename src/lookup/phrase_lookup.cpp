@@ -94,7 +94,8 @@ PhraseLookup::PhraseLookup(const gfloat lambda,
                            FacadePhraseTable3 * phrase_table,
                            FacadePhraseIndex * phrase_index,
                            Bigram * system_bigram,
-                           Bigram * user_bigram)
+                           Bigram * user_bigram,
+                           SingleGramCache * single_gram_cache)
     : bigram_lambda(lambda),
       unigram_lambda(1. - lambda)
 {
@@ -102,6 +103,7 @@ PhraseLookup::PhraseLookup(const gfloat lambda,
     m_phrase_index = phrase_index;
     m_system_bigram = system_bigram;
     m_user_bigram = user_bigram;
+    m_single_gram_cache = single_gram_cache;
 
     m_steps_index = g_ptr_array_new();
     m_steps_content = g_ptr_array_new();
@@ -189,11 +191,9 @@ bool PhraseLookup::search_bigram(int nstep, phrase_token_t token){
     for ( size_t i = 0; i < lookup_content->len; ++i ){
         lookup_value_t * cur_value = &g_array_index(lookup_content, lookup_value_t, i);
         phrase_token_t index_token = cur_value->m_handles[1];
-        SingleGram * system, * user;
-        m_system_bigram->load(index_token, system);
-        m_user_bigram->load(index_token, user);
 
-        if ( !merge_single_gram(&m_merged_single_gram, system, user) )
+        if ( !m_single_gram_cache->load(index_token, m_single_gram_ref,
+                                        m_merged_single_gram) )
             continue;
 
         guint32 freq;
@@ -203,11 +203,6 @@ bool PhraseLookup::search_bigram(int nstep, phrase_token_t token){
             gfloat bigram_poss = freq / (gfloat) total_freq;
             found = bigram_gen_next_step(nstep, cur_value, token, bigram_poss) || found;
         }
-
-        if (system)
-            delete system;
-        if (user)
-            delete user;
     }
 
     return found;
@@ -266,12 +261,8 @@ bool PhraseLookup::search_bigram2(int nstep, PhraseTokens tokens){
             (lookup_content, lookup_value_t, i);
         phrase_token_t index_token = cur_value->m_handles[1];
 
-        SingleGram * system = NULL, * user = NULL;
-        m_system_bigram->load(index_token, system);
-        m_user_bigram->load(index_token, user);
-
-        if (!merge_single_gram
-            (&m_merged_single_gram, system, user))
+        if (!m_single_gram_cache->load(index_token, m_single_gram_ref,
+                                       m_merged_single_gram))
             continue;
 
         /* iterate over tokens */
@@ -295,11 +286,6 @@ bool PhraseLookup::search_bigram2(int nstep, PhraseTokens tokens){
                 }
             }
         }
-
-        if (system)
-            delete system;
-        if (user)
-            delete user;
     }
 
     return found;
@@ -308,18 +294,18 @@ bool PhraseLookup::search_bigram2(int nstep, PhraseTokens tokens){
 bool PhraseLookup::unigram_gen_next_step(int nstep, lookup_value_t * cur_value,
 phrase_token_t token){
 
-    if (m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
+    gfloat elem_log_poss = 0; guint8 phrase_length = 0;
+    if (m_phrase_index->get_unigram_log_possibility
+        (token, elem_log_poss, phrase_length))
         return false;
 
-    size_t phrase_length = m_cached_phrase_item.get_phrase_length();
-    gdouble elem_poss = m_cached_phrase_item.get_unigram_frequency() / (gdouble)
-        m_phrase_index->get_phrase_index_total_freq();
-    if ( elem_poss < DBL_EPSILON )
+    if ( elem_log_poss <= -FLT_MAX )
         return false;
 
     lookup_value_t next_value;
     next_value.m_handles[0] = cur_value->m_handles[1]; next_value.m_handles[1] = token;
-    next_value.m_poss = cur_value->m_poss + log(elem_poss * unigram_lambda);
+    next_value.m_poss = cur_value->m_poss + elem_log_poss +
+        log(unigram_lambda);
     next_value.m_last_step = nstep;
 
     return save_next_step(nstep + phrase_length, cur_value, &next_value);
@@ -327,13 +313,11 @@ phrase_token_t token){
 
 bool PhraseLookup::bigram_gen_next_step(int nstep, lookup_value_t * cur_value, phrase_token_t token, gfloat bigram_poss){
 
-    if ( m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
+    gdouble unigram_poss = 0; guint8 phrase_length = 0;
+    if (m_phrase_index->get_unigram_possibility
+        (token, unigram_poss, phrase_length))
         return false;
 
-    size_t phrase_length = m_cached_phrase_item.get_phrase_length();
-    gdouble unigram_poss = m_cached_phrase_item.get_unigram_frequency() /
-        (gdouble) m_phrase_index->get_phrase_index_total_freq();
-
     if ( bigram_poss < FLT_EPSILON && unigram_poss < DBL_EPSILON )
         return false;
 
@@ -24,6 +24,7 @@
 
 #include "novel_types.h"
 #include "ngram.h"
+#include "single_gram_cache.h"
 #include "lookup.h"
 
 /**
@@ -46,14 +47,16 @@ private:
     const gfloat bigram_lambda;
     const gfloat unigram_lambda;
 
-    PhraseItem m_cached_phrase_item;
-    SingleGram m_merged_single_gram;
+    /* the reference to the cached single grams and their merged view. */
+    SingleGramCacheRef m_single_gram_ref;
+    MergedSingleGramView m_merged_single_gram;
 protected:
     //saved varibles
     FacadePhraseTable3 * m_phrase_table;
     FacadePhraseIndex * m_phrase_index;
     Bigram * m_system_bigram;
     Bigram * m_user_bigram;
+    SingleGramCache * m_single_gram_cache;
 
     //internal step data structure
     GPtrArray * m_steps_index;
@@ -86,6 +89,7 @@ public:
      * @phrase_index: the phrase index.
      * @system_bigram: the system bi-gram.
      * @user_bigram: the user bi-gram.
+     * @single_gram_cache: the cache of the merged single grams.
      *
      * The constructor of the PhraseLookup.
      *
@@ -94,7 +98,8 @@ public:
                  FacadePhraseTable3 * phrase_table,
                  FacadePhraseIndex * phrase_index,
                  Bigram * system_bigram,
-                 Bigram * user_bigram);
+                 Bigram * user_bigram,
+                 SingleGramCache * single_gram_cache);
 
     /**
      * PhraseLookup::~PhraseLookup:
@@ -32,7 +32,15 @@ using namespace pinyin;
 */
 
 /* internal definition */
+/* the default beam width. */
 static const size_t nbeam = 32;
+/* the minimum beam width for the adaptive beam. */
+static const size_t min_nbeam = 4;
+/* the maximum number of the tri-gram histories kept for one token. */
+static const size_t max_histories = 2;
+/* the tri-gram nodes selected for the beam width, oversampled for
+   the nodes dropped by max_histories. */
+static const size_t trigram_oversample = 2;
 
 bool dump_max_value(GPtrArray * values){
     if (0 == values->len)
@@ -90,13 +98,30 @@ static bool populate_candidates(/* out */ GPtrArray * candidates,
     return true;
 }
 
-static bool lookup_value_less_than(lookup_value_t * lhs, lookup_value_t * rhs){
-    return lhs->m_poss < rhs->m_poss;
+static bool lookup_value_greater_than(lookup_value_t * lhs,
+                                     lookup_value_t * rhs){
+    return lhs->m_poss > rhs->m_poss;
 }
 
-/* use maximum heap to get the topest results. */
-static bool get_top_results(/* out */ GPtrArray * topresults,
-                            /* in */ GPtrArray * candidates) {
+size_t PinyinLookup2::compute_beam_width(int step_pos) {
+    const size_t width = m_beam.m_width;
+    const size_t length = m_beam.m_adaptive_length;
+
+    if (0 == length)
+        return width;
+
+    /* shrink the beam as the sentence grows. */
+    const size_t adaptive_width = width * length / (length + step_pos);
+    return std_lite::max(adaptive_width, std_lite::min(width, min_nbeam));
+}
+
+/* use partial selection to get the topest results, the maximum first. */
+bool PinyinLookup2::get_top_results(int step_pos,
+                                    /* out */ GPtrArray * topresults,
+                                    /* in */ GPtrArray * candidates) {
+    if (m_system_trigram)
+        return get_top_trigram_results(step_pos, topresults, candidates);
+
     g_ptr_array_set_size(topresults, 0);
 
     if (0 == candidates->len)
@@ -107,17 +132,33 @@ static bool get_top_results(/* out */ GPtrArray * topresults,
     lookup_value_t ** end =
         (lookup_value_t **) &g_ptr_array_index(candidates, candidates->len);
 
-    std_lite::make_heap(begin, end, lookup_value_less_than);
+    const size_t width = compute_beam_width(step_pos);
+    if (candidates->len > width) {
+        end = begin + width;
+        std_lite::nth_element(begin, end, begin + candidates->len,
+                              lookup_value_greater_than);
+    }
 
-    while (end != begin) {
-        lookup_value_t * one = *begin;
-        g_ptr_array_add(topresults, one);
+    m_beam_stats.m_candidates += candidates->len;
+    m_beam_stats.m_pruned_by_width += candidates->len - (end - begin);
 
-        std_lite::pop_heap(begin, end, lookup_value_less_than);
-        --end;
+    /* move the maximum to the front. */
+    lookup_value_t ** max = begin;
+    for (lookup_value_t ** cur = begin + 1; cur != end; ++cur) {
+        if ((*cur)->m_poss > (*max)->m_poss)
+            max = cur;
+    }
+    lookup_value_t * tmp = *begin; *begin = *max; *max = tmp;
 
-        if (topresults->len >= nbeam)
-            break;
+    const gfloat margin = m_beam.m_margin;
+    const gfloat threshold = (*begin)->m_poss - margin;
+    for (lookup_value_t ** cur = begin; cur != end; ++cur) {
+        if (margin > 0. && (*cur)->m_poss < threshold) {
+            ++m_beam_stats.m_pruned_by_margin;
+            continue;
+        }
+
+        g_ptr_array_add(topresults, *cur);
     }
 
     /* dump_all_values(topresults); */
@@ -125,63 +166,92 @@ static bool get_top_results(/* out */ GPtrArray * topresults,
     return true;
 }
 
-static bool populate_prefixes(GPtrArray * steps_index,
-                              GPtrArray * steps_content,
-                              TokenVector prefixes) {
-    assert(prefixes->len > 0);
-
-    for (size_t i = 0; i < prefixes->len; ++i) {
-        phrase_token_t token = g_array_index(prefixes, phrase_token_t, i);
-        lookup_key_t initial_key = token;
-        lookup_value_t initial_value(log(1.f));
-        initial_value.m_handles[1] = token;
+/* use partial selection to get the topest tri-gram nodes, the maximum
+   first, and keep at most max_histories nodes for one token, as the
+   nodes with the same token but different histories would crowd out
+   the other tokens. */
+bool PinyinLookup2::get_top_trigram_results(int step_pos,
+                                            /* out */ GPtrArray * topresults,
+                                            /* in */ GPtrArray * candidates) {
+    g_ptr_array_set_size(topresults, 0);
 
-        LookupStepContent initial_step_content = (LookupStepContent)
-            g_ptr_array_index(steps_content, 0);
-        initial_step_content = g_array_append_val
-            (initial_step_content, initial_value);
+    if (0 == candidates->len)
+        return false;
 
-        LookupStepIndex initial_step_index = (LookupStepIndex)
-            g_ptr_array_index(steps_index, 0);
-        g_hash_table_insert(initial_step_index,
-                            GUINT_TO_POINTER(initial_key),
-                            GUINT_TO_POINTER(initial_step_content->len - 1));
+    lookup_value_t ** begin =
+        (lookup_value_t **) &g_ptr_array_index(candidates, 0);
+    lookup_value_t ** end = begin + candidates->len;
+
+    /* only the selected nodes are sorted. */
+    const size_t width = compute_beam_width(step_pos);
+    lookup_value_t ** middle = end;
+    if (candidates->len > width * trigram_oversample) {
+        middle = begin + width * trigram_oversample;
+        std_lite::nth_element(begin, middle, end, lookup_value_greater_than);
     }
+    std_lite::sort(begin, middle, lookup_value_greater_than);
 
-    return true;
-}
+    m_beam_stats.m_candidates += candidates->len;
 
-static bool init_steps(GPtrArray * steps_index,
-                       GPtrArray * steps_content,
-                       int nstep){
-    /* add null start step */
-    g_ptr_array_set_size(steps_index, nstep);
-    g_ptr_array_set_size(steps_content, nstep);
+    const gfloat margin = m_beam.m_margin;
+    const gfloat threshold = (*begin)->m_poss - margin;
+
+    for (lookup_value_t ** cur = begin; cur != end; ++cur) {
+        if (topresults->len >= width) {
+            m_beam_stats.m_pruned_by_width += end - cur;
+            break;
+        }
+
+        /* too many nodes are dropped by max_histories,
+           sort the remaining nodes, which are even worse. */
+        if (cur == middle) {
+            std_lite::sort(middle, end, lookup_value_greater_than);
+            middle = end;
+        }
+
+        /* the remaining nodes are even worse. */
+        if (margin > 0. && (*cur)->m_poss < threshold) {
+            m_beam_stats.m_pruned_by_margin += end - cur;
+            break;
+        }
 
-    for (int i = 0; i < nstep; ++i) {
-        /* initialize steps_index */
-        g_ptr_array_index(steps_index, i) = g_hash_table_new(g_direct_hash, g_direct_equal);
-        /* initialize steps_content */
-        g_ptr_array_index(steps_content, i) = g_array_new(FALSE, FALSE, sizeof(lookup_value_t));
+        size_t histories = 0;
+        for (size_t k = 0; k < topresults->len; ++k) {
+            const lookup_value_t * kept = (const lookup_value_t *)
+                g_ptr_array_index(topresults, k);
+
+            if (kept->m_handles[1] == (*cur)->m_handles[1])
+                ++histories;
+        }
+
+        if (histories >= max_histories) {
+            ++m_beam_stats.m_pruned_by_history;
+            continue;
+        }
+
+        g_ptr_array_add(topresults, *cur);
     }
 
+    /* dump_all_values(topresults); */
+
     return true;
 }
 
-static void clear_steps(GPtrArray * steps_index, GPtrArray * steps_content){
-    /* clear steps_index */
-    for ( size_t i = 0; i < steps_index->len; ++i){
-        GHashTable * table = (GHashTable *) g_ptr_array_index(steps_index, i);
-        g_hash_table_destroy(table);
-        g_ptr_array_index(steps_index, i) = NULL;
-    }
+static bool populate_prefixes(LookupLattice & lattice,
+                              TokenVector prefixes) {
+    assert(prefixes->len > 0);
+
+    for (size_t i = 0; i < prefixes->len; ++i) {
+        phrase_token_t token = g_array_index(prefixes, phrase_token_t, i);
+        lookup_state_key_t initial_key = token;
+        lookup_value_t initial_value(log(1.f));
+        initial_value.m_handles[1] = token;
 
-    /* clear steps_content */
-    for ( size_t i = 0; i < steps_content->len; ++i){
-        GArray * array = (GArray *) g_ptr_array_index(steps_content, i);
-        g_array_free(array, TRUE);
-        g_ptr_array_index(steps_content, i) = NULL;
+        lookup_value_t * orig_value = NULL;
+        lattice.insert(0, initial_key, initial_value, orig_value);
     }
+
+    return true;
 }
 
 
@@ -189,7 +259,8 @@ PinyinLookup2::PinyinLookup2(const gfloat lambda,
                              FacadeChewingTable2 * pinyin_table,
                              FacadePhraseIndex * phrase_index,
                              Bigram * system_bigram,
-                             Bigram * user_bigram)
+                             Bigram * user_bigram,
+                             SingleGramCache * single_gram_cache)
     : bigram_lambda(lambda),
       unigram_lambda(1. - lambda)
 {
@@ -197,11 +268,33 @@ PinyinLookup2::PinyinLookup2(const gfloat lambda,
     m_phrase_index = phrase_index;
     m_system_bigram = system_bigram;
     m_user_bigram = user_bigram;
+    m_single_gram_cache = single_gram_cache;
+
+    /* the tri-gram is disabled by default. */
+    m_system_trigram = NULL;
+    trigram_lambda = 0.;
+    m_trigram_histories = NULL;
+
+    m_search_cache = NULL;
+    m_options = 0;
+
+    m_candidates = g_ptr_array_new();
+    m_topresults = g_ptr_array_new();
+    m_bigram_phrase_items = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItem));
+
+    m_clean_steps = 0;
+    m_last_prefixes = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    m_last_constraints = g_array_new
+        (FALSE, FALSE, sizeof(lookup_constraint_t));
+    m_step_stops = g_array_new(FALSE, FALSE, sizeof(guint32));
+    m_tracked_matrix = NULL;
 
-    m_steps_index = g_ptr_array_new();
-    m_steps_content = g_ptr_array_new();
+    m_nbest = 1;
+    m_steps_paths = g_ptr_array_new();
+
+    get_default_beam(m_beam);
 
-    m_cached_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
 
     /* the member variables below are saved in get_best_match call. */
     m_matrix = NULL;
@@ -209,17 +302,300 @@ PinyinLookup2::PinyinLookup2(const gfloat lambda,
 }
 
 PinyinLookup2::~PinyinLookup2(){
-    clear_steps(m_steps_index, m_steps_content);
-    g_ptr_array_free(m_steps_index, TRUE);
-    g_ptr_array_free(m_steps_content, TRUE);
-    g_array_free(m_cached_keys, TRUE);
+    g_ptr_array_free(m_candidates, TRUE);
+    g_ptr_array_free(m_topresults, TRUE);
+    g_array_free(m_bigram_phrase_items, TRUE);
+
+    g_array_free(m_last_prefixes, TRUE);
+    g_array_free(m_last_constraints, TRUE);
+    g_array_free(m_step_stops, TRUE);
+
+    for (size_t i = 0; i < m_steps_paths->len; ++i) {
+        GArray * paths = (GArray *) g_ptr_array_index(m_steps_paths, i);
+        g_array_free(paths, TRUE);
+    }
+    g_ptr_array_free(m_steps_paths, TRUE);
+
 }
 
 
+static bool constraint_equal(const lookup_constraint_t * lhs,
+                             const lookup_constraint_t * rhs) {
+    if (lhs->m_type != rhs->m_type)
+        return false;
+
+    switch (lhs->m_type) {
+    case NO_CONSTRAINT:
+        return true;
+    case CONSTRAINT_ONESTEP:
+        return lhs->m_token == rhs->m_token && lhs->m_end == rhs->m_end;
+    case CONSTRAINT_NOSEARCH:
+        return lhs->m_constraint_step == rhs->m_constraint_step;
+    }
+
+    assert(FALSE);
+    return false;
+}
+
+/* compare the matrix with the snapshot, and drop the cached steps
+   and pronunciations from the first changed column. */
+size_t PinyinLookup2::update_snapshot(PhoneticKeyMatrix * matrix){
+    /* the changes are already told by update_matrix. */
+    if (matrix == m_tracked_matrix)
+        return matrix->size();
+    m_tracked_matrix = NULL;
+
+    size_t column = 0;
+    if (!m_snapshot.update(matrix, column))
+        return column;
+
+    /* the step i depends on the matrix columns [0, i]. */
+    invalidate_steps(column);
+    m_pronunciation_cache.invalidate(column);
+    return column;
+}
+
+bool PinyinLookup2::update_matrix(PhoneticKeyMatrix * matrix,
+                                  size_t column){
+    /* the steps may be searched with other matrix before tracking,
+       the snapshot is compared again when other matrix is searched. */
+    if (matrix != m_tracked_matrix) {
+        m_tracked_matrix = matrix;
+        m_snapshot.clear();
+        column = 0;
+    }
+
+    /* the step i depends on the matrix columns [0, i]. */
+    invalidate_steps(column);
+    m_pronunciation_cache.invalidate(column);
+    return true;
+}
+
+/* the steps before the returned step are not changed since last search. */
+size_t PinyinLookup2::compute_clean_steps(TokenVector prefixes,
+                                          CandidateConstraints constraints){
+    update_snapshot(m_matrix);
+
+    const size_t nstep = m_matrix->size();
+    size_t clean_steps = std_lite::min(m_clean_steps, nstep);
+
+    if (0 == clean_steps)
+        return clean_steps;
+
+    /* check prefixes. */
+    if (prefixes->len != m_last_prefixes->len ||
+        0 != memcmp(prefixes->data, m_last_prefixes->data,
+                    prefixes->len * sizeof(phrase_token_t)))
+        return 0;
+
+    /* check constraints. */
+    assert(m_last_constraints->len >= clean_steps);
+    assert(constraints->len >= clean_steps);
+    for (size_t i = 0; i < clean_steps; ++i) {
+        const lookup_constraint_t * constraint = &g_array_index
+            (constraints, lookup_constraint_t, i);
+        const lookup_constraint_t * last_constraint = &g_array_index
+            (m_last_constraints, lookup_constraint_t, i);
+
+        if (!constraint_equal(constraint, last_constraint)) {
+            clean_steps = i;
+            break;
+        }
+    }
+
+    return clean_steps;
+}
+
+bool PinyinLookup2::save_snapshot(TokenVector prefixes,
+                                  CandidateConstraints constraints){
+    g_array_set_size(m_last_prefixes, 0);
+    g_array_append_vals(m_last_prefixes, prefixes->data, prefixes->len);
+
+    g_array_set_size(m_last_constraints, 0);
+    g_array_append_vals(m_last_constraints,
+                        constraints->data, constraints->len);
+
+    /* the matrix columns are kept by update_snapshot. */
+    m_clean_steps = m_matrix->size();
+    return true;
+}
+
 bool PinyinLookup2::get_best_match(TokenVector prefixes,
                                    PhoneticKeyMatrix * matrix,
                                    CandidateConstraints constraints,
                                    MatchResults & results){
+    /* only keep the best path for each node. */
+    if (1 != m_nbest) {
+        m_nbest = 1;
+        invalidate_steps(0);
+    }
+
+    if (!search_steps(prefixes, matrix, constraints))
+        return false;
+
+    return final_step(results);
+}
+
+bool PinyinLookup2::get_nbest_match(TokenVector prefixes,
+                                    PhoneticKeyMatrix * matrix,
+                                    CandidateConstraints constraints,
+                                    size_t nbest,
+                                    GPtrArray * results){
+    assert(nbest > 0);
+
+    /* keep the n-best paths for each node. */
+    if (nbest != m_nbest) {
+        m_nbest = nbest;
+        invalidate_steps(0);
+    }
+
+    if (!search_steps(prefixes, matrix, constraints))
+        return false;
+
+    /* no n-best paths are kept for only one sentence. */
+    if (1 == m_nbest) {
+        MatchResults result = g_array_new
+            (TRUE, TRUE, sizeof(phrase_token_t));
+
+        if (!final_step(result)) {
+            g_array_free(result, TRUE);
+            return false;
+        }
+
+        g_ptr_array_add(results, result);
+        return true;
+    }
+
+    return final_nbest_step(results);
+}
+
+bool PinyinLookup2::set_beam(const lookup_beam_t & beam){
+    assert(beam.m_width > 0);
+
+    if (beam.m_width == m_beam.m_width &&
+        beam.m_margin == m_beam.m_margin &&
+        beam.m_adaptive_length == m_beam.m_adaptive_length)
+        return true;
+
+    /* the cached steps were pruned with the old beam. */
+    m_beam = beam;
+    invalidate_steps(0);
+    return true;
+}
+
+static bool trigram_key_less_than(const TrigramKey & lhs,
+                                  const TrigramKey & rhs) {
+    if (lhs.m_tokens[0] != rhs.m_tokens[0])
+        return lhs.m_tokens[0] < rhs.m_tokens[0];
+    return lhs.m_tokens[1] < rhs.m_tokens[1];
+}
+
+static gint compare_trigram_key(gconstpointer lhs, gconstpointer rhs) {
+    const TrigramKey * lhs_key = (const TrigramKey *) lhs;
+    const TrigramKey * rhs_key = (const TrigramKey *) rhs;
+
+    if (trigram_key_less_than(*lhs_key, *rhs_key))
+        return -1;
+    if (trigram_key_less_than(*rhs_key, *lhs_key))
+        return 1;
+    return 0;
+}
+
+bool PinyinLookup2::get_default_beam(lookup_beam_t & beam){
+    beam.m_width = nbeam;
+    beam.m_margin = 0.;
+    beam.m_adaptive_length = 0;
+    return true;
+}
+
+bool PinyinLookup2::load_trigram_histories(Trigram * system_trigram,
+                                           TrigramKeyArray histories){
+    g_array_set_size(histories, 0);
+    if (!system_trigram->get_all_items(histories))
+        return false;
+
+    g_array_sort(histories, compare_trigram_key);
+    return true;
+}
+
+bool PinyinLookup2::set_trigram(Trigram * system_trigram,
+                                TrigramKeyArray histories,
+                                gfloat lambda){
+    assert(0. <= lambda && lambda < 1.);
+    assert(NULL == system_trigram || NULL != histories);
+
+    m_system_trigram = system_trigram;
+    m_trigram_histories = system_trigram ? histories : NULL;
+    trigram_lambda = lambda;
+
+    /* the cached steps were keyed and scored without the tri-gram. */
+    invalidate_steps(0);
+    return true;
+}
+
+bool PinyinLookup2::set_search_cache(MatrixSearchCache * search_cache){
+    assert(NULL == search_cache ||
+           m_pinyin_table == search_cache->get_table());
+
+    m_search_cache = search_cache;
+    return true;
+}
+
+bool PinyinLookup2::set_options(pinyin_option_t options){
+    options &= PINYIN_AMB_ALL;
+    if (options == m_options)
+        return false;
+
+    m_options = options;
+    m_pronunciation_cache.set_options(options);
+    /* the cached steps were searched with the old fuzzy pinyins. */
+    invalidate_steps(0);
+    return true;
+}
+
+int PinyinLookup2::search_span(int start, int end,
+                               PhraseIndexRanges ranges){
+    if (m_search_cache)
+        return m_search_cache->search(m_matrix, start, end, ranges);
+
+    return search_matrix(m_options, m_pinyin_table, m_matrix,
+                         start, end, ranges);
+}
+
+bool PinyinLookup2::has_trigram_history(phrase_token_t prev_token,
+                                        phrase_token_t token) const {
+    if (null_token == prev_token || NULL == m_trigram_histories ||
+        0 == m_trigram_histories->len)
+        return false;
+
+    TrigramKey key;
+    key.m_tokens[0] = prev_token;
+    key.m_tokens[1] = token;
+
+    const TrigramKey * begin = (const TrigramKey *) m_trigram_histories->data;
+    const TrigramKey * end = begin + m_trigram_histories->len;
+    const TrigramKey * iter = std_lite::lower_bound
+        (begin, end, key, trigram_key_less_than);
+
+    return iter != end && !trigram_key_less_than(key, *iter);
+}
+
+/* the nodes without the tri-gram history are scored by the same bi-gram
+   afterwards, so merge them by the current token like the bi-gram nodes. */
+lookup_state_key_t PinyinLookup2::get_state_key
+(const lookup_value_t * value) const {
+    const phrase_token_t prev_token = value->m_handles[0];
+    const phrase_token_t token = value->m_handles[1];
+
+    if (NULL == m_system_trigram || !has_trigram_history(prev_token, token))
+        return token;
+
+    return ((lookup_state_key_t) prev_token << 32) | token;
+}
+
+bool PinyinLookup2::search_steps(TokenVector prefixes,
+                                 PhoneticKeyMatrix * matrix,
+                                 CandidateConstraints constraints){
     m_constraints = constraints;
     m_matrix = matrix;
 
@@ -227,44 +603,91 @@ bool PinyinLookup2::get_best_match(TokenVector prefixes,
     if (0 == nstep)
         return false;
 
-    clear_steps(m_steps_index, m_steps_content);
+    m_beam_stats = lookup_beam_stats_t();
+
+    /* reuse the clean steps from the last search. */
+    const size_t clean_steps = compute_clean_steps(prefixes, constraints);
+
+    /* reuse the lattice columns, no allocation in steady state. */
+    m_lattice.set_size(nstep);
+    for (int i = clean_steps; i < nstep; ++i)
+        m_lattice.clear_column(i);
+
+    if (0 == clean_steps)
+        populate_prefixes(m_lattice, prefixes);
+
+    /* the n-best paths of the nodes. */
+    if (m_nbest > 1) {
+        for (size_t i = m_steps_paths->len; i < (size_t) nstep; ++i) {
+            GArray * paths = g_array_new
+                (FALSE, FALSE, sizeof(lookup_path_t));
+            g_ptr_array_add(m_steps_paths, paths);
+        }
+
+        for (int i = clean_steps; i < nstep; ++i) {
+            GArray * paths = (GArray *) g_ptr_array_index(m_steps_paths, i);
+            g_array_set_size(paths, 0);
+        }
+
+        if (0 == clean_steps) {
+            LookupStepContent initial_step = m_lattice.get_column(0);
+            for (size_t i = 0; i < initial_step->len; ++i) {
+                lookup_value_t * value = &g_array_index
+                    (initial_step, lookup_value_t, i);
 
-    init_steps(m_steps_index, m_steps_content, nstep);
+                lookup_path_t * path = get_paths(0, i);
+                path->m_length = value->m_length;
+                path->m_poss = value->m_poss;
+            }
+        }
+    }
 
-    populate_prefixes(m_steps_index, m_steps_content, prefixes);
+    g_array_set_size(m_step_stops, nstep);
 
     PhraseIndexRanges ranges;
     memset(ranges, 0, sizeof(PhraseIndexRanges));
     m_phrase_index->prepare_ranges(ranges);
 
-    GPtrArray * candidates = g_ptr_array_new();
-    GPtrArray * topresults = g_ptr_array_new();
+    GPtrArray * candidates = m_candidates;
+    GPtrArray * topresults = m_topresults;
 
     /* begin the viterbi beam search. */
     for ( int i = 0; i < nstep - 1; ++i ){
+        guint32 * stop = &g_array_index(m_step_stops, guint32, i);
+
+        /* the step i and the steps searched from it are not changed. */
+        if (i < (int) clean_steps && *stop < clean_steps)
+            continue;
+
+        /* the first step to be searched from the step i. */
+        const int begin = std_lite::max(i + 1, (int) clean_steps);
+        *stop = i + 1;
+
         lookup_constraint_t * cur_constraint = &g_array_index
             (m_constraints, lookup_constraint_t, i);
 
         if (CONSTRAINT_NOSEARCH == cur_constraint->m_type)
             continue;
 
-        LookupStepContent step = (LookupStepContent)
-            g_ptr_array_index(m_steps_content, i);
+        LookupStepContent step = m_lattice.get_column(i);
 
         populate_candidates(candidates, step);
-        get_top_results(topresults, candidates);
+        get_top_results(i, topresults, candidates);
 
         if (0 == topresults->len)
             continue;
 
         if (CONSTRAINT_ONESTEP == cur_constraint->m_type) {
             int m = cur_constraint->m_end;
+            *stop = m + 1;
+
+            if (m < begin)
+                continue;
 
             m_phrase_index->clear_ranges(ranges);
 
             /* do one pinyin table search. */
-            int retval = search_matrix(m_pinyin_table, m_matrix,
-                                       i, m, ranges);
+            int retval = search_span(i, m, ranges);
 
             if (retval & SEARCH_OK) {
                 /* assume topresults always contains items. */
@@ -275,18 +698,21 @@ bool PinyinLookup2::get_best_match(TokenVector prefixes,
             continue;
         }
 
-        for ( int m = i + 1; m < nstep; ++m ){
+        *stop = nstep;
+
+        for ( int m = begin; m < nstep; ++m ){
             lookup_constraint_t * next_constraint = &g_array_index
                 (m_constraints, lookup_constraint_t, m);
 
-            if (CONSTRAINT_NOSEARCH == next_constraint->m_type)
+            if (CONSTRAINT_NOSEARCH == next_constraint->m_type) {
+                *stop = m;
                 break;
+            }
 
             m_phrase_index->clear_ranges(ranges);
 
             /* do one pinyin table search. */
-            int retval = search_matrix(m_pinyin_table, m_matrix,
-                                       i, m, ranges);
+            int retval = search_span(i, m, ranges);
 
             if (retval & SEARCH_OK) {
                 /* assume topresults always contains items. */
@@ -295,17 +721,24 @@ bool PinyinLookup2::get_best_match(TokenVector prefixes,
             }
 
             /* no longer pinyin */
-            if (!(retval & SEARCH_CONTINUED))
+            if (!(retval & SEARCH_CONTINUED)) {
+                *stop = m + 1;
                 break;
+            }
         }
     }
 
+    /* no search from the last step. */
+    g_array_index(m_step_stops, guint32, nstep - 1) = nstep;
+
     m_phrase_index->destroy_ranges(ranges);
 
-    g_ptr_array_free(candidates, TRUE);
-    g_ptr_array_free(topresults, TRUE);
+    g_ptr_array_set_size(candidates, 0);
+    g_ptr_array_set_size(topresults, 0);
 
-    return final_step(results);
+    save_snapshot(prefixes, constraints);
+
+    return true;
 }
 
 bool PinyinLookup2::search_unigram2(GPtrArray * topresults,
@@ -347,6 +780,17 @@ bool PinyinLookup2::search_unigram2(GPtrArray * topresults,
     return found;
 }
 
+static gfloat compute_trigram_possibility(const SingleGram * trigram,
+                                          guint32 total_freq,
+                                          phrase_token_t token) {
+    guint32 freq = 0;
+    if (NULL == trigram || 0 == total_freq ||
+        !trigram->get_freq(token, freq))
+        return 0.;
+
+    return freq / (gfloat) total_freq;
+}
+
 bool PinyinLookup2::search_bigram2(GPtrArray * topresults,
                                    int start, int end,
                                    PhraseIndexRanges ranges) {
@@ -355,8 +799,7 @@ bool PinyinLookup2::search_bigram2(GPtrArray * topresults,
         &g_array_index(m_constraints, lookup_constraint_t, start);
 
     bool found = false;
-    BigramPhraseArray bigram_phrase_items = g_array_new
-        (FALSE, FALSE, sizeof(BigramPhraseItem));
+    BigramPhraseArray bigram_phrase_items = m_bigram_phrase_items;
 
     for (size_t i = 0; i < topresults->len; ++i) {
         lookup_value_t * value = (lookup_value_t *)
@@ -364,13 +807,26 @@ bool PinyinLookup2::search_bigram2(GPtrArray * topresults,
 
         phrase_token_t index_token = value->m_handles[1];
 
-        SingleGram * system = NULL, * user = NULL;
-        m_system_bigram->load(index_token, system);
-        m_user_bigram->load(index_token, user);
-
-        if ( !merge_single_gram(&m_merged_single_gram, system, user) )
+        if ( !m_single_gram_cache->load(index_token, m_single_gram_ref,
+                                        m_merged_single_gram) )
             continue;
 
+        /* load the tri-gram of the last two tokens. */
+        SingleGram * trigram = NULL;
+        guint32 trigram_total_freq = 0;
+        if (m_system_trigram &&
+            has_trigram_history(value->m_handles[0], index_token)) {
+            TrigramKey history;
+            history.m_tokens[0] = value->m_handles[0];
+            history.m_tokens[1] = index_token;
+
+            if (m_system_trigram->load(history, trigram))
+                trigram->get_total_freq(trigram_total_freq);
+        }
+        /* fall back to the bi-gram without the tri-gram history. */
+        const gfloat trigram_weight =
+            trigram_total_freq > 0 ? trigram_lambda : 0.;
+
         if ( CONSTRAINT_ONESTEP == constraint->m_type ){
             phrase_token_t token = constraint->m_token;
 
@@ -379,36 +835,30 @@ bool PinyinLookup2::search_bigram2(GPtrArray * topresults,
                 guint32 total_freq;
                 m_merged_single_gram.get_total_freq(total_freq);
                 gfloat bigram_poss = freq / (gfloat) total_freq;
+                gfloat trigram_poss = compute_trigram_possibility
+                    (trigram, trigram_total_freq, token);
                 found = bigram_gen_next_step(start, constraint->m_end,
-                                             value, token, bigram_poss) || found;
+                                             value, token, bigram_poss,
+                                             trigram_weight, trigram_poss) || found;
             }
         }
 
         if (NO_CONSTRAINT == constraint->m_type) {
-            for( size_t m = 0; m < PHRASE_INDEX_LIBRARY_COUNT; ++m){
-                GArray * array = ranges[m];
-                if ( !array ) continue;
-
-                for ( size_t n = 0; n < array->len; ++n){
-                    PhraseIndexRange * range =
-                        &g_array_index(array, PhraseIndexRange, n);
-
-                    g_array_set_size(bigram_phrase_items, 0);
-                    m_merged_single_gram.search(range, bigram_phrase_items);
-                    for( size_t k = 0; k < bigram_phrase_items->len; ++k) {
-                        BigramPhraseItem * item = &g_array_index(bigram_phrase_items, BigramPhraseItem, k);
-                        found = bigram_gen_next_step(start, end, value, item->m_token, item->m_freq) || found;
-                    }
-                }
+            /* sweep all ranges at once. */
+            g_array_set_size(bigram_phrase_items, 0);
+            m_merged_single_gram.search_ranges(ranges, bigram_phrase_items);
+            for( size_t k = 0; k < bigram_phrase_items->len; ++k) {
+                BigramPhraseItem * item = &g_array_index(bigram_phrase_items, BigramPhraseItem, k);
+                gfloat trigram_poss = compute_trigram_possibility
+                    (trigram, trigram_total_freq, item->m_token);
+                found = bigram_gen_next_step(start, end, value, item->m_token, item->m_freq, trigram_weight, trigram_poss) || found;
             }
         }
-        if (system)
-            delete system;
-        if (user)
-            delete user;
+        if (trigram)
+            delete trigram;
     }
 
-    g_array_free(bigram_phrase_items, TRUE);
+    g_array_set_size(bigram_phrase_items, 0);
     return found;
 }
 
@@ -417,24 +867,29 @@ bool PinyinLookup2::unigram_gen_next_step(int start, int end,
                                           lookup_value_t * cur_step,
                                           phrase_token_t token) {
 
-    if (m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
+    /* check the dense uni-gram column before reading the phrase item. */
+    gfloat elem_log_poss = 0; guint8 phrase_length = 0;
+    if (m_phrase_index->get_unigram_log_possibility
+        (token, elem_log_poss, phrase_length))
+        return false;
+
+    if ( elem_log_poss <= -FLT_MAX )
         return false;
 
-    size_t phrase_length = m_cached_phrase_item.get_phrase_length();
-    gdouble elem_poss = m_cached_phrase_item.get_unigram_frequency() / (gdouble)
-        m_phrase_index->get_phrase_index_total_freq();
-    if ( elem_poss < DBL_EPSILON )
+    if (m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
         return false;
 
-    gfloat pinyin_poss = compute_pronunciation_possibility
-        (m_matrix, start, end, m_cached_keys, m_cached_phrase_item);
+    gfloat pinyin_poss = m_pronunciation_cache.
+        compute_pronunciation_possibility
+        (m_matrix, start, end, m_cached_phrase_item);
     if (pinyin_poss < FLT_EPSILON )
         return false;
 
     lookup_value_t next_step;
     next_step.m_handles[0] = cur_step->m_handles[1]; next_step.m_handles[1] = token;
     next_step.m_length = cur_step->m_length + phrase_length;
-    next_step.m_poss = cur_step->m_poss + log(elem_poss * pinyin_poss * unigram_lambda);
+    next_step.m_poss = cur_step->m_poss + elem_log_poss +
+        log(pinyin_poss * unigram_lambda);
     next_step.m_last_step = start;
 
     return save_next_step(end, cur_step, &next_step);
@@ -443,27 +898,36 @@ bool PinyinLookup2::unigram_gen_next_step(int start, int end,
 bool PinyinLookup2::bigram_gen_next_step(int start, int end,
                                          lookup_value_t * cur_step,
                                          phrase_token_t token,
-                                         gfloat bigram_poss) {
-
-    if (m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
+                                         gfloat bigram_poss,
+                                         gfloat trigram_weight,
+                                         gfloat trigram_poss) {
+
+    /* check the dense uni-gram column before reading the phrase item. */
+    gdouble unigram_poss = 0; guint8 phrase_length = 0;
+    if (m_phrase_index->get_unigram_possibility
+        (token, unigram_poss, phrase_length))
         return false;
 
-    size_t phrase_length = m_cached_phrase_item.get_phrase_length();
-    gdouble unigram_poss = m_cached_phrase_item.get_unigram_frequency() /
-        (gdouble) m_phrase_index->get_phrase_index_total_freq();
     if ( bigram_poss < FLT_EPSILON && unigram_poss < DBL_EPSILON )
         return false;
 
-    gfloat pinyin_poss = compute_pronunciation_possibility
-                       (m_matrix, start, end, m_cached_keys, m_cached_phrase_item);
+    if (m_phrase_index->get_phrase_item(token, m_cached_phrase_item))
+        return false;
+
+    gfloat pinyin_poss = m_pronunciation_cache.
+        compute_pronunciation_possibility
+        (m_matrix, start, end, m_cached_phrase_item);
     if ( pinyin_poss < FLT_EPSILON )
         return false;
 
     lookup_value_t next_step;
     next_step.m_handles[0] = cur_step->m_handles[1]; next_step.m_handles[1] = token;
     next_step.m_length = cur_step->m_length + phrase_length;
-    next_step.m_poss = cur_step->m_poss +
-        log((bigram_lambda * bigram_poss + unigram_lambda * unigram_poss) * pinyin_poss);
+    /* interpolate the tri-gram with the bi-gram model. */
+    gdouble poss = bigram_lambda * bigram_poss + unigram_lambda * unigram_poss;
+    poss = (1 - trigram_weight) * poss + trigram_weight * trigram_poss;
+
+    next_step.m_poss = cur_step->m_poss + log(poss * pinyin_poss);
     next_step.m_last_step = start;
 
     return save_next_step(end, cur_step, &next_step);
@@ -473,54 +937,128 @@ bool PinyinLookup2::save_next_step(int next_step_pos,
                                    lookup_value_t * cur_step,
                                    lookup_value_t * next_step){
 
-    lookup_key_t next_key = next_step->m_handles[1];
-    LookupStepIndex next_lookup_index = (LookupStepIndex)
-        g_ptr_array_index(m_steps_index, next_step_pos);
-    LookupStepContent next_lookup_content = (LookupStepContent)
-        g_ptr_array_index(m_steps_content, next_step_pos);
+    /* back-pointer by index, the tri-gram nodes are not keyed by token. */
+    LookupStepContent cur_lookup_content =
+        m_lattice.get_column(next_step->m_last_step);
+    next_step->m_last_index = cur_step -
+        (lookup_value_t *) cur_lookup_content->data;
+
+    lookup_state_key_t next_key = get_state_key(next_step);
+
+    lookup_value_t * orig_next_value = NULL;
+    if (m_lattice.insert(next_step_pos, next_key, *next_step,
+                         orig_next_value)) {
+        if (m_nbest > 1) {
+            LookupStepContent next_lookup_content =
+                m_lattice.get_column(next_step_pos);
+            save_next_paths(next_step_pos, next_lookup_content->len - 1,
+                            cur_step, next_step);
+        }
+        return true;
+    }
 
-    gpointer key = NULL, value = NULL;
-    gboolean lookup_result = g_hash_table_lookup_extended
-        (next_lookup_index, GUINT_TO_POINTER(next_key), &key, &value);
+    if (m_nbest > 1) {
+        LookupStepContent next_lookup_content =
+            m_lattice.get_column(next_step_pos);
+        save_next_paths(next_step_pos, orig_next_value -
+                        (lookup_value_t *) next_lookup_content->data,
+                        cur_step, next_step);
+    }
 
-    if ( !lookup_result ){
-        g_array_append_val(next_lookup_content, *next_step);
-        g_hash_table_insert(next_lookup_index, GUINT_TO_POINTER(next_key), GUINT_TO_POINTER(next_lookup_content->len - 1));
+    if (orig_next_value->m_length > next_step->m_length ||
+        (orig_next_value->m_length == next_step->m_length &&
+         orig_next_value->m_poss < next_step->m_poss)) {
+        /* found better result. */
+        orig_next_value->m_handles[0] = next_step->m_handles[0];
+        assert(orig_next_value->m_handles[1] == next_step->m_handles[1]);
+        orig_next_value->m_length = next_step->m_length;
+        orig_next_value->m_poss = next_step->m_poss;
+        orig_next_value->m_last_step = next_step->m_last_step;
+        orig_next_value->m_last_index = next_step->m_last_index;
         return true;
-    }else{
-        size_t step_index = GPOINTER_TO_UINT(value);
-        lookup_value_t * orig_next_value = &g_array_index
-            (next_lookup_content, lookup_value_t, step_index);
-
-        if (orig_next_value->m_length > next_step->m_length ||
-            (orig_next_value->m_length == next_step->m_length &&
-             orig_next_value->m_poss < next_step->m_poss)) {
-            /* found better result. */
-            orig_next_value->m_handles[0] = next_step->m_handles[0];
-            assert(orig_next_value->m_handles[1] == next_step->m_handles[1]);
-            orig_next_value->m_length = next_step->m_length;
-            orig_next_value->m_poss = next_step->m_poss;
-            orig_next_value->m_last_step = next_step->m_last_step;
-            return true;
+    }
+
+    return false;
+}
+
+static bool lookup_path_better_than(const lookup_path_t * lhs,
+                                    const lookup_path_t * rhs) {
+    return lhs->m_length < rhs->m_length ||
+        (lhs->m_length == rhs->m_length && lhs->m_poss > rhs->m_poss);
+}
+
+lookup_path_t * PinyinLookup2::get_paths(int step_pos, size_t index){
+    GArray * paths = (GArray *) g_ptr_array_index(m_steps_paths, step_pos);
+
+    /* add the empty paths for the new nodes. */
+    const lookup_path_t empty_path;
+    while (paths->len < (index + 1) * m_nbest)
+        g_array_append_val(paths, empty_path);
+
+    return &g_array_index(paths, lookup_path_t, index * m_nbest);
+}
+
+/* merge the paths of the current node into the paths of the next node. */
+bool PinyinLookup2::save_next_paths(int next_step_pos, size_t next_index,
+                                    lookup_value_t * cur_step,
+                                    lookup_value_t * next_step){
+    const int cur_step_pos = next_step->m_last_step;
+    LookupStepContent cur_lookup_content = m_lattice.get_column(cur_step_pos);
+    const size_t cur_index = cur_step -
+        (lookup_value_t *) cur_lookup_content->data;
+
+    const lookup_path_t * cur_paths = get_paths(cur_step_pos, cur_index);
+    lookup_path_t * next_paths = get_paths(next_step_pos, next_index);
+
+    const gint32 length_delta = next_step->m_length - cur_step->m_length;
+    const gfloat poss_delta = next_step->m_poss - cur_step->m_poss;
+
+    bool found = false;
+    /* both paths are sorted, the best path comes first. */
+    for (size_t rank = 0; rank < m_nbest; ++rank) {
+        const lookup_path_t * cur_path = cur_paths + rank;
+        if (cur_path->is_empty())
+            break;
+
+        lookup_path_t path;
+        path.m_length = cur_path->m_length + length_delta;
+        path.m_poss = cur_path->m_poss + poss_delta;
+        path.m_last_step = cur_step_pos;
+        path.m_last_index = cur_index;
+        path.m_last_rank = rank;
+
+        size_t pos = 0;
+        for (; pos < m_nbest; ++pos) {
+            if (lookup_path_better_than(&path, next_paths + pos))
+                break;
         }
 
-        return false;
+        /* the remaining paths are even worse. */
+        if (m_nbest == pos)
+            break;
+
+        memmove(next_paths + pos + 1, next_paths + pos,
+                (m_nbest - pos - 1) * sizeof(lookup_path_t));
+        next_paths[pos] = path;
+        found = true;
     }
+
+    return found;
 }
 
 bool PinyinLookup2::final_step(MatchResults & results){
 
     /* reset results */
-    g_array_set_size(results, m_steps_content->len);
+    g_array_set_size(results, m_lattice.size());
     for (size_t i = 0; i < results->len; ++i){
         phrase_token_t * token = &g_array_index(results, phrase_token_t, i);
         *token = null_token;
     }
 
     /* find max element */
-    size_t last_step_pos = m_steps_content->len - 1;
+    size_t last_step_pos = m_lattice.size() - 1;
     /* skip the preceding "'" characters for constraints? */
-    GArray * last_step_array = (GArray *)g_ptr_array_index(m_steps_content, last_step_pos);
+    LookupStepContent last_step_array = m_lattice.get_column(last_step_pos);
     if ( last_step_array->len == 0 )
         return false;
 
@@ -543,20 +1081,10 @@ bool PinyinLookup2::final_step(MatchResults & results){
             (results, phrase_token_t, cur_step_pos);
         *token = max_value->m_handles[1];
 
-        phrase_token_t last_token = max_value->m_handles[0];
-        LookupStepIndex lookup_step_index = (LookupStepIndex)
-            g_ptr_array_index(m_steps_index, cur_step_pos);
-
-        gpointer key = NULL, value = NULL;
-        gboolean result = g_hash_table_lookup_extended
-            (lookup_step_index, GUINT_TO_POINTER(last_token), &key, &value);
-        if (!result)
-            return false;
-
-        LookupStepContent lookup_step_content = (LookupStepContent)
-            g_ptr_array_index(m_steps_content, cur_step_pos);
+        LookupStepContent cur_step_array = m_lattice.get_column(cur_step_pos);
+        assert(max_value->m_last_index < (gint32) cur_step_array->len);
         max_value = &g_array_index
-            (lookup_step_content, lookup_value_t, GPOINTER_TO_UINT(value));
+            (cur_step_array, lookup_value_t, max_value->m_last_index);
     }
 
     /* no need to reverse the result */
@@ -564,6 +1092,90 @@ bool PinyinLookup2::final_step(MatchResults & results){
 }
 
 
+struct lookup_nbest_t{
+    phrase_token_t m_token;
+    lookup_path_t m_path;
+};
+
+static gint compare_nbest_path(gconstpointer lhs, gconstpointer rhs) {
+    const lookup_path_t * lhs_path = &((const lookup_nbest_t *) lhs)->m_path;
+    const lookup_path_t * rhs_path = &((const lookup_nbest_t *) rhs)->m_path;
+
+    if (lookup_path_better_than(lhs_path, rhs_path))
+        return -1;
+    if (lookup_path_better_than(rhs_path, lhs_path))
+        return 1;
+    return 0;
+}
+
+bool PinyinLookup2::final_nbest_step(GPtrArray * results){
+    const size_t nstep = m_lattice.size();
+    const size_t last_step_pos = nstep - 1;
+    LookupStepContent last_step_array = m_lattice.get_column(last_step_pos);
+    if (0 == last_step_array->len)
+        return false;
+
+    /* collect all paths reaching the last step. */
+    GArray * candidates = g_array_new(FALSE, FALSE, sizeof(lookup_nbest_t));
+    for (size_t i = 0; i < last_step_array->len; ++i) {
+        lookup_value_t * value = &g_array_index
+            (last_step_array, lookup_value_t, i);
+        const lookup_path_t * paths = get_paths(last_step_pos, i);
+
+        for (size_t rank = 0; rank < m_nbest; ++rank) {
+            if (paths[rank].is_empty())
+                break;
+
+            lookup_nbest_t candidate;
+            candidate.m_token = value->m_handles[1];
+            candidate.m_path = paths[rank];
+            g_array_append_val(candidates, candidate);
+        }
+    }
+
+    g_array_sort(candidates, compare_nbest_path);
+
+    const size_t num = std_lite::min(m_nbest, (size_t) candidates->len);
+    for (size_t i = 0; i < num; ++i) {
+        lookup_nbest_t * candidate = &g_array_index
+            (candidates, lookup_nbest_t, i);
+
+        MatchResults result = g_array_new
+            (TRUE, TRUE, sizeof(phrase_token_t));
+        g_array_set_size(result, nstep);
+        for (size_t k = 0; k < result->len; ++k) {
+            g_array_index(result, phrase_token_t, k) = null_token;
+        }
+
+        /* backtracing */
+        phrase_token_t token = candidate->m_token;
+        const lookup_path_t * path = &candidate->m_path;
+        while (true) {
+            int cur_step_pos = path->m_last_step;
+            if (-1 == cur_step_pos)
+                break;
+
+            g_array_index(result, phrase_token_t, cur_step_pos) = token;
+
+            LookupStepContent lookup_step_content =
+                m_lattice.get_column(cur_step_pos);
+            const size_t index = path->m_last_index;
+            assert(index < lookup_step_content->len);
+
+            lookup_value_t * value = &g_array_index
+                (lookup_step_content, lookup_value_t, index);
+            token = value->m_handles[1];
+            path = get_paths(cur_step_pos, index) + path->m_last_rank;
+        }
+
+        g_ptr_array_add(results, result);
+    }
+
+    g_array_free(candidates, TRUE);
+    return results->len > 0;
+}
+
+
 bool PinyinLookup2::train_result2(PhoneticKeyMatrix * matrix,
                                   CandidateConstraints constraints,
                                   MatchResults results) {
@@ -573,6 +1185,10 @@ bool PinyinLookup2::train_result2(PhoneticKeyMatrix * matrix,
     const guint32 pinyin_factor = 1;
     const guint32 ceiling_seed = 23 * 15 * 64;
 
+    /* the language models will be changed. */
+    update_snapshot(matrix);
+    invalidate_steps(0);
+
     /* begin training based on constraints and results. */
     bool train_next = false;
 
@@ -597,7 +1213,7 @@ bool PinyinLookup2::train_result2(PhoneticKeyMatrix * matrix,
             /* train bi-gram first, and get train seed. */
             if (last_token) {
                 SingleGram * user = NULL;
-                m_user_bigram->load(last_token, user);
+                m_single_gram_cache->load_user(last_token, user);
 
                 guint32 total_freq = 0;
                 if (!user) {
@@ -623,7 +1239,7 @@ bool PinyinLookup2::train_result2(PhoneticKeyMatrix * matrix,
                 assert(user->set_total_freq(total_freq + seed));
                 /* if total_freq is not overflow, then freq won't overflow. */
                 assert(user->set_freq(token, freq + seed));
-                assert(m_user_bigram->store(last_token, user));
+                assert(m_single_gram_cache->store_user(last_token, user));
             next:
                 assert(NULL != user);
                 if (user)
@@ -644,9 +1260,10 @@ bool PinyinLookup2::train_result2(PhoneticKeyMatrix * matrix,
 
             /* train uni-gram */
             m_phrase_index->get_phrase_item(token, m_cached_phrase_item);
-            increase_pronunciation_possibility
+            m_pronunciation_cache.increase_pronunciation_possibility
                 (matrix, i, next_pos,
-                 m_cached_keys, m_cached_phrase_item, seed * pinyin_factor);
+                 m_cached_phrase_item, seed * pinyin_factor);
+            m_phrase_index->mark_dirty(token);
             m_phrase_index->add_unigram_frequency
                 (token, seed * unigram_factor);
         }
@@ -719,6 +1336,8 @@ bool PinyinLookup2::clear_constraint(CandidateConstraints constraints,
 
 bool PinyinLookup2::validate_constraint(PhoneticKeyMatrix * matrix,
                                         CandidateConstraints constraints) {
+    update_snapshot(matrix);
+
     /* resize constraints array first */
     const size_t oldlength = constraints->len;
     const size_t newlength = matrix->size();
@@ -754,9 +1373,9 @@ bool PinyinLookup2::validate_constraint(PhoneticKeyMatrix * matrix,
                 continue;
             }
 
-            gfloat pinyin_poss = compute_pronunciation_possibility
-                (matrix, i, end,
-                 m_cached_keys, m_cached_phrase_item);
+            gfloat pinyin_poss = m_pronunciation_cache.
+                compute_pronunciation_possibility
+                (matrix, i, end, m_cached_phrase_item);
             /* clear invalid pinyin */
             if (pinyin_poss < FLT_EPSILON)
                 clear_constraint(constraints, i);
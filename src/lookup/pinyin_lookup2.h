@@ -30,8 +30,12 @@
 #include "chewing_key.h"
 #include "phrase_index.h"
 #include "ngram.h"
+#include "single_gram_cache.h"
 #include "lookup.h"
+#include "lookup_lattice.h"
 #include "phonetic_key_matrix.h"
+#include "matrix_search_cache.h"
+#include "stl_lite.h"
 
 
 namespace pinyin{
@@ -76,6 +80,78 @@ struct lookup_constraint_t{
 };
 
 
+/**
+ * lookup_beam_t:
+ *
+ * The beam pruning options of the viterbi beam search.
+ *
+ */
+struct lookup_beam_t{
+    /* the maximum number of nodes expanded from each step. */
+    guint32 m_width;
+    /* prune the nodes whose log possibility is lower than the best node
+       by more than the margin, zero to disable. */
+    gfloat m_margin;
+    /* shrink the beam width to m_width * L / (L + i) at the step i,
+       where L is m_adaptive_length, zero to disable. */
+    guint32 m_adaptive_length;
+};
+
+/**
+ * lookup_beam_stats_t:
+ *
+ * The beam pruning statistics of the viterbi beam search.
+ *
+ */
+struct lookup_beam_stats_t{
+    /* the number of the nodes considered for expansion. */
+    guint32 m_candidates;
+    /* the number of the nodes pruned by the beam width. */
+    guint32 m_pruned_by_width;
+    /* the number of the nodes pruned by the margin. */
+    guint32 m_pruned_by_margin;
+    /* the number of the tri-gram nodes pruned by the history limit. */
+    guint32 m_pruned_by_history;
+
+    lookup_beam_stats_t(){
+        m_candidates = 0;
+        m_pruned_by_width = 0;
+        m_pruned_by_margin = 0;
+        m_pruned_by_history = 0;
+    }
+};
+
+/**
+ * lookup_path_t:
+ *
+ * One of the n-best paths which reach a node in the lattice.
+ *
+ */
+struct lookup_path_t{
+    /* the sentence length */
+    gint32 m_length;
+    /* the possibility of the path */
+    gfloat m_poss;
+    /* the previous node and its path, -1 for the prefixes */
+    gint32 m_last_step;
+    guint32 m_last_index;
+    guint32 m_last_rank;
+
+    lookup_path_t(){
+        /* the empty path is worse than any other path. */
+        m_length = G_MAXINT32;
+        m_poss = -FLT_MAX;
+        m_last_step = -1;
+        m_last_index = 0;
+        m_last_rank = 0;
+    }
+
+    bool is_empty() const {
+        return G_MAXINT32 == m_length;
+    }
+};
+
+
 /**
  * PinyinLookup2:
  *
@@ -86,10 +162,54 @@ class PinyinLookup2{
 private:
     const gfloat bigram_lambda;
     const gfloat unigram_lambda;
+    /* the tri-gram weight, the rest is for the bi-gram interpolation. */
+    gfloat trigram_lambda;
 
-    GArray * m_cached_keys;
+    /* the key sequences of the matrix spans. */
+    MatrixPronunciationCache m_pronunciation_cache;
     PhraseItem m_cached_phrase_item;
-    SingleGram m_merged_single_gram;
+    /* the reference to the cached single grams and their merged view. */
+    SingleGramCacheRef m_single_gram_ref;
+    MergedSingleGramView m_merged_single_gram;
+    /* the sorted histories of the system tri-gram, Array of TrigramKey,
+       shared by the lookups and not owned. */
+    TrigramKeyArray m_trigram_histories;
+
+    /* the beam pruning options and statistics. */
+    lookup_beam_t m_beam;
+    lookup_beam_stats_t m_beam_stats;
+
+    /* reused between get_best_match calls. */
+    GPtrArray * m_candidates;
+    GPtrArray * m_topresults;
+    BigramPhraseArray m_bigram_phrase_items;
+
+    /* the snapshot of the last search, for incremental decoding. */
+    size_t m_clean_steps;
+    TokenVector m_last_prefixes;
+    CandidateConstraints m_last_constraints;
+    /* the matrix columns of the last search or training. */
+    MatrixSnapshot m_snapshot;
+    /* the matrix whose changes are told by update_matrix,
+       not compared with the snapshot. */
+    PhoneticKeyMatrix * m_tracked_matrix;
+    /* the first step not searched from each step, Array of guint32. */
+    GArray * m_step_stops;
+
+    /* the number of paths kept for each node. */
+    size_t m_nbest;
+    /* Pointer Array of Array of lookup_path_t, m_nbest paths per node. */
+    GPtrArray * m_steps_paths;
+
+    size_t update_snapshot(PhoneticKeyMatrix * matrix);
+    size_t compute_clean_steps(TokenVector prefixes,
+                               CandidateConstraints constraints);
+    bool save_snapshot(TokenVector prefixes,
+                       CandidateConstraints constraints);
+
+    bool has_trigram_history(phrase_token_t prev_token,
+                             phrase_token_t token) const;
+    lookup_state_key_t get_state_key(const lookup_value_t * value) const;
 
 protected:
     /* saved varibles */
@@ -100,14 +220,27 @@ protected:
     FacadePhraseIndex * m_phrase_index;
     Bigram * m_system_bigram;
     Bigram * m_user_bigram;
+    Trigram * m_system_trigram;
+    SingleGramCache * m_single_gram_cache;
+    /* the span search cache of the pinyin table, not owned. */
+    MatrixSearchCache * m_search_cache;
+    /* the fuzzy pinyin options, matched when searching the spans. */
+    pinyin_option_t m_options;
 
     /* internal step data structure */
-    GPtrArray * m_steps_index;
-    /* Array of LookupStepIndex */
-    GPtrArray * m_steps_content;
-    /* Array of LookupStepContent */
+    LookupLattice m_lattice;
 
 
+    size_t compute_beam_width(int step_pos);
+    bool get_top_results(int step_pos,
+                         /* out */ GPtrArray * topresults,
+                         /* in */ GPtrArray * candidates);
+    bool get_top_trigram_results(int step_pos,
+                                 /* out */ GPtrArray * topresults,
+                                 /* in */ GPtrArray * candidates);
+
+    int search_span(int start, int end, PhraseIndexRanges ranges);
+
     bool search_unigram2(GPtrArray * topresults,
                          int start, int end,
                          PhraseIndexRanges ranges);
@@ -121,11 +254,22 @@ protected:
     bool bigram_gen_next_step(int start, int end,
                               lookup_value_t * cur_step,
                               phrase_token_t token,
-                              gfloat bigram_poss);
+                              gfloat bigram_poss,
+                              gfloat trigram_weight = 0.,
+                              gfloat trigram_poss = 0.);
 
     bool save_next_step(int next_step_pos, lookup_value_t * cur_step, lookup_value_t * next_step);
+    bool save_next_paths(int next_step_pos, size_t next_index,
+                         lookup_value_t * cur_step,
+                         lookup_value_t * next_step);
+    lookup_path_t * get_paths(int step_pos, size_t index);
+
+    bool search_steps(TokenVector prefixes,
+                      PhoneticKeyMatrix * matrix,
+                      CandidateConstraints constraints);
 
     bool final_step(MatchResults & results);
+    bool final_nbest_step(GPtrArray * results);
 
 public:
     /**
@@ -135,6 +279,7 @@ public:
      * @phrase_index: the phrase index.
      * @system_bigram: the system bi-gram.
      * @user_bigram: the user bi-gram.
+     * @single_gram_cache: the cache of the merged single grams.
      *
      * The constructor of the PinyinLookup2.
      *
@@ -143,7 +288,8 @@ public:
                   FacadeChewingTable2 * pinyin_table,
                   FacadePhraseIndex * phrase_index,
                   Bigram * system_bigram,
-                  Bigram * user_bigram);
+                  Bigram * user_bigram,
+                  SingleGramCache * single_gram_cache);
 
     /**
      * PinyinLookup2::~PinyinLookup2:
@@ -163,12 +309,172 @@ public:
      *
      * Guess the best sentence according to user inputs.
      *
+     * Note: the steps before the first changed step since the last call
+     * are reused, only the remaining steps are searched again.
+     *
      */
     bool get_best_match(TokenVector prefixes,
                         PhoneticKeyMatrix * matrix,
                         CandidateConstraints constraints,
                         MatchResults & results);
 
+    /**
+     * PinyinLookup2::get_nbest_match:
+     * @prefixes: the phrase tokens before the guessed sentences.
+     * @matrix: the matrix of the pinyin keys.
+     * @constraints: the constraints on the guessed sentences.
+     * @nbest: the maximum number of the guessed sentences.
+     * @results: the guessed sentences in the form of the phrase tokens.
+     * @returns: whether the guess operation is successful.
+     *
+     * Guess the n-best sentences according to user inputs,
+     * the best sentence comes first.
+     *
+     * Note: the MatchResults in results should be freed by g_array_free.
+     *
+     */
+    bool get_nbest_match(TokenVector prefixes,
+                         PhoneticKeyMatrix * matrix,
+                         CandidateConstraints constraints,
+                         size_t nbest,
+                         /* out */ GPtrArray * results);
+
+    /**
+     * PinyinLookup2::set_beam:
+     * @beam: the beam pruning options.
+     * @returns: whether the set operation is successful.
+     *
+     * Set the beam pruning options of the viterbi beam search.
+     *
+     */
+    bool set_beam(const lookup_beam_t & beam);
+
+    /**
+     * PinyinLookup2::get_default_beam:
+     * @beam: the default beam pruning options.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the default beam pruning options of the viterbi beam search.
+     *
+     */
+    static bool get_default_beam(lookup_beam_t & beam);
+
+    /**
+     * PinyinLookup2::get_beam:
+     * @beam: the beam pruning options.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the beam pruning options of the viterbi beam search.
+     *
+     */
+    bool get_beam(lookup_beam_t & beam) const {
+        beam = m_beam;
+        return true;
+    }
+
+    /**
+     * PinyinLookup2::load_trigram_histories:
+     * @system_trigram: the system tri-gram.
+     * @histories: the sorted histories of the tri-gram.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the histories of the tri-gram, the histories are read-only
+     * and can be shared by the lookups of all threads.
+     *
+     */
+    static bool load_trigram_histories(/* in */ Trigram * system_trigram,
+                                       /* out */ TrigramKeyArray histories);
+
+    /**
+     * PinyinLookup2::set_trigram:
+     * @system_trigram: the system tri-gram, NULL to disable the tri-gram.
+     * @histories: the sorted histories from load_trigram_histories.
+     * @lambda: the tri-gram weight in the interpolation model.
+     * @returns: whether the set operation is successful.
+     *
+     * Set the system tri-gram of the viterbi beam search, the nodes are
+     * keyed by the last two tokens when the tri-gram is enabled.
+     *
+     * Note: the histories are not copied, please keep them alive and
+     * call it again after the tri-gram is changed.
+     *
+     */
+    bool set_trigram(Trigram * system_trigram, TrigramKeyArray histories,
+                     gfloat lambda);
+
+    /**
+     * PinyinLookup2::set_search_cache:
+     * @search_cache: the span search cache of the pinyin table,
+     *                NULL to search the pinyin table directly.
+     * @returns: whether the set operation is successful.
+     *
+     * Set the span search cache, the spans of the matrix are searched
+     * through the cache.
+     *
+     * Note: the cache is not owned, please invalidate the changed
+     * columns of the cache before the search.
+     *
+     */
+    bool set_search_cache(MatrixSearchCache * search_cache);
+
+    /**
+     * PinyinLookup2::set_options:
+     * @options: the pinyin options.
+     * @returns: whether the fuzzy pinyin options are changed.
+     *
+     * Set the fuzzy pinyin options, the fuzzy pinyins are matched
+     * by the chewing table search instead of filling them into the matrix.
+     *
+     * Note: the search cache has its own options, please set
+     * the same options for the cache.
+     *
+     */
+    bool set_options(pinyin_option_t options);
+
+    /**
+     * PinyinLookup2::get_beam_stats:
+     * @stats: the beam pruning statistics.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the beam pruning statistics of the last search.
+     *
+     */
+    bool get_beam_stats(lookup_beam_stats_t & stats) const {
+        stats = m_beam_stats;
+        return true;
+    }
+
+    /**
+     * PinyinLookup2::invalidate_steps:
+     * @start: the first changed step.
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate the cached steps from start, the next get_best_match
+     * will re-compute them. Call it with zero when the language models
+     * are changed; the changes of the matrix, prefixes and constraints
+     * are detected by get_best_match itself.
+     *
+     */
+    bool invalidate_steps(size_t start) {
+        m_clean_steps = std_lite::min(m_clean_steps, start);
+        return true;
+    }
+
+    /**
+     * PinyinLookup2::update_matrix:
+     * @matrix: the changed phonetic key matrix.
+     * @column: the first changed column of the matrix.
+     * @returns: whether the update operation is successful.
+     *
+     * Invalidate the cached steps and spans from the changed column,
+     * the following searches of the matrix skip comparing it with the
+     * last one.
+     *
+     * Note: once called, call it after every change of the matrix.
+     *
+     */
+    bool update_matrix(PhoneticKeyMatrix * matrix, size_t column);
+
     /**
      * PinyinLookup2::train_result2:
      * @matrix: the matrix of the pinyin keys.
@@ -34,6 +34,34 @@ using namespace pinyin;
 
 typedef GArray * CandidateVector; /* GArray of lookup_candidate_t */
 
+/* the tri-gram weight in the interpolation model. */
+static const gfloat trigram_lambda = 0.4;
+
+/* the save request of pinyin_save_async. */
+struct save_callback_t{
+    pinyin_save_callback_t m_callback;
+    gpointer m_user_data;
+};
+
+/* the save request and the copy of the mutable user state,
+   the copy is taken by the thread which writes it. */
+struct save_snapshot_t{
+    gchar * m_user_dir;
+    /* the generation of the written manifest. */
+    guint32 m_generation;
+
+    /* the phrase library logs, user libraries and version,
+       the tables are added when written. */
+    UserManifest * m_manifest;
+
+    ChewingLargeTable2 * m_pinyin_table;
+    PhraseLargeTable3 * m_phrase_table;
+    Bigram * m_user_bigram;
+
+    /* Array of save_callback_t, the coalesced save requests. */
+    GArray * m_callbacks;
+};
+
 struct _pinyin_context_t{
     pinyin_option_t m_options;
 
@@ -47,11 +75,25 @@ struct _pinyin_context_t{
     FacadePhraseTable3 * m_phrase_table;
     FacadePhraseIndex * m_phrase_index;
     Bigram * m_system_bigram;
+    /* the optional compact system bi-gram, NULL if not installed. */
+    CompactBigram * m_compact_bigram;
     Bigram * m_user_bigram;
-
-    /* lookups. */
-    PinyinLookup2 * m_pinyin_lookup;
-    PhraseLookup * m_phrase_lookup;
+    /* the trained user single grams before stored into m_user_bigram. */
+    UserBigramBuffer * m_user_bigram_buffer;
+    /* the optional system tri-gram, NULL if not installed. */
+    Trigram * m_system_trigram;
+    /* the sorted histories of the system tri-gram, Array of TrigramKey. */
+    TrigramKeyArray m_trigram_histories;
+    /* the merged single grams shared by all lookups. */
+    SingleGramCache * m_single_gram_cache;
+
+    /* the default beam pruning options. */
+    lookup_beam_t m_beam;
+
+    /* the lookups are owned by the instances,
+       increased when the shared tables are changed,
+       then the cached steps of the lookups are invalidated. */
+    gint m_generation;
 
     /* addon tables. */
     FacadeChewingTable2 * m_addon_pinyin_table;
@@ -62,24 +104,91 @@ struct _pinyin_context_t{
     char * m_user_dir;
     bool m_modified;
 
+    /* the user data of the newest manifest, the tables are removed
+       after loaded, the phrase library logs are kept for the saves. */
+    UserManifest * m_user_manifest;
+
+    /* the background save, see pinyin_save_async,
+       the pending snapshot is protected by m_save_mutex. */
+    GMutex m_save_mutex;
+    GCond m_save_cond;
+    GThread * m_save_thread;
+    save_snapshot_t * m_pending_save;
+    bool m_save_quit;
+    /* serializes the writes of the snapshots into the user directory. */
+    GMutex m_write_mutex;
+    /* the generation of the last save request. */
+    guint32 m_save_generation;
+    /* the snapshot copy holds the reader lock, the functions which
+       change the shared tables hold the writer lock. */
+    GRWLock m_tables_lock;
+
     SystemTableInfo2 m_system_table_info;
 };
 
+/* hold the writer lock of the shared tables in the scope. */
+struct tables_writer_locker_t{
+    GRWLock * m_lock;
+
+    tables_writer_locker_t(pinyin_context_t * context){
+        m_lock = &context->m_tables_lock;
+        g_rw_lock_writer_lock(m_lock);
+    }
+
+    ~tables_writer_locker_t(){
+        g_rw_lock_writer_unlock(m_lock);
+    }
+};
+
 struct _pinyin_instance_t{
     /* pointer of pinyin_context_t. */
     pinyin_context_t * m_context;
 
+    /* lookups, the per instance workspaces. */
+    PinyinLookup2 * m_pinyin_lookup;
+    PhraseLookup * m_phrase_lookup;
+    /* the span search caches of the pinyin tables. */
+    MatrixSearchCache * m_search_cache;
+    MatrixSearchCache * m_addon_search_cache;
+    /* the generation of the context when the lookups were checked. */
+    gint m_generation;
+
     /* the tokens of phrases before the user input. */
     TokenVector m_prefixes;
 
     /* cached parsed pinyin keys. */
     PhoneticKeyMatrix m_matrix;
     size_t m_parsed_len;
+    /* the first changed column of the matrix by the last parse. */
+    size_t m_changed_column;
+
+    /* the kept state of the last full pinyin parse. */
+    FullPinyinParseState m_parse_state;
+    /* whether the matrix is filled by the parsed keys with the options. */
+    bool m_full_pinyin_parsed;
+    pinyin_option_t m_parsed_options;
+    ChewingKeyVector m_parsed_keys;
+    ChewingKeyRestVector m_parsed_key_rests;
+    /* the keys of the current parse, swapped with the parsed keys. */
+    ChewingKeyVector m_keys;
+    ChewingKeyRestVector m_key_rests;
 
     /* cached pinyin lookup variables. */
     CandidateConstraints m_constraints;
     MatchResults m_match_results;
     CandidateVector m_candidates;
+
+    /* the beam pruning options, zero width to use the context options. */
+    lookup_beam_t m_beam;
+    lookup_beam_stats_t m_beam_stats;
+
+    /* the n-best sentences, Pointer Array of MatchResults. */
+    GPtrArray * m_nbest_results;
+
+    /* the returned key of pinyin_get_pinyin_key and
+       pinyin_get_pinyin_key_rest, valid until the next call. */
+    ChewingKey m_pinyin_key;
+    ChewingKeyRest m_pinyin_key_rest;
 };
 
 struct _lookup_candidate_t{
@@ -115,6 +224,13 @@ struct _export_iterator_t{
     guint8 m_next_pronunciation;
 };
 
+/* the cached steps of all lookups are invalidated lazily,
+   see pinyin_update_lookup. */
+static bool _invalidate_lookups(pinyin_context_t * context){
+    g_atomic_int_inc(&context->m_generation);
+    return true;
+}
+
 static bool _clean_user_files(const char * user_dir,
                               const pinyin_table_info_t * phrase_files){
     /* clean up files, if version mis-matches. */
@@ -138,20 +254,34 @@ static bool _clean_user_files(const char * user_dir,
     return true;
 }
 
-static bool check_format(pinyin_context_t * context){
+/* the user tables are dropped when the versions mis-match,
+   only the user pinyin index is rebuilt for the old revision. */
+static bool check_format(pinyin_context_t * context,
+                         /* out */ bool & rebuild_pinyin_index){
     const char * user_dir = context->m_user_dir;
+    rebuild_pinyin_index = false;
 
     UserTableInfo user_table_info;
-    gchar * filename = g_build_filename
-        (user_dir, USER_TABLE_INFO, NULL);
-    user_table_info.load(filename);
-    g_free(filename);
+    gchar * filename = NULL;
+
+    MemoryChunk chunk;
+    if (context->m_user_manifest->get_entry(USER_TABLE_INFO, &chunk)) {
+        user_table_info.load(&chunk);
+    } else {
+        filename = g_build_filename(user_dir, USER_TABLE_INFO, NULL);
+        user_table_info.load(filename);
+        g_free(filename);
+    }
 
     bool exists = user_table_info.is_conform
         (&context->m_system_table_info);
 
-    if (exists)
+    if (exists) {
+        /* the in-complete chewing index is folded since revision 1,
+           the phrase libraries and the bi-gram are not changed. */
+        rebuild_pinyin_index = !user_table_info.is_revision_conform();
         return exists;
+    }
 
     const pinyin_table_info_t * phrase_files = NULL;
 
@@ -176,25 +306,29 @@ static bool check_format(pinyin_context_t * context){
     unlink(filename);
     g_free(filename);
 
+    UserManifest::remove_all(user_dir);
+    context->m_user_manifest->clear();
+
     return exists;
 }
 
-static bool mark_version(pinyin_context_t * context){
-    const char * userdir = context->m_user_dir;
-
-    UserTableInfo user_table_info;
-    user_table_info.make_conform(&context->m_system_table_info);
+/* load the user file from the manifest, or the file in user directory. */
+static bool _load_user_file(const char * user_dir,
+                            const UserManifest * manifest,
+                            const char * userfilename,
+                            MemoryChunk * chunk){
+    if (manifest->get_entry(userfilename, chunk))
+        return true;
 
-    gchar * filename = g_build_filename
-        (userdir, USER_TABLE_INFO, NULL);
-    bool retval = user_table_info.save(filename);
+    gchar * filename = g_build_filename(user_dir, userfilename, NULL);
+    bool retval = chunk->load(filename);
     g_free(filename);
-
     return retval;
 }
 
 static bool _load_phrase_library (const char * system_dir,
                                   const char * user_dir,
+                                  const UserManifest * manifest,
                                   FacadePhraseIndex * phrase_index,
                                   const pinyin_table_info_t * table_info){
     /* check whether the sub phrase index is already loaded. */
@@ -227,12 +361,8 @@ static bool _load_phrase_library (const char * system_dir,
 
         const char * userfilename = table_info->m_user_filename;
 
-        chunkfilename = g_build_filename(user_dir,
-                                         userfilename, NULL);
-
         MemoryChunk * log = new MemoryChunk;
-        log->load(chunkfilename);
-        g_free(chunkfilename);
+        _load_user_file(user_dir, manifest, userfilename, log);
 
         /* merge the chunk log. */
         phrase_index->merge(index, log);
@@ -267,18 +397,14 @@ static bool _load_phrase_library (const char * system_dir,
         MemoryChunk * chunk = new MemoryChunk;
         const char * userfilename = table_info->m_user_filename;
 
-        gchar * chunkfilename = g_build_filename(user_dir,
-                                                 userfilename, NULL);
-
         /* check bin file exists. if not, create a new one. */
-        if (chunk->load(chunkfilename)) {
+        if (_load_user_file(user_dir, manifest, userfilename, chunk)) {
             phrase_index->load(index, chunk);
         } else {
             delete chunk;
             phrase_index->create_sub_phrase(index);
         }
 
-        g_free(chunkfilename);
         return true;
     }
 
@@ -294,6 +420,14 @@ pinyin_context_t * pinyin_init(const char * systemdir, const char * userdir){
     context->m_user_dir = g_strdup(userdir);
     context->m_modified = false;
 
+    g_mutex_init(&context->m_save_mutex);
+    g_cond_init(&context->m_save_cond);
+    context->m_save_thread = NULL;
+    context->m_pending_save = NULL;
+    context->m_save_quit = false;
+    g_mutex_init(&context->m_write_mutex);
+    g_rw_lock_init(&context->m_tables_lock);
+
     gchar * filename = g_build_filename
         (context->m_system_dir, SYSTEM_TABLE_INFO, NULL);
     if (!context->m_system_table_info.load(filename)) {
@@ -303,7 +437,13 @@ pinyin_context_t * pinyin_init(const char * systemdir, const char * userdir){
     g_free(filename);
 
 
-    check_format(context);
+    /* the manifest comes first, then the files in user directory. */
+    context->m_user_manifest = new UserManifest;
+    context->m_user_manifest->load(context->m_user_dir);
+
+    bool rebuild_pinyin_index = false;
+    check_format(context, rebuild_pinyin_index);
+    context->m_save_generation = context->m_user_manifest->get_generation();
 
     context->m_full_pinyin_parser = new FullPinyinParser2;
     context->m_double_pinyin_parser = new DoublePinyinParser2;
@@ -312,26 +452,53 @@ pinyin_context_t * pinyin_init(const char * systemdir, const char * userdir){
     /* load chewing table. */
     context->m_pinyin_table = new FacadeChewingTable2;
 
+    MemoryChunk chunk;
+    const bool has_pinyin_index =
+        context->m_user_manifest->get_entry(USER_PINYIN_INDEX, &chunk);
+
     gchar * system_filename = g_build_filename
         (context->m_system_dir, SYSTEM_PINYIN_INDEX, NULL);
-    gchar * user_filename = g_build_filename
-        (context->m_user_dir, USER_PINYIN_INDEX, NULL);
+    gchar * user_filename = NULL;
+    if (!has_pinyin_index)
+        user_filename = g_build_filename
+            (context->m_user_dir, USER_PINYIN_INDEX, NULL);
     context->m_pinyin_table->load(system_filename, user_filename);
     g_free(user_filename);
     g_free(system_filename);
 
+    if (has_pinyin_index) {
+        context->m_pinyin_table->load_user_chunk(&chunk);
+        context->m_user_manifest->remove_entry(USER_PINYIN_INDEX);
+    }
+
+    /* upgrade the user pinyin index, kept by the next save. */
+    if (rebuild_pinyin_index) {
+        context->m_pinyin_table->rebuild_user_index();
+        context->m_modified = true;
+    }
+
 
     /* load phrase table */
     context->m_phrase_table = new FacadePhraseTable3;
 
+    const bool has_phrase_index =
+        context->m_user_manifest->get_entry(USER_PHRASE_INDEX, &chunk);
+
     system_filename = g_build_filename
         (context->m_system_dir, SYSTEM_PHRASE_INDEX, NULL);
-    user_filename = g_build_filename
-        (context->m_user_dir, USER_PHRASE_INDEX, NULL);
+    user_filename = NULL;
+    if (!has_phrase_index)
+        user_filename = g_build_filename
+            (context->m_user_dir, USER_PHRASE_INDEX, NULL);
     context->m_phrase_table->load(system_filename, user_filename);
     g_free(user_filename);
     g_free(system_filename);
 
+    if (has_phrase_index) {
+        context->m_phrase_table->load_user_chunk(&chunk);
+        context->m_user_manifest->remove_entry(USER_PHRASE_INDEX);
+    }
+
 
     context->m_phrase_index = new FacadePhraseIndex;
 
@@ -350,30 +517,71 @@ pinyin_context_t * pinyin_init(const char * systemdir, const char * userdir){
         assert(DICTIONARY != table_info->m_file_type);
 
         _load_phrase_library(context->m_system_dir, context->m_user_dir,
+                             context->m_user_manifest,
                              context->m_phrase_index, table_info);
     }
 
+    /* prefer the compact system bi-gram, fall back to the DB
+       when the compact bi-gram is missing or stale. */
     context->m_system_bigram = new Bigram;
-    filename = g_build_filename(context->m_system_dir, SYSTEM_BIGRAM, NULL);
-    context->m_system_bigram->attach(filename, ATTACH_READONLY);
+    context->m_compact_bigram = new CompactBigram;
+    gchar * bigram_filename = g_build_filename
+        (context->m_system_dir, SYSTEM_BIGRAM, NULL);
+    filename = g_build_filename
+        (context->m_system_dir, SYSTEM_COMPACT_BIGRAM, NULL);
+    if (!context->m_compact_bigram->attach(filename, bigram_filename)) {
+        delete context->m_compact_bigram;
+        context->m_compact_bigram = NULL;
+    }
     g_free(filename);
 
+    if (NULL == context->m_compact_bigram)
+        context->m_system_bigram->attach(bigram_filename, ATTACH_READONLY);
+    g_free(bigram_filename);
+
     context->m_user_bigram = new Bigram;
-    filename = g_build_filename(context->m_user_dir, USER_BIGRAM, NULL);
-    context->m_user_bigram->load_db(filename);
+    if (context->m_user_manifest->get_entry(USER_BIGRAM, &chunk)) {
+        context->m_user_bigram->load_chunk(&chunk);
+    } else {
+        filename = g_build_filename(context->m_user_dir, USER_BIGRAM, NULL);
+        context->m_user_bigram->load_db(filename);
+        g_free(filename);
+    }
+    context->m_user_manifest->remove_entry(USER_BIGRAM);
+    context->m_user_manifest->remove_entry(USER_TABLE_INFO);
+
+    /* the system tri-gram is optional. */
+    context->m_system_trigram = NULL;
+    filename = g_build_filename(context->m_system_dir, SYSTEM_TRIGRAM, NULL);
+    if (g_file_test(filename, G_FILE_TEST_EXISTS)) {
+        context->m_system_trigram = new Trigram;
+        if (!context->m_system_trigram->attach(filename, ATTACH_READONLY)) {
+            delete context->m_system_trigram;
+            context->m_system_trigram = NULL;
+        }
+    }
     g_free(filename);
 
-    gfloat lambda = context->m_system_table_info.get_lambda();
+    /* the histories are shared by the lookups of all instances. */
+    context->m_trigram_histories = g_array_new
+        (FALSE, FALSE, sizeof(TrigramKey));
+    if (context->m_system_trigram)
+        PinyinLookup2::load_trigram_histories
+            (context->m_system_trigram, context->m_trigram_histories);
 
-    context->m_pinyin_lookup = new PinyinLookup2
-        ( lambda,
-          context->m_pinyin_table, context->m_phrase_index,
-          context->m_system_bigram, context->m_user_bigram);
+    context->m_user_bigram_buffer = new UserBigramBuffer
+        (context->m_user_bigram);
 
-    context->m_phrase_lookup = new PhraseLookup
-        (lambda,
-         context->m_phrase_table, context->m_phrase_index,
-         context->m_system_bigram, context->m_user_bigram);
+    context->m_single_gram_cache = new SingleGramCache
+        (context->m_system_bigram, context->m_user_bigram);
+    context->m_single_gram_cache->set_user_buffer
+        (context->m_user_bigram_buffer);
+    if (context->m_compact_bigram)
+        context->m_single_gram_cache->set_compact_bigram
+            (context->m_compact_bigram);
+
+    PinyinLookup2::get_default_beam(context->m_beam);
+    context->m_generation = 0;
 
     /* load addon chewing table. */
     context->m_addon_pinyin_table = new FacadeChewingTable2;
@@ -403,6 +611,8 @@ bool pinyin_load_phrase_library(pinyin_context_t * context,
     if (!(index < PHRASE_INDEX_LIBRARY_COUNT))
         return false;
 
+    tables_writer_locker_t locker(context);
+
     const pinyin_table_info_t * phrase_files =
         context->m_system_table_info.get_default_tables();
     FacadePhraseIndex * phrase_index = context->m_phrase_index;
@@ -412,7 +622,10 @@ bool pinyin_load_phrase_library(pinyin_context_t * context,
     assert(SYSTEM_FILE == table_info->m_file_type
            || USER_FILE == table_info->m_file_type);
 
+    _invalidate_lookups(context);
+
     return _load_phrase_library(context->m_system_dir, context->m_user_dir,
+                                context->m_user_manifest,
                                 phrase_index, table_info);
 }
 
@@ -425,7 +638,9 @@ bool pinyin_unload_phrase_library(pinyin_context_t * context,
     if (GBK_DICTIONARY != index)
         return false;
 
+    tables_writer_locker_t locker(context);
     context->m_phrase_index->unload(index);
+    _invalidate_lookups(context);
     return true;
 }
 
@@ -446,6 +661,7 @@ bool pinyin_load_addon_phrase_library(pinyin_context_t * context,
     assert(DICTIONARY == table_info->m_file_type);
 
     return _load_phrase_library(context->m_system_dir, context->m_user_dir,
+                                context->m_user_manifest,
                                 phrase_index, table_info);
 }
 
@@ -573,6 +789,7 @@ bool pinyin_iterator_add_phrase(import_iterator_t * iter,
 
     pinyin_context_t * context = iter->m_context;
     guint8 index = iter->m_phrase_index;
+    tables_writer_locker_t locker(context);
 
     bool result = false;
 
@@ -600,6 +817,7 @@ bool pinyin_iterator_add_phrase(import_iterator_t * iter,
 
     result = _add_phrase(context, index, keys,
                          ucs4_phrase, phrase_length, count);
+    _invalidate_lookups(context);
 
     g_array_free(key_rests, TRUE);
     g_array_free(keys, TRUE);
@@ -608,6 +826,7 @@ bool pinyin_iterator_add_phrase(import_iterator_t * iter,
 }
 
 void pinyin_end_add_phrases(import_iterator_t * iter){
+    tables_writer_locker_t locker(iter->m_context);
     /* compact the content memory chunk of phrase index. */
     iter->m_context->m_phrase_index->compact();
     iter->m_context->m_modified = true;
@@ -727,26 +946,42 @@ void pinyin_end_get_phrases(export_iterator_t * iter){
     delete iter;
 }
 
-bool pinyin_save(pinyin_context_t * context){
-    if (!context->m_user_dir)
-        return false;
+/* take the save request on the caller thread,
+   the user state is copied by _copy_save_snapshot. */
+static save_snapshot_t * _take_save_snapshot(pinyin_context_t * context){
+    save_snapshot_t * snapshot = new save_snapshot_t;
+    snapshot->m_user_dir = g_strdup(context->m_user_dir);
+    snapshot->m_callbacks = g_array_new
+        (FALSE, FALSE, sizeof(save_callback_t));
 
-    if (!context->m_modified)
-        return false;
+    /* each save writes the next generation. */
+    snapshot->m_generation = ++context->m_save_generation;
 
-    context->m_phrase_index->compact();
+    snapshot->m_manifest = NULL;
+    snapshot->m_pinyin_table = NULL;
+    snapshot->m_phrase_table = NULL;
+    snapshot->m_user_bigram = NULL;
+
+    context->m_modified = false;
+    return snapshot;
+}
+
+/* copy the user state into the snapshot on the thread which writes it,
+   the functions which change the shared tables wait for the copy. */
+static void _copy_save_snapshot(pinyin_context_t * context,
+                                save_snapshot_t * snapshot){
+    g_rw_lock_reader_lock(&context->m_tables_lock);
+
+    UserManifest * manifest = new UserManifest;
+    context->m_user_manifest->copy(manifest);
+    manifest->set_generation(snapshot->m_generation);
+    snapshot->m_manifest = manifest;
 
     const pinyin_table_info_t * phrase_files =
         context->m_system_table_info.get_default_tables();
 
     /* skip the reserved zero phrase library. */
     for (size_t i = 1; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
-        PhraseIndexRange range;
-        int retval = context->m_phrase_index->get_range(i, range);
-
-        if (ERROR_NO_SUB_PHRASE_INDEX == retval)
-            continue;
-
         const pinyin_table_info_t * table_info = phrase_files + i;
 
         if (NOT_USED == table_info->m_file_type)
@@ -757,11 +992,25 @@ bool pinyin_save(pinyin_context_t * context){
         if (NULL == userfilename)
             continue;
 
+        PhraseIndexRange range;
+        int retval = context->m_phrase_index->get_range(i, range);
+
+        if (ERROR_NO_SUB_PHRASE_INDEX == retval) {
+            /* keep the user file of the unloaded phrase library. */
+            if (!manifest->has_entry(userfilename)) {
+                MemoryChunk chunk;
+                if (_load_user_file(context->m_user_dir, manifest,
+                                    userfilename, &chunk))
+                    manifest->set_entry(userfilename, &chunk);
+            }
+            continue;
+        }
+
         if (SYSTEM_FILE == table_info->m_file_type ||
             DICTIONARY == table_info->m_file_type) {
             /* system phrase library */
             MemoryChunk * chunk = new MemoryChunk;
-            MemoryChunk * log = new MemoryChunk;
+            MemoryChunk log;
             const char * systemfilename = table_info->m_system_filename;
 
             /* check bin file in system dir. */
@@ -776,108 +1025,219 @@ bool pinyin_save(pinyin_context_t * context){
 #endif
 
             g_free(chunkfilename);
-            context->m_phrase_index->diff(i, chunk, log);
+            /* the chunk is owned by the diff. */
+            context->m_phrase_index->diff(i, chunk, &log);
 
-            const char * userfilename = table_info->m_user_filename;
-            gchar * tmpfilename = g_strdup_printf("%s.tmp", userfilename);
+            manifest->set_entry(userfilename, &log);
+        }
 
-            gchar * tmppathname = g_build_filename(context->m_user_dir,
-                                                   tmpfilename, NULL);
-            g_free(tmpfilename);
+        if (USER_FILE == table_info->m_file_type) {
+            /* user phrase library, compacted in the copy. */
+            MemoryChunk * content = new MemoryChunk;
+            context->m_phrase_index->store(i, content);
 
-            gchar * chunkpathname = g_build_filename(context->m_user_dir,
-                                                     userfilename, NULL);
-            log->save(tmppathname);
+            FacadePhraseIndex user_phrase_index;
+            user_phrase_index.load(i, content);
+            user_phrase_index.compact();
 
-            int result = rename(tmppathname, chunkpathname);
-            if (0 != result)
-                fprintf(stderr, "rename %s to %s failed.\n",
-                        tmppathname, chunkpathname);
+            MemoryChunk chunk;
+            user_phrase_index.store(i, &chunk);
 
-            g_free(chunkpathname);
-            g_free(tmppathname);
-            delete log;
+            manifest->set_entry(userfilename, &chunk);
         }
+    }
 
-        if (USER_FILE == table_info->m_file_type) {
-            /* user phrase library */
-            MemoryChunk * chunk = new MemoryChunk;
-            context->m_phrase_index->store(i, chunk);
-
-            const char * userfilename = table_info->m_user_filename;
-            gchar * tmpfilename = g_strdup_printf("%s.tmp", userfilename);
-            gchar * tmppathname = g_build_filename(context->m_user_dir,
-                                                   tmpfilename, NULL);
-            g_free(tmpfilename);
+    /* mark version */
+    UserTableInfo user_table_info;
+    user_table_info.make_conform(&context->m_system_table_info);
 
-            gchar * chunkpathname = g_build_filename(context->m_user_dir,
-                                                     userfilename, NULL);
+    MemoryChunk chunk;
+    user_table_info.save(&chunk);
+    manifest->set_entry(USER_TABLE_INFO, &chunk);
 
-            chunk->save(tmppathname);
+    /* copy user pinyin table */
+    snapshot->m_pinyin_table = new ChewingLargeTable2;
+    if (!context->m_pinyin_table->copy_user_db(snapshot->m_pinyin_table)) {
+        delete snapshot->m_pinyin_table;
+        snapshot->m_pinyin_table = NULL;
+    }
 
-            int result = rename(tmppathname, chunkpathname);
-            if (0 != result)
-                fprintf(stderr, "rename %s to %s failed.\n",
-                        tmppathname, chunkpathname);
+    /* copy user phrase table */
+    snapshot->m_phrase_table = new PhraseLargeTable3;
+    if (!context->m_phrase_table->copy_user_db(snapshot->m_phrase_table)) {
+        delete snapshot->m_phrase_table;
+        snapshot->m_phrase_table = NULL;
+    }
 
-            g_free(chunkpathname);
-            g_free(tmppathname);
-            delete chunk;
-        }
+    /* copy user bi-gram */
+    snapshot->m_user_bigram = new Bigram;
+    if (!context->m_user_bigram_buffer->copy_db(snapshot->m_user_bigram)) {
+        delete snapshot->m_user_bigram;
+        snapshot->m_user_bigram = NULL;
     }
 
-    /* save user pinyin table */
-    gchar * tmpfilename = g_build_filename
-        (context->m_user_dir, USER_PINYIN_INDEX ".tmp", NULL);
-    unlink(tmpfilename);
-    gchar * filename = g_build_filename
-        (context->m_user_dir, USER_PINYIN_INDEX, NULL);
+    g_rw_lock_reader_unlock(&context->m_tables_lock);
 
-    context->m_pinyin_table->store(tmpfilename);
+    /* the saved logs are kept for the unloaded phrase libraries. */
+    g_rw_lock_writer_lock(&context->m_tables_lock);
+    manifest->copy(context->m_user_manifest);
+    g_rw_lock_writer_unlock(&context->m_tables_lock);
+}
 
-    int result = rename(tmpfilename, filename);
-    if (0 != result)
-        fprintf(stderr, "rename %s to %s failed.\n",
-                tmpfilename, filename);
+static void _free_save_snapshot(save_snapshot_t * snapshot){
+    delete snapshot->m_manifest;
 
-    g_free(tmpfilename);
-    g_free(filename);
+    delete snapshot->m_pinyin_table;
+    delete snapshot->m_phrase_table;
+    delete snapshot->m_user_bigram;
 
-    /* save user phrase table */
-    tmpfilename = g_build_filename
-        (context->m_user_dir, USER_PHRASE_INDEX ".tmp", NULL);
-    unlink(tmpfilename);
-    filename = g_build_filename
-        (context->m_user_dir, USER_PHRASE_INDEX, NULL);
+    g_array_free(snapshot->m_callbacks, TRUE);
+    g_free(snapshot->m_user_dir);
+    delete snapshot;
+}
 
-    context->m_phrase_table->store(tmpfilename);
+/* write the snapshot into the user directory as one manifest,
+   only touches the snapshot, runs on any thread. */
+static bool _write_save_snapshot(save_snapshot_t * snapshot){
+    UserManifest * manifest = snapshot->m_manifest;
+    MemoryChunk chunk;
 
-    result = rename(tmpfilename, filename);
-    if (0 != result)
-        fprintf(stderr, "rename %s to %s failed.\n",
-                tmpfilename, filename);
+    /* save user pinyin table */
+    if (NULL == snapshot->m_pinyin_table ||
+        !snapshot->m_pinyin_table->store_chunk(&chunk))
+        return false;
+    manifest->set_entry(USER_PINYIN_INDEX, &chunk);
 
-    g_free(tmpfilename);
-    g_free(filename);
+    /* save user phrase table */
+    if (NULL == snapshot->m_phrase_table ||
+        !snapshot->m_phrase_table->store_chunk(&chunk))
+        return false;
+    manifest->set_entry(USER_PHRASE_INDEX, &chunk);
 
     /* save user bi-gram */
-    tmpfilename = g_build_filename
-        (context->m_user_dir, USER_BIGRAM ".tmp", NULL);
-    unlink(tmpfilename);
-    filename = g_build_filename(context->m_user_dir, USER_BIGRAM, NULL);
-    context->m_user_bigram->save_db(tmpfilename);
-
-    result = rename(tmpfilename, filename);
-    if (0 != result)
-        fprintf(stderr, "rename %s to %s failed.\n",
-                tmpfilename, filename);
-
-    g_free(tmpfilename);
-    g_free(filename);
+    if (NULL == snapshot->m_user_bigram ||
+        !snapshot->m_user_bigram->save_chunk(&chunk))
+        return false;
+    manifest->set_entry(USER_BIGRAM, &chunk);
 
-    mark_version(context);
+    /* one segment with one manifest swap. */
+    return manifest->save(snapshot->m_user_dir);
+}
+
+/* invoke the callbacks of the coalesced save requests,
+   then free the snapshot. */
+static void _finish_save_snapshot(pinyin_context_t * context,
+                                  save_snapshot_t * snapshot,
+                                  bool retval){
+    for (size_t i = 0; i < snapshot->m_callbacks->len; ++i) {
+        save_callback_t * item = &g_array_index
+            (snapshot->m_callbacks, save_callback_t, i);
+        item->m_callback(context, retval, item->m_user_data);
+    }
+
+    _free_save_snapshot(snapshot);
+}
+
+/* move the callbacks of the replaced snapshot into the new one. */
+static void _coalesce_save_snapshot(save_snapshot_t * snapshot,
+                                    save_snapshot_t * replaced){
+    g_array_append_vals(snapshot->m_callbacks, replaced->m_callbacks->data,
+                        replaced->m_callbacks->len);
+    g_array_set_size(replaced->m_callbacks, 0);
+    _free_save_snapshot(replaced);
+}
+
+static gpointer _save_thread_func(gpointer data){
+    pinyin_context_t * context = (pinyin_context_t *) data;
+
+    g_mutex_lock(&context->m_save_mutex);
+    while (true) {
+        while (NULL == context->m_pending_save && !context->m_save_quit)
+            g_cond_wait(&context->m_save_cond, &context->m_save_mutex);
+
+        save_snapshot_t * snapshot = context->m_pending_save;
+        /* the pending snapshot is written before quit. */
+        if (NULL == snapshot)
+            break;
+        context->m_pending_save = NULL;
+
+        /* lock the write before releasing the pending snapshot,
+           keeps the snapshots written in order. */
+        g_mutex_lock(&context->m_write_mutex);
+        g_mutex_unlock(&context->m_save_mutex);
+
+        _copy_save_snapshot(context, snapshot);
+        bool retval = _write_save_snapshot(snapshot);
+        g_mutex_unlock(&context->m_write_mutex);
+
+        _finish_save_snapshot(context, snapshot, retval);
+
+        g_mutex_lock(&context->m_save_mutex);
+    }
+    g_mutex_unlock(&context->m_save_mutex);
+
+    return NULL;
+}
+
+bool pinyin_save(pinyin_context_t * context){
+    if (!context->m_user_dir)
+        return false;
+
+    if (!context->m_modified)
+        return false;
+
+    save_snapshot_t * snapshot = _take_save_snapshot(context);
+
+    /* the pending snapshot of the background save is out of date,
+       completes with this save. */
+    g_mutex_lock(&context->m_save_mutex);
+    if (context->m_pending_save) {
+        _coalesce_save_snapshot(snapshot, context->m_pending_save);
+        context->m_pending_save = NULL;
+    }
+    g_mutex_lock(&context->m_write_mutex);
+    g_mutex_unlock(&context->m_save_mutex);
+
+    _copy_save_snapshot(context, snapshot);
+    bool retval = _write_save_snapshot(snapshot);
+    g_mutex_unlock(&context->m_write_mutex);
+
+    _finish_save_snapshot(context, snapshot, retval);
+    return retval;
+}
+
+bool pinyin_save_async(pinyin_context_t * context,
+                       pinyin_save_callback_t callback,
+                       gpointer user_data){
+    if (!context->m_user_dir)
+        return false;
+
+    if (!context->m_modified)
+        return false;
+
+    save_snapshot_t * snapshot = _take_save_snapshot(context);
+
+    if (callback) {
+        save_callback_t item;
+        item.m_callback = callback;
+        item.m_user_data = user_data;
+        g_array_append_val(snapshot->m_callbacks, item);
+    }
+
+    g_mutex_lock(&context->m_save_mutex);
+
+    /* only the newest snapshot is written. */
+    if (context->m_pending_save)
+        _coalesce_save_snapshot(snapshot, context->m_pending_save);
+    context->m_pending_save = snapshot;
+
+    if (NULL == context->m_save_thread)
+        context->m_save_thread = g_thread_new
+            ("pinyin_save", _save_thread_func, context);
+
+    g_cond_signal(&context->m_save_cond);
+    g_mutex_unlock(&context->m_save_mutex);
 
-    context->m_modified = false;
     return true;
 }
 
@@ -927,6 +1287,22 @@ bool pinyin_set_zhuyin_scheme(pinyin_context_t * context,
 }
 
 void pinyin_fini(pinyin_context_t * context){
+    /* wait for the background save. */
+    g_mutex_lock(&context->m_save_mutex);
+    context->m_save_quit = true;
+    g_cond_signal(&context->m_save_cond);
+    GThread * save_thread = context->m_save_thread;
+    context->m_save_thread = NULL;
+    g_mutex_unlock(&context->m_save_mutex);
+
+    if (save_thread)
+        g_thread_join(save_thread);
+
+    g_mutex_clear(&context->m_save_mutex);
+    g_cond_clear(&context->m_save_cond);
+    g_mutex_clear(&context->m_write_mutex);
+    g_rw_lock_clear(&context->m_tables_lock);
+
     delete context->m_full_pinyin_parser;
     delete context->m_double_pinyin_parser;
     delete context->m_chewing_parser;
@@ -934,12 +1310,16 @@ void pinyin_fini(pinyin_context_t * context){
     delete context->m_phrase_table;
     delete context->m_phrase_index;
     delete context->m_system_bigram;
+    delete context->m_compact_bigram;
+    delete context->m_user_bigram_buffer;
     delete context->m_user_bigram;
-    delete context->m_pinyin_lookup;
-    delete context->m_phrase_lookup;
+    delete context->m_system_trigram;
+    g_array_free(context->m_trigram_histories, TRUE);
+    delete context->m_single_gram_cache;
     delete context->m_addon_pinyin_table;
     delete context->m_addon_phrase_table;
     delete context->m_addon_phrase_index;
+    delete context->m_user_manifest;
 
     g_free(context->m_system_dir);
     g_free(context->m_user_dir);
@@ -951,10 +1331,14 @@ void pinyin_fini(pinyin_context_t * context){
 bool pinyin_mask_out(pinyin_context_t * context,
                      phrase_token_t mask,
                      phrase_token_t value) {
+    tables_writer_locker_t locker(context);
+
+    _invalidate_lookups(context);
 
     context->m_pinyin_table->mask_out(mask, value);
     context->m_phrase_table->mask_out(mask, value);
-    context->m_user_bigram->mask_out(mask, value);
+    context->m_user_bigram_buffer->mask_out(mask, value);
+    context->m_single_gram_cache->invalidate_all();
 
     const pinyin_table_info_t * phrase_files =
         context->m_system_table_info.get_default_tables();
@@ -1034,13 +1418,72 @@ bool pinyin_set_options(pinyin_context_t * context,
 }
 
 
+bool pinyin_set_beam_options(pinyin_context_t * context,
+                             guint width,
+                             gfloat margin,
+                             guint adaptive_length){
+    if (0 == width || margin < 0.)
+        return false;
+
+    context->m_beam.m_width = width;
+    context->m_beam.m_margin = margin;
+    context->m_beam.m_adaptive_length = adaptive_length;
+    return true;
+}
+
+/* the matrix columns from the column are changed by the parsers,
+   the lookup and the search caches only drop the changed columns. */
+static void _update_matrix_columns(pinyin_instance_t * instance,
+                                   size_t column){
+    instance->m_changed_column = column;
+    instance->m_pinyin_lookup->update_matrix(&instance->m_matrix, column);
+    instance->m_search_cache->invalidate(column);
+    instance->m_addon_search_cache->invalidate(column);
+}
+
 pinyin_instance_t * pinyin_alloc_instance(pinyin_context_t * context){
     pinyin_instance_t * instance = new pinyin_instance_t;
     instance->m_context = context;
 
+    gfloat lambda = context->m_system_table_info.get_lambda();
+
+    instance->m_pinyin_lookup = new PinyinLookup2
+        ( lambda,
+          context->m_pinyin_table, context->m_phrase_index,
+          context->m_system_bigram, context->m_user_bigram,
+          context->m_single_gram_cache);
+    if (context->m_system_trigram)
+        instance->m_pinyin_lookup->set_trigram
+            (context->m_system_trigram, context->m_trigram_histories,
+             trigram_lambda);
+
+    instance->m_search_cache = new MatrixSearchCache
+        (context->m_pinyin_table);
+    instance->m_addon_search_cache = new MatrixSearchCache
+        (context->m_addon_pinyin_table);
+    instance->m_pinyin_lookup->set_search_cache(instance->m_search_cache);
+
+    instance->m_phrase_lookup = new PhraseLookup
+        (lambda,
+         context->m_phrase_table, context->m_phrase_index,
+         context->m_system_bigram, context->m_user_bigram,
+         context->m_single_gram_cache);
+
+    instance->m_generation = g_atomic_int_get(&context->m_generation);
+
     instance->m_prefixes = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
 
     instance->m_parsed_len = 0;
+    _update_matrix_columns(instance, 0);
+
+    instance->m_full_pinyin_parsed = false;
+    instance->m_parsed_options = 0;
+    instance->m_parsed_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+    instance->m_parsed_key_rests =
+        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+    instance->m_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+    instance->m_key_rests =
+        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
 
     instance->m_constraints = g_array_new
         (TRUE, TRUE, sizeof(lookup_constraint_t));
@@ -1048,15 +1491,41 @@ pinyin_instance_t * pinyin_alloc_instance(pinyin_context_t * context){
         g_array_new(TRUE, TRUE, sizeof(phrase_token_t));
     instance->m_candidates =
         g_array_new(TRUE, TRUE, sizeof(lookup_candidate_t));
+    instance->m_nbest_results = g_ptr_array_new();
+
+    instance->m_beam.m_width = 0;
+    instance->m_beam.m_margin = 0.;
+    instance->m_beam.m_adaptive_length = 0;
 
     return instance;
 }
 
+static bool _free_nbest_results(GPtrArray * nbest_results) {
+    for (size_t i = 0; i < nbest_results->len; ++i) {
+        MatchResults results = (MatchResults)
+            g_ptr_array_index(nbest_results, i);
+        g_array_free(results, TRUE);
+    }
+    g_ptr_array_set_size(nbest_results, 0);
+
+    return true;
+}
+
 void pinyin_free_instance(pinyin_instance_t * instance){
+    delete instance->m_pinyin_lookup;
+    delete instance->m_phrase_lookup;
+    delete instance->m_search_cache;
+    delete instance->m_addon_search_cache;
     g_array_free(instance->m_prefixes, TRUE);
+    g_array_free(instance->m_parsed_keys, TRUE);
+    g_array_free(instance->m_parsed_key_rests, TRUE);
+    g_array_free(instance->m_keys, TRUE);
+    g_array_free(instance->m_key_rests, TRUE);
     g_array_free(instance->m_constraints, TRUE);
     g_array_free(instance->m_match_results, TRUE);
     g_array_free(instance->m_candidates, TRUE);
+    _free_nbest_results(instance->m_nbest_results);
+    g_ptr_array_free(instance->m_nbest_results, TRUE);
 
     delete instance;
 }
@@ -1065,12 +1534,82 @@ pinyin_context_t * pinyin_get_context (pinyin_instance_t * instance){
     return instance->m_context;
 }
 
+bool pinyin_set_instance_beam_options(pinyin_instance_t * instance,
+                                      guint width,
+                                      gfloat margin,
+                                      guint adaptive_length){
+    if (margin < 0.)
+        return false;
+
+    instance->m_beam.m_width = width;
+    instance->m_beam.m_margin = margin;
+    instance->m_beam.m_adaptive_length = adaptive_length;
+    return true;
+}
+
+bool pinyin_get_beam_statistics(pinyin_instance_t * instance,
+                                guint * candidates,
+                                guint * pruned_by_width,
+                                guint * pruned_by_margin,
+                                guint * pruned_by_history){
+    const lookup_beam_stats_t & stats = instance->m_beam_stats;
+
+    *candidates = stats.m_candidates;
+    *pruned_by_width = stats.m_pruned_by_width;
+    *pruned_by_margin = stats.m_pruned_by_margin;
+    *pruned_by_history = stats.m_pruned_by_history;
+    return true;
+}
+
+static bool pinyin_update_lookup(pinyin_instance_t * instance){
+    pinyin_context_t * & context = instance->m_context;
+
+    /* the shared tables are changed since the last lookup. */
+    gint generation = g_atomic_int_get(&context->m_generation);
+    if (generation != instance->m_generation) {
+        instance->m_generation = generation;
+        instance->m_pinyin_lookup->invalidate_steps(0);
+        instance->m_search_cache->invalidate_all();
+        instance->m_addon_search_cache->invalidate_all();
+    }
+
+    /* the fuzzy pinyins are matched by the chewing table search. */
+    pinyin_option_t & options = context->m_options;
+    instance->m_pinyin_lookup->set_options(options);
+    instance->m_search_cache->set_options(options);
+    instance->m_addon_search_cache->set_options(options);
+    return true;
+}
+
+static bool pinyin_update_beam(pinyin_instance_t * instance){
+    pinyin_context_t * & context = instance->m_context;
+
+    if (0 == instance->m_beam.m_width)
+        return instance->m_pinyin_lookup->set_beam(context->m_beam);
+
+    return instance->m_pinyin_lookup->set_beam(instance->m_beam);
+}
+
+static bool pinyin_update_beam_stats(pinyin_instance_t * instance){
+    pinyin_context_t * & context = instance->m_context;
+
+    lookup_beam_stats_t stats;
+    instance->m_pinyin_lookup->get_beam_stats(stats);
+
+    lookup_beam_stats_t & total = instance->m_beam_stats;
+    total.m_candidates += stats.m_candidates;
+    total.m_pruned_by_width += stats.m_pruned_by_width;
+    total.m_pruned_by_margin += stats.m_pruned_by_margin;
+    total.m_pruned_by_history += stats.m_pruned_by_history;
+    return true;
+}
+
 static bool pinyin_update_constraints(pinyin_instance_t * instance){
     pinyin_context_t * & context = instance->m_context;
     PhoneticKeyMatrix & matrix = instance->m_matrix;
     CandidateConstraints & constraints = instance->m_constraints;
 
-    context->m_pinyin_lookup->validate_constraint
+    instance->m_pinyin_lookup->validate_constraint
         (&matrix, constraints);
 
     return true;
@@ -1084,12 +1623,77 @@ bool pinyin_guess_sentence(pinyin_instance_t * instance){
     g_array_set_size(instance->m_prefixes, 0);
     g_array_append_val(instance->m_prefixes, sentence_start);
 
+    pinyin_update_lookup(instance);
     pinyin_update_constraints(instance);
-    bool retval = context->m_pinyin_lookup->get_best_match
+    pinyin_update_beam(instance);
+    bool retval = instance->m_pinyin_lookup->get_best_match
         (instance->m_prefixes,
          &matrix,
          instance->m_constraints,
          instance->m_match_results);
+    pinyin_update_beam_stats(instance);
+
+    return retval;
+}
+
+bool pinyin_guess_sentences_nbest(pinyin_instance_t * instance,
+                                  guint nbest){
+    pinyin_context_t * & context = instance->m_context;
+    FacadePhraseIndex * & phrase_index = context->m_phrase_index;
+    PhoneticKeyMatrix & matrix = instance->m_matrix;
+    GPtrArray * & nbest_results = instance->m_nbest_results;
+
+    _free_nbest_results(nbest_results);
+
+    if (0 == nbest)
+        return false;
+
+    g_array_set_size(instance->m_prefixes, 0);
+    g_array_append_val(instance->m_prefixes, sentence_start);
+
+    pinyin_update_lookup(instance);
+    pinyin_update_constraints(instance);
+    pinyin_update_beam(instance);
+    bool retval = instance->m_pinyin_lookup->get_nbest_match
+        (instance->m_prefixes,
+         &matrix,
+         instance->m_constraints,
+         nbest, nbest_results);
+    pinyin_update_beam_stats(instance);
+
+    if (!retval)
+        return retval;
+
+    /* remove the sentences which only differ in the segmentation. */
+    GHashTable * sentences = g_hash_table_new_full
+        (g_str_hash, g_str_equal, g_free, NULL);
+
+    size_t len = 0;
+    for (size_t i = 0; i < nbest_results->len; ++i) {
+        MatchResults results = (MatchResults)
+            g_ptr_array_index(nbest_results, i);
+
+        char * sentence = NULL;
+        pinyin::convert_to_utf8(phrase_index, results,
+                                NULL, false, sentence);
+
+        if (g_hash_table_lookup_extended(sentences, sentence, NULL, NULL)) {
+            g_free(sentence);
+            g_array_free(results, TRUE);
+            continue;
+        }
+
+        g_hash_table_insert(sentences, sentence, NULL);
+        g_ptr_array_index(nbest_results, len++) = results;
+    }
+    g_ptr_array_set_size(nbest_results, len);
+
+    g_hash_table_destroy(sentences);
+
+    /* save the best sentence. */
+    MatchResults best = (MatchResults) g_ptr_array_index(nbest_results, 0);
+    g_array_set_size(instance->m_match_results, 0);
+    g_array_append_vals(instance->m_match_results, best->data, best->len);
 
     return retval;
 }
@@ -1137,16 +1741,103 @@ bool pinyin_guess_sentence_with_prefix(pinyin_instance_t * instance,
 
     _compute_prefixes(instance, prefix);
 
+    pinyin_update_lookup(instance);
     pinyin_update_constraints(instance);
-    bool retval = context->m_pinyin_lookup->get_best_match
+    pinyin_update_beam(instance);
+    bool retval = instance->m_pinyin_lookup->get_best_match
         (instance->m_prefixes,
          &matrix,
          instance->m_constraints,
          instance->m_match_results);
+    pinyin_update_beam_stats(instance);
 
     return retval;
 }
 
+struct _convert_batch_t{
+    pinyin_context_t * m_context;
+    const char ** m_inputs;
+    size_t m_num;
+    char ** m_results;
+
+    /* the next input to be converted, shared by the workers. */
+    volatile gint m_next;
+    /* the number of the failed conversions. */
+    volatile gint m_failed;
+};
+
+static gpointer _convert_batch_worker(gpointer user_data){
+    _convert_batch_t * batch = (_convert_batch_t *) user_data;
+
+    /* the per worker scratch, reused for all inputs of this worker. */
+    pinyin_instance_t * instance = pinyin_alloc_instance(batch->m_context);
+
+    while (TRUE) {
+        /* the idle worker takes the next input, keeps the load balanced. */
+        const size_t index = g_atomic_int_add(&batch->m_next, 1);
+        if (index >= batch->m_num)
+            break;
+
+        char * sentence = NULL;
+        pinyin_parse_more_full_pinyins(instance, batch->m_inputs[index]);
+        if (!pinyin_guess_sentence(instance) ||
+            !pinyin_get_sentence(instance, &sentence)) {
+            g_free(sentence);
+            sentence = NULL;
+            g_atomic_int_inc(&batch->m_failed);
+        }
+
+        batch->m_results[index] = sentence;
+        pinyin_reset(instance);
+    }
+
+    pinyin_free_instance(instance);
+    return NULL;
+}
+
+bool pinyin_convert_batch(pinyin_context_t * context,
+                          const char ** inputs,
+                          size_t num,
+                          char ** results,
+                          guint nthreads){
+    memset(results, 0, num * sizeof(char *));
+
+    if (0 == num)
+        return true;
+
+    if (0 == nthreads) {
+        long nprocessors = sysconf(_SC_NPROCESSORS_ONLN);
+        nthreads = nprocessors > 0 ? nprocessors : 1;
+    }
+    nthreads = std_lite::min((size_t) nthreads, num);
+
+    _convert_batch_t batch;
+    batch.m_context = context;
+    batch.m_inputs = inputs;
+    batch.m_num = num;
+    batch.m_results = results;
+    batch.m_next = 0;
+    batch.m_failed = 0;
+
+    /* the calling thread is also one of the workers. */
+    GPtrArray * threads = g_ptr_array_new();
+    for (guint i = 1; i < nthreads; ++i) {
+        GThread * thread = g_thread_new
+            ("pinyin_convert_batch", _convert_batch_worker, &batch);
+        g_ptr_array_add(threads, thread);
+    }
+
+    _convert_batch_worker(&batch);
+
+    for (size_t i = 0; i < threads->len; ++i) {
+        GThread * thread = (GThread *) g_ptr_array_index(threads, i);
+        g_thread_join(thread);
+    }
+    g_ptr_array_free(threads, TRUE);
+
+    return 0 == batch.m_failed;
+}
+
 bool pinyin_phrase_segment(pinyin_instance_t * instance,
                            const char * sentence){
     pinyin_context_t * & context = instance->m_context;
@@ -1157,13 +1848,39 @@ bool pinyin_phrase_segment(pinyin_instance_t * instance,
 
     g_return_val_if_fail(num_of_chars == ucs4_len, FALSE);
 
-    bool retval = context->m_phrase_lookup->get_best_match
+    bool retval = instance->m_phrase_lookup->get_best_match
         (ucs4_len, ucs4_str, instance->m_match_results);
 
     g_free(ucs4_str);
     return retval;
 }
 
+bool pinyin_get_n_sentence(pinyin_instance_t * instance,
+                           guint * num){
+    *num = instance->m_nbest_results->len;
+    return true;
+}
+
+/* the returned sentence should be freed by g_free(). */
+bool pinyin_get_nth_sentence(pinyin_instance_t * instance,
+                             guint index,
+                             char ** sentence){
+    pinyin_context_t * & context = instance->m_context;
+    GPtrArray * & nbest_results = instance->m_nbest_results;
+
+    if (index >= nbest_results->len)
+        return false;
+
+    MatchResults results = (MatchResults)
+        g_ptr_array_index(nbest_results, index);
+
+    bool retval = pinyin::convert_to_utf8
+        (context->m_phrase_index, results,
+         NULL, false, *sentence);
+
+    return retval;
+}
+
 /* the returned sentence should be freed by g_free(). */
 bool pinyin_get_sentence(pinyin_instance_t * instance,
                          char ** sentence){
@@ -1187,32 +1904,45 @@ bool pinyin_parse_full_pinyin(pinyin_instance_t * instance,
     return retval;
 }
 
+/* the matrix is changed by other parsers. */
+static void _reset_full_pinyin_parsed(pinyin_instance_t * instance){
+    instance->m_full_pinyin_parsed = false;
+    _update_matrix_columns(instance, 0);
+}
+
 size_t pinyin_parse_more_full_pinyins(pinyin_instance_t * instance,
                                       const char * pinyins){
     pinyin_context_t * & context = instance->m_context;
     pinyin_option_t & options = context->m_options;
     PhoneticKeyMatrix & matrix = instance->m_matrix;
 
-    ChewingKeyVector keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    ChewingKeyRestVector key_rests =
-        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+    ChewingKeyVector keys = instance->m_keys;
+    ChewingKeyRestVector key_rests = instance->m_key_rests;
 
-    int parsed_len = context->m_full_pinyin_parser->parse
-        (options, keys,
+    /* only the changed tail of the pinyins is parsed again. */
+    int parsed_len = context->m_full_pinyin_parser->parse_more
+        (options, instance->m_parse_state, keys,
          key_rests, pinyins, strlen(pinyins));
 
-    instance->m_parsed_len = parsed_len;
-
-    fill_matrix(&matrix, keys, key_rests, parsed_len);
-
-    resplit_step(options, &matrix);
-
-    inner_split_step(options, &matrix);
+    /* only the changed tail of the matrix is filled again. */
+    const bool incremental = instance->m_full_pinyin_parsed &&
+        options == instance->m_parsed_options;
+    const size_t column = update_matrix
+        (options, &matrix,
+         incremental ? instance->m_parsed_keys : NULL,
+         incremental ? instance->m_parsed_key_rests : NULL,
+         instance->m_parsed_len, keys, key_rests, parsed_len);
+    _update_matrix_columns(instance, column);
 
-    fuzzy_syllable_step(options, &matrix);
+    instance->m_parsed_len = parsed_len;
 
-    g_array_free(key_rests, TRUE);
-    g_array_free(keys, TRUE);
+    /* keep the keys for the next parse. */
+    instance->m_keys = instance->m_parsed_keys;
+    instance->m_key_rests = instance->m_parsed_key_rests;
+    instance->m_parsed_keys = keys;
+    instance->m_parsed_key_rests = key_rests;
+    instance->m_full_pinyin_parsed = true;
+    instance->m_parsed_options = options;
     return parsed_len;
 }
 
@@ -1242,11 +1972,10 @@ size_t pinyin_parse_more_double_pinyins(pinyin_instance_t * instance,
          key_rests, pinyins, strlen(pinyins));
 
     instance->m_parsed_len = parsed_len;
+    _reset_full_pinyin_parsed(instance);
 
     fill_matrix(&matrix, keys, key_rests, parsed_len);
 
-    fuzzy_syllable_step(options, &matrix);
-
     g_array_free(key_rests, TRUE);
     g_array_free(keys, TRUE);
     return parsed_len;
@@ -1278,11 +2007,10 @@ size_t pinyin_parse_more_chewings(pinyin_instance_t * instance,
          key_rests, chewings, strlen(chewings));
 
     instance->m_parsed_len = parsed_len;
+    _reset_full_pinyin_parsed(instance);
 
     fill_matrix(&matrix, keys, key_rests, parsed_len);
 
-    fuzzy_syllable_step(options, &matrix);
-
     g_array_free(key_rests, TRUE);
     g_array_free(keys, TRUE);
     return parsed_len;
@@ -1292,6 +2020,10 @@ size_t pinyin_get_parsed_input_length(pinyin_instance_t * instance) {
     return instance->m_parsed_len;
 }
 
+size_t pinyin_get_changed_column(pinyin_instance_t * instance) {
+    return instance->m_changed_column;
+}
+
 bool pinyin_in_chewing_keyboard(pinyin_instance_t * instance,
                                 const char key, gchar *** symbols) {
     pinyin_context_t * & context = instance->m_context;
@@ -1426,7 +2158,7 @@ static void _append_items(PhraseIndexRanges ranges,
 
 static void _compute_frequency_of_items(pinyin_context_t * context,
                                         phrase_token_t prev_token,
-                                        SingleGram * merged_gram,
+                                        MergedSingleGramView * merged_gram,
                                         CandidateVector items) {
     pinyin_option_t & options = context->m_options;
     ssize_t i;
@@ -1708,6 +2440,8 @@ bool pinyin_guess_candidates(pinyin_instance_t * instance,
     if (0 == matrix.size())
         return false;
 
+    pinyin_update_lookup(instance);
+
     /* lookup the previous token here. */
     phrase_token_t prev_token = null_token;
 
@@ -1715,15 +2449,13 @@ bool pinyin_guess_candidates(pinyin_instance_t * instance,
         prev_token = _get_previous_token(instance, offset);
     }
 
-    SingleGram merged_gram;
-    SingleGram * system_gram = NULL, * user_gram = NULL;
+    SingleGramCacheRef gram_ref;
+    MergedSingleGramView merged_gram;
 
     if (options & DYNAMIC_ADJUST) {
-        if (null_token != prev_token) {
-            context->m_system_bigram->load(prev_token, system_gram);
-            context->m_user_bigram->load(prev_token, user_gram);
-            merge_single_gram(&merged_gram, system_gram, user_gram);
-        }
+        if (null_token != prev_token)
+            context->m_single_gram_cache->load
+                (prev_token, gram_ref, merged_gram);
     }
 
     PhraseIndexRanges ranges;
@@ -1741,12 +2473,12 @@ bool pinyin_guess_candidates(pinyin_instance_t * instance,
     for (size_t end = start + 1; end < matrix.size();) {
         /* do pinyin search. */
         context->m_phrase_index->clear_ranges(ranges);
-        int retval = search_matrix(context->m_pinyin_table, &matrix,
-                                   start, end, ranges);
+        int retval = instance->m_search_cache->search
+            (&matrix, start, end, ranges);
 
         context->m_addon_phrase_index->clear_ranges(addon_ranges);
-        retval = search_matrix(context->m_addon_pinyin_table, &matrix,
-                               start, end, addon_ranges) | retval;
+        retval = instance->m_addon_search_cache->search
+            (&matrix, start, end, addon_ranges) | retval;
 
         if ( !(retval & SEARCH_OK) ) {
             ++end;
@@ -1786,10 +2518,6 @@ bool pinyin_guess_candidates(pinyin_instance_t * instance,
     }
 
     context->m_phrase_index->destroy_ranges(ranges);
-    if (system_gram)
-        delete system_gram;
-    if (user_gram)
-        delete user_gram;
 
     /* post process to sort the candidates */
 
@@ -1827,12 +2555,11 @@ bool pinyin_guess_predicted_candidates(pinyin_instance_t * instance,
     if (null_token == prev_token)
         return false;
 
-    /* merge single gram. */
-    SingleGram merged_gram;
-    SingleGram * system_gram = NULL, * user_gram = NULL;
-    context->m_system_bigram->load(prev_token, system_gram);
-    context->m_user_bigram->load(prev_token, user_gram);
-    merge_single_gram(&merged_gram, system_gram, user_gram);
+    /* the merged view of the cached single grams. */
+    SingleGramCacheRef gram_ref;
+    MergedSingleGramView merged_gram;
+    context->m_single_gram_cache->load
+        (prev_token, gram_ref, merged_gram);
 
     /* retrieve all items. */
     BigramPhraseWithCountArray tokens = g_array_new
@@ -1866,11 +2593,6 @@ bool pinyin_guess_predicted_candidates(pinyin_instance_t * instance,
 
     }
 
-    if (system_gram)
-        delete system_gram;
-    if (user_gram)
-        delete user_gram;
-
     /* post process to sort the candidates */
 
     _compute_phrase_length(context, candidates);
@@ -1900,6 +2622,8 @@ int pinyin_choose_candidate(pinyin_instance_t * instance,
     if (BEST_MATCH_CANDIDATE == candidate->m_candidate_type)
         return matrix.size() - 1;
 
+    tables_writer_locker_t locker(context);
+
     if (ADDON_CANDIDATE == candidate->m_candidate_type) {
         PhraseItem item;
         context->m_addon_phrase_index->get_phrase_item
@@ -1925,6 +2649,7 @@ int pinyin_choose_candidate(pinyin_instance_t * instance,
         item.get_phrase_string(phrase);
         context->m_phrase_table->add_index(len, phrase, token);
         context->m_phrase_index->add_phrase_item(token, &item);
+        _invalidate_lookups(context);
 
         /* update the candidate. */
         candidate->m_candidate_type = NORMAL_CANDIDATE;
@@ -1932,16 +2657,16 @@ int pinyin_choose_candidate(pinyin_instance_t * instance,
     }
 
     /* sync m_constraints to the length of m_pinyin_keys. */
-    bool retval = context->m_pinyin_lookup->validate_constraint
+    bool retval = instance->m_pinyin_lookup->validate_constraint
         (&matrix, instance->m_constraints);
 
     phrase_token_t token = candidate->m_token;
-    guint8 len = context->m_pinyin_lookup->add_constraint
+    guint8 len = instance->m_pinyin_lookup->add_constraint
         (instance->m_constraints,
          candidate->m_begin, candidate->m_end, token);
 
     /* safe guard: validate the m_constraints again. */
-    retval = context->m_pinyin_lookup->validate_constraint
+    retval = instance->m_pinyin_lookup->validate_constraint
         (&matrix, instance->m_constraints) && len;
 
     return offset + len;
@@ -1956,6 +2681,9 @@ bool pinyin_choose_predicted_candidate(pinyin_instance_t * instance,
 
     pinyin_context_t * & context = instance->m_context;
     FacadePhraseIndex * & phrase_index = context->m_phrase_index;
+    tables_writer_locker_t locker(context);
+
+    _invalidate_lookups(context);
 
     /* train uni-gram */
     phrase_token_t token = candidate->m_token;
@@ -1969,7 +2697,7 @@ bool pinyin_choose_predicted_candidate(pinyin_instance_t * instance,
         return false;
 
     SingleGram * user_gram = NULL;
-    context->m_user_bigram->load(prev_token, user_gram);
+    context->m_single_gram_cache->load_user(prev_token, user_gram);
 
     if (NULL == user_gram)
         user_gram = new SingleGram;
@@ -1984,7 +2712,7 @@ bool pinyin_choose_predicted_candidate(pinyin_instance_t * instance,
         assert(user_gram->set_freq(token, freq + initial_seed));
     }
     assert(user_gram->set_total_freq(total_freq + initial_seed));
-    context->m_user_bigram->store(prev_token, user_gram);
+    context->m_single_gram_cache->store_user(prev_token, user_gram);
     delete user_gram;
     return true;
 }
@@ -1993,7 +2721,7 @@ bool pinyin_clear_constraint(pinyin_instance_t * instance,
                              size_t offset){
     pinyin_context_t * & context = instance->m_context;
 
-    bool retval = context->m_pinyin_lookup->clear_constraint
+    bool retval = instance->m_pinyin_lookup->clear_constraint
         (instance->m_constraints, offset);
 
     return retval;
@@ -2023,24 +2751,33 @@ bool pinyin_train(pinyin_instance_t * instance){
 
     pinyin_context_t * context = instance->m_context;
     PhoneticKeyMatrix & matrix = instance->m_matrix;
+    tables_writer_locker_t locker(context);
 
     context->m_modified = true;
 
-    bool retval = context->m_pinyin_lookup->train_result2
+    pinyin_update_lookup(instance);
+    bool retval = instance->m_pinyin_lookup->train_result2
         (&matrix, instance->m_constraints,
          instance->m_match_results);
 
+    /* the shared uni-gram and user bi-gram frequencies are changed. */
+    if (retval)
+        _invalidate_lookups(context);
+
     return retval;
 }
 
 bool pinyin_reset(pinyin_instance_t * instance){
     instance->m_parsed_len = 0;
     instance->m_matrix.clear_all();
+    instance->m_parse_state.reset();
+    _reset_full_pinyin_parsed(instance);
 
     g_array_set_size(instance->m_prefixes, 0);
     g_array_set_size(instance->m_constraints, 0);
     g_array_set_size(instance->m_match_results, 0);
     _free_candidates(instance->m_candidates);
+    _free_nbest_results(instance->m_nbest_results);
 
     return true;
 }
@@ -2178,6 +2915,8 @@ bool pinyin_token_add_unigram_frequency(pinyin_instance_t * instance,
                                         phrase_token_t token,
                                         guint delta){
     pinyin_context_t * & context = instance->m_context;
+    tables_writer_locker_t locker(context);
+    _invalidate_lookups(context);
     int retval = context->m_phrase_index->add_unigram_frequency
         (token, delta);
     return ERROR_OK == retval;
@@ -2266,7 +3005,7 @@ bool pinyin_get_pinyin_key(pinyin_instance_t * instance,
     _check_offset(matrix, offset);
     offset = _compute_pinyin_start(matrix, offset);
 
-    static ChewingKey key;
+    ChewingKey & key = instance->m_pinyin_key;
     ChewingKeyRest key_rest;
     matrix.get_item(offset, 0, key, key_rest);
 
@@ -2290,7 +3029,7 @@ bool pinyin_get_pinyin_key_rest(pinyin_instance_t * instance,
     offset = _compute_pinyin_start(matrix, offset);
 
     ChewingKey key;
-    static ChewingKeyRest key_rest;
+    ChewingKeyRest & key_rest = instance->m_pinyin_key_rest;
     matrix.get_item(offset, 0, key, key_rest);
 
     *ppkey_rest = &key_rest;
@@ -2504,7 +3243,15 @@ static bool _get_char_offset_recur(pinyin_instance_t * instance,
             (cached_tokens, phrase_token_t, length);
         phrase_index->get_phrase_item(token, item);
 
-        gfloat pinyin_poss = item.get_pronunciation_possibility(&key);
+        /* the fuzzy pinyins are not filled into the matrix. */
+        ChewingKey fuzzy_keys[MAX_FUZZY_KEYS];
+        const size_t num = compute_fuzzy_keys
+            (context->m_options, key, fuzzy_keys);
+
+        gfloat pinyin_poss = 0.;
+        for (size_t k = 0; k < num; ++k)
+            pinyin_poss += item.get_pronunciation_possibility
+                (fuzzy_keys + k);
         if (pinyin_poss < FLT_EPSILON)
             return false;
 
@@ -2971,19 +3718,35 @@ static bool _remember_phrase_recur(pinyin_instance_t * instance,
             (cached_tokens, phrase_token_t, cached_keys->len);
         phrase_index->get_phrase_item(token, item);
 
-        gfloat pinyin_poss = item.get_pronunciation_possibility(&key);
-        if (pinyin_poss < FLT_EPSILON)
-            return false;
+        /* the fuzzy pinyins are not filled into the matrix,
+           remember the phrase with the matched fuzzy pinyins. */
+        ChewingKey fuzzy_keys[MAX_FUZZY_KEYS];
+        const size_t num = compute_fuzzy_keys
+            (context->m_options, key, fuzzy_keys);
+
+        bool matched = false;
+        for (size_t k = 0; k < num; ++k) {
+            ChewingKey & fuzzy_key = fuzzy_keys[k];
+            gfloat pinyin_poss = item.get_pronunciation_possibility
+                (&fuzzy_key);
+            if (pinyin_poss < FLT_EPSILON)
+                continue;
+
+            matched = true;
 
-        /* push value */
-        g_array_append_val(cached_keys, key);
+            /* push value */
+            g_array_append_val(cached_keys, fuzzy_key);
+
+            result = _remember_phrase_recur
+                (instance, cached_keys, cached_tokens,
+                 newstart, phrase, count) || result;
 
-        result = _remember_phrase_recur
-            (instance, cached_keys, cached_tokens,
-             newstart, phrase, count) || result;
+            /* pop value */
+            g_array_set_size(cached_keys, cached_keys->len - 1);
+        }
 
-        /* pop value */
-        g_array_set_size(cached_keys, cached_keys->len - 1);
+        if (!matched)
+            return false;
     }
 
     return result;
@@ -2997,6 +3760,8 @@ bool pinyin_remember_user_input(pinyin_instance_t * instance,
     if (NULL == phrase)
         return false;
 
+    tables_writer_locker_t locker(context);
+
     glong phrase_length = 0;
     ucs4_t * ucs4_phrase = g_utf8_to_ucs4(phrase, -1, NULL, &phrase_length, NULL);
 
@@ -3021,6 +3786,8 @@ bool pinyin_remember_user_input(pinyin_instance_t * instance,
 
     ChewingKeyVector cached_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
 
+    _invalidate_lookups(context);
+
     bool result = _remember_phrase_recur
         (instance, cached_keys, cached_tokens,
          start, ucs4_phrase, count);
@@ -3050,7 +3817,8 @@ bool pinyin_remove_user_candidate(pinyin_instance_t * instance,
     FacadePhraseIndex * phrase_index = context->m_phrase_index;
     FacadePhraseTable3 * phrase_table = context->m_phrase_table;
     FacadeChewingTable2 * pinyin_table = context->m_pinyin_table;
-    Bigram * user_bigram = context->m_user_bigram;
+    UserBigramBuffer * user_bigram = context->m_user_bigram_buffer;
+    tables_writer_locker_t locker(context);
 
     assert(NORMAL_CANDIDATE == candidate->m_candidate_type);
 
@@ -3058,6 +3826,8 @@ bool pinyin_remove_user_candidate(pinyin_instance_t * instance,
     guint8 index = PHRASE_INDEX_LIBRARY_INDEX(token);
     assert(USER_DICTIONARY == index);
 
+    _invalidate_lookups(context);
+
     /* remove from phrase index */
     PhraseItem * item = NULL;
     int retval = phrase_index->remove_phrase_item(token, item);
@@ -3085,6 +3855,7 @@ bool pinyin_remove_user_candidate(pinyin_instance_t * instance,
     /* remove from user bigram */
     phrase_token_t mask = PHRASE_INDEX_LIBRARY_MASK | PHRASE_MASK;
     user_bigram->mask_out(mask, token);
+    context->m_single_gram_cache->invalidate_all();
 
     return true;
 }
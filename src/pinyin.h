@@ -48,6 +48,46 @@ typedef enum _lookup_candidate_type_t{
     ADDON_CANDIDATE,
 } lookup_candidate_type_t;
 
+/**
+ * pinyin_save_callback_t:
+ * @context: the saved pinyin context.
+ * @success: whether the save succeeded.
+ * @user_data: the user data passed to pinyin_save_async.
+ *
+ * The completion callback of pinyin_save_async, called from the
+ * background save thread.
+ *
+ */
+typedef void (* pinyin_save_callback_t) (pinyin_context_t * context,
+                                         gboolean success,
+                                         gpointer user_data);
+
+/**
+ * Thread Safety:
+ *
+ * The pinyin context holds the shared tables, each pinyin instance owns
+ * its lookups and the other per instance workspaces.
+ *
+ * The instances of one context can be used from different threads at
+ * the same time, one thread for one instance, when only the read-only
+ * functions are called, such as pinyin_parse_*, pinyin_guess_*,
+ * pinyin_phrase_segment, pinyin_get_* and pinyin_lookup_tokens.
+ *
+ * The functions which change the shared tables or options, such as
+ * pinyin_train, pinyin_choose_candidate, pinyin_remember_user_input,
+ * pinyin_token_add_unigram_frequency, pinyin_remove_user_candidate,
+ * pinyin_mask_out, pinyin_set_options, pinyin_set_*_scheme and the
+ * phrase library functions, must not run concurrently with any other
+ * call on the same context, the caller should serialize them.
+ *
+ * pinyin_save and pinyin_save_async only read the shared tables, they
+ * can run with the read-only functions, and should be serialized with
+ * the functions above. The copy of pinyin_save_async is taken on the
+ * background thread, the functions which change the shared tables wait
+ * for the copy, the read-only functions do not.
+ *
+ */
+
 /**
  * pinyin_init:
  * @systemdir: the system wide language model data directory.
@@ -201,6 +241,26 @@ void pinyin_end_get_phrases(export_iterator_t * iter);
  */
 bool pinyin_save(pinyin_context_t * context);
 
+/**
+ * pinyin_save_async:
+ * @context: the pinyin context to be saved into user directory.
+ * @callback: the completion callback, or NULL.
+ * @user_data: the user data passed to the callback.
+ * @returns: whether the save is scheduled.
+ *
+ * Schedule the save of the user's self-learning information, the
+ * background thread copies the pinyin context and writes the copy into
+ * user directory, the lookups and trainings can continue meanwhile.
+ *
+ * The save requests before the copy is taken are coalesced, only the
+ * newest copy is written, and all their callbacks are called with the
+ * result. pinyin_fini waits for the pending save.
+ *
+ */
+bool pinyin_save_async(pinyin_context_t * context,
+                       pinyin_save_callback_t callback,
+                       gpointer user_data);
+
 /**
  * pinyin_set_full_pinyin_scheme:
  * @context: the pinyin context.
@@ -274,12 +334,29 @@ bool pinyin_mask_out(pinyin_context_t * context,
 bool pinyin_set_options(pinyin_context_t * context,
                         pinyin_option_t options);
 
+/**
+ * pinyin_set_beam_options:
+ * @context: the pinyin context.
+ * @width: the maximum number of nodes expanded from each step.
+ * @margin: the log possibility margin relative to the best node of each step, zero to disable.
+ * @adaptive_length: shrink the beam width to width * L / (L + i) at the step i, zero to disable.
+ * @returns: whether the set beam options succeeded.
+ *
+ * Set the default beam pruning options of the pinyin context.
+ *
+ */
+bool pinyin_set_beam_options(pinyin_context_t * context,
+                             guint width,
+                             gfloat margin,
+                             guint adaptive_length);
+
 /**
  * pinyin_alloc_instance:
  * @context: the pinyin context.
  * @returns: the newly allocated pinyin instance, NULL if failed.
  *
- * Allocate a new pinyin instance from the context.
+ * Allocate a new pinyin instance from the context, the instance owns
+ * its lookups, please free all instances before pinyin_fini.
  *
  */
 pinyin_instance_t * pinyin_alloc_instance(pinyin_context_t * context);
@@ -303,6 +380,40 @@ void pinyin_free_instance(pinyin_instance_t * instance);
  */
 pinyin_context_t * pinyin_get_context (pinyin_instance_t * instance);
 
+/**
+ * pinyin_set_instance_beam_options:
+ * @instance: the pinyin instance.
+ * @width: the maximum number of nodes expanded from each step, zero to use the options of the pinyin context.
+ * @margin: the log possibility margin relative to the best node of each step, zero to disable.
+ * @adaptive_length: shrink the beam width to width * L / (L + i) at the step i, zero to disable.
+ * @returns: whether the set beam options succeeded.
+ *
+ * Set the beam pruning options of the pinyin instance.
+ *
+ */
+bool pinyin_set_instance_beam_options(pinyin_instance_t * instance,
+                                      guint width,
+                                      gfloat margin,
+                                      guint adaptive_length);
+
+/**
+ * pinyin_get_beam_statistics:
+ * @instance: the pinyin instance.
+ * @candidates: the number of the nodes considered for expansion.
+ * @pruned_by_width: the number of the nodes pruned by the beam width.
+ * @pruned_by_margin: the number of the nodes pruned by the margin.
+ * @pruned_by_history: the number of the tri-gram nodes pruned by the history limit.
+ * @returns: whether the get operation succeeded.
+ *
+ * Get the beam pruning statistics accumulated in the pinyin instance.
+ *
+ */
+bool pinyin_get_beam_statistics(pinyin_instance_t * instance,
+                                guint * candidates,
+                                guint * pruned_by_width,
+                                guint * pruned_by_margin,
+                                guint * pruned_by_history);
+
 /**
  * pinyin_guess_sentence:
  * @instance: the pinyin instance.
@@ -325,6 +436,45 @@ bool pinyin_guess_sentence(pinyin_instance_t * instance);
 bool pinyin_guess_sentence_with_prefix(pinyin_instance_t * instance,
                                        const char * prefix);
 
+/**
+ * pinyin_guess_sentences_nbest:
+ * @instance: the pinyin instance.
+ * @nbest: the maximum number of the sentences.
+ * @returns: whether the sentences are guessed successfully.
+ *
+ * Guess the n-best sentences from the saved pinyin keys in the instance,
+ * the best sentence is also saved as the guessed sentence.
+ *
+ * Note: the sentences which only differ in the segmentation are merged,
+ *   so less than nbest sentences may be guessed.
+ *
+ */
+bool pinyin_guess_sentences_nbest(pinyin_instance_t * instance,
+                                  guint nbest);
+
+/**
+ * pinyin_convert_batch:
+ * @context: the pinyin context.
+ * @inputs: the full pinyin strings to be converted.
+ * @num: the number of the full pinyin strings.
+ * @results: the converted utf-8 sentences, in the order of the inputs.
+ * @nthreads: the number of the worker threads, zero to use all processors.
+ * @returns: whether all the full pinyin strings are converted successfully.
+ *
+ * Convert the full pinyin strings to the guessed sentences with the
+ * worker threads, each worker thread reuses one pinyin instance.
+ *
+ * Note: the results array should contain num elements, each sentence
+ *   should be freed by g_free(), NULL if the conversion failed.
+ *   Please don't change the context during the conversion.
+ *
+ */
+bool pinyin_convert_batch(pinyin_context_t * context,
+                          const char ** inputs,
+                          size_t num,
+                          char ** results,
+                          guint nthreads);
+
 /**
  * pinyin_guess_predicted_candidates:
  * @instance: the pinyin instance.
@@ -349,6 +499,34 @@ bool pinyin_guess_predicted_candidates(pinyin_instance_t * instance,
 bool pinyin_phrase_segment(pinyin_instance_t * instance,
                            const char * sentence);
 
+/**
+ * pinyin_get_n_sentence:
+ * @instance: the pinyin instance.
+ * @num: the number of the n-best sentences.
+ * @returns: whether the get operation is successful.
+ *
+ * Get the number of the n-best sentences.
+ *
+ */
+bool pinyin_get_n_sentence(pinyin_instance_t * instance,
+                           guint * num);
+
+/**
+ * pinyin_get_nth_sentence:
+ * @instance: the pinyin instance.
+ * @index: the index of the n-best sentences.
+ * @sentence: the n-best sentence.
+ * @returns: whether the get operation is successful.
+ *
+ * Get the nth sentence of the n-best sentences.
+ *
+ * Note: the returned sentence should be freed by g_free().
+ *
+ */
+bool pinyin_get_nth_sentence(pinyin_instance_t * instance,
+                             guint index,
+                             char ** sentence);
+
 /**
  * pinyin_get_sentence:
  * @instance: the pinyin instance.
@@ -385,6 +563,9 @@ bool pinyin_parse_full_pinyin(pinyin_instance_t * instance,
  *
  * Parse multiple full pinyins and save it in the instance.
  *
+ * Note: the pinyins are parsed incrementally when only the tail
+ *   is changed since the last call, see pinyin_get_changed_column.
+ *
  */
 size_t pinyin_parse_more_full_pinyins(pinyin_instance_t * instance,
                                       const char * pinyins);
@@ -451,6 +632,17 @@ size_t pinyin_parse_more_chewings(pinyin_instance_t * instance,
  */
 size_t pinyin_get_parsed_input_length(pinyin_instance_t * instance);
 
+/**
+ * pinyin_get_changed_column:
+ * @instance: the pinyin instance.
+ * @returns: the first changed column of the last parse.
+ *
+ * Get the first offset of the input whose parsed keys are changed by
+ * the last parse, the keys before the offset are kept.
+ *
+ */
+size_t pinyin_get_changed_column(pinyin_instance_t * instance);
+
 
 /**
  * pinyin_in_chewing_keyboard:
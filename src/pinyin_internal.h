@@ -31,14 +31,20 @@
 #include "pinyin_parser2.h"
 #include "zhuyin_parser2.h"
 #include "phonetic_key_matrix.h"
+#include "matrix_search_cache.h"
 #include "pinyin_phrase3.h"
 #include "chewing_large_table2.h"
+#include "chewing_mmap_table2.h"
 #include "phrase_large_table3.h"
 #include "facade_chewing_table2.h"
 #include "facade_phrase_table3.h"
 #include "phrase_index.h"
 #include "phrase_index_logger.h"
 #include "ngram.h"
+#include "ngram_compact.h"
+#include "user_bigram_buffer.h"
+#include "user_manifest.h"
+#include "single_gram_cache.h"
 #include "lookup.h"
 #include "pinyin_lookup2.h"
 #include "phrase_lookup.h"
@@ -54,7 +60,9 @@
 #define SYSTEM_TABLE_INFO "table.conf"
 #define USER_TABLE_INFO "user.conf"
 #define SYSTEM_BIGRAM "bigram.db"
+#define SYSTEM_COMPACT_BIGRAM "bigram.bin"
 #define USER_BIGRAM "user_bigram.db"
+#define SYSTEM_TRIGRAM "trigram.db"
 #define DELETED_BIGRAM "deleted_bigram.db"
 #define SYSTEM_PINYIN_INDEX "pinyin_index.bin"
 #define USER_PINYIN_INDEX "user_pinyin_index.bin"
@@ -24,6 +24,7 @@
 
 #include <assert.h>
 #include <db.h>
+#include "memory_chunk.h"
 
 namespace pinyin{
 
@@ -70,5 +71,81 @@ inline bool copy_bdb(DB * srcdb, DB * destdb) {
     return true;
 }
 
+/* the record of the dumped DB, the key and data follow the sizes. */
+struct db_record_header_t{
+    guint32 m_key_size;
+    guint32 m_data_size;
+};
+
+inline bool dump_bdb(DB * srcdb, MemoryChunk * chunk) {
+    int ret = 0;
+
+    DBC * cursorp = NULL;
+    DBT key, data;
+    /* Get a cursor */
+    srcdb->cursor(srcdb, NULL, &cursorp, 0);
+
+    if (NULL == cursorp)
+        return false;
+
+    /* Initialize our DBTs. */
+    memset(&key, 0, sizeof(DBT));
+    memset(&data, 0, sizeof(DBT));
+
+    chunk->set_size(0);
+
+    /* Iterate over the database, retrieving each record in turn. */
+    while ((ret = cursorp->c_get(cursorp, &key, &data, DB_NEXT)) == 0) {
+        db_record_header_t header;
+        header.m_key_size = key.size;
+        header.m_data_size = data.size;
+
+        chunk->append_content(&header, sizeof(header));
+        chunk->append_content(key.data, key.size);
+        chunk->append_content(data.data, data.size);
+    }
+    assert(DB_NOTFOUND == ret);
+
+    /* Cursors must be closed */
+    if ( cursorp != NULL )
+        cursorp->c_close(cursorp);
+
+    return true;
+}
+
+inline bool restore_bdb(const MemoryChunk * chunk, DB * destdb) {
+    const char * cur = (const char *) chunk->begin();
+    const char * end = (const char *) chunk->end();
+
+    DBT key, data;
+
+    while (cur < end) {
+        db_record_header_t header;
+        if (end - cur < (ssize_t) sizeof(header))
+            return false;
+        memcpy(&header, cur, sizeof(header));
+        cur += sizeof(header);
+
+        if ((size_t) (end - cur) <
+            (size_t) header.m_key_size + header.m_data_size)
+            return false;
+
+        memset(&key, 0, sizeof(DBT));
+        key.data = (void *) cur;
+        key.size = header.m_key_size;
+        cur += header.m_key_size;
+
+        memset(&data, 0, sizeof(DBT));
+        data.data = (void *) cur;
+        data.size = header.m_data_size;
+        cur += header.m_data_size;
+
+        int ret = destdb->put(destdb, NULL, &key, &data, 0);
+        assert(0 == ret);
+    }
+
+    return true;
+}
+
 };
 #endif
@@ -108,6 +108,60 @@ void ChewingLargeTable2::fini_entries() {
     m_entries = NULL;
 }
 
+/* add the index items of one record back under the chewing index. */
+template<int phrase_length>
+static int add_index_items_internal(ChewingLargeTable2 * table,
+                                    const void * data, size_t size) {
+    typedef PinyinIndexItem2<phrase_length> IndexItem;
+
+    const IndexItem * begin = (const IndexItem *) data;
+    const IndexItem * end = (const IndexItem *) ((const char *) data + size);
+
+    for (const IndexItem * iter = begin; iter != end; ++iter) {
+        /* the items are in both the chewing index and
+           the in-complete chewing index. */
+        int result = table->add_index
+            (phrase_length, iter->m_keys, iter->m_token);
+        if (ERROR_OK != result && ERROR_INSERT_ITEM_EXISTS != result)
+            return result;
+    }
+
+    return ERROR_OK;
+}
+
+int ChewingLargeTable2::add_index_items(int phrase_length,
+                                        const void * data, size_t size) {
+#define CASE(len) case len:                                     \
+    {                                                           \
+        return add_index_items_internal<len>(this, data, size); \
+    }
+
+    switch(phrase_length) {
+        CASE(1);
+        CASE(2);
+        CASE(3);
+        CASE(4);
+        CASE(5);
+        CASE(6);
+        CASE(7);
+        CASE(8);
+        CASE(9);
+        CASE(10);
+        CASE(11);
+        CASE(12);
+        CASE(13);
+        CASE(14);
+        CASE(15);
+        CASE(16);
+    default:
+        assert(false);
+    }
+
+#undef CASE
+
+    return ERROR_FILE_CORRUPTION;
+}
+
 /* load text method */
 bool ChewingLargeTable2::load_text(FILE * infile) {
     char pinyin[256];
@@ -155,19 +209,14 @@ bool ChewingLargeTable2::load_text(FILE * infile) {
 /* search method */
 int ChewingLargeTable2::search(int phrase_length,
                                /* in */ const ChewingKey keys[],
-                               /* out */ PhraseIndexRanges ranges) const {
+                               /* out */ PhraseIndexRanges ranges,
+                               /* in */ pinyin_option_t options) const {
     ChewingKey index[MAX_PHRASE_LENGTH];
     assert(NULL != m_db);
 
-    if (contains_incomplete_pinyin(keys, phrase_length)) {
-        compute_incomplete_chewing_index(keys, index, phrase_length);
-        return search_internal(phrase_length, index, keys, ranges);
-    } else {
-        compute_chewing_index(keys, index, phrase_length);
-        return search_internal(phrase_length, index, keys, ranges);
-    }
-
-    return SEARCH_NONE;
+    options = compute_search_chewing_index
+        (options, keys, index, phrase_length);
+    return search_internal(phrase_length, index, keys, ranges, options);
 }
 
 /* add/remove index method */
@@ -179,7 +228,7 @@ int ChewingLargeTable2::add_index(int phrase_length,
     int result = ERROR_OK;
 
     /* for in-complete chewing index */
-    compute_incomplete_chewing_index(keys, index, phrase_length);
+    compute_fuzzy_chewing_index(keys, index, phrase_length);
     result = add_index_internal(phrase_length, index, keys, token);
     assert(ERROR_OK == result || ERROR_INSERT_ITEM_EXISTS == result);
     if (ERROR_OK != result)
@@ -200,7 +249,7 @@ int ChewingLargeTable2::remove_index(int phrase_length,
     int result = ERROR_OK;
 
     /* for in-complete chewing index */
-    compute_incomplete_chewing_index(keys, index, phrase_length);
+    compute_fuzzy_chewing_index(keys, index, phrase_length);
     result = remove_index_internal(phrase_length, index, keys, token);
     assert(ERROR_OK == result || ERROR_REMOVE_ITEM_DONOT_EXISTS == result);
     if (ERROR_OK != result)
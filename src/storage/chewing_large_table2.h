@@ -43,6 +43,7 @@ class MaskOutVisitor2;
 template<int phrase_length>
 class ChewingTableEntry{
     friend class ChewingLargeTable2;
+    friend class ChewingMmapTable2;
     friend class MaskOutVisitor2;
 protected:
     typedef PinyinIndexItem2<phrase_length> IndexItem;
@@ -59,7 +60,8 @@ public:
     /* compress consecutive tokens */
     int convert(const ChewingKey keys[],
      const IndexItem * begin, const IndexItem * end,
-     PhraseIndexRanges ranges) const {
+     PhraseIndexRanges ranges,
+     const ChewingFuzzyKeys * fuzzy_keys = NULL) const {
         const IndexItem * iter = NULL;
         PhraseIndexRange cursor;
         GArray * head, * cursor_head = NULL;
@@ -68,9 +70,15 @@ public:
         /* TODO: check the below code */
         cursor.m_range_begin = null_token; cursor.m_range_end = null_token;
         for (iter = begin; iter != end; ++iter) {
-            if (0 != pinyin_compare_with_tones
-                (keys, iter->m_keys, phrase_length))
-                continue;
+            if (fuzzy_keys) {
+                if (!pinyin_match_fuzzy_keys
+                    (fuzzy_keys, iter->m_keys, phrase_length))
+                    continue;
+            } else {
+                if (0 != pinyin_compare_with_tones
+                    (keys, iter->m_keys, phrase_length))
+                    continue;
+            }
 
             phrase_token_t token = iter->m_token;
             head = ranges[PHRASE_INDEX_LIBRARY_INDEX(token)];
@@ -103,7 +111,17 @@ public:
 
     /* search method */
     int search(/* in */ const ChewingKey keys[],
-               /* out */ PhraseIndexRanges ranges) const {
+               /* out */ PhraseIndexRanges ranges,
+               /* in */ pinyin_option_t options = 0) const {
+        const IndexItem * begin = (IndexItem *) m_chunk.begin();
+        const IndexItem * end = (IndexItem *) m_chunk.end();
+
+        /* the fuzzy pinyins are in the same entry of the fuzzy chewing
+           index, but not consecutive, check all items of the entry. */
+        ChewingFuzzyKeys fuzzy_keys[phrase_length];
+        if (compute_fuzzy_keys(options, keys, fuzzy_keys, phrase_length))
+            return convert(keys, begin, end, ranges, fuzzy_keys);
+
         IndexItem item;
         if (contains_incomplete_pinyin(keys, phrase_length)) {
             compute_incomplete_chewing_index(keys, item.m_keys, phrase_length);
@@ -111,9 +129,6 @@ public:
             compute_chewing_index(keys, item.m_keys, phrase_length);
         }
 
-        const IndexItem * begin = (IndexItem *) m_chunk.begin();
-        const IndexItem * end = (IndexItem *) m_chunk.end();
-
         std_lite::pair<const IndexItem *, const IndexItem *> range =
             std_lite::equal_range(begin, end, item,
                                   phrase_less_than_with_tones<phrase_length>);
@@ -22,6 +22,7 @@
 #include "chewing_large_table2.h"
 #include <errno.h>
 #include "bdb_utils.h"
+#include "chewing_mmap_table2.h"
 
 namespace pinyin{
 
@@ -35,6 +36,8 @@ ChewingLargeTable2::ChewingLargeTable2() {
                      DB_BTREE, DB_CREATE, 0600);
     assert(0 == ret);
 
+    g_mutex_init(&m_mutex);
+
     m_entries = NULL;
     init_entries();
 }
@@ -137,16 +140,88 @@ bool ChewingLargeTable2::store_db(const char * new_filename) {
     return true;
 }
 
+bool ChewingLargeTable2::copy_db(ChewingLargeTable2 * new_table) {
+    new_table->reset();
+    new_table->init_entries();
+
+    /* create in-memory db. */
+    int ret = db_create(&new_table->m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = new_table->m_db->open(new_table->m_db, NULL, NULL, NULL,
+                                DB_BTREE, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return copy_bdb(m_db, new_table->m_db);
+}
+
+bool ChewingLargeTable2::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    init_entries();
+
+    /* create in-memory db. */
+    int ret = db_create(&m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = m_db->open(m_db, NULL, NULL, NULL,
+                     DB_BTREE, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return restore_bdb(chunk, m_db);
+}
+
+bool ChewingLargeTable2::store_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    return dump_bdb(m_db, new_chunk);
+}
+
+bool ChewingLargeTable2::store_mmap(const char * new_filename) {
+    DBC * cursorp = NULL;
+    DBT db_key, db_data;
+
+    /* Get a cursor */
+    m_db->cursor(m_db, NULL, &cursorp, 0);
+
+    if (NULL == cursorp)
+        return false;
+
+    /* Initialize our DBTs. */
+    memset(&db_key, 0, sizeof(DBT));
+    memset(&db_data, 0, sizeof(DBT));
+
+    ChewingMmapTable2 table;
+
+    /* Iterate over the database, retrieving each record in turn. */
+    int ret = 0;
+    while((ret = cursorp->c_get(cursorp, &db_key, &db_data, DB_NEXT)) == 0) {
+        int phrase_length = db_key.size / sizeof(ChewingKey);
+
+        table.add_entry(phrase_length, (const ChewingKey *) db_key.data,
+                        db_data.data, db_data.size);
+    }
+    assert(ret == DB_NOTFOUND);
+
+    /* Cursors must be closed */
+    if (cursorp != NULL)
+        cursorp->c_close(cursorp);
+
+    return table.store(new_filename);
+}
+
 template<int phrase_length>
 int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
                                         /* in */ const ChewingKey keys[],
-                                        /* out */ PhraseIndexRanges ranges) const {
+                                        /* out */ PhraseIndexRanges ranges,
+                                        /* in */ pinyin_option_t options) const {
     int result = SEARCH_NONE;
 
-    ChewingTableEntry<phrase_length> * entry =
-        (ChewingTableEntry<phrase_length> *)
-        g_ptr_array_index(m_entries, phrase_length);
-    assert(NULL != entry);
+    /* use the local entry, the search is reentrant. */
+    ChewingTableEntry<phrase_length> entry;
 
     DBT db_key;
     memset(&db_key, 0, sizeof(DBT));
@@ -155,16 +230,22 @@ int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
 
     DBT db_data;
     memset(&db_data, 0, sizeof(DBT));
+
+    /* the returned data is owned by the DB handle. */
+    g_mutex_lock(&m_mutex);
     int ret = m_db->get(m_db, NULL, &db_key, &db_data, 0);
-    if (ret != 0)
+    if (ret != 0) {
+        g_mutex_unlock(&m_mutex);
         return result;
+    }
 
     /* continue searching. */
     result |= SEARCH_CONTINUED;
 
-    entry->m_chunk.set_chunk(db_data.data, db_data.size, NULL);
+    entry.m_chunk.set_chunk(db_data.data, db_data.size, NULL);
 
-    result = entry->search(keys, ranges) | result;
+    result = entry.search(keys, ranges, options) | result;
+    g_mutex_unlock(&m_mutex);
 
     return result;
 }
@@ -172,10 +253,12 @@ int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
 int ChewingLargeTable2::search_internal(int phrase_length,
                                         /* in */ const ChewingKey index[],
                                         /* in */ const ChewingKey keys[],
-                                        /* out */ PhraseIndexRanges ranges) const {
+                                        /* out */ PhraseIndexRanges ranges,
+                                        /* in */ pinyin_option_t options) const {
 #define CASE(len) case len:                                     \
     {                                                           \
-        return search_internal<len>(index, keys, ranges);       \
+        return search_internal<len>                             \
+            (index, keys, ranges, options);                     \
     }
 
     switch(phrase_length) {
@@ -461,4 +544,46 @@ bool ChewingLargeTable2::mask_out(phrase_token_t mask,
     return true;
 }
 
+/* rebuild method */
+bool ChewingLargeTable2::rebuild_index() {
+    /* copy the records, then add the items back. */
+    ChewingLargeTable2 old_table;
+    if (!copy_db(&old_table))
+        return false;
+
+    u_int32_t count = 0;
+    int ret = m_db->truncate(m_db, NULL, &count, 0);
+    if (ret != 0)
+        return false;
+
+    DBC * cursorp = NULL;
+    DBT db_key, db_data;
+
+    /* Get a cursor */
+    old_table.m_db->cursor(old_table.m_db, NULL, &cursorp, 0);
+
+    if (NULL == cursorp)
+        return false;
+
+    /* Initialize our DBTs. */
+    memset(&db_key, 0, sizeof(DBT));
+    memset(&db_data, 0, sizeof(DBT));
+
+    /* Iterate over the database, retrieving each record in turn. */
+    while((ret = cursorp->c_get(cursorp, &db_key, &db_data, DB_NEXT)) == 0) {
+        int phrase_length = db_key.size / sizeof(ChewingKey);
+
+        add_index_items(phrase_length, db_data.data, db_data.size);
+    }
+    assert(ret == DB_NOTFOUND);
+
+    /* Cursors must be closed */
+    if (cursorp != NULL)
+        cursorp->c_close(cursorp);
+
+    m_db->sync(m_db, 0);
+
+    return true;
+}
+
 };
@@ -23,6 +23,7 @@
 #include <kchashdb.h>
 #include <kcprotodb.h>
 #include "kyotodb_utils.h"
+#include "chewing_mmap_table2.h"
 
 using namespace kyotocabinet;
 
@@ -110,16 +111,87 @@ bool ChewingLargeTable2::store_db(const char * new_filename) {
     return true;
 }
 
+bool ChewingLargeTable2::copy_db(ChewingLargeTable2 * new_table) {
+    new_table->reset();
+    new_table->init_entries();
+
+    /* create in-memory db. */
+    new_table->m_db = new ProtoTreeDB;
+
+    if (!new_table->m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    CopyVisitor visitor(new_table->m_db);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
+bool ChewingLargeTable2::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    init_entries();
+
+    /* create in-memory db. */
+    m_db = new ProtoTreeDB;
+
+    if (!m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    return restore_kyotodb(chunk, m_db);
+}
+
+bool ChewingLargeTable2::store_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    new_chunk->set_size(0);
+
+    DumpVisitor visitor(new_chunk);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
+class StoreMmapVisitor2 : public DB::Visitor {
+    ChewingMmapTable2 * m_table;
+public:
+    StoreMmapVisitor2(ChewingMmapTable2 * table) {
+        m_table = table;
+    }
+
+    virtual const char* visit_full(const char* kbuf, size_t ksiz,
+                                   const char* vbuf, size_t vsiz, size_t* sp) {
+        int phrase_length = ksiz / sizeof(ChewingKey);
+
+        m_table->add_entry(phrase_length, (const ChewingKey *) kbuf,
+                           vbuf, vsiz);
+        return NOP;
+    }
+
+    virtual const char* visit_empty(const char* kbuf, size_t ksiz, size_t* sp) {
+        return NOP;
+    }
+};
+
+bool ChewingLargeTable2::store_mmap(const char * new_filename) {
+    ChewingMmapTable2 table;
+
+    StoreMmapVisitor2 visitor(&table);
+    m_db->iterate(&visitor, false);
+
+    return table.store(new_filename);
+}
+
 template<int phrase_length>
 int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
                                         /* in */ const ChewingKey keys[],
-                                        /* out */ PhraseIndexRanges ranges) const {
+                                        /* out */ PhraseIndexRanges ranges,
+                                        /* in */ pinyin_option_t options) const {
     int result = SEARCH_NONE;
 
-    ChewingTableEntry<phrase_length> * entry =
-        (ChewingTableEntry<phrase_length> *)
-        g_ptr_array_index(m_entries, phrase_length);
-    assert(NULL != entry);
+    /* use the local entry, the search is reentrant. */
+    ChewingTableEntry<phrase_length> entry;
 
     const char * kbuf = (char *) index;
     const int32_t vsiz = m_db->check(kbuf, phrase_length * sizeof(ChewingKey));
@@ -132,13 +204,13 @@ int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
     if (0 == vsiz)
         return result;
 
-    entry->m_chunk.set_size(vsiz);
+    entry.m_chunk.set_size(vsiz);
     /* m_chunk may re-allocate here. */
-    char * vbuf = (char *) entry->m_chunk.begin();
+    char * vbuf = (char *) entry.m_chunk.begin();
     assert(vsiz == m_db->get(kbuf, phrase_length * sizeof(ChewingKey),
                              vbuf, vsiz));
 
-    result = entry->search(keys, ranges) | result;
+    result = entry.search(keys, ranges, options) | result;
 
     return result;
 }
@@ -146,10 +218,12 @@ int ChewingLargeTable2::search_internal(/* in */ const ChewingKey index[],
 int ChewingLargeTable2::search_internal(int phrase_length,
                                         /* in */ const ChewingKey index[],
                                         /* in */ const ChewingKey keys[],
-                                        /* out */ PhraseIndexRanges ranges) const {
+                                        /* out */ PhraseIndexRanges ranges,
+                                        /* in */ pinyin_option_t options) const {
 #define CASE(len) case len:                                 \
     {                                                       \
-        return search_internal<len>(index, keys, ranges);   \
+        return search_internal<len>                         \
+            (index, keys, ranges, options);                 \
     }
 
     switch(phrase_length) {
@@ -424,4 +498,41 @@ bool ChewingLargeTable2::mask_out(phrase_token_t mask,
     return true;
 }
 
+class RebuildIndexVisitor2 : public DB::Visitor {
+    ChewingLargeTable2 * m_table;
+public:
+    RebuildIndexVisitor2(ChewingLargeTable2 * table) {
+        m_table = table;
+    }
+
+    virtual const char* visit_full(const char* kbuf, size_t ksiz,
+                                   const char* vbuf, size_t vsiz, size_t* sp) {
+        int phrase_length = ksiz / sizeof(ChewingKey);
+
+        m_table->add_index_items(phrase_length, vbuf, vsiz);
+        return NOP;
+    }
+
+    virtual const char* visit_empty(const char* kbuf, size_t ksiz, size_t* sp) {
+        return NOP;
+    }
+};
+
+/* rebuild method */
+bool ChewingLargeTable2::rebuild_index() {
+    /* copy the records, then add the items back. */
+    ChewingLargeTable2 old_table;
+    if (!copy_db(&old_table))
+        return false;
+
+    if (!m_db->clear())
+        return false;
+
+    RebuildIndexVisitor2 visitor(this);
+    old_table.m_db->iterate(&visitor, false);
+
+    m_db->synchronize();
+    return true;
+}
+
 };
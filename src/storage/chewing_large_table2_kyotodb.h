@@ -32,7 +32,10 @@ namespace pinyin{
 template<int phrase_length>
 class ChewingTableEntry;
 
+class RebuildIndexVisitor2;
+
 class ChewingLargeTable2{
+    friend class RebuildIndexVisitor2;
 private:
     /* member variables. */
     kyotocabinet::BasicDB * m_db;
@@ -51,12 +54,14 @@ protected:
     template<int phrase_length>
     int search_internal(/* in */ const ChewingKey index[],
                         /* in */ const ChewingKey keys[],
-                        /* out */ PhraseIndexRanges ranges) const;
+                        /* out */ PhraseIndexRanges ranges,
+                        /* in */ pinyin_option_t options) const;
 
     int search_internal(int phrase_length,
                         /* in */ const ChewingKey index[],
                         /* in */ const ChewingKey keys[],
-                        /* out */ PhraseIndexRanges ranges) const;
+                        /* out */ PhraseIndexRanges ranges,
+                        /* in */ pinyin_option_t options) const;
 
     template<int phrase_length>
     int add_index_internal(/* in */ const ChewingKey index[],
@@ -78,6 +83,9 @@ protected:
                               /* in */ const ChewingKey keys[],
                               /* in */ phrase_token_t token);
 
+    /* add the index items of one record, see rebuild_index. */
+    int add_index_items(int phrase_length, const void * data, size_t size);
+
 public:
     ChewingLargeTable2();
 
@@ -94,11 +102,23 @@ public:
 
     bool store_db(const char * new_filename);
 
+    /* copy the table into the in-memory DBM of the new table. */
+    bool copy_db(ChewingLargeTable2 * new_table);
+
+    /* load/store the records of the in-memory DBM from/into the chunk. */
+    bool load_chunk(const MemoryChunk * chunk);
+
+    bool store_chunk(MemoryChunk * new_chunk);
+
+    /* store the chewing table in the native format of ChewingMmapTable2. */
+    bool store_mmap(const char * new_filename);
+
     bool load_text(FILE * infile);
 
     /* search method */
     int search(int phrase_length, /* in */ const ChewingKey keys[],
-               /* out */ PhraseIndexRanges ranges) const;
+               /* out */ PhraseIndexRanges ranges,
+               /* in */ pinyin_option_t options = 0) const;
 
     /* add/remove index method */
     int add_index(int phrase_length, /* in */ const ChewingKey keys[],
@@ -109,6 +129,11 @@ public:
 
     /* mask out method */
     bool mask_out(phrase_token_t mask, phrase_token_t value);
+
+    /* rebuild method */
+    /* add the index items back under the current chewing index,
+       used to upgrade the user tables of the old revision. */
+    bool rebuild_index();
 };
 
 };
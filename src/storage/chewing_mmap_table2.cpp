@@ -0,0 +1,442 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <errno.h>
+#include "chewing_mmap_table2.h"
+#include "pinyin_phrase3.h"
+#include "stl_lite.h"
+
+namespace pinyin{
+
+template<int phrase_length>
+static bool mmap_dir_less_than(const ChewingMmapDirItem<phrase_length> & lhs,
+                               const ChewingMmapDirItem<phrase_length> & rhs) {
+    return 0 > pinyin_exact_compare2(lhs.m_index, rhs.m_index,
+                                     phrase_length);
+}
+
+template<int phrase_length>
+static gint compare_mmap_dir_item(gconstpointer lhs, gconstpointer rhs) {
+    const ChewingMmapDirItem<phrase_length> * lhs_item =
+        (const ChewingMmapDirItem<phrase_length> *) lhs;
+    const ChewingMmapDirItem<phrase_length> * rhs_item =
+        (const ChewingMmapDirItem<phrase_length> *) rhs;
+
+    return pinyin_exact_compare2(lhs_item->m_index, rhs_item->m_index,
+                                 phrase_length);
+}
+
+ChewingMmapTable2::ChewingMmapTable2() {
+    m_chunk = NULL;
+
+    m_new_directories = g_ptr_array_new();
+    /* NULL for the first pointer. */
+    g_ptr_array_set_size(m_new_directories, MAX_PHRASE_LENGTH + 1);
+
+#define CASE(len) case len:                                             \
+    {                                                                   \
+        GArray * directory = g_array_new                                \
+            (FALSE, FALSE, sizeof(ChewingMmapDirItem<len>));            \
+        g_ptr_array_index(m_new_directories, len) = directory;          \
+        break;                                                          \
+    }
+
+    for (size_t i = 1; i < m_new_directories->len; ++i) {
+        switch(i) {
+            CASE(1);
+            CASE(2);
+            CASE(3);
+            CASE(4);
+            CASE(5);
+            CASE(6);
+            CASE(7);
+            CASE(8);
+            CASE(9);
+            CASE(10);
+            CASE(11);
+            CASE(12);
+            CASE(13);
+            CASE(14);
+            CASE(15);
+            CASE(16);
+        default:
+            assert(false);
+        }
+    }
+
+#undef CASE
+}
+
+ChewingMmapTable2::~ChewingMmapTable2() {
+    reset();
+
+    for (size_t i = 1; i < m_new_directories->len; ++i) {
+        GArray * directory = (GArray *)
+            g_ptr_array_index(m_new_directories, i);
+        g_array_free(directory, TRUE);
+    }
+
+    g_ptr_array_free(m_new_directories, TRUE);
+    m_new_directories = NULL;
+}
+
+void ChewingMmapTable2::reset() {
+    for (size_t i = 0; i <= MAX_PHRASE_LENGTH; ++i)
+        m_directories[i].set_chunk(NULL, 0, NULL);
+
+    if (m_chunk) {
+        delete m_chunk;
+        m_chunk = NULL;
+    }
+}
+
+bool ChewingMmapTable2::load(const char * filename) {
+    reset();
+
+    MemoryChunk * chunk = new MemoryChunk;
+
+#ifdef LIBPINYIN_USE_MMAP
+    if (!chunk->mmap(filename)) {
+        delete chunk;
+        return false;
+    }
+#else
+    if (!chunk->load(filename)) {
+        delete chunk;
+        return false;
+    }
+#endif
+
+    const size_t size = chunk->size();
+    if (size < sizeof(chewing_mmap_header_t)) {
+        delete chunk;
+        return false;
+    }
+
+    const chewing_mmap_header_t * header =
+        (const chewing_mmap_header_t *) chunk->begin();
+
+    if (CHEWING_MMAP_TABLE_MAGIC != header->m_magic ||
+        CHEWING_MMAP_TABLE_VERSION != header->m_version) {
+        delete chunk;
+        return false;
+    }
+
+    for (size_t i = 1; i <= MAX_PHRASE_LENGTH; ++i) {
+        const table_offset_t begin = header->m_begins[i];
+        const table_offset_t end = header->m_ends[i];
+
+        if (begin > end || end > size) {
+            delete chunk;
+            return false;
+        }
+    }
+
+    m_chunk = chunk;
+
+    /* the views of the directories, without copying. */
+    char * buf_begin = (char *) m_chunk->begin();
+    for (size_t i = 1; i <= MAX_PHRASE_LENGTH; ++i) {
+        const table_offset_t begin = header->m_begins[i];
+        const table_offset_t end = header->m_ends[i];
+
+        m_directories[i].set_chunk(buf_begin + begin, end - begin, NULL);
+    }
+
+    return true;
+}
+
+template<int phrase_length>
+bool ChewingMmapTable2::add_entry_internal(/* in */ const ChewingKey index[],
+                                           /* in */ table_offset_t offset,
+                                           /* in */ guint32 size) {
+    GArray * directory = (GArray *)
+        g_ptr_array_index(m_new_directories, phrase_length);
+
+    ChewingMmapDirItem<phrase_length> item;
+    memcpy(item.m_index, index, phrase_length * sizeof(ChewingKey));
+    item.m_offset = offset;
+    item.m_size = size;
+
+    g_array_append_val(directory, item);
+    return true;
+}
+
+bool ChewingMmapTable2::add_entry(int phrase_length,
+                                  /* in */ const ChewingKey index[],
+                                  /* in */ const void * data,
+                                  /* in */ size_t size) {
+    /* the values are kept aligned in the file. */
+    const table_offset_t offset = m_new_content.size();
+    assert(0 == offset % sizeof(guint32));
+    m_new_content.set_content(offset, data, size);
+
+    guint32 padding = 0;
+    const size_t npadding = (sizeof(guint32) - size % sizeof(guint32))
+        % sizeof(guint32);
+    if (npadding)
+        m_new_content.append_content(&padding, npadding);
+
+#define CASE(len) case len:                                     \
+    {                                                           \
+        return add_entry_internal<len>(index, offset, size);    \
+    }
+
+    switch(phrase_length) {
+        CASE(1);
+        CASE(2);
+        CASE(3);
+        CASE(4);
+        CASE(5);
+        CASE(6);
+        CASE(7);
+        CASE(8);
+        CASE(9);
+        CASE(10);
+        CASE(11);
+        CASE(12);
+        CASE(13);
+        CASE(14);
+        CASE(15);
+        CASE(16);
+    default:
+        assert(false);
+    }
+
+#undef CASE
+
+    return false;
+}
+
+template<int phrase_length>
+size_t ChewingMmapTable2::get_directory_size() const {
+    GArray * directory = (GArray *)
+        g_ptr_array_index(m_new_directories, phrase_length);
+
+    return directory->len * sizeof(ChewingMmapDirItem<phrase_length>);
+}
+
+template<int phrase_length>
+bool ChewingMmapTable2::store_directory(/* in */ MemoryChunk * new_chunk,
+                                        /* in */ table_offset_t content_offset,
+                                        /* inout */ table_offset_t & offset) {
+    typedef ChewingMmapDirItem<phrase_length> DirItem;
+
+    GArray * directory = (GArray *)
+        g_ptr_array_index(m_new_directories, phrase_length);
+
+    g_array_sort(directory, compare_mmap_dir_item<phrase_length>);
+
+    for (size_t i = 0; i < directory->len; ++i) {
+        DirItem item = g_array_index(directory, DirItem, i);
+        /* the key is unique in the DB. */
+        if (i > 0)
+            assert(0 != compare_mmap_dir_item<phrase_length>
+                   (&g_array_index(directory, DirItem, i - 1), &item));
+
+        item.m_offset += content_offset;
+        new_chunk->set_content(offset, &item, sizeof(DirItem));
+        offset += sizeof(DirItem);
+    }
+
+    return true;
+}
+
+bool ChewingMmapTable2::store(const char * new_filename) {
+    MemoryChunk new_chunk;
+
+    chewing_mmap_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.m_magic = CHEWING_MMAP_TABLE_MAGIC;
+    header.m_version = CHEWING_MMAP_TABLE_VERSION;
+
+    /* compute the offsets of the directories, then the values. */
+    table_offset_t offset = sizeof(chewing_mmap_header_t);
+
+#define CASE(len) case len:                                             \
+    {                                                                   \
+        header.m_begins[len] = offset;                                  \
+        offset += get_directory_size<len>();                            \
+        header.m_ends[len] = offset;                                    \
+        break;                                                          \
+    }
+
+    for (size_t i = 1; i <= MAX_PHRASE_LENGTH; ++i) {
+        switch(i) {
+            CASE(1);
+            CASE(2);
+            CASE(3);
+            CASE(4);
+            CASE(5);
+            CASE(6);
+            CASE(7);
+            CASE(8);
+            CASE(9);
+            CASE(10);
+            CASE(11);
+            CASE(12);
+            CASE(13);
+            CASE(14);
+            CASE(15);
+            CASE(16);
+        default:
+            assert(false);
+        }
+    }
+
+#undef CASE
+
+    const table_offset_t content_offset = offset;
+    assert(0 == content_offset % sizeof(guint32));
+
+    new_chunk.set_content(0, &header, sizeof(header));
+
+#define CASE(len) case len:                                             \
+    {                                                                   \
+        offset = header.m_begins[len];                                  \
+        store_directory<len>(&new_chunk, content_offset, offset);       \
+        assert(offset == header.m_ends[len]);                           \
+        break;                                                          \
+    }
+
+    for (size_t i = 1; i <= MAX_PHRASE_LENGTH; ++i) {
+        switch(i) {
+            CASE(1);
+            CASE(2);
+            CASE(3);
+            CASE(4);
+            CASE(5);
+            CASE(6);
+            CASE(7);
+            CASE(8);
+            CASE(9);
+            CASE(10);
+            CASE(11);
+            CASE(12);
+            CASE(13);
+            CASE(14);
+            CASE(15);
+            CASE(16);
+        default:
+            assert(false);
+        }
+    }
+
+#undef CASE
+
+    new_chunk.set_content(content_offset, m_new_content.begin(),
+                          m_new_content.size());
+
+    int ret = unlink(new_filename);
+    if (ret != 0 && errno != ENOENT)
+        return false;
+
+    return new_chunk.save(new_filename);
+}
+
+template<int phrase_length>
+int ChewingMmapTable2::search_internal(/* in */ const ChewingKey index[],
+                                       /* in */ const ChewingKey keys[],
+                                       /* out */ PhraseIndexRanges ranges,
+                                       /* in */ pinyin_option_t options) const {
+    typedef ChewingMmapDirItem<phrase_length> DirItem;
+
+    int result = SEARCH_NONE;
+
+    const MemoryChunk & directory = m_directories[phrase_length];
+    const DirItem * begin = (const DirItem *) directory.begin();
+    const DirItem * end = (const DirItem *) directory.end();
+
+    DirItem item;
+    memcpy(item.m_index, index, phrase_length * sizeof(ChewingKey));
+
+    const DirItem * iter = std_lite::lower_bound
+        (begin, end, item, mmap_dir_less_than<phrase_length>);
+    if (iter == end ||
+        0 != pinyin_exact_compare2(iter->m_index, index, phrase_length))
+        return result;
+
+    /* continue searching. */
+    result |= SEARCH_CONTINUED;
+
+    assert(iter->m_offset + iter->m_size <= m_chunk->size());
+
+    /* use the local entry as the view of the value, the search is
+       reentrant. */
+    ChewingTableEntry<phrase_length> entry;
+    char * buf_begin = (char *) m_chunk->begin();
+    entry.m_chunk.set_chunk(buf_begin + iter->m_offset, iter->m_size, NULL);
+
+    result = entry.search(keys, ranges, options) | result;
+
+    return result;
+}
+
+int ChewingMmapTable2::search_internal(int phrase_length,
+                                       /* in */ const ChewingKey index[],
+                                       /* in */ const ChewingKey keys[],
+                                       /* out */ PhraseIndexRanges ranges,
+                                       /* in */ pinyin_option_t options) const {
+#define CASE(len) case len:                                     \
+    {                                                           \
+        return search_internal<len>                             \
+            (index, keys, ranges, options);                     \
+    }
+
+    switch(phrase_length) {
+        CASE(1);
+        CASE(2);
+        CASE(3);
+        CASE(4);
+        CASE(5);
+        CASE(6);
+        CASE(7);
+        CASE(8);
+        CASE(9);
+        CASE(10);
+        CASE(11);
+        CASE(12);
+        CASE(13);
+        CASE(14);
+        CASE(15);
+        CASE(16);
+    default:
+        assert(false);
+    }
+
+#undef CASE
+
+    return SEARCH_NONE;
+}
+
+int ChewingMmapTable2::search(int phrase_length,
+                              /* in */ const ChewingKey keys[],
+                              /* out */ PhraseIndexRanges ranges,
+                              /* in */ pinyin_option_t options) const {
+    ChewingKey index[MAX_PHRASE_LENGTH];
+    assert(NULL != m_chunk);
+
+    options = compute_search_chewing_index
+        (options, keys, index, phrase_length);
+    return search_internal(phrase_length, index, keys, ranges, options);
+}
+
+};
@@ -0,0 +1,195 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef CHEWING_MMAP_TABLE2_H
+#define CHEWING_MMAP_TABLE2_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "memory_chunk.h"
+#include "chewing_key.h"
+#include "chewing_large_table2.h"
+
+namespace pinyin{
+
+/* "CMT2" in little endian. */
+#define CHEWING_MMAP_TABLE_MAGIC 0x32544D43
+#define CHEWING_MMAP_TABLE_VERSION 1
+
+/**
+ * chewing_mmap_header_t:
+ *
+ * The file header of the memory mapped chewing table.
+ *
+ * Note:
+ *   The directory of the phrase length is [m_begins[len], m_ends[len])
+ *   in the file, an array of ChewingMmapDirItem sorted by the index.
+ *   The values are the same PinyinIndexItem2 arrays as the DB values.
+ *
+ */
+struct chewing_mmap_header_t{
+    guint32 m_magic;
+    guint32 m_version;
+    table_offset_t m_begins[MAX_PHRASE_LENGTH + 1];
+    table_offset_t m_ends[MAX_PHRASE_LENGTH + 1];
+};
+
+/**
+ * ChewingMmapDirItem:
+ *
+ * The directory item of the chewing index, points to the value
+ * in the same file.
+ *
+ */
+template<int phrase_length>
+struct ChewingMmapDirItem{
+    ChewingKey m_index[phrase_length];
+    table_offset_t m_offset;
+    guint32 m_size;
+};
+
+/**
+ * ChewingMmapTable2:
+ *
+ * The read-only system chewing table in the native format,
+ * generated by gen_binary_files and memory mapped when loading.
+ *
+ * Note:
+ *   The search runs on the views of the mapped file without copying,
+ *   and is reentrant without any lock.
+ *   The directories and values are collected by add_entry,
+ *   then written by store, only used when generating the file.
+ *
+ */
+class ChewingMmapTable2{
+protected:
+    /* the mapped file. */
+    MemoryChunk * m_chunk;
+
+    /* the directories of the mapped file, index by phrase length. */
+    MemoryChunk m_directories[MAX_PHRASE_LENGTH + 1];
+
+    /* the directories and values for store,
+       Array of ChewingMmapDirItem, index by phrase length. */
+    GPtrArray * m_new_directories;
+    MemoryChunk m_new_content;
+
+    void reset();
+
+protected:
+    template<int phrase_length>
+    int search_internal(/* in */ const ChewingKey index[],
+                        /* in */ const ChewingKey keys[],
+                        /* out */ PhraseIndexRanges ranges,
+                        /* in */ pinyin_option_t options) const;
+
+    int search_internal(int phrase_length,
+                        /* in */ const ChewingKey index[],
+                        /* in */ const ChewingKey keys[],
+                        /* out */ PhraseIndexRanges ranges,
+                        /* in */ pinyin_option_t options) const;
+
+    template<int phrase_length>
+    bool add_entry_internal(/* in */ const ChewingKey index[],
+                            /* in */ table_offset_t offset,
+                            /* in */ guint32 size);
+
+    template<int phrase_length>
+    size_t get_directory_size() const;
+
+    template<int phrase_length>
+    bool store_directory(/* in */ MemoryChunk * new_chunk,
+                         /* in */ table_offset_t content_offset,
+                         /* inout */ table_offset_t & offset);
+
+public:
+    /**
+     * ChewingMmapTable2::ChewingMmapTable2:
+     *
+     * The constructor of the ChewingMmapTable2.
+     *
+     */
+    ChewingMmapTable2();
+
+    /**
+     * ChewingMmapTable2::~ChewingMmapTable2:
+     *
+     * The destructor of the ChewingMmapTable2.
+     *
+     */
+    ~ChewingMmapTable2();
+
+    /**
+     * ChewingMmapTable2::load:
+     * @filename: the file name of the chewing table.
+     * @returns: whether the load operation is successful.
+     *
+     * Map the chewing table from the file, fails when the file is not
+     * in the native format, such as the chewing table in DB format.
+     *
+     */
+    bool load(const char * filename);
+
+    /**
+     * ChewingMmapTable2::add_entry:
+     * @phrase_length: the length of the phrase.
+     * @index: the chewing index of the entry.
+     * @data: the PinyinIndexItem2 array of the entry.
+     * @size: the size of the data.
+     * @returns: whether the add operation is successful.
+     *
+     * Add the entry of the chewing table for store.
+     *
+     */
+    bool add_entry(int phrase_length, /* in */ const ChewingKey index[],
+                   /* in */ const void * data, /* in */ size_t size);
+
+    /**
+     * ChewingMmapTable2::store:
+     * @new_filename: the file name to store the chewing table.
+     * @returns: whether the store operation is successful.
+     *
+     * Sort the directories of the added entries, and write them with
+     * the values into the file.
+     *
+     */
+    bool store(const char * new_filename);
+
+    /**
+     * ChewingMmapTable2::search:
+     * @phrase_length: the length of the phrase to be searched.
+     * @keys: the pinyin key of the phrase to be searched.
+     * @ranges: the array of GArrays to store the matched phrase token.
+     * @options: the fuzzy pinyin options to be matched.
+     * @returns: the search result of enum SearchResult.
+     *
+     * Search the phrase tokens according to the pinyin keys,
+     * the same as ChewingLargeTable2::search.
+     *
+     */
+    int search(int phrase_length, /* in */ const ChewingKey keys[],
+               /* out */ PhraseIndexRanges ranges,
+               /* in */ pinyin_option_t options = 0) const;
+};
+
+};
+
+#endif
@@ -24,6 +24,7 @@
 
 #include "novel_types.h"
 #include "chewing_large_table2.h"
+#include "chewing_mmap_table2.h"
 
 namespace pinyin{
 
@@ -36,10 +37,17 @@ namespace pinyin{
 
 class FacadeChewingTable2{
 private:
+    /* the system chewing table in the native format. */
+    ChewingMmapTable2 * m_mmap_chewing_table;
     ChewingLargeTable2 * m_system_chewing_table;
     ChewingLargeTable2 * m_user_chewing_table;
 
     void reset() {
+        if (m_mmap_chewing_table) {
+            delete m_mmap_chewing_table;
+            m_mmap_chewing_table = NULL;
+        }
+
         if (m_system_chewing_table) {
             delete m_system_chewing_table;
             m_system_chewing_table = NULL;
@@ -59,6 +67,7 @@ public:
      *
      */
     FacadeChewingTable2() {
+        m_mmap_chewing_table = NULL;
         m_system_chewing_table = NULL;
         m_user_chewing_table = NULL;
     }
@@ -73,15 +82,34 @@ public:
         reset();
     }
 
+    /**
+     * FacadeChewingTable2::load:
+     * @system_filename: the file name of the system chewing table.
+     * @user_filename: the file name of the user chewing table.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the system or user chewing table from the files,
+     * the system chewing table is mapped when it is in the native format,
+     * otherwise it is attached as the DB.
+     *
+     */
     bool load(const char * system_filename,
               const char * user_filename) {
         reset();
 
         bool result = false;
         if (system_filename) {
-            m_system_chewing_table = new ChewingLargeTable2;
-            result = m_system_chewing_table->attach
-                (system_filename, ATTACH_READONLY) || result;
+            m_mmap_chewing_table = new ChewingMmapTable2;
+            if (m_mmap_chewing_table->load(system_filename)) {
+                result = true;
+            } else {
+                delete m_mmap_chewing_table;
+                m_mmap_chewing_table = NULL;
+
+                m_system_chewing_table = new ChewingLargeTable2;
+                result = m_system_chewing_table->attach
+                    (system_filename, ATTACH_READONLY) || result;
+            }
         }
         if (user_filename) {
             m_user_chewing_table = new ChewingLargeTable2;
@@ -97,18 +125,64 @@ public:
         return m_user_chewing_table->store_db(new_user_filename);
     }
 
+    /**
+     * FacadeChewingTable2::load_user_chunk:
+     * @chunk: the dumped records of the user table.
+     * @returns: whether the load operation is successful.
+     *
+     * Replace the user table with the records of the chunk.
+     *
+     */
+    bool load_user_chunk(const MemoryChunk * chunk) {
+        if (m_user_chewing_table)
+            delete m_user_chewing_table;
+        m_user_chewing_table = new ChewingLargeTable2;
+        return m_user_chewing_table->load_chunk(chunk);
+    }
+
+    /**
+     * FacadeChewingTable2::copy_user_db:
+     * @new_table: the table to store the copied user table.
+     * @returns: whether the copy operation is successful.
+     *
+     * Copy the user table into the in-memory DBM of the new table.
+     *
+     */
+    bool copy_user_db(ChewingLargeTable2 * new_table) {
+        if (NULL == m_user_chewing_table)
+            return false;
+        return m_user_chewing_table->copy_db(new_table);
+    }
+
+    /**
+     * FacadeChewingTable2::rebuild_user_index:
+     * @returns: whether the rebuild operation is successful.
+     *
+     * Add the items of the user table back under the current chewing
+     * index, used to upgrade the user table of the old revision.
+     *
+     */
+    bool rebuild_user_index() {
+        if (NULL == m_user_chewing_table)
+            return false;
+        return m_user_chewing_table->rebuild_index();
+    }
+
     /**
      * FacadeChewingTable2::search:
      * @phrase_length: the length of the phrase to be searched.
      * @keys: the pinyin key of the phrase to be searched.
      * @ranges: the array of GArrays to store the matched phrase token.
+     * @options: the fuzzy pinyin options to be matched.
      * @returns: the search result of enum SearchResult.
      *
-     * Search the phrase tokens according to the pinyin keys.
+     * Search the phrase tokens according to the pinyin keys,
+     * the fuzzy pinyins of the keys are matched in the same search.
      *
      */
     int search(int phrase_length, /* in */ const ChewingKey keys[],
-               /* out */ PhraseIndexRanges ranges) const {
+               /* out */ PhraseIndexRanges ranges,
+               /* in */ pinyin_option_t options = 0) const {
 #if 0
         /* clear ranges. */
         for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
@@ -118,13 +192,17 @@ public:
 #endif
         int result = SEARCH_NONE;
 
+        if (NULL != m_mmap_chewing_table)
+            result |= m_mmap_chewing_table->search
+                (phrase_length, keys, ranges, options);
+
         if (NULL != m_system_chewing_table)
             result |= m_system_chewing_table->search
-                (phrase_length, keys, ranges);
+                (phrase_length, keys, ranges, options);
 
         if (NULL != m_user_chewing_table)
             result |= m_user_chewing_table->search
-                (phrase_length, keys, ranges);
+                (phrase_length, keys, ranges, options);
 
         return result;
     }
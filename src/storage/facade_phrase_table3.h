@@ -96,6 +96,35 @@ public:
         return m_user_phrase_table->store_db(new_user_filename);
     }
 
+    /**
+     * FacadePhraseTable3::load_user_chunk:
+     * @chunk: the dumped records of the user table.
+     * @returns: whether the load operation is successful.
+     *
+     * Replace the user table with the records of the chunk.
+     *
+     */
+    bool load_user_chunk(const MemoryChunk * chunk) {
+        if (m_user_phrase_table)
+            delete m_user_phrase_table;
+        m_user_phrase_table = new PhraseLargeTable3;
+        return m_user_phrase_table->load_chunk(chunk);
+    }
+
+    /**
+     * FacadePhraseTable3::copy_user_db:
+     * @new_table: the table to store the copied user table.
+     * @returns: whether the copy operation is successful.
+     *
+     * Copy the user table into the in-memory DBM of the new table.
+     *
+     */
+    bool copy_user_db(PhraseLargeTable3 * new_table) {
+        if (NULL == m_user_phrase_table)
+            return false;
+        return m_user_phrase_table->copy_db(new_table);
+    }
+
     /**
      * FacadePhraseTable3::search:
      * @phrase_length: the length of the phrase to be searched.
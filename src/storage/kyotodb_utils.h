@@ -25,6 +25,7 @@
 #include <assert.h>
 #include <kchashdb.h>
 #include <kcprotodb.h>
+#include "memory_chunk.h"
 
 using namespace kyotocabinet;
 
@@ -70,6 +71,66 @@ public:
     }
 };
 
+/* the record of the dumped DB, the key and value follow the sizes. */
+struct db_record_header_t{
+    guint32 m_key_size;
+    guint32 m_data_size;
+};
+
+class DumpVisitor : public DB::Visitor {
+private:
+    MemoryChunk * m_chunk;
+public:
+    DumpVisitor(MemoryChunk * chunk) {
+        m_chunk = chunk;
+    }
+
+    virtual const char* visit_full(const char* kbuf, size_t ksiz,
+                                   const char* vbuf, size_t vsiz, size_t* sp) {
+        db_record_header_t header;
+        header.m_key_size = ksiz;
+        header.m_data_size = vsiz;
+
+        m_chunk->append_content(&header, sizeof(header));
+        m_chunk->append_content(kbuf, ksiz);
+        m_chunk->append_content(vbuf, vsiz);
+        return NOP;
+    }
+
+    virtual const char* visit_empty(const char* kbuf, size_t ksiz, size_t* sp) {
+        return NOP;
+    }
+};
+
+inline bool restore_kyotodb(const MemoryChunk * chunk, BasicDB * db) {
+    const char * cur = (const char *) chunk->begin();
+    const char * end = (const char *) chunk->end();
+
+    while (cur < end) {
+        db_record_header_t header;
+        if (end - cur < (ssize_t) sizeof(header))
+            return false;
+        memcpy(&header, cur, sizeof(header));
+        cur += sizeof(header);
+
+        if ((size_t) (end - cur) <
+            (size_t) header.m_key_size + header.m_data_size)
+            return false;
+
+        const char * kbuf = cur;
+        cur += header.m_key_size;
+        const char * vbuf = cur;
+        cur += header.m_data_size;
+
+        if (0 == header.m_data_size)
+            vbuf = empty_vbuf;
+
+        db->set(kbuf, header.m_key_size, vbuf, header.m_data_size);
+    }
+
+    return true;
+}
+
 };
 
 #endif
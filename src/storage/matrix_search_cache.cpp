@@ -0,0 +1,595 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "matrix_search_cache.h"
+#include "pinyin_phrase3.h"
+#include "stl_lite.h"
+
+using namespace pinyin;
+
+MatrixSnapshot::MatrixSnapshot(){
+    m_keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    m_key_rests = g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
+    m_offsets = g_array_new(FALSE, FALSE, sizeof(guint32));
+
+    guint32 offset = 0;
+    g_array_append_val(m_offsets, offset);
+}
+
+MatrixSnapshot::~MatrixSnapshot(){
+    g_array_free(m_keys, TRUE);
+    m_keys = NULL;
+    g_array_free(m_key_rests, TRUE);
+    m_key_rests = NULL;
+    g_array_free(m_offsets, TRUE);
+    m_offsets = NULL;
+}
+
+size_t MatrixSnapshot::compute_changed_column(PhoneticKeyMatrix * matrix){
+    const size_t ncolumn = std_lite::min
+        (matrix->size(), (size_t) m_offsets->len - 1);
+
+    for (size_t i = 0; i < ncolumn; ++i) {
+        const guint32 begin = g_array_index(m_offsets, guint32, i);
+        const guint32 end = g_array_index(m_offsets, guint32, i + 1);
+
+        const ChewingKey * keys = NULL;
+        const ChewingKeyRest * key_rests = NULL;
+        size_t size = 0;
+        matrix->get_column(i, keys, key_rests, size);
+        if (size != end - begin)
+            return i;
+
+        for (size_t row = 0; row < size; ++row) {
+            const ChewingKey & key = keys[row];
+            const ChewingKeyRest & key_rest = key_rests[row];
+
+            const ChewingKey & last_key = g_array_index
+                (m_keys, ChewingKey, begin + row);
+            const ChewingKeyRest & last_key_rest = g_array_index
+                (m_key_rests, ChewingKeyRest, begin + row);
+
+            if (key != last_key ||
+                key_rest.m_raw_begin != last_key_rest.m_raw_begin ||
+                key_rest.m_raw_end != last_key_rest.m_raw_end)
+                return i;
+        }
+    }
+
+    return ncolumn;
+}
+
+bool MatrixSnapshot::update(PhoneticKeyMatrix * matrix, size_t & column){
+    column = compute_changed_column(matrix);
+
+    const size_t ncolumn = matrix->size();
+    if (column == ncolumn && column == m_offsets->len - 1)
+        return false;
+
+    /* only copy the changed matrix columns. */
+    assert(column < m_offsets->len);
+    g_array_set_size(m_offsets, column + 1);
+    const guint32 offset = g_array_index(m_offsets, guint32, column);
+    g_array_set_size(m_keys, offset);
+    g_array_set_size(m_key_rests, offset);
+
+    for (size_t i = column; i < ncolumn; ++i) {
+        const ChewingKey * keys = NULL;
+        const ChewingKeyRest * key_rests = NULL;
+        size_t size = 0;
+        matrix->get_column(i, keys, key_rests, size);
+
+        g_array_append_vals(m_keys, keys, size);
+        g_array_append_vals(m_key_rests, key_rests, size);
+
+        guint32 end = m_keys->len;
+        g_array_append_val(m_offsets, end);
+    }
+
+    return true;
+}
+
+void MatrixSnapshot::clear(){
+    g_array_set_size(m_keys, 0);
+    g_array_set_size(m_key_rests, 0);
+
+    g_array_set_size(m_offsets, 0);
+    guint32 offset = 0;
+    g_array_append_val(m_offsets, offset);
+}
+
+MatrixSearchCache::MatrixSearchCache(FacadeChewingTable2 * table){
+    m_table = table;
+    m_options = 0;
+
+    m_spans = g_ptr_array_new();
+}
+
+MatrixSearchCache::~MatrixSearchCache(){
+    for (size_t i = 0; i < m_spans->len; ++i) {
+        GArray * entries = (GArray *) g_ptr_array_index(m_spans, i);
+
+        for (size_t k = 0; k < entries->len; ++k) {
+            matrix_search_entry_t * entry = &g_array_index
+                (entries, matrix_search_entry_t, k);
+            if (entry->m_ranges)
+                g_array_free(entry->m_ranges, TRUE);
+        }
+
+        g_array_free(entries, TRUE);
+    }
+    g_ptr_array_free(m_spans, TRUE);
+    m_spans = NULL;
+}
+
+bool MatrixSearchCache::invalidate(size_t column){
+    for (size_t start = 0; start < m_spans->len; ++start) {
+        GArray * entries = (GArray *) g_ptr_array_index(m_spans, start);
+
+        /* the span [start, end] reads the columns from start to end. */
+        const size_t first = start < column ? column - start : 0;
+        for (size_t k = first; k < entries->len; ++k) {
+            matrix_search_entry_t * entry = &g_array_index
+                (entries, matrix_search_entry_t, k);
+            entry->m_valid = false;
+        }
+    }
+
+    return true;
+}
+
+bool MatrixSearchCache::invalidate_all(){
+    return invalidate(0);
+}
+
+bool MatrixSearchCache::set_options(pinyin_option_t options){
+    options &= PINYIN_AMB_ALL;
+    if (options == m_options)
+        return false;
+
+    m_options = options;
+    return invalidate_all();
+}
+
+int MatrixSearchCache::search(PhoneticKeyMatrix * matrix,
+                              size_t start, size_t end,
+                              PhraseIndexRanges ranges){
+    assert(start <= end && end < matrix->size());
+
+    /* the spans are allocated on demand, and kept for the reuse. */
+    for (size_t i = m_spans->len; i <= start; ++i) {
+        GArray * entries = g_array_new
+            (FALSE, TRUE, sizeof(matrix_search_entry_t));
+        g_ptr_array_add(m_spans, entries);
+    }
+
+    GArray * entries = (GArray *) g_ptr_array_index(m_spans, start);
+    const size_t index = end - start;
+    if (index >= entries->len)
+        g_array_set_size(entries, index + 1);
+
+    matrix_search_entry_t * entry = &g_array_index
+        (entries, matrix_search_entry_t, index);
+
+    if (entry->m_valid) {
+        /* the token contains the index of the sub phrase index. */
+        for (size_t i = 0; i < entry->m_ranges->len; ++i) {
+            const PhraseIndexRange & range = g_array_index
+                (entry->m_ranges, PhraseIndexRange, i);
+
+            GArray * array = ranges[PHRASE_INDEX_LIBRARY_INDEX
+                                    (range.m_range_begin)];
+            if (array)
+                g_array_append_val(array, range);
+        }
+
+        return entry->m_result;
+    }
+
+    /* remember the lengths to only save the new ranges. */
+    guint lengths[PHRASE_INDEX_LIBRARY_COUNT];
+    for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i)
+        lengths[i] = ranges[i] ? ranges[i]->len : 0;
+
+    int result = search_matrix(m_options, m_table, matrix,
+                               start, end, ranges);
+
+    if (NULL == entry->m_ranges)
+        entry->m_ranges = g_array_new
+            (FALSE, FALSE, sizeof(PhraseIndexRange));
+    g_array_set_size(entry->m_ranges, 0);
+
+    for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
+        GArray * array = ranges[i];
+        if (NULL == array)
+            continue;
+
+        g_array_append_vals(entry->m_ranges,
+                            &g_array_index(array, PhraseIndexRange,
+                                           lengths[i]),
+                            array->len - lengths[i]);
+    }
+
+    entry->m_result = result;
+    entry->m_valid = true;
+    return result;
+}
+
+static inline bool _is_incomplete_key(const ChewingKey & key) {
+    return CHEWING_ZERO_MIDDLE == key.m_middle &&
+        CHEWING_ZERO_FINAL == key.m_final;
+}
+
+static guint32 _compute_pattern(const ChewingKey * keys, size_t length) {
+    guint32 pattern = 0;
+    for (size_t i = 0; i < length; ++i) {
+        if (_is_incomplete_key(keys[i]))
+            pattern |= 1U << (i * 2);
+        if (CHEWING_ZERO_TONE == keys[i].m_tone)
+            pattern |= 1U << (i * 2 + 1);
+    }
+    return pattern;
+}
+
+/* mask the keys with the incomplete pinyin and zero tone of the pattern,
+   then pinyin_exact_compare2 works as pinyin_compare_with_tones. */
+static void _apply_pattern(ChewingKey * keys, size_t length,
+                           guint32 pattern) {
+    for (size_t i = 0; i < length; ++i) {
+        if (pattern & (1U << (i * 2))) {
+            keys[i].m_middle = CHEWING_ZERO_MIDDLE;
+            keys[i].m_final = CHEWING_ZERO_FINAL;
+        }
+        if (pattern & (1U << (i * 2 + 1)))
+            keys[i].m_tone = CHEWING_ZERO_TONE;
+    }
+}
+
+static gint compare_matrix_path(gconstpointer lhs, gconstpointer rhs) {
+    const matrix_path_t * lhs_path = (const matrix_path_t *) lhs;
+    const matrix_path_t * rhs_path = (const matrix_path_t *) rhs;
+
+    if (lhs_path->m_length != rhs_path->m_length)
+        return lhs_path->m_length - rhs_path->m_length;
+
+    if (lhs_path->m_pattern != rhs_path->m_pattern)
+        return lhs_path->m_pattern < rhs_path->m_pattern ? -1 : 1;
+
+    return pinyin_exact_compare2(lhs_path->m_keys, rhs_path->m_keys,
+                                 lhs_path->m_length);
+}
+
+static bool matrix_path_less_than(const matrix_path_t & lhs,
+                                  const matrix_path_t & rhs) {
+    return compare_matrix_path(&lhs, &rhs) < 0;
+}
+
+static void _collect_paths(pinyin_option_t options,
+                           PhoneticKeyMatrix * matrix,
+                           size_t start, size_t end,
+                           GArray * cached_keys, GArray * paths) {
+    if (start > end)
+        return;
+
+    /* exceed the maximum phrase length.  */
+    if (cached_keys->len > MAX_PHRASE_LENGTH)
+        return;
+
+    /* only collect the paths with 'start' and 'end'. */
+    if (start == end) {
+        if (0 == cached_keys->len)
+            return;
+
+        matrix_path_t path;
+        memset(&path, 0, sizeof(path));
+        memcpy(path.m_keys, cached_keys->data,
+               cached_keys->len * sizeof(ChewingKey));
+        path.m_length = cached_keys->len;
+        path.m_pattern = _compute_pattern(path.m_keys, path.m_length);
+        path.m_count = 1;
+        g_array_append_val(paths, path);
+        return;
+    }
+
+    const size_t size = matrix->get_column_size(start);
+    /* assume pinyin parsers will filter invalid keys. */
+    assert(size > 0);
+
+    for (size_t i = 0; i < size; ++i) {
+        ChewingKey key; ChewingKeyRest key_rest;
+        matrix->get_item(start, i, key, key_rest);
+
+        const size_t newstart = key_rest.m_raw_end;
+
+        const ChewingKey zero_key;
+        if (zero_key == key) {
+            /* assume only one key here for "'" or the last key. */
+            assert(1 == size);
+            _collect_paths(options, matrix, newstart, end,
+                           cached_keys, paths);
+            return;
+        }
+
+        /* the fuzzy pinyins are not filled into the matrix. */
+        ChewingKey fuzzy_keys[MAX_FUZZY_KEYS];
+        const size_t num = compute_fuzzy_keys(options, key, fuzzy_keys);
+
+        for (size_t k = 0; k < num; ++k) {
+            /* push value */
+            g_array_append_val(cached_keys, fuzzy_keys[k]);
+
+            _collect_paths(options, matrix, newstart, end,
+                           cached_keys, paths);
+
+            /* pop value */
+            g_array_set_size(cached_keys, cached_keys->len - 1);
+        }
+    }
+}
+
+MatrixPronunciationCache::MatrixPronunciationCache(){
+    m_options = 0;
+    m_spans = g_ptr_array_new();
+    m_cached_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+}
+
+MatrixPronunciationCache::~MatrixPronunciationCache(){
+    for (size_t i = 0; i < m_spans->len; ++i) {
+        GArray * entries = (GArray *) g_ptr_array_index(m_spans, i);
+
+        for (size_t k = 0; k < entries->len; ++k) {
+            matrix_path_entry_t * entry = &g_array_index
+                (entries, matrix_path_entry_t, k);
+            if (entry->m_paths)
+                g_array_free(entry->m_paths, TRUE);
+            if (entry->m_groups)
+                g_array_free(entry->m_groups, TRUE);
+        }
+
+        g_array_free(entries, TRUE);
+    }
+    g_ptr_array_free(m_spans, TRUE);
+    m_spans = NULL;
+
+    g_array_free(m_cached_keys, TRUE);
+    m_cached_keys = NULL;
+}
+
+bool MatrixPronunciationCache::invalidate(size_t column){
+    for (size_t start = 0; start < m_spans->len; ++start) {
+        GArray * entries = (GArray *) g_ptr_array_index(m_spans, start);
+
+        /* the span [start, end] reads the columns from start to end. */
+        const size_t first = start < column ? column - start : 0;
+        for (size_t k = first; k < entries->len; ++k) {
+            matrix_path_entry_t * entry = &g_array_index
+                (entries, matrix_path_entry_t, k);
+            entry->m_valid = false;
+        }
+    }
+
+    return true;
+}
+
+bool MatrixPronunciationCache::set_options(pinyin_option_t options){
+    options &= PINYIN_AMB_ALL;
+    if (options == m_options)
+        return false;
+
+    m_options = options;
+    return invalidate(0);
+}
+
+bool MatrixPronunciationCache::enumerate_paths(PhoneticKeyMatrix * matrix,
+                                               size_t start, size_t end,
+                                               matrix_path_entry_t * entry){
+    GArray * paths = entry->m_paths;
+    GArray * groups = entry->m_groups;
+
+    g_array_set_size(paths, 0);
+    g_array_set_size(groups, 0);
+
+    g_array_set_size(m_cached_keys, 0);
+    _collect_paths(m_options, matrix, start, end, m_cached_keys, paths);
+
+    if (0 == paths->len)
+        return true;
+
+    g_array_sort(paths, compare_matrix_path);
+
+    /* merge the same key sequences from the different paths. */
+    size_t last = 0;
+    for (size_t i = 1; i < paths->len; ++i) {
+        matrix_path_t * path = &g_array_index(paths, matrix_path_t, i);
+        matrix_path_t * last_path = &g_array_index
+            (paths, matrix_path_t, last);
+
+        if (0 == compare_matrix_path(last_path, path)) {
+            last_path->m_count += path->m_count;
+            continue;
+        }
+
+        ++last;
+        if (last != i)
+            g_array_index(paths, matrix_path_t, last) = *path;
+    }
+    g_array_set_size(paths, last + 1);
+
+    /* group the key sequences by length and pattern. */
+    for (size_t i = 0; i < paths->len; ++i) {
+        const matrix_path_t & path = g_array_index(paths, matrix_path_t, i);
+
+        if (groups->len) {
+            matrix_path_group_t * group = &g_array_index
+                (groups, matrix_path_group_t, groups->len - 1);
+            if (group->m_length == path.m_length &&
+                group->m_pattern == path.m_pattern) {
+                group->m_end = i + 1;
+                continue;
+            }
+        }
+
+        matrix_path_group_t group;
+        group.m_length = path.m_length;
+        group.m_pattern = path.m_pattern;
+        group.m_begin = i;
+        group.m_end = i + 1;
+        g_array_append_val(groups, group);
+    }
+
+    return true;
+}
+
+matrix_path_entry_t * MatrixPronunciationCache::get_entry
+(PhoneticKeyMatrix * matrix, size_t start, size_t end){
+    assert(end < matrix->size());
+
+    assert(matrix->get_column_size(start) > 0);
+    assert(matrix->get_column_size(end) > 0);
+
+    /* the spans are allocated on demand, and kept for the reuse. */
+    for (size_t i = m_spans->len; i <= start; ++i) {
+        GArray * entries = g_array_new
+            (FALSE, TRUE, sizeof(matrix_path_entry_t));
+        g_ptr_array_add(m_spans, entries);
+    }
+
+    GArray * entries = (GArray *) g_ptr_array_index(m_spans, start);
+    const size_t index = end - start;
+    if (index >= entries->len)
+        g_array_set_size(entries, index + 1);
+
+    matrix_path_entry_t * entry = &g_array_index
+        (entries, matrix_path_entry_t, index);
+
+    if (entry->m_valid)
+        return entry;
+
+    if (NULL == entry->m_paths) {
+        entry->m_paths = g_array_new(FALSE, FALSE, sizeof(matrix_path_t));
+        entry->m_groups = g_array_new
+            (FALSE, FALSE, sizeof(matrix_path_group_t));
+    }
+
+    enumerate_paths(matrix, start, end, entry);
+    entry->m_valid = true;
+    return entry;
+}
+
+guint32 MatrixPronunciationCache::count_matched_paths
+(matrix_path_entry_t * entry, guint8 length, const ChewingKey * keys){
+    GArray * paths = entry->m_paths;
+    GArray * groups = entry->m_groups;
+
+    /* the pronunciation contains incomplete pinyin or zero tone,
+       compare it with every key sequence. */
+    const bool fuzzy = 0 != _compute_pattern(keys, length);
+
+    guint32 count = 0;
+    for (size_t i = 0; i < groups->len; ++i) {
+        const matrix_path_group_t & group = g_array_index
+            (groups, matrix_path_group_t, i);
+
+        if (group.m_length != length)
+            continue;
+
+        const matrix_path_t * begin = &g_array_index
+            (paths, matrix_path_t, group.m_begin);
+        const matrix_path_t * end = &g_array_index
+            (paths, matrix_path_t, group.m_end);
+
+        if (fuzzy) {
+            for (const matrix_path_t * path = begin; path != end; ++path) {
+                if (0 == pinyin_compare_with_tones
+                    (keys, path->m_keys, length))
+                    count += path->m_count;
+            }
+            continue;
+        }
+
+        matrix_path_t target;
+        memset(&target, 0, sizeof(target));
+        memcpy(target.m_keys, keys, length * sizeof(ChewingKey));
+        _apply_pattern(target.m_keys, length, group.m_pattern);
+        target.m_length = length;
+        target.m_pattern = group.m_pattern;
+
+        const matrix_path_t * path = std_lite::lower_bound
+            (begin, end, target, matrix_path_less_than);
+        if (path != end && 0 == compare_matrix_path(path, &target))
+            count += path->m_count;
+    }
+
+    return count;
+}
+
+gfloat MatrixPronunciationCache::compute_pronunciation_possibility
+(PhoneticKeyMatrix * matrix, size_t start, size_t end, PhraseItem & item){
+    matrix_path_entry_t * entry = get_entry(matrix, start, end);
+
+    const guint8 phrase_length = item.get_phrase_length();
+    const guint8 npron = item.get_n_pronunciation();
+
+    /* one pass over the pronunciations of the phrase item. */
+    gfloat matched = 0; guint32 total_freq = 0;
+    for (size_t i = 0; i < npron; ++i) {
+        ChewingKey keys[MAX_PHRASE_LENGTH];
+        guint32 freq = 0;
+        item.get_nth_pronunciation(i, keys, freq);
+        total_freq += freq;
+
+        if (0 == freq)
+            continue;
+
+        const guint32 count = count_matched_paths
+            (entry, phrase_length, keys);
+        matched += count * (gfloat) freq;
+    }
+
+    /* an additional safe guard for chewing. */
+    if (0 == total_freq)
+        return 0.;
+
+    return matched / total_freq;
+}
+
+bool MatrixPronunciationCache::increase_pronunciation_possibility
+(PhoneticKeyMatrix * matrix, size_t start, size_t end,
+ PhraseItem & item, gint32 delta){
+    matrix_path_entry_t * entry = get_entry(matrix, start, end);
+    GArray * paths = entry->m_paths;
+
+    const guint8 phrase_length = item.get_phrase_length();
+
+    bool result = false;
+    for (size_t i = 0; i < paths->len; ++i) {
+        matrix_path_t * path = &g_array_index(paths, matrix_path_t, i);
+        if (path->m_length != phrase_length)
+            continue;
+
+        /* the same key sequence is increased once per path. */
+        for (size_t k = 0; k < path->m_count; ++k)
+            item.increase_pronunciation_possibility(path->m_keys, delta);
+        result = true;
+    }
+
+    return result;
+}
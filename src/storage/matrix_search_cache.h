@@ -0,0 +1,361 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef MATRIX_SEARCH_CACHE_H
+#define MATRIX_SEARCH_CACHE_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "facade_chewing_table2.h"
+#include "phonetic_key_matrix.h"
+#include "phrase_index.h"
+
+namespace pinyin{
+
+/**
+ * MatrixSnapshot:
+ *
+ * The copy of the phonetic key matrix columns, used to find the first
+ * changed column of the matrix.
+ *
+ */
+class MatrixSnapshot{
+private:
+    GArray * m_keys;
+    GArray * m_key_rests;
+    /* the columns offsets in m_keys, the last one is the end. */
+    GArray * m_offsets;
+
+    size_t compute_changed_column(PhoneticKeyMatrix * matrix);
+
+public:
+    /**
+     * MatrixSnapshot::MatrixSnapshot:
+     *
+     * The constructor of the MatrixSnapshot.
+     *
+     */
+    MatrixSnapshot();
+
+    /**
+     * MatrixSnapshot::~MatrixSnapshot:
+     *
+     * The destructor of the MatrixSnapshot.
+     *
+     */
+    ~MatrixSnapshot();
+
+    /**
+     * MatrixSnapshot::update:
+     * @matrix: the phonetic key matrix.
+     * @column: the first changed column of the matrix.
+     * @returns: whether the matrix is changed.
+     *
+     * Compare the matrix with the snapshot, and only copy
+     * the changed columns into the snapshot.
+     *
+     */
+    bool update(/* in */ PhoneticKeyMatrix * matrix,
+                /* out */ size_t & column);
+
+    /**
+     * MatrixSnapshot::clear:
+     *
+     * Clear the snapshot, the next update reports the first column.
+     *
+     */
+    void clear();
+};
+
+/**
+ * matrix_search_entry_t:
+ *
+ * The cached search result of one span of the phonetic key matrix.
+ *
+ */
+struct matrix_search_entry_t{
+    /* whether the span is searched. */
+    bool m_valid;
+    /* the returned value of search_matrix. */
+    int m_result;
+    /* Array of PhraseIndexRange of all sub phrase indices. */
+    GArray * m_ranges;
+};
+
+/**
+ * MatrixSearchCache:
+ *
+ * The per instance cache of the search_matrix results of one
+ * chewing table, keyed by the span [start, end] of the matrix.
+ *
+ * Note:
+ *   The search of the span only reads the matrix columns [start, end],
+ *   so only the spans touching the changed columns are invalidated
+ *   when the matrix is changed, the first changed column is told by
+ *   the caller who changes the matrix.
+ *   Please call invalidate_all after the chewing table is changed.
+ *   The cache is not thread-safe, use one cache per instance.
+ *
+ */
+class MatrixSearchCache{
+private:
+    FacadeChewingTable2 * m_table;
+
+    /* the fuzzy pinyin options of the search. */
+    pinyin_option_t m_options;
+
+    /* Pointer Array of Array of matrix_search_entry_t,
+       indexed by start and then by (end - start). */
+    GPtrArray * m_spans;
+
+public:
+    /**
+     * MatrixSearchCache::MatrixSearchCache:
+     * @table: the chewing table to be searched.
+     *
+     * The constructor of the MatrixSearchCache.
+     *
+     */
+    MatrixSearchCache(FacadeChewingTable2 * table);
+
+    /**
+     * MatrixSearchCache::~MatrixSearchCache:
+     *
+     * The destructor of the MatrixSearchCache.
+     *
+     */
+    ~MatrixSearchCache();
+
+    /**
+     * MatrixSearchCache::get_table:
+     * @returns: the chewing table of the cache.
+     *
+     * Get the chewing table of the cache.
+     *
+     */
+    FacadeChewingTable2 * get_table() const {
+        return m_table;
+    }
+
+    /**
+     * MatrixSearchCache::invalidate:
+     * @column: the first changed column.
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate the spans which end at or after the column,
+     * call it after the matrix is changed.
+     *
+     */
+    bool invalidate(size_t column);
+
+    /**
+     * MatrixSearchCache::invalidate_all:
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate all spans, call it after the chewing table is changed.
+     *
+     */
+    bool invalidate_all();
+
+    /**
+     * MatrixSearchCache::set_options:
+     * @options: the pinyin options.
+     * @returns: whether the fuzzy pinyin options are changed.
+     *
+     * Set the fuzzy pinyin options of the search, all spans are
+     * invalidated when the fuzzy pinyin options are changed.
+     *
+     */
+    bool set_options(pinyin_option_t options);
+
+    /**
+     * MatrixSearchCache::search:
+     * @matrix: the phonetic key matrix, the changes are told by invalidate.
+     * @start: the start column of the span.
+     * @end: the end column of the span.
+     * @ranges: the phrase index ranges to store the results.
+     * @returns: the same value as search_matrix.
+     *
+     * Search the span with the memo, the chewing table is only searched
+     * for the first time.
+     *
+     * Note: the ranges should be prepared by the same phrase index.
+     *
+     */
+    int search(PhoneticKeyMatrix * matrix,
+               size_t start, size_t end,
+               PhraseIndexRanges ranges);
+};
+
+/**
+ * matrix_path_t:
+ *
+ * One distinct key sequence through the span of the matrix.
+ *
+ */
+struct matrix_path_t{
+    ChewingKey m_keys[MAX_PHRASE_LENGTH];
+    guint8 m_length;
+    /* two bits per key, the incomplete pinyin and the zero tone. */
+    guint32 m_pattern;
+    /* the number of the paths with the same key sequence. */
+    guint32 m_count;
+};
+
+/**
+ * matrix_path_group_t:
+ *
+ * The key sequences with the same length and pattern, sorted by keys.
+ *
+ */
+struct matrix_path_group_t{
+    guint8 m_length;
+    guint32 m_pattern;
+    guint32 m_begin;
+    guint32 m_end;
+};
+
+/**
+ * matrix_path_entry_t:
+ *
+ * The enumerated key sequences of one span of the phonetic key matrix.
+ *
+ */
+struct matrix_path_entry_t{
+    /* whether the span is enumerated. */
+    bool m_valid;
+    /* Array of matrix_path_t, sorted by length, pattern and keys. */
+    GArray * m_paths;
+    /* Array of matrix_path_group_t. */
+    GArray * m_groups;
+};
+
+/**
+ * MatrixPronunciationCache:
+ *
+ * The per lookup cache of the key sequences of the spans,
+ * to compute the pronunciation possibility of the phrase items.
+ *
+ * Note:
+ *   The key sequences of the span [start, end] are enumerated once,
+ *   then the pronunciations of the phrase item are matched against
+ *   the sorted key sequences with binary search, instead of comparing
+ *   every path with every pronunciation.
+ *   The cache is not thread-safe, use one cache per lookup.
+ *
+ */
+class MatrixPronunciationCache{
+private:
+    /* the fuzzy pinyin options of the key sequences. */
+    pinyin_option_t m_options;
+
+    /* Pointer Array of Array of matrix_path_entry_t,
+       indexed by start and then by (end - start). */
+    GPtrArray * m_spans;
+
+    /* the cached keys for the enumeration. */
+    GArray * m_cached_keys;
+
+    matrix_path_entry_t * get_entry(PhoneticKeyMatrix * matrix,
+                                    size_t start, size_t end);
+    bool enumerate_paths(PhoneticKeyMatrix * matrix,
+                         size_t start, size_t end,
+                         matrix_path_entry_t * entry);
+    guint32 count_matched_paths(matrix_path_entry_t * entry,
+                                guint8 length, const ChewingKey * keys);
+
+public:
+    /**
+     * MatrixPronunciationCache::MatrixPronunciationCache:
+     *
+     * The constructor of the MatrixPronunciationCache.
+     *
+     */
+    MatrixPronunciationCache();
+
+    /**
+     * MatrixPronunciationCache::~MatrixPronunciationCache:
+     *
+     * The destructor of the MatrixPronunciationCache.
+     *
+     */
+    ~MatrixPronunciationCache();
+
+    /**
+     * MatrixPronunciationCache::invalidate:
+     * @column: the first changed column.
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate the spans which end at or after the column,
+     * call it after the matrix is changed.
+     *
+     */
+    bool invalidate(size_t column);
+
+    /**
+     * MatrixPronunciationCache::set_options:
+     * @options: the pinyin options.
+     * @returns: whether the fuzzy pinyin options are changed.
+     *
+     * Set the fuzzy pinyin options, the fuzzy pinyins of the matrix keys
+     * are enumerated into the key sequences of the spans.
+     *
+     */
+    bool set_options(pinyin_option_t options);
+
+    /**
+     * MatrixPronunciationCache::compute_pronunciation_possibility:
+     * @matrix: the phonetic key matrix, the changes are told by invalidate.
+     * @start: the start column of the span.
+     * @end: the end column of the span.
+     * @item: the phrase item.
+     * @returns: the same value as compute_pronunciation_possibility.
+     *
+     * Compute the pronunciation possibility of the phrase item
+     * with the cached key sequences of the span.
+     *
+     */
+    gfloat compute_pronunciation_possibility(PhoneticKeyMatrix * matrix,
+                                             size_t start, size_t end,
+                                             PhraseItem & item);
+
+    /**
+     * MatrixPronunciationCache::increase_pronunciation_possibility:
+     * @matrix: the phonetic key matrix, the changes are told by invalidate.
+     * @start: the start column of the span.
+     * @end: the end column of the span.
+     * @item: the phrase item.
+     * @delta: the delta to be added to the matched pronunciations.
+     * @returns: the same value as increase_pronunciation_possibility.
+     *
+     * Increase the pronunciation possibility of the phrase item
+     * with the cached key sequences of the span.
+     *
+     */
+    bool increase_pronunciation_possibility(PhoneticKeyMatrix * matrix,
+                                            size_t start, size_t end,
+                                            PhraseItem & item,
+                                            gint32 delta);
+};
+
+};
+
+#endif
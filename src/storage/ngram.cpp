@@ -29,11 +29,6 @@
 
 using namespace pinyin;
 
-struct SingleGramItem{
-    phrase_token_t m_token;
-    guint32 m_freq;
-};
-
 SingleGram::SingleGram(){
     m_chunk.set_size(sizeof(guint32));
     memset(m_chunk.begin(), 0, sizeof(guint32));
@@ -133,6 +128,31 @@ static bool token_less_than(const SingleGramItem & lhs,const SingleGramItem & rh
     return lhs.m_token < rhs.m_token;
 }
 
+/* the lower bound of the token, gallop forward from the cursor. */
+static const SingleGramItem * gallop_lower_bound
+(const SingleGramItem * begin, const SingleGramItem * cursor,
+ const SingleGramItem * end, phrase_token_t token){
+    SingleGramItem compare_item;
+    compare_item.m_token = token;
+
+    /* search before the cursor for the smaller token. */
+    if (cursor > begin && (cursor - 1)->m_token >= token)
+        return std_lite::lower_bound(begin, cursor, compare_item,
+                                     token_less_than);
+
+    /* the items before low are less than the token,
+       and high is the end or not less than the token. */
+    const SingleGramItem * low = cursor, * high = cursor;
+    size_t step = 1;
+    while (high < end && high->m_token < token) {
+        low = high + 1;
+        high = (size_t)(end - high) > step ? high + step : end;
+        step *= 2;
+    }
+
+    return std_lite::lower_bound(low, high, compare_item, token_less_than);
+}
+
 bool SingleGram::retrieve_all(/* out */ BigramPhraseWithCountArray array)
     const {
     const SingleGramItem * begin = (const SingleGramItem *)
@@ -178,6 +198,44 @@ bool SingleGram::search(/* in */ PhraseIndexRange * range,
     return true;
 }
 
+bool SingleGram::search_ranges(/* in */ PhraseIndexRanges ranges,
+                               /* out */ BigramPhraseArray array) const {
+    const SingleGramItem * begin = (const SingleGramItem *)
+        ((const char *)(m_chunk.begin()) + sizeof(guint32));
+    const SingleGramItem * end = (const SingleGramItem *) m_chunk.end();
+
+    guint32 total_freq;
+    BigramPhraseItem bigram_item;
+    assert(get_total_freq(total_freq));
+
+    /* the ranges are mostly ascending, gallop from the last range. */
+    const SingleGramItem * cursor = begin;
+    for (size_t m = 0; m < PHRASE_INDEX_LIBRARY_COUNT; ++m) {
+        GArray * sub_ranges = ranges[m];
+        if (!sub_ranges)
+            continue;
+
+        for (size_t n = 0; n < sub_ranges->len; ++n) {
+            PhraseIndexRange * range =
+                &g_array_index(sub_ranges, PhraseIndexRange, n);
+
+            cursor = gallop_lower_bound
+                (begin, cursor, end, range->m_range_begin);
+
+            for (const SingleGramItem * cur_item = cursor;
+                 cur_item != end; ++cur_item) {
+                if (cur_item->m_token >= range->m_range_end)
+                    break;
+                bigram_item.m_token = cur_item->m_token;
+                bigram_item.m_freq = cur_item->m_freq / (gfloat)total_freq;
+                g_array_append_val(array, bigram_item);
+            }
+        }
+    }
+
+    return true;
+}
+
 bool SingleGram::insert_freq( /* in */ phrase_token_t token,
                               /* in */ guint32 freq){
     SingleGramItem * begin = (SingleGramItem *)
@@ -353,3 +411,182 @@ bool merge_single_gram(SingleGram * merged, const SingleGram * system,
 }
 
 };
+
+/* emit the merged items before the range end. */
+static bool merge_range(const SingleGramItem * cur_system,
+                        const SingleGramItem * system_end,
+                        const SingleGramItem * cur_user,
+                        const SingleGramItem * user_end,
+                        phrase_token_t range_end, guint32 total_freq,
+                        BigramPhraseArray array){
+    BigramPhraseItem bigram_item;
+
+    while (true) {
+        const bool has_system = cur_system != system_end &&
+            cur_system->m_token < range_end;
+        const bool has_user = cur_user != user_end &&
+            cur_user->m_token < range_end;
+
+        if (!has_system && !has_user)
+            break;
+
+        guint32 freq = 0;
+        if (has_system && (!has_user ||
+                           cur_system->m_token <= cur_user->m_token)) {
+            bigram_item.m_token = cur_system->m_token;
+            freq = cur_system->m_freq;
+            if (has_user && cur_system->m_token == cur_user->m_token) {
+                freq += cur_user->m_freq;
+                cur_user++;
+            }
+            cur_system++;
+        } else {
+            bigram_item.m_token = cur_user->m_token;
+            freq = cur_user->m_freq;
+            cur_user++;
+        }
+
+        bigram_item.m_freq = freq / (gfloat)total_freq;
+        g_array_append_val(array, bigram_item);
+    }
+
+    return true;
+}
+
+MergedSingleGramView::MergedSingleGramView(){
+    reset(NULL, NULL);
+}
+
+bool MergedSingleGramView::reset(const SingleGram * system,
+                                 const SingleGram * user){
+    m_system_begin = m_system_end = NULL;
+    m_user_begin = m_user_end = NULL;
+    m_total_freq = 0;
+
+    if (system) {
+        m_system_begin = (const SingleGramItem *)
+            (((const char *)(system->m_chunk.begin())) + sizeof(guint32));
+        m_system_end = (const SingleGramItem *) system->m_chunk.end();
+
+        guint32 total_freq = 0;
+        assert(system->get_total_freq(total_freq));
+        m_total_freq += total_freq;
+    }
+
+    if (user) {
+        m_user_begin = (const SingleGramItem *)
+            (((const char *)(user->m_chunk.begin())) + sizeof(guint32));
+        m_user_end = (const SingleGramItem *) user->m_chunk.end();
+
+        guint32 total_freq = 0;
+        assert(user->get_total_freq(total_freq));
+        m_total_freq += total_freq;
+    }
+
+    m_system_cursor = m_system_begin;
+    m_user_cursor = m_user_begin;
+
+    return NULL != system || NULL != user;
+}
+
+bool MergedSingleGramView::get_freq(/* in */ phrase_token_t token,
+                                    /* out */ guint32 & freq) const{
+    freq = 0;
+    bool found = false;
+
+    m_system_cursor = gallop_lower_bound
+        (m_system_begin, m_system_cursor, m_system_end, token);
+    if (m_system_cursor != m_system_end &&
+        m_system_cursor->m_token == token) {
+        freq += m_system_cursor->m_freq;
+        found = true;
+    }
+
+    m_user_cursor = gallop_lower_bound
+        (m_user_begin, m_user_cursor, m_user_end, token);
+    if (m_user_cursor != m_user_end &&
+        m_user_cursor->m_token == token) {
+        freq += m_user_cursor->m_freq;
+        found = true;
+    }
+
+    return found;
+}
+
+bool MergedSingleGramView::search(/* in */ PhraseIndexRange * range,
+                                  /* out */ BigramPhraseArray array) const{
+    SingleGramItem compare_item;
+    compare_item.m_token = range->m_range_begin;
+
+    const SingleGramItem * cur_system = std_lite::lower_bound
+        (m_system_begin, m_system_end, compare_item, token_less_than);
+    const SingleGramItem * cur_user = std_lite::lower_bound
+        (m_user_begin, m_user_end, compare_item, token_less_than);
+
+    return merge_range(cur_system, m_system_end, cur_user, m_user_end,
+                       range->m_range_end, m_total_freq, array);
+}
+
+bool MergedSingleGramView::search_ranges(/* in */ PhraseIndexRanges ranges,
+                                         /* out */ BigramPhraseArray array)
+    const{
+    const SingleGramItem * system_cursor = m_system_begin;
+    const SingleGramItem * user_cursor = m_user_begin;
+
+    for (size_t m = 0; m < PHRASE_INDEX_LIBRARY_COUNT; ++m) {
+        GArray * sub_ranges = ranges[m];
+        if (!sub_ranges)
+            continue;
+
+        for (size_t n = 0; n < sub_ranges->len; ++n) {
+            PhraseIndexRange * range =
+                &g_array_index(sub_ranges, PhraseIndexRange, n);
+
+            system_cursor = gallop_lower_bound
+                (m_system_begin, system_cursor, m_system_end,
+                 range->m_range_begin);
+            user_cursor = gallop_lower_bound
+                (m_user_begin, user_cursor, m_user_end,
+                 range->m_range_begin);
+
+            merge_range(system_cursor, m_system_end,
+                        user_cursor, m_user_end,
+                        range->m_range_end, m_total_freq, array);
+        }
+    }
+
+    return true;
+}
+
+bool MergedSingleGramView::retrieve_all
+(/* out */ BigramPhraseWithCountArray array) const{
+    const SingleGramItem * cur_system = m_system_begin;
+    const SingleGramItem * cur_user = m_user_begin;
+
+    BigramPhraseItemWithCount bigram_item_with_count;
+
+    while (cur_system != m_system_end || cur_user != m_user_end) {
+        guint32 freq = 0;
+        if (cur_user == m_user_end || (cur_system != m_system_end &&
+                                       cur_system->m_token <= cur_user->m_token)) {
+            bigram_item_with_count.m_token = cur_system->m_token;
+            freq = cur_system->m_freq;
+            if (cur_user != m_user_end &&
+                cur_system->m_token == cur_user->m_token) {
+                freq += cur_user->m_freq;
+                cur_user++;
+            }
+            cur_system++;
+        } else {
+            bigram_item_with_count.m_token = cur_user->m_token;
+            freq = cur_user->m_freq;
+            cur_user++;
+        }
+
+        bigram_item_with_count.m_count = freq;
+        bigram_item_with_count.m_freq = freq / (gfloat)m_total_freq;
+        g_array_append_val(array, bigram_item_with_count);
+    }
+
+    return true;
+}
@@ -37,6 +37,15 @@
 namespace pinyin{
 
 class Bigram;
+class Trigram;
+class SingleGramCache;
+class CompactSingleGram;
+
+/* the item of the single gram, sorted by the token. */
+struct SingleGramItem{
+    phrase_token_t m_token;
+    guint32 m_freq;
+};
 
 /** Note:
  *  The system single gram contains the trained freqs.
@@ -54,9 +63,16 @@ class Bigram;
  */
 class SingleGram{
     friend class Bigram;
+    friend class Trigram;
+    friend class SingleGramCache;
+    friend class MergedSingleGramView;
+    friend class UserBigramBuffer;
     friend bool merge_single_gram(SingleGram * merged,
                                   const SingleGram * system,
                                   const SingleGram * user);
+    friend bool merge_single_gram(SingleGram * merged,
+                                  const CompactSingleGram * system,
+                                  const SingleGram * user);
 
 private:
     MemoryChunk m_chunk;
@@ -93,6 +109,19 @@ public:
     bool search(/* in */ PhraseIndexRange * range,
 	       /* out */ BigramPhraseArray array) const;
 
+    /**
+     * SingleGram::search_ranges:
+     * @ranges: the token ranges of all sub phrase indices.
+     * @array: the GArray to store the matched bi-gram phrase item.
+     * @returns: whether the search operation is successful.
+     *
+     * Search all token ranges in one sweep, the same as calling search
+     * for each range in order.
+     *
+     */
+    bool search_ranges(/* in */ PhraseIndexRanges ranges,
+                       /* out */ BigramPhraseArray array) const;
+
     /**
      * SingleGram::insert_freq:
      * @token: the phrase token.
@@ -208,6 +237,113 @@ public:
 bool merge_single_gram(SingleGram * merged, const SingleGram * system,
                        const SingleGram * user);
 
+/**
+ * MergedSingleGramView:
+ *
+ * The merged view of the system and user single gram,
+ * walks the two sorted items lazily without building the merged chunk.
+ *
+ * Note:
+ *   Please keep system and user single gram when using the view.
+ *   The point lookups gallop from the last found item, as the tokens
+ *   are usually looked up in the ascending order.
+ *   The view is not thread-safe, use one view per lookup.
+ *
+ */
+class MergedSingleGramView{
+private:
+    const SingleGramItem * m_system_begin;
+    const SingleGramItem * m_system_end;
+    const SingleGramItem * m_user_begin;
+    const SingleGramItem * m_user_end;
+    guint32 m_total_freq;
+
+    /* the cursors of the galloping search. */
+    mutable const SingleGramItem * m_system_cursor;
+    mutable const SingleGramItem * m_user_cursor;
+
+public:
+    /**
+     * MergedSingleGramView::MergedSingleGramView:
+     *
+     * The constructor of the MergedSingleGramView.
+     *
+     */
+    MergedSingleGramView();
+
+    /**
+     * MergedSingleGramView::reset:
+     * @system: the system single gram, or NULL.
+     * @user: the user single gram, or NULL.
+     * @returns: whether any single gram exists.
+     *
+     * Reset the view to the system and user single gram.
+     *
+     */
+    bool reset(const SingleGram * system, const SingleGram * user);
+
+    /**
+     * MergedSingleGramView::get_total_freq:
+     * @total: the merged total frequency.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the total frequency of the system and user single gram.
+     *
+     */
+    bool get_total_freq(guint32 & total) const {
+        total = m_total_freq;
+        return true;
+    }
+
+    /**
+     * MergedSingleGramView::get_freq:
+     * @token: the phrase token.
+     * @freq: the merged frequency of the token.
+     * @returns: whether the token exists in any single gram.
+     *
+     * Get the merged frequency of the token.
+     *
+     */
+    bool get_freq(/* in */ phrase_token_t token,
+                  /* out */ guint32 & freq) const;
+
+    /**
+     * MergedSingleGramView::search:
+     * @range: the token range.
+     * @array: the GArray to store the matched bi-gram phrase item.
+     * @returns: whether the search operation is successful.
+     *
+     * Search the merged bi-gram phrase items according to the token range,
+     * the same as SingleGram::search of the merged single gram.
+     *
+     */
+    bool search(/* in */ PhraseIndexRange * range,
+                /* out */ BigramPhraseArray array) const;
+
+    /**
+     * MergedSingleGramView::search_ranges:
+     * @ranges: the token ranges of all sub phrase indices.
+     * @array: the GArray to store the matched bi-gram phrase item.
+     * @returns: whether the search operation is successful.
+     *
+     * Search all token ranges in one sweep, the same as calling search
+     * for each range in order.
+     *
+     */
+    bool search_ranges(/* in */ PhraseIndexRanges ranges,
+                       /* out */ BigramPhraseArray array) const;
+
+    /**
+     * MergedSingleGramView::retrieve_all:
+     * @array: the GArray to store the retrieved bi-gram phrase item.
+     * @returns: whether the retrieve operation is successful.
+     *
+     * Retrieve all merged bi-gram phrase items.
+     *
+     */
+    bool retrieve_all(/* out */ BigramPhraseWithCountArray array) const;
+};
+
 };
 
 #endif
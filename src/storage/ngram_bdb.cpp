@@ -31,10 +31,12 @@ using namespace pinyin;
 
 Bigram::Bigram(){
 	m_db = NULL;
+	g_mutex_init(&m_mutex);
 }
 
 Bigram::~Bigram(){
 	reset();
+	g_mutex_clear(&m_mutex);
 }
 
 void Bigram::reset(){
@@ -108,6 +110,43 @@ bool Bigram::save_db(const char * dbfile){
     return true;
 }
 
+bool Bigram::copy_db(Bigram * new_bigram) {
+    new_bigram->reset();
+
+    /* create in-memory db. */
+    int ret = db_create(&new_bigram->m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = new_bigram->m_db->open(new_bigram->m_db, NULL, NULL, NULL,
+                                 DB_HASH, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return copy_bdb(m_db, new_bigram->m_db);
+}
+
+bool Bigram::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    /* create in-memory db. */
+    int ret = db_create(&m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = m_db->open(m_db, NULL, NULL, NULL,
+                     DB_HASH, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return restore_bdb(chunk, m_db);
+}
+
+bool Bigram::save_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    return dump_bdb(m_db, new_chunk);
+}
+
 bool Bigram::attach(const char * dbfile, guint32 flags){
     reset();
     u_int32_t db_flags = attach_options(flags);
@@ -138,11 +177,17 @@ bool Bigram::load(phrase_token_t index, SingleGram * & single_gram,
 
     DBT db_data;
     memset(&db_data, 0, sizeof(DBT));
+
+    g_mutex_lock(&m_mutex);
     int ret = m_db->get(m_db, NULL, &db_key, &db_data, 0);
-    if ( ret != 0 )
+    if ( ret != 0 ) {
+        g_mutex_unlock(&m_mutex);
         return false;
+    }
 
-    single_gram = new SingleGram(db_data.data, db_data.size, copy);
+    /* copy before the next call reuses the returned data. */
+    single_gram = new SingleGram(db_data.data, db_data.size, true);
+    g_mutex_unlock(&m_mutex);
     return true;
 }
 
@@ -249,3 +294,234 @@ bool Bigram::mask_out(phrase_token_t mask, phrase_token_t value){
     g_array_free(items, TRUE);
     return true;
 }
+
+
+Trigram::Trigram(){
+    m_db = NULL;
+    g_mutex_init(&m_mutex);
+}
+
+Trigram::~Trigram(){
+    reset();
+    g_mutex_clear(&m_mutex);
+}
+
+void Trigram::reset(){
+    if ( m_db ){
+        m_db->sync(m_db, 0);
+        m_db->close(m_db, 0);
+        m_db = NULL;
+    }
+}
+
+bool Trigram::load_db(const char * dbfile){
+    reset();
+
+    /* create in memory db. */
+    int ret = db_create(&m_db, NULL, 0);
+    assert(ret == 0);
+
+    ret = m_db->open(m_db, NULL, NULL, NULL,
+                     DB_HASH, DB_CREATE, 0600);
+    if ( ret != 0 )
+        return false;
+
+    /* load db into memory. */
+    DB * tmp_db = NULL;
+    ret = db_create(&tmp_db, NULL, 0);
+    assert(0 == ret);
+
+    if (NULL == tmp_db)
+        return false;
+
+    ret = tmp_db->open(tmp_db, NULL, dbfile, NULL,
+                       DB_HASH, DB_RDONLY, 0600);
+    if ( ret != 0 )
+        return false;
+
+    if ( !copy_bdb(tmp_db, m_db) )
+        return false;
+
+    if ( tmp_db != NULL )
+        tmp_db->close(tmp_db, 0);
+
+    return true;
+}
+
+bool Trigram::save_db(const char * dbfile){
+    DB * tmp_db = NULL;
+
+    int ret = unlink(dbfile);
+    if ( ret != 0 && errno != ENOENT)
+        return false;
+
+    ret = db_create(&tmp_db, NULL, 0);
+    assert(0 == ret);
+
+    if (NULL == tmp_db)
+        return false;
+
+    ret = tmp_db->open(tmp_db, NULL, dbfile, NULL,
+                       DB_HASH, DB_CREATE, 0600);
+    if ( ret != 0 )
+        return false;
+
+    if ( !copy_bdb(m_db, tmp_db) )
+        return false;
+
+    if ( tmp_db != NULL ) {
+        tmp_db->sync(tmp_db, 0);
+        tmp_db->close(tmp_db, 0);
+    }
+
+    return true;
+}
+
+bool Trigram::attach(const char * dbfile, guint32 flags){
+    reset();
+    u_int32_t db_flags = attach_options(flags);
+
+    if ( !dbfile )
+        return false;
+    int ret = db_create(&m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = m_db->open(m_db, NULL, dbfile, NULL,
+                     DB_HASH, db_flags, 0644);
+    if ( ret != 0)
+        return false;
+
+    return true;
+}
+
+bool Trigram::load(const TrigramKey & index, SingleGram * & single_gram,
+                   bool copy){
+    single_gram = NULL;
+    if ( !m_db )
+        return false;
+
+    DBT db_key;
+    memset(&db_key, 0, sizeof(DBT));
+    db_key.data = (void *) &index;
+    db_key.size = sizeof(TrigramKey);
+
+    DBT db_data;
+    memset(&db_data, 0, sizeof(DBT));
+
+    g_mutex_lock(&m_mutex);
+    int ret = m_db->get(m_db, NULL, &db_key, &db_data, 0);
+    if ( ret != 0 ) {
+        g_mutex_unlock(&m_mutex);
+        return false;
+    }
+
+    /* copy before the next call reuses the returned data. */
+    single_gram = new SingleGram(db_data.data, db_data.size, true);
+    g_mutex_unlock(&m_mutex);
+    return true;
+}
+
+bool Trigram::store(const TrigramKey & index, SingleGram * single_gram){
+    if ( !m_db )
+        return false;
+
+    DBT db_key;
+    memset(&db_key, 0, sizeof(DBT));
+    db_key.data = (void *) &index;
+    db_key.size = sizeof(TrigramKey);
+    DBT db_data;
+    memset(&db_data, 0, sizeof(DBT));
+    db_data.data = single_gram->m_chunk.begin();
+    db_data.size = single_gram->m_chunk.size();
+
+    int ret = m_db->put(m_db, NULL, &db_key, &db_data, 0);
+    return ret == 0;
+}
+
+bool Trigram::remove(/* in */ const TrigramKey & index){
+    if ( !m_db )
+        return false;
+
+    DBT db_key;
+    memset(&db_key, 0, sizeof(DBT));
+    db_key.data = (void *) &index;
+    db_key.size = sizeof(TrigramKey);
+
+    int ret = m_db->del(m_db, NULL, &db_key, 0);
+    return 0 == ret;
+}
+
+bool Trigram::get_all_items(TrigramKeyArray items){
+    g_array_set_size(items, 0);
+
+    if ( !m_db )
+        return false;
+
+    DBC * cursorp = NULL;
+    DBT key, data;
+    int ret;
+    /* Get a cursor */
+    m_db->cursor(m_db, NULL, &cursorp, 0);
+
+    if (NULL == cursorp)
+        return false;
+
+    /* Initialize our DBTs. */
+    memset(&key, 0, sizeof(DBT));
+    memset(&data, 0, sizeof(DBT));
+
+    /* Iterate over the database, retrieving each record in turn. */
+    while ((ret = cursorp->c_get(cursorp, &key, &data, DB_NEXT)) == 0) {
+        assert(key.size == sizeof(TrigramKey));
+        TrigramKey * index = (TrigramKey *)key.data;
+        g_array_append_val(items, *index);
+    }
+
+    assert (ret == DB_NOTFOUND);
+
+    /* Cursors must be closed */
+    if (cursorp != NULL)
+        cursorp->c_close(cursorp);
+
+    return true;
+}
+
+/* Note: sync mask_out code with ngram_kyotodb.cpp. */
+bool Trigram::mask_out(phrase_token_t mask, phrase_token_t value){
+    GArray * items = g_array_new(FALSE, FALSE, sizeof(TrigramKey));
+
+    if (!get_all_items(items)) {
+        g_array_free(items, TRUE);
+        return false;
+    }
+
+    for (size_t i = 0; i < items->len; ++i) {
+        const TrigramKey index = g_array_index(items, TrigramKey, i);
+
+        if ((index.m_tokens[0] & mask) == value ||
+            (index.m_tokens[1] & mask) == value) {
+            assert(remove(index));
+            continue;
+        }
+
+        SingleGram * gram = NULL;
+        assert(load(index, gram));
+
+        int num = gram->mask_out(mask, value);
+        if (0 == num) {
+            delete gram;
+            continue;
+        }
+
+        if (0 == gram->get_length()) {
+            assert(remove(index));
+        } else {
+            assert(store(index, gram));
+        }
+
+        delete gram;
+    }
+
+    g_array_free(items, TRUE);
+    return true;
+}
@@ -0,0 +1,468 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include "ngram_compact.h"
+#include "ngram_bdb.h"
+#include "stl_lite.h"
+
+using namespace pinyin;
+
+/* the varint uses 7 bits per byte, the high bit marks more bytes. */
+static inline void append_varint(MemoryChunk & chunk, guint32 value) {
+    guint8 buf[5]; size_t len = 0;
+
+    while (value >= 0x80) {
+        buf[len++] = (guint8) (value | 0x80);
+        value >>= 7;
+    }
+    buf[len++] = (guint8) value;
+
+    chunk.append_content(buf, len);
+}
+
+static inline bool read_varint(const guint8 * & cur, const guint8 * end,
+                               guint32 & value) {
+    value = 0;
+
+    for (size_t shift = 0; cur < end && shift < 32; shift += 7) {
+        const guint8 byte = *cur++;
+        value |= (guint32) (byte & 0x7f) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
+
+/* decode the next item of the single gram, the token is delta encoded. */
+static inline bool read_item(const guint8 * & cur, const guint8 * end,
+                             phrase_token_t & token, guint32 & freq) {
+    guint32 delta = 0;
+    if (!read_varint(cur, end, delta))
+        return false;
+    if (!read_varint(cur, end, freq))
+        return false;
+
+    token += delta;
+    return true;
+}
+
+/* the identity of the source bi-gram file, the size and the FNV-1a hash. */
+static bool compute_source_identity(const char * filename,
+                                    guint32 & size, guint32 & checksum) {
+    size = 0; checksum = 0;
+    if (NULL == filename)
+        return true;
+
+    MemoryChunk chunk;
+#ifdef LIBPINYIN_USE_MMAP
+    if (!chunk.mmap(filename))
+        return false;
+#else
+    if (!chunk.load(filename))
+        return false;
+#endif
+
+    const size_t len = chunk.size();
+    const guint8 * begin = (const guint8 *) chunk.begin();
+
+    /* hash the 32 bits words, then the tail bytes. */
+    guint32 hash = 2166136261U;
+    size_t i = 0;
+    for (; i + sizeof(guint32) <= len; i += sizeof(guint32)) {
+        guint32 word = 0;
+        memcpy(&word, begin + i, sizeof(guint32));
+        hash = (hash ^ word) * 16777619U;
+    }
+    for (; i < len; ++i)
+        hash = (hash ^ begin[i]) * 16777619U;
+
+    size = len; checksum = hash;
+    return true;
+}
+
+static bool dir_item_less_than(const CompactBigramDirItem & lhs,
+                               const CompactBigramDirItem & rhs) {
+    return lhs.m_token < rhs.m_token;
+}
+
+static gint compare_token(gconstpointer lhs, gconstpointer rhs) {
+    const phrase_token_t token_lhs = *(const phrase_token_t *) lhs;
+    const phrase_token_t token_rhs = *(const phrase_token_t *) rhs;
+
+    if (token_lhs < token_rhs)
+        return -1;
+    if (token_lhs > token_rhs)
+        return 1;
+    return 0;
+}
+
+CompactSingleGram::CompactSingleGram() {
+    m_begin = m_end = NULL;
+    m_total_freq = 0;
+    m_length = 0;
+}
+
+bool CompactSingleGram::retrieve_all(/* out */ BigramPhraseWithCountArray array)
+    const {
+    BigramPhraseItemWithCount bigram_item_with_count;
+
+    const guint8 * cur = m_begin;
+    phrase_token_t token = null_token; guint32 freq = 0;
+    while (cur < m_end) {
+        if (!read_item(cur, m_end, token, freq))
+            return false;
+
+        bigram_item_with_count.m_token = token;
+        bigram_item_with_count.m_count = freq;
+        bigram_item_with_count.m_freq = freq / (gfloat)m_total_freq;
+        g_array_append_val(array, bigram_item_with_count);
+    }
+
+    return true;
+}
+
+bool CompactSingleGram::search(/* in */ PhraseIndexRange * range,
+                               /* out */ BigramPhraseArray array) const {
+    BigramPhraseItem bigram_item;
+
+    const guint8 * cur = m_begin;
+    phrase_token_t token = null_token; guint32 freq = 0;
+    while (cur < m_end) {
+        if (!read_item(cur, m_end, token, freq))
+            return false;
+
+        if (token < range->m_range_begin)
+            continue;
+        if (token >= range->m_range_end)
+            break;
+
+        bigram_item.m_token = token;
+        bigram_item.m_freq = freq / (gfloat)m_total_freq;
+        g_array_append_val(array, bigram_item);
+    }
+
+    return true;
+}
+
+bool CompactSingleGram::get_freq(/* in */ phrase_token_t token,
+                                 /* out */ guint32 & freq) const {
+    freq = 0;
+
+    const guint8 * cur = m_begin;
+    phrase_token_t cur_token = null_token; guint32 cur_freq = 0;
+    while (cur < m_end) {
+        if (!read_item(cur, m_end, cur_token, cur_freq))
+            return false;
+
+        if (cur_token > token)
+            return false;
+
+        if (cur_token == token) {
+            freq = cur_freq;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+CompactBigram::CompactBigram() {
+    m_chunk = NULL;
+}
+
+CompactBigram::~CompactBigram() {
+    reset();
+}
+
+void CompactBigram::reset() {
+    m_directory.set_chunk(NULL, 0, NULL);
+
+    if (m_chunk) {
+        delete m_chunk;
+        m_chunk = NULL;
+    }
+}
+
+bool CompactBigram::attach(const char * filename,
+                           const char * source_filename) {
+    reset();
+
+    MemoryChunk * chunk = new MemoryChunk;
+
+#ifdef LIBPINYIN_USE_MMAP
+    if (!chunk->mmap(filename)) {
+        delete chunk;
+        return false;
+    }
+#else
+    if (!chunk->load(filename)) {
+        delete chunk;
+        return false;
+    }
+#endif
+
+    const size_t size = chunk->size();
+    if (size < sizeof(compact_bigram_header_t)) {
+        delete chunk;
+        return false;
+    }
+
+    const compact_bigram_header_t * header =
+        (const compact_bigram_header_t *) chunk->begin();
+
+    if (COMPACT_BIGRAM_MAGIC != header->m_magic ||
+        COMPACT_BIGRAM_VERSION != header->m_version) {
+        delete chunk;
+        return false;
+    }
+
+    /* the stale compact bi-gram falls back to the source bi-gram. */
+    if (source_filename) {
+        guint32 source_size = 0, source_checksum = 0;
+        if (!compute_source_identity(source_filename,
+                                     source_size, source_checksum) ||
+            source_size != header->m_source_size ||
+            source_checksum != header->m_source_checksum) {
+            delete chunk;
+            return false;
+        }
+    }
+
+    const table_offset_t begin = header->m_directory_begin;
+    const table_offset_t end = header->m_directory_end;
+    if (begin > end || end > size ||
+        0 != (end - begin) % sizeof(CompactBigramDirItem)) {
+        delete chunk;
+        return false;
+    }
+
+    m_chunk = chunk;
+
+    /* the view of the directory, without copying. */
+    char * buf_begin = (char *) m_chunk->begin();
+    m_directory.set_chunk(buf_begin + begin, end - begin, NULL);
+    return true;
+}
+
+bool CompactBigram::save(/* in */ Bigram * bigram,
+                         const char * source_filename,
+                         const char * new_filename) {
+    guint32 source_size = 0, source_checksum = 0;
+    if (!compute_source_identity(source_filename,
+                                 source_size, source_checksum))
+        return false;
+
+    GArray * items = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    bigram->get_all_items(items);
+    g_array_sort(items, compare_token);
+
+    GArray * directory = g_array_new
+        (FALSE, FALSE, sizeof(CompactBigramDirItem));
+    GArray * array = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItemWithCount));
+    MemoryChunk content;
+
+    for (size_t i = 0; i < items->len; ++i) {
+        phrase_token_t index = g_array_index(items, phrase_token_t, i);
+
+        SingleGram * single_gram = NULL;
+        if (!bigram->load(index, single_gram))
+            continue;
+
+        CompactBigramDirItem item;
+        item.m_token = index;
+        assert(single_gram->get_total_freq(item.m_total_freq));
+        item.m_length = single_gram->get_length();
+        item.m_offset = content.size();
+
+        g_array_set_size(array, 0);
+        single_gram->retrieve_all(array);
+
+        phrase_token_t last_token = null_token;
+        for (size_t k = 0; k < array->len; ++k) {
+            BigramPhraseItemWithCount * phrase = &g_array_index
+                (array, BigramPhraseItemWithCount, k);
+
+            append_varint(content, phrase->m_token - last_token);
+            append_varint(content, phrase->m_count);
+            last_token = phrase->m_token;
+        }
+
+        item.m_size = content.size() - item.m_offset;
+        g_array_append_val(directory, item);
+
+        delete single_gram;
+    }
+
+    compact_bigram_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.m_magic = COMPACT_BIGRAM_MAGIC;
+    header.m_version = COMPACT_BIGRAM_VERSION;
+    header.m_directory_begin = sizeof(compact_bigram_header_t);
+    header.m_directory_end = header.m_directory_begin +
+        directory->len * sizeof(CompactBigramDirItem);
+    header.m_source_size = source_size;
+    header.m_source_checksum = source_checksum;
+
+    /* the content follows the directory. */
+    const table_offset_t content_offset = header.m_directory_end;
+    for (size_t i = 0; i < directory->len; ++i) {
+        CompactBigramDirItem * item = &g_array_index
+            (directory, CompactBigramDirItem, i);
+        item->m_offset += content_offset;
+    }
+
+    MemoryChunk new_chunk;
+    new_chunk.set_content(0, &header, sizeof(header));
+    new_chunk.set_content(header.m_directory_begin, directory->data,
+                          directory->len * sizeof(CompactBigramDirItem));
+    new_chunk.set_content(content_offset, content.begin(), content.size());
+
+    g_array_free(array, TRUE);
+    g_array_free(directory, TRUE);
+    g_array_free(items, TRUE);
+
+    int ret = unlink(new_filename);
+    if (ret != 0 && errno != ENOENT)
+        return false;
+
+    return new_chunk.save(new_filename);
+}
+
+bool CompactBigram::load(/* in */ phrase_token_t index,
+                         /* out */ CompactSingleGram & single_gram) const {
+    if (NULL == m_chunk)
+        return false;
+
+    const CompactBigramDirItem * begin =
+        (const CompactBigramDirItem *) m_directory.begin();
+    const CompactBigramDirItem * end =
+        (const CompactBigramDirItem *) m_directory.end();
+
+    CompactBigramDirItem item;
+    item.m_token = index;
+    const CompactBigramDirItem * cur = std_lite::lower_bound
+        (begin, end, item, dir_item_less_than);
+
+    if (cur == end || cur->m_token != index)
+        return false;
+
+    const size_t size = m_chunk->size();
+    if (cur->m_offset > size || cur->m_size > size - cur->m_offset)
+        return false;
+
+    const guint8 * buf_begin = (const guint8 *) m_chunk->begin();
+    single_gram.m_begin = buf_begin + cur->m_offset;
+    single_gram.m_end = single_gram.m_begin + cur->m_size;
+    single_gram.m_total_freq = cur->m_total_freq;
+    single_gram.m_length = cur->m_length;
+    return true;
+}
+
+bool CompactBigram::get_all_items(/* out */ GArray * items) const {
+    g_array_set_size(items, 0);
+
+    const CompactBigramDirItem * begin =
+        (const CompactBigramDirItem *) m_directory.begin();
+    const CompactBigramDirItem * end =
+        (const CompactBigramDirItem *) m_directory.end();
+
+    for (const CompactBigramDirItem * cur = begin; cur != end; ++cur)
+        g_array_append_val(items, cur->m_token);
+
+    return true;
+}
+
+namespace pinyin{
+
+bool merge_single_gram(SingleGram * merged,
+                       const CompactSingleGram * system,
+                       const SingleGram * user){
+    if (NULL == system && NULL == user)
+        return false;
+
+    if (NULL == system) {
+        merged->m_chunk.set_content(0, user->m_chunk.begin(),
+                                    user->m_chunk.size());
+        merged->m_chunk.set_size(user->m_chunk.size());
+        return true;
+    }
+
+    MemoryChunk & merged_chunk = merged->m_chunk;
+
+    /* clear merged. */
+    merged_chunk.set_size(sizeof(guint32));
+
+    guint32 merged_total = 0, user_total = 0;
+    assert(system->get_total_freq(merged_total));
+    if (user) {
+        assert(user->get_total_freq(user_total));
+        merged_total += user_total;
+    }
+    merged_chunk.set_content(0, &merged_total, sizeof(guint32));
+
+    const SingleGramItem * cur_user = NULL, * user_end = NULL;
+    if (user) {
+        cur_user = (const SingleGramItem *)
+            (((const char *)(user->m_chunk.begin())) + sizeof(guint32));
+        user_end = (const SingleGramItem *) user->m_chunk.end();
+    }
+
+    const guint8 * cur_system = system->m_begin;
+    SingleGramItem system_item;
+    system_item.m_token = null_token; system_item.m_freq = 0;
+
+    while (cur_system < system->m_end) {
+        if (!read_item(cur_system, system->m_end,
+                       system_item.m_token, system_item.m_freq))
+            break;
+
+        /* add the smaller user items. */
+        while (cur_user < user_end &&
+               cur_user->m_token < system_item.m_token) {
+            merged_chunk.append_content(cur_user, sizeof(SingleGramItem));
+            cur_user++;
+        }
+
+        SingleGramItem merged_item = system_item;
+        if (cur_user < user_end &&
+            cur_user->m_token == system_item.m_token) {
+            merged_item.m_freq += cur_user->m_freq;
+            cur_user++;
+        }
+
+        merged_chunk.append_content(&merged_item, sizeof(SingleGramItem));
+    }
+
+    /* add remained items. */
+    while (cur_user < user_end) {
+        merged_chunk.append_content(cur_user, sizeof(SingleGramItem));
+        cur_user++;
+    }
+
+    return true;
+}
+
+};
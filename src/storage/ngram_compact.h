@@ -0,0 +1,270 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef NGRAM_COMPACT_H
+#define NGRAM_COMPACT_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "memory_chunk.h"
+#include "ngram.h"
+
+namespace pinyin{
+
+/* "CBG1" in little endian. */
+#define COMPACT_BIGRAM_MAGIC 0x31474243
+#define COMPACT_BIGRAM_VERSION 2
+
+/**
+ * compact_bigram_header_t:
+ *
+ * The file header of the compact bi-gram.
+ *
+ * Note:
+ *   The directory is [m_directory_begin, m_directory_end) in the file,
+ *   an array of CompactBigramDirItem sorted by the previous token.
+ *   The content of each single gram is a stream of varint pairs,
+ *   the delta of the token from the previous item and the frequency.
+ *   The size and the checksum of the source bi-gram file are recorded,
+ *   to detect the compact bi-gram which is stale against the source.
+ *
+ */
+struct compact_bigram_header_t{
+    guint32 m_magic;
+    guint32 m_version;
+    table_offset_t m_directory_begin;
+    table_offset_t m_directory_end;
+    guint32 m_source_size;
+    guint32 m_source_checksum;
+};
+
+/**
+ * CompactBigramDirItem:
+ *
+ * The directory item of the compact bi-gram, points to the content
+ * in the same file.
+ *
+ */
+struct CompactBigramDirItem{
+    phrase_token_t m_token;
+    guint32 m_total_freq;
+    guint32 m_length;
+    table_offset_t m_offset;
+    guint32 m_size;
+};
+
+/**
+ * CompactSingleGram:
+ *
+ * The read-only view of one single gram in the compact bi-gram,
+ * decoded on the fly without copying.
+ *
+ */
+class CompactSingleGram{
+    friend class CompactBigram;
+    friend bool merge_single_gram(SingleGram * merged,
+                                  const CompactSingleGram * system,
+                                  const SingleGram * user);
+
+private:
+    const guint8 * m_begin;
+    const guint8 * m_end;
+    guint32 m_total_freq;
+    guint32 m_length;
+
+public:
+    /**
+     * CompactSingleGram::CompactSingleGram:
+     *
+     * The constructor of the CompactSingleGram.
+     *
+     */
+    CompactSingleGram();
+
+    /**
+     * CompactSingleGram::get_length:
+     * @returns: the number of items in this single gram.
+     *
+     * Get the number of items in this single gram.
+     *
+     */
+    guint32 get_length() const {
+        return m_length;
+    }
+
+    /**
+     * CompactSingleGram::get_total_freq:
+     * @total: the total frequency.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the total frequency of this single gram.
+     *
+     */
+    bool get_total_freq(guint32 & total) const {
+        total = m_total_freq;
+        return true;
+    }
+
+    /**
+     * CompactSingleGram::retrieve_all:
+     * @array: the GArray to store the retrieved bi-gram phrase item.
+     * @returns: whether the retrieve operation is successful.
+     *
+     * Retrieve all bi-gram phrase items in this single gram.
+     *
+     */
+    bool retrieve_all(/* out */ BigramPhraseWithCountArray array) const;
+
+    /**
+     * CompactSingleGram::search:
+     * @range: the token range.
+     * @array: the GArray to store the matched bi-gram phrase item.
+     * @returns: whether the search operation is successful.
+     *
+     * Search the bi-gram phrase items according to the token range,
+     * the same as SingleGram::search.
+     *
+     */
+    bool search(/* in */ PhraseIndexRange * range,
+                /* out */ BigramPhraseArray array) const;
+
+    /**
+     * CompactSingleGram::get_freq:
+     * @token: the phrase token.
+     * @freq: the frequency of the token.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the frequency of the token in this single gram.
+     *
+     */
+    bool get_freq(/* in */ phrase_token_t token,
+                  /* out */ guint32 & freq) const;
+};
+
+/**
+ * CompactBigram:
+ *
+ * The read-only system bi-gram in the compact format,
+ * generated by import_interpolation and memory mapped when loading.
+ *
+ * Note:
+ *   The single grams are the views of the mapped file, the load
+ *   is reentrant without any lock, and allocates no memory.
+ *
+ */
+class CompactBigram{
+private:
+    /* the mapped file. */
+    MemoryChunk * m_chunk;
+
+    /* the directory of the mapped file. */
+    MemoryChunk m_directory;
+
+    void reset();
+
+public:
+    /**
+     * CompactBigram::CompactBigram:
+     *
+     * The constructor of the CompactBigram.
+     *
+     */
+    CompactBigram();
+
+    /**
+     * CompactBigram::~CompactBigram:
+     *
+     * The destructor of the CompactBigram.
+     *
+     */
+    ~CompactBigram();
+
+    /**
+     * CompactBigram::attach:
+     * @filename: the file name of the compact bi-gram.
+     * @source_filename: the file name of the source bi-gram, or NULL.
+     * @returns: whether the attach operation is successful.
+     *
+     * Map the compact bi-gram from the file, fails when the file is not
+     * in the compact format, or is not converted from the source bi-gram.
+     *
+     */
+    bool attach(const char * filename, const char * source_filename);
+
+    /**
+     * CompactBigram::save:
+     * @bigram: the bi-gram to be converted.
+     * @source_filename: the file name of the bi-gram, or NULL.
+     * @new_filename: the file name to store the compact bi-gram.
+     * @returns: whether the save operation is successful.
+     *
+     * Convert all single grams of the bi-gram into the compact format,
+     * and write them into the file with the identity of the source file.
+     *
+     * Note: the bi-gram should be flushed into the source file before.
+     *
+     */
+    static bool save(/* in */ Bigram * bigram,
+                     const char * source_filename,
+                     const char * new_filename);
+
+    /**
+     * CompactBigram::load:
+     * @index: the previous token in the bi-gram.
+     * @single_gram: the view of the single gram of the previous token.
+     * @returns: whether the single gram exists.
+     *
+     * Load the view of the single gram of the previous token,
+     * the view is valid until the compact bi-gram is destroyed.
+     *
+     */
+    bool load(/* in */ phrase_token_t index,
+              /* out */ CompactSingleGram & single_gram) const;
+
+    /**
+     * CompactBigram::get_all_items:
+     * @items: the GArray to store all previous tokens.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the array of all previous tokens.
+     *
+     */
+    bool get_all_items(/* out */ GArray * items) const;
+};
+
+/**
+ * merge_single_gram:
+ * @merged: the merged single gram of system and user single gram.
+ * @system: the view of the system single gram to be merged.
+ * @user: the user single gram to be merged.
+ * @returns: whether the single gram exists.
+ *
+ * Merge the compact system single gram and the user single gram,
+ * the content is always copied into the merged single gram.
+ *
+ */
+bool merge_single_gram(SingleGram * merged,
+                       const CompactSingleGram * system,
+                       const SingleGram * user);
+
+};
+
+#endif
@@ -96,6 +96,45 @@ bool Bigram::save_db(const char * dbfile){
     return true;
 }
 
+bool Bigram::copy_db(Bigram * new_bigram) {
+    new_bigram->reset();
+
+    /* create in-memory db. */
+    new_bigram->m_db = new ProtoHashDB;
+
+    if (!new_bigram->m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    CopyVisitor visitor(new_bigram->m_db);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
+bool Bigram::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    /* create in-memory db. */
+    m_db = new ProtoHashDB;
+
+    if (!m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    return restore_kyotodb(chunk, m_db);
+}
+
+bool Bigram::save_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    new_chunk->set_size(0);
+
+    DumpVisitor visitor(new_chunk);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
 bool Bigram::attach(const char * dbfile, guint32 flags){
     reset();
     uint32_t mode = attach_options(flags);
@@ -122,12 +161,12 @@ bool Bigram::load(phrase_token_t index, SingleGram * & single_gram,
     if (-1 == vsiz)
         return false;
 
-    m_chunk.set_size(vsiz);
-    char * vbuf = (char *) m_chunk.begin();
+    /* read into the new single gram, the load is reentrant. */
+    single_gram = new SingleGram;
+    single_gram->m_chunk.set_size(vsiz);
+    char * vbuf = (char *) single_gram->m_chunk.begin();
     assert (vsiz == m_db->get(kbuf, sizeof(phrase_token_t),
                               vbuf, vsiz));
-
-    single_gram = new SingleGram(m_chunk.begin(), vsiz, copy);
     return true;
 }
 
@@ -222,3 +261,194 @@ bool Bigram::mask_out(phrase_token_t mask, phrase_token_t value){
     g_array_free(items, TRUE);
     return true;
 }
+
+
+Trigram::Trigram(){
+    m_db = NULL;
+}
+
+Trigram::~Trigram(){
+    reset();
+}
+
+void Trigram::reset(){
+    if ( m_db ){
+        m_db->synchronize();
+        m_db->close();
+        delete m_db;
+        m_db = NULL;
+    }
+}
+
+/* Use ProtoHashDB for load_db/save_db methods. */
+bool Trigram::load_db(const char * dbfile){
+    reset();
+
+    /* create in-memory db. */
+    m_db = new ProtoHashDB;
+
+    if ( !m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE) )
+        return false;
+
+    /* load db into memory. */
+    BasicDB * tmp_db = new HashDB;
+    if (!tmp_db->open(dbfile, BasicDB::OREADER))
+        return false;
+
+    CopyVisitor visitor(m_db);
+    tmp_db->iterate(&visitor, false);
+
+    tmp_db->close();
+    delete tmp_db;
+
+    return true;
+}
+
+bool Trigram::save_db(const char * dbfile){
+
+    int ret = unlink(dbfile);
+    if ( ret != 0 && errno != ENOENT)
+        return false;
+
+    BasicDB * tmp_db = new HashDB;
+
+    if ( !tmp_db->open(dbfile, BasicDB::OWRITER|BasicDB::OCREATE) )
+        return false;
+
+    CopyVisitor visitor(tmp_db);
+    m_db->iterate(&visitor, false);
+
+    tmp_db->synchronize();
+    tmp_db->close();
+    delete tmp_db;
+
+    return true;
+}
+
+bool Trigram::attach(const char * dbfile, guint32 flags){
+    reset();
+    uint32_t mode = attach_options(flags);
+
+    if (!dbfile)
+        return false;
+
+    m_db = new HashDB;
+
+    return m_db->open(dbfile, mode);
+}
+
+/* Use DB interface, first check, second reserve the memory chunk,
+   third get value into the chunk. */
+bool Trigram::load(const TrigramKey & index, SingleGram * & single_gram,
+                   bool copy){
+    single_gram = NULL;
+    if ( !m_db )
+        return false;
+
+    const char * kbuf = (char *) &index;
+    const int32_t vsiz = m_db->check(kbuf, sizeof(TrigramKey));
+    /* -1 on failure. */
+    if (-1 == vsiz)
+        return false;
+
+    /* read into the new single gram, the load is reentrant. */
+    single_gram = new SingleGram;
+    single_gram->m_chunk.set_size(vsiz);
+    char * vbuf = (char *) single_gram->m_chunk.begin();
+    assert (vsiz == m_db->get(kbuf, sizeof(TrigramKey),
+                              vbuf, vsiz));
+    return true;
+}
+
+bool Trigram::store(const TrigramKey & index, SingleGram * single_gram){
+    if ( !m_db )
+        return false;
+
+    const char * kbuf = (char *) &index;
+    char * vbuf = (char *) single_gram->m_chunk.begin();
+    size_t vsiz = single_gram->m_chunk.size();
+    return m_db->set(kbuf, sizeof(TrigramKey), vbuf, vsiz);
+}
+
+bool Trigram::remove(/* in */ const TrigramKey & index){
+    if ( !m_db )
+        return false;
+
+    const char * kbuf = (char *) &index;
+    return m_db->remove(kbuf, sizeof(TrigramKey));
+}
+
+class TrigramKeyCollectVisitor : public DB::Visitor {
+private:
+    TrigramKeyArray m_items;
+public:
+    TrigramKeyCollectVisitor(TrigramKeyArray items) {
+        m_items = items;
+    }
+
+    virtual const char* visit_full(const char* kbuf, size_t ksiz,
+                                   const char* vbuf, size_t vsiz, size_t* sp) {
+        assert(ksiz == sizeof(TrigramKey));
+        const TrigramKey * index = (TrigramKey *) kbuf;
+        g_array_append_val(m_items, *index);
+        return NOP;
+    }
+
+    virtual const char* visit_empty(const char* kbuf, size_t ksiz, size_t* sp) {
+        /* assume no empty record. */
+        assert (FALSE);
+        return NOP;
+    }
+};
+
+bool Trigram::get_all_items(TrigramKeyArray items){
+    g_array_set_size(items, 0);
+
+    if ( !m_db )
+        return false;
+
+    TrigramKeyCollectVisitor visitor(items);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
+/* Note: sync mask_out code with ngram_bdb.cpp. */
+bool Trigram::mask_out(phrase_token_t mask, phrase_token_t value){
+    GArray * items = g_array_new(FALSE, FALSE, sizeof(TrigramKey));
+
+    if (!get_all_items(items)) {
+        g_array_free(items, TRUE);
+        return false;
+    }
+
+    for (size_t i = 0; i < items->len; ++i) {
+        const TrigramKey index = g_array_index(items, TrigramKey, i);
+
+        if ((index.m_tokens[0] & mask) == value ||
+            (index.m_tokens[1] & mask) == value) {
+            assert(remove(index));
+            continue;
+        }
+
+        SingleGram * gram = NULL;
+        assert(load(index, gram));
+
+        int num = gram->mask_out(mask, value);
+        if (0 == num) {
+            delete gram;
+            continue;
+        }
+
+        if (0 == gram->get_length()) {
+            assert(remove(index));
+        } else {
+            assert(store(index, gram));
+        }
+
+        delete gram;
+    }
+
+    g_array_free(items, TRUE);
+    return true;
+}
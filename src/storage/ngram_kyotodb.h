@@ -39,9 +39,6 @@ class Bigram{
 private:
     kyotocabinet::BasicDB * m_db;
 
-    /* memory chunk for Kyoto Cabinet. */
-    MemoryChunk m_chunk;
-
     void reset();
 
 public:
@@ -81,6 +78,36 @@ public:
      */
     bool save_db(const char * dbfile);
 
+    /**
+     * Bigram::copy_db:
+     * @new_bigram: the bi-gram to store the copied items.
+     * @returns: whether the copy operation is successful.
+     *
+     * Copy all items into the in-memory DB of the new bi-gram.
+     *
+     */
+    bool copy_db(Bigram * new_bigram);
+
+    /**
+     * Bigram::load_chunk:
+     * @chunk: the memory chunk of the dumped records.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the records into the in-memory DB.
+     *
+     */
+    bool load_chunk(const MemoryChunk * chunk);
+
+    /**
+     * Bigram::save_chunk:
+     * @new_chunk: the memory chunk to store the dumped records.
+     * @returns: whether the save operation is successful.
+     *
+     * Dump the records of the DB into the memory chunk.
+     *
+     */
+    bool save_chunk(MemoryChunk * new_chunk);
+
     /**
      * Bigram::attach:
      * @dbfile: the Berkeley DB file name.
@@ -96,7 +123,7 @@ public:
      * Bigram::load:
      * @index: the previous token in the bi-gram.
      * @single_gram: the single gram of the previous token.
-     * @copy: whether copy content to the single gram.
+     * @copy: unused, the content is always owned by the single gram.
      * @returns: whether the load operation is successful.
      *
      * Load the single gram of the previous token.
@@ -150,6 +177,123 @@ public:
     bool mask_out(phrase_token_t mask, phrase_token_t value);
 };
 
+/**
+ * Trigram:
+ *
+ * The Tri-gram class, the single gram is keyed by the previous two tokens.
+ *
+ */
+class Trigram{
+private:
+    kyotocabinet::BasicDB * m_db;
+
+    void reset();
+
+public:
+    /**
+     * Trigram::Trigram:
+     *
+     * The constructor of the Trigram.
+     *
+     */
+    Trigram();
+
+    /**
+     * Trigram::~Trigram:
+     *
+     * The destructor of the Trigram.
+     *
+     */
+    ~Trigram();
+
+    /**
+     * Trigram::load_db:
+     * @dbfile: the Kyoto Cabinet DB file name.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the Kyoto Cabinet DB into memory.
+     *
+     */
+    bool load_db(const char * dbfile);
+
+    /**
+     * Trigram::save_db:
+     * @dbfile: the Kyoto Cabinet DB file name.
+     * @returns: whether the save operation is successful.
+     *
+     * Save the in-memory Kyoto Cabinet DB into disk.
+     *
+     */
+    bool save_db(const char * dbfile);
+
+    /**
+     * Trigram::attach:
+     * @dbfile: the Kyoto Cabinet DB file name.
+     * @flags: the flags of enum ATTACH_FLAG.
+     * @returns: whether the attach operation is successful.
+     *
+     * Attach this Trigram with the Kyoto Cabinet DB.
+     *
+     */
+    bool attach(const char * dbfile, guint32 flags);
+
+    /**
+     * Trigram::load:
+     * @index: the previous two tokens in the tri-gram.
+     * @single_gram: the single gram of the previous two tokens.
+     * @copy: unused, the content is always owned by the single gram.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the single gram of the previous two tokens.
+     *
+     */
+    bool load(/* in */ const TrigramKey & index,
+              /* out */ SingleGram * & single_gram, bool copy=false);
+
+    /**
+     * Trigram::store:
+     * @index: the previous two tokens in the tri-gram.
+     * @single_gram: the single gram of the previous two tokens.
+     * @returns: whether the store operation is successful.
+     *
+     * Store the single gram of the previous two tokens.
+     *
+     */
+    bool store(/* in */ const TrigramKey & index,
+               /* in */ SingleGram * single_gram);
+
+    /**
+     * Trigram::remove:
+     * @index: the previous two tokens in the tri-gram.
+     * @returns: whether the remove operation is successful.
+     *
+     * Remove the single gram of the previous two tokens.
+     *
+     */
+    bool remove(/* in */ const TrigramKey & index);
+
+    /**
+     * Trigram::get_all_items:
+     * @items: the GArray to store all previous two tokens.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the array of all previous two tokens for parameter estimation.
+     *
+     */
+    bool get_all_items(/* out */ TrigramKeyArray items);
+
+    /**
+     * Trigram::mask_out:
+     * @mask: the mask.
+     * @value: the value.
+     * @returns: whether the mask out operation is successful.
+     *
+     * Mask out the matched items.
+     *
+     */
+    bool mask_out(phrase_token_t mask, phrase_token_t value);
+};
+
 };
 
 #endif
@@ -22,21 +22,29 @@
 #include "phonetic_key_matrix.h"
 #include <assert.h>
 #include <stdio.h>
+#include "stl_lite.h"
 #include "pinyin_custom2.h"
 #include "special_table.h"
 
 namespace pinyin{
 
-/* zero ChewingKey for "'" symbol and last key in fill_matrix function. */
 bool fill_matrix(PhoneticKeyMatrix * matrix,
                  ChewingKeyVector keys,
                  ChewingKeyRestVector key_rests,
                  size_t parsed_len) {
-    matrix->clear_all();
+    return fill_matrix(matrix, keys, key_rests, parsed_len, 0);
+}
 
+/* zero ChewingKey for "'" symbol and last key in fill_matrix function. */
+bool fill_matrix(PhoneticKeyMatrix * matrix,
+                 ChewingKeyVector keys,
+                 ChewingKeyRestVector key_rests,
+                 size_t parsed_len, size_t start) {
     assert(keys->len == key_rests->len);
-    if (0 == keys->len)
+    if (0 == keys->len) {
+        matrix->clear_all();
         return false;
+    }
 
     const ChewingKey * key = NULL;
     const ChewingKeyRest * key_rest = NULL;
@@ -46,14 +54,16 @@ bool fill_matrix(PhoneticKeyMatrix * matrix,
 
     /* one extra slot for the last key. */
     size_t length = parsed_len + 1;
-    matrix->set_size(length);
+    assert(start < length);
+    matrix->set_size(length, start);
 
     /* fill keys and key rests. */
     size_t i;
     for (i = 0; i < keys->len; ++i) {
         key = &g_array_index(keys, ChewingKey, i);
         key_rest = &g_array_index(key_rests, ChewingKeyRest, i);
-        matrix->append(key_rest->m_raw_begin, *key, *key_rest);
+        if (key_rest->m_raw_begin >= start)
+            matrix->append(key_rest->m_raw_begin, *key, *key_rest);
     }
 
     const ChewingKey zero_key;
@@ -72,7 +82,7 @@ bool fill_matrix(PhoneticKeyMatrix * matrix,
         key_rest = &g_array_index(key_rests, ChewingKeyRest, i);
         next_key_rest = &g_array_index(key_rests, ChewingKeyRest, i + 1);
 
-        for (size_t fill = key_rest->m_raw_end;
+        for (size_t fill = std_lite::max((size_t) key_rest->m_raw_end, start);
              fill < next_key_rest->m_raw_begin; ++fill) {
             zero_key_rest.m_raw_begin = fill;
             zero_key_rest.m_raw_end = fill + 1;
@@ -85,52 +95,145 @@ bool fill_matrix(PhoneticKeyMatrix * matrix,
     return true;
 }
 
+MatrixExpansionTable::MatrixExpansionTable() {
+    m_resplit_items = g_array_new
+        (TRUE, TRUE, sizeof(const resplit_table_item_t *));
+    m_resplit_offsets = g_array_new(TRUE, TRUE, sizeof(guint32));
+
+    m_divided_items = g_array_new
+        (TRUE, TRUE, sizeof(const divided_table_item_t *));
+
+    build_special_items();
+}
+
+MatrixExpansionTable::~MatrixExpansionTable() {
+    g_array_free(m_resplit_items, TRUE);
+    m_resplit_items = NULL;
+    g_array_free(m_resplit_offsets, TRUE);
+    m_resplit_offsets = NULL;
+
+    g_array_free(m_divided_items, TRUE);
+    m_divided_items = NULL;
+}
+
+bool MatrixExpansionTable::build_special_items() {
+    const size_t num = get_num_of_key_indexes();
+
+    /* only the first divided item of the key is used. */
+    g_array_set_size(m_divided_items, 0);
+    g_array_set_size(m_divided_items, num);
+
+    size_t k;
+    for (k = 0; k < G_N_ELEMENTS(divided_table); ++k) {
+        const divided_table_item_t * item = divided_table + k;
+
+        const divided_table_item_t * & slot = g_array_index
+            (m_divided_items, const divided_table_item_t *,
+             get_key_index(item->m_orig_struct));
+        if (NULL == slot)
+            slot = item;
+    }
+
+    /* count the resplit items of each key, then place them
+       in the table order. */
+    g_array_set_size(m_resplit_offsets, 0);
+    g_array_set_size(m_resplit_offsets, num + 1);
+
+    for (k = 0; k < G_N_ELEMENTS(resplit_table); ++k) {
+        const resplit_table_item_t * item = resplit_table + k;
+        ++g_array_index(m_resplit_offsets, guint32,
+                        get_key_index(item->m_orig_structs[0]) + 1);
+    }
+
+    size_t i;
+    for (i = 0; i < num; ++i) {
+        g_array_index(m_resplit_offsets, guint32, i + 1) +=
+            g_array_index(m_resplit_offsets, guint32, i);
+    }
+
+    g_array_set_size(m_resplit_items, G_N_ELEMENTS(resplit_table));
+
+    GArray * cursors = g_array_new(FALSE, FALSE, sizeof(guint32));
+    g_array_append_vals(cursors, m_resplit_offsets->data, num);
+
+    for (k = 0; k < G_N_ELEMENTS(resplit_table); ++k) {
+        const resplit_table_item_t * item = resplit_table + k;
+        guint32 & cursor = g_array_index
+            (cursors, guint32, get_key_index(item->m_orig_structs[0]));
+
+        g_array_index(m_resplit_items, const resplit_table_item_t *,
+                      cursor) = item;
+        ++cursor;
+    }
+
+    g_array_free(cursors, TRUE);
+    return true;
+}
+
+const MatrixExpansionTable * get_matrix_expansion_table() {
+    static gsize expansion_table = 0;
+
+    if (g_once_init_enter(&expansion_table)) {
+        /* the shared table is never freed. */
+        MatrixExpansionTable * table = new MatrixExpansionTable;
+        g_once_init_leave(&expansion_table, (gsize) table);
+    }
+
+    return (const MatrixExpansionTable *) expansion_table;
+}
+
 bool resplit_step(pinyin_option_t options,
                   PhoneticKeyMatrix * matrix) {
+    return resplit_step(options, matrix, 0, 0);
+}
+
+bool resplit_step(pinyin_option_t options,
+                  PhoneticKeyMatrix * matrix,
+                  size_t start, size_t stable) {
     if (!(options & USE_RESPLIT_TABLE))
         return false;
 
+    const MatrixExpansionTable * table = get_matrix_expansion_table();
+
     size_t length = matrix->size();
     if (0 == length)
         return false;
 
-    GArray * keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    GArray * key_rests = g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
-
-    GArray * next_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    GArray * next_key_rests = g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+    /* the appends below move the columns, so the items are copied
+       by the row, and only the rows before the appends are walked. */
 
     /* skip the last column */
-    for (size_t index = 0; index < length - 1; ++index) {
-        matrix->get_items(index, keys, key_rests);
-        if (0 == keys->len)
+    for (size_t index = start; index < length - 1; ++index) {
+        const size_t size = matrix->get_column_size(index);
+        if (0 == size)
             continue;
 
-        for (size_t i = 0; i < keys->len; ++i) {
-            const ChewingKey key = g_array_index(keys, ChewingKey, i);
-            const ChewingKeyRest key_rest = g_array_index(key_rests,
-                                                      ChewingKeyRest, i);
+        for (size_t i = 0; i < size; ++i) {
+            ChewingKey key; ChewingKeyRest key_rest;
+            matrix->get_item(index, i, key, key_rest);
+
+            /* As no resplit table used in the FullPinyinParser2,
+               only one-way match is needed, this is simpler. */
+            const resplit_table_item_t * const * items = NULL;
+            size_t num_items = 0;
+            table->get_resplit_items(key, items, num_items);
+            if (0 == num_items)
+                continue;
 
             size_t midindex = key_rest.m_raw_end;
-            matrix->get_items(midindex, next_keys, next_key_rests);
-            assert(next_keys->len == next_key_rests->len);
-            if (0 == next_keys->len)
+            const size_t next_size = matrix->get_column_size(midindex);
+            if (0 == next_size)
                 continue;
 
-            for (size_t j = 0; j < next_keys->len; ++j) {
-                const ChewingKey next_key = g_array_index
-                    (next_keys, ChewingKey, j);
-                const ChewingKeyRest next_key_rest = g_array_index
-                    (next_key_rests, ChewingKeyRest, j);
+            for (size_t j = 0; j < next_size; ++j) {
+                ChewingKey next_key; ChewingKeyRest next_key_rest;
+                matrix->get_item(midindex, j, next_key, next_key_rest);
 
-                /* lookup resplit table */
+                /* lookup resplit items of the key */
                 size_t k;
                 const resplit_table_item_t * item = NULL;
-                for (k = 0; k < G_N_ELEMENTS(resplit_table); ++k) {
-                    item = resplit_table + k;
-
-                    /* As no resplit table used in the FullPinyinParser2,
-                       only one-way match is needed, this is simpler. */
+                for (k = 0; k < num_items; ++k) {
+                    item = items[k];
 
                     /* "'" is filled by zero key of ChewingKey. */
                     if (key == item->m_orig_structs[0] &&
@@ -139,91 +242,144 @@ bool resplit_step(pinyin_option_t options,
                 }
 
                 /* found the match */
-                if (k < G_N_ELEMENTS(resplit_table)) {
+                if (k < num_items) {
                     /* resplit the key */
-                    item = resplit_table + k;
-
                     size_t newindex = index + strlen(item->m_new_keys[0]);
 
+                    /* the columns before the stable column are kept. */
                     ChewingKey newkey = item->m_new_structs[0];
                     ChewingKeyRest newkeyrest = key_rest;
                     newkeyrest.m_raw_end = newindex;
-                    matrix->append(index, newkey, newkeyrest);
+                    if (index >= stable)
+                        matrix->append(index, newkey, newkeyrest);
 
                     newkey = item->m_new_structs[1];
                     newkeyrest = next_key_rest;
                     newkeyrest.m_raw_begin = newindex;
-                    matrix->append(newindex, newkey, newkeyrest);
+                    if (newindex >= stable)
+                        matrix->append(newindex, newkey, newkeyrest);
                 }
             }
         }
     }
 
-    g_array_free(next_keys, TRUE);
-    g_array_free(next_key_rests, TRUE);
-
-    g_array_free(keys, TRUE);
-    g_array_free(key_rests, TRUE);
     return true;
 }
 
 bool inner_split_step(pinyin_option_t options,
                       PhoneticKeyMatrix * matrix) {
+    return inner_split_step(options, matrix, 0, 0);
+}
+
+bool inner_split_step(pinyin_option_t options,
+                      PhoneticKeyMatrix * matrix,
+                      size_t start, size_t stable) {
     if (!(options & USE_DIVIDED_TABLE))
         return false;
 
+    const MatrixExpansionTable * table = get_matrix_expansion_table();
+
     size_t length = matrix->size();
     if (0 == length)
         return false;
 
-    GArray * keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    GArray * key_rests = g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
-
-    for (size_t index = 0; index < length; ++index) {
-        matrix->get_items(index, keys, key_rests);
-        if (0 ==  keys->len)
+    /* the appends below move the columns, copy the items by the row. */
+    for (size_t index = start; index < length; ++index) {
+        const size_t size = matrix->get_column_size(index);
+        if (0 == size)
             continue;
 
-        for (size_t i = 0; i < keys->len; ++i) {
-            const ChewingKey key = g_array_index(keys, ChewingKey, i);
-            const ChewingKeyRest key_rest = g_array_index(key_rests,
-                                                          ChewingKeyRest, i);
+        for (size_t i = 0; i < size; ++i) {
+            ChewingKey key; ChewingKeyRest key_rest;
+            matrix->get_item(index, i, key, key_rest);
 
-            /* lookup divided table */
-            size_t k;
-            const divided_table_item_t * item = NULL;
-            for (k = 0; k < G_N_ELEMENTS(divided_table); ++k) {
-                item = divided_table + k;
-
-                if (key == item->m_orig_struct)
-                    break;
-            }
+            /* lookup divided item of the key */
+            const divided_table_item_t * item =
+                table->get_divided_item(key);
 
             /* found the match */
-            if (k < G_N_ELEMENTS(divided_table)) {
+            if (item && key == item->m_orig_struct) {
                 /* divide the key */
-                item = divided_table + k;
-
                 size_t newindex = index + strlen(item->m_new_keys[0]);
 
+                /* the columns before the stable column are kept. */
                 ChewingKey newkey = item->m_new_structs[0];
                 ChewingKeyRest newkeyrest = key_rest;
                 newkeyrest.m_raw_end = newindex;
-                matrix->append(index, newkey, newkeyrest);
+                if (index >= stable)
+                    matrix->append(index, newkey, newkeyrest);
 
                 newkey = item->m_new_structs[1];
                 newkeyrest = key_rest;
                 newkeyrest.m_raw_begin = newindex;
-                matrix->append(newindex, newkey, newkeyrest);
+                if (newindex >= stable)
+                    matrix->append(newindex, newkey, newkeyrest);
             }
         }
     }
 
-    g_array_free(keys, TRUE);
-    g_array_free(key_rests, TRUE);
     return true;
 }
 
+size_t update_matrix(pinyin_option_t options,
+                     PhoneticKeyMatrix * matrix,
+                     ChewingKeyVector last_keys,
+                     ChewingKeyRestVector last_key_rests,
+                     size_t last_parsed_len,
+                     ChewingKeyVector keys,
+                     ChewingKeyRestVector key_rests,
+                     size_t parsed_len) {
+    assert(keys->len == key_rests->len);
+
+    /* the common keys with the last keys. */
+    size_t num_keys = 0;
+    if (last_keys) {
+        assert(last_keys->len == last_key_rests->len);
+
+        const size_t len = std_lite::min(last_keys->len, keys->len);
+        for (; num_keys < len; ++num_keys) {
+            const ChewingKey & last_key = g_array_index
+                (last_keys, ChewingKey, num_keys);
+            const ChewingKeyRest & last_key_rest = g_array_index
+                (last_key_rests, ChewingKeyRest, num_keys);
+            const ChewingKey & key = g_array_index
+                (keys, ChewingKey, num_keys);
+            const ChewingKeyRest & key_rest = g_array_index
+                (key_rests, ChewingKeyRest, num_keys);
+
+            if (last_key != key ||
+                last_key_rest.m_raw_begin != key_rest.m_raw_begin ||
+                last_key_rest.m_raw_end != key_rest.m_raw_end)
+                break;
+        }
+
+        /* nothing changed. */
+        if (num_keys == last_keys->len && num_keys == keys->len &&
+            last_parsed_len == parsed_len)
+            return matrix->size();
+    }
+
+    /* the resplit step pairs the key with its next key, and appends
+       the second new key into the next key, so the columns from the key
+       before the first changed key are refilled, and the steps are
+       re-run from one more key before. */
+    size_t start = 0, stable = 0;
+    if (num_keys >= 1)
+        stable = g_array_index(key_rests, ChewingKeyRest,
+                               num_keys - 1).m_raw_begin;
+    if (num_keys >= 2)
+        start = g_array_index(key_rests, ChewingKeyRest,
+                              num_keys - 2).m_raw_begin;
+
+    fill_matrix(matrix, keys, key_rests, parsed_len, stable);
+
+    resplit_step(options, matrix, start, stable);
+
+    inner_split_step(options, matrix, start, stable);
+
+    return stable;
+}
+
 bool fuzzy_syllable_step(pinyin_option_t options,
                          PhoneticKeyMatrix * matrix) {
     if (!(options & PINYIN_AMB_ALL))
@@ -233,20 +389,17 @@ bool fuzzy_syllable_step(pinyin_option_t options,
     if (0 == length)
         return false;
 
-    GArray * keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    GArray * key_rests = g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
-
+    /* the appends below move the columns, copy the items by the row. */
     for (size_t index = 0; index < length; ++index) {
         /* for pinyin initials. */
-        matrix->get_items(index, keys, key_rests);
-        if (0 == keys->len)
+        size_t size = matrix->get_column_size(index);
+        if (0 == size)
             continue;
 
         size_t i = 0;
-        for (i = 0; i < keys->len; ++i) {
-            const ChewingKey key = g_array_index(keys, ChewingKey, i);
-            const ChewingKeyRest key_rest = g_array_index(key_rests,
-                                                          ChewingKeyRest, i);
+        for (i = 0; i < size; ++i) {
+            ChewingKey key; ChewingKeyRest key_rest;
+            matrix->get_item(index, i, key, key_rest);
 
 #define MATCH(AMBIGUITY, ORIGIN, ANOTHER) do {                          \
                 if (options & AMBIGUITY) {                              \
@@ -280,13 +433,12 @@ bool fuzzy_syllable_step(pinyin_option_t options,
         }
 
         /* for pinyin finals. */
-        matrix->get_items(index, keys, key_rests);
-        assert(0 != keys->len);
+        size = matrix->get_column_size(index);
+        assert(0 != size);
 
-        for (i = 0; i < keys->len; ++i) {
-            const ChewingKey key = g_array_index(keys, ChewingKey, i);
-            const ChewingKeyRest key_rest = g_array_index(key_rests,
-                                                          ChewingKeyRest, i);
+        for (i = 0; i < size; ++i) {
+            ChewingKey key; ChewingKeyRest key_rest;
+            matrix->get_item(index, i, key, key_rest);
 
 #define MATCH(AMBIGUITY, ORIGIN, ANOTHER) do {                     \
                 if (options & AMBIGUITY) {                         \
@@ -311,8 +463,6 @@ bool fuzzy_syllable_step(pinyin_option_t options,
         }
     }
 
-    g_array_free(keys, TRUE);
-    g_array_free(key_rests, TRUE);
     return true;
 }
 
@@ -320,20 +470,19 @@ bool fuzzy_syllable_step(pinyin_option_t options,
 bool dump_matrix(PhoneticKeyMatrix * matrix) {
     size_t length = matrix->size();
 
-    GArray * keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
-    GArray * key_rests = g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
-
     for (size_t index = 0; index < length; ++index) {
-        matrix->get_items(index, keys, key_rests);
-        if (0 == keys->len)
+        const ChewingKey * keys = NULL;
+        const ChewingKeyRest * key_rests = NULL;
+        size_t size = 0;
+        matrix->get_column(index, keys, key_rests, size);
+        if (0 == size)
             continue;
 
         printf("Column:%ld:\n", index);
 
-        for (size_t i = 0; i < keys->len; ++i) {
-            ChewingKey key = g_array_index(keys, ChewingKey, i);
-            ChewingKeyRest key_rest = g_array_index(key_rests,
-                                                    ChewingKeyRest, i);
+        for (size_t i = 0; i < size; ++i) {
+            ChewingKey key = keys[i];
+            const ChewingKeyRest & key_rest = key_rests[i];
 
             gchar * pinyin = key.get_pinyin_string();
             printf("ChewingKey:%s\n", pinyin);
@@ -343,12 +492,11 @@ bool dump_matrix(PhoneticKeyMatrix * matrix) {
         }
     }
 
-    g_array_free(keys, TRUE);
-    g_array_free(key_rests, TRUE);
     return true;
 }
 
-int search_matrix_recur(GArray * cached_keys,
+int search_matrix_recur(pinyin_option_t options,
+                        GArray * cached_keys,
                         FacadeChewingTable2 * table,
                         PhoneticKeyMatrix * matrix,
                         size_t start, size_t end,
@@ -371,18 +519,22 @@ int search_matrix_recur(GArray * cached_keys,
         printf("search table:%d\n", cached_keys->len);
 #endif
         return table->search(cached_keys->len,
-                             (ChewingKey *)cached_keys->data, ranges);
+                             (ChewingKey *)cached_keys->data, ranges,
+                             options);
     }
 
     int result = SEARCH_NONE;
 
-    const size_t size = matrix->get_column_size(start);
+    const ChewingKey * keys = NULL;
+    const ChewingKeyRest * key_rests = NULL;
+    size_t size = 0;
+    matrix->get_column(start, keys, key_rests, size);
     /* assume pinyin parsers will filter invalid keys. */
     assert(size > 0);
 
     for (size_t i = 0; i < size; ++i) {
-        ChewingKey key; ChewingKeyRest key_rest;
-        matrix->get_item(start, i, key, key_rest);
+        const ChewingKey & key = keys[i];
+        const ChewingKeyRest & key_rest = key_rests[i];
 
         const size_t newstart = key_rest.m_raw_end;
 
@@ -390,7 +542,7 @@ int search_matrix_recur(GArray * cached_keys,
         if (zero_key == key) {
             /* assume only one key here for "'" or the last key. */
             assert(1 == size);
-            return search_matrix_recur(cached_keys, table, matrix,
+            return search_matrix_recur(options, cached_keys, table, matrix,
                                        newstart, end, ranges, longest);
         }
 
@@ -398,7 +550,7 @@ int search_matrix_recur(GArray * cached_keys,
         g_array_append_val(cached_keys, key);
         longest = std_lite::max(longest, newstart);
 
-        result |= search_matrix_recur(cached_keys, table, matrix,
+        result |= search_matrix_recur(options, cached_keys, table, matrix,
                                       newstart, end, ranges, longest);
 
         /* pop value */
@@ -408,7 +560,8 @@ int search_matrix_recur(GArray * cached_keys,
     return result;
 }
 
-int search_matrix(FacadeChewingTable2 * table,
+int search_matrix(pinyin_option_t options,
+                  FacadeChewingTable2 * table,
                   PhoneticKeyMatrix * matrix,
                   size_t start, size_t end,
                   PhraseIndexRanges ranges) {
@@ -426,7 +579,7 @@ int search_matrix(FacadeChewingTable2 * table,
     GArray * cached_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
 
     size_t longest = 0;
-    int result = search_matrix_recur(cached_keys, table, matrix,
+    int result = search_matrix_recur(options, cached_keys, table, matrix,
                                      start, end, ranges, longest);
 
     /* if any recur search return SEARCH_CONTINUED or longest > end,
@@ -460,13 +613,16 @@ gfloat compute_pronunciation_possibility_recur(PhoneticKeyMatrix * matrix,
 
     gfloat result = 0.;
 
-    const size_t size = matrix->get_column_size(start);
+    const ChewingKey * keys = NULL;
+    const ChewingKeyRest * key_rests = NULL;
+    size_t size = 0;
+    matrix->get_column(start, keys, key_rests, size);
     /* assume pinyin parsers will filter invalid keys. */
     assert(size > 0);
 
     for (size_t i = 0; i < size; ++i) {
-        ChewingKey key; ChewingKeyRest key_rest;
-        matrix->get_item(start, i, key, key_rest);
+        const ChewingKey & key = keys[i];
+        const ChewingKeyRest & key_rest = key_rests[i];
 
         const size_t newstart = key_rest.m_raw_end;
 
@@ -528,13 +684,16 @@ bool increase_pronunciation_possibility_recur(PhoneticKeyMatrix * matrix,
 
     bool result = false;
 
-    const size_t size = matrix->get_column_size(start);
+    const ChewingKey * keys = NULL;
+    const ChewingKeyRest * key_rests = NULL;
+    size_t size = 0;
+    matrix->get_column(start, keys, key_rests, size);
     /* assume pinyin parsers will filter invalid keys. */
     assert(size > 0);
 
     for (size_t i = 0; i < size; ++i) {
-        ChewingKey key; ChewingKeyRest key_rest;
-        matrix->get_item(start, i, key, key_rest);
+        const ChewingKey & key = keys[i];
+        const ChewingKeyRest & key_rest = key_rests[i];
 
         const size_t newstart = key_rest.m_raw_end;
 
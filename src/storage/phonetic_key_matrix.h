@@ -23,6 +23,7 @@
 #define PHONETIC_KEY_MATRIX_H
 
 #include <assert.h>
+#include <string.h>
 #include "novel_types.h"
 #include "chewing_key.h"
 #include "facade_chewing_table2.h"
@@ -30,37 +31,85 @@
 
 namespace pinyin {
 
+/**
+ * PhoneticTable:
+ *
+ * The columns of the items, stored as the slices of one item array.
+ *
+ * Note:
+ *   Each column is one contiguous slice, the append moves the column to
+ *   the end of the items when it is not there yet, and the unused items
+ *   are reclaimed by compacting the columns.
+ *   The item array is reused after set_size, without reallocation.
+ *   The views of get_column are valid until the next append, set_size
+ *   or clear_all.
+ *
+ */
 template<typename Item>
 class PhoneticTable {
 protected:
-    /* Pointer Array of Array of Item. */
-    GPtrArray * m_table_content;
+    /* the slice of one column. */
+    typedef struct {
+        size_t m_begin;
+        size_t m_len;
+    } column_t;
+
+    /* Array of Item, holds the slices of all columns. */
+    GArray * m_items;
+    /* Array of column_t, one per column. */
+    GArray * m_columns;
+    /* the number of the items not in any column. */
+    size_t m_unused;
+
+    /* Array of Item, the compacted items are swapped with m_items. */
+    GArray * m_compacted;
+
+    /* move all columns to the start of the items in the column order. */
+    bool compact() {
+        g_array_set_size(m_compacted, 0);
+
+        for (size_t i = 0; i < m_columns->len; ++i) {
+            column_t * column = &g_array_index(m_columns, column_t, i);
+            const size_t begin = m_compacted->len;
+            g_array_append_vals(m_compacted, &g_array_index
+                                (m_items, Item, column->m_begin),
+                                column->m_len);
+            column->m_begin = begin;
+        }
+
+        GArray * items = m_items;
+        m_items = m_compacted;
+        m_compacted = items;
+        m_unused = 0;
+        return true;
+    }
 
 public:
     PhoneticTable() {
-        m_table_content = g_ptr_array_new();
+        m_items = g_array_new(TRUE, TRUE, sizeof(Item));
+        m_columns = g_array_new(TRUE, TRUE, sizeof(column_t));
+        m_unused = 0;
+        m_compacted = g_array_new(TRUE, TRUE, sizeof(Item));
     }
 
     ~PhoneticTable() {
-        clear_all();
-
-        g_ptr_array_free(m_table_content, TRUE);
-        m_table_content = NULL;
+        g_array_free(m_compacted, TRUE);
+        m_compacted = NULL;
+        g_array_free(m_columns, TRUE);
+        m_columns = NULL;
+        g_array_free(m_items, TRUE);
+        m_items = NULL;
     }
 
     bool clear_all() {
-        for (size_t i = 0; i < m_table_content->len; ++i) {
-            GArray * column = (GArray *)
-                g_ptr_array_index(m_table_content, i);
-            g_array_free(column, TRUE);
-        }
-
-        g_ptr_array_set_size(m_table_content, 0);
+        g_array_set_size(m_items, 0);
+        g_array_set_size(m_columns, 0);
+        m_unused = 0;
         return true;
     }
 
     size_t size() {
-        return m_table_content->len;
+        return m_columns->len;
     }
 
     /* when call this function,
@@ -68,59 +117,111 @@ public:
     bool set_size(size_t size) {
         clear_all();
 
-        g_ptr_array_set_size(m_table_content, size);
-        for (size_t i = 0; i < m_table_content->len; ++i) {
-            g_ptr_array_index(m_table_content, i) =
-                g_array_new(TRUE, TRUE, sizeof(Item));
+        /* the new columns are cleared to be empty. */
+        g_array_set_size(m_columns, size);
+        return true;
+    }
+
+    /* keep the columns before the start column, and clear the others. */
+    bool set_size(size_t size, size_t start) {
+        if (start > size)
+            start = size;
+
+        for (size_t i = start; i < m_columns->len; ++i) {
+            column_t * column = &g_array_index(m_columns, column_t, i);
+            m_unused += column->m_len;
+            column->m_begin = 0; column->m_len = 0;
         }
 
-        return true;
+        /* the new columns are cleared to be empty. */
+        g_array_set_size(m_columns, size);
+
+        return compact();
     }
 
     /* Array of Item. */
     bool get_items(size_t index, GArray * items) {
         g_array_set_size(items, 0);
 
-        if (index >= m_table_content->len)
+        if (index >= m_columns->len)
+            return false;
+
+        const column_t * column = &g_array_index(m_columns, column_t, index);
+        g_array_append_vals(items, &g_array_index
+                            (m_items, Item, column->m_begin),
+                            column->m_len);
+        return true;
+    }
+
+    /* the view of the column, without copy. */
+    bool get_column(size_t index, const Item * & items, size_t & len) {
+        items = NULL; len = 0;
+
+        if (index >= m_columns->len)
             return false;
 
-        GArray * column = (GArray *)
-            g_ptr_array_index(m_table_content, index);
-        g_array_append_vals(items, column->data, column->len);
+        const column_t * column = &g_array_index(m_columns, column_t, index);
+        items = &g_array_index(m_items, Item, column->m_begin);
+        len = column->m_len;
         return true;
     }
 
     bool append(size_t index, const Item & item) {
-        if (index >= m_table_content->len)
+        if (index >= m_columns->len)
             return false;
 
-        GArray * column = (GArray *)
-            g_ptr_array_index(m_table_content, index);
-        g_array_append_val(column, item);
+        column_t * column = &g_array_index(m_columns, column_t, index);
+
+        if (0 == column->m_len)
+            column->m_begin = m_items->len;
+
+        /* move the column to the end of the items. */
+        if (column->m_begin + column->m_len != m_items->len) {
+            const size_t begin = m_items->len;
+            g_array_set_size(m_items, begin + column->m_len);
+            memcpy(&g_array_index(m_items, Item, begin),
+                   &g_array_index(m_items, Item, column->m_begin),
+                   column->m_len * sizeof(Item));
+
+            m_unused += column->m_len;
+            column->m_begin = begin;
+        }
+
+        g_array_append_val(m_items, item);
+        ++column->m_len;
+
+        /* reclaim the unused items when they are the most. */
+        if (m_unused * 2 > m_items->len)
+            compact();
+
         return true;
     }
 
     size_t get_column_size(size_t index) {
-        assert(index < m_table_content->len);
+        assert(index < m_columns->len);
 
-        GArray * column = (GArray *)
-            g_ptr_array_index(m_table_content, index);
-        return column->len;
+        return g_array_index(m_columns, column_t, index).m_len;
     }
 
     bool get_item(size_t index, size_t row, Item & item) {
-        assert(index < m_table_content->len);
+        assert(index < m_columns->len);
 
-        GArray * column = (GArray *)
-            g_ptr_array_index(m_table_content, index);
-        assert(row < column->len);
+        const column_t * column = &g_array_index(m_columns, column_t, index);
+        assert(row < column->m_len);
 
-        item = g_array_index(column, Item, row);
+        item = g_array_index(m_items, Item, column->m_begin + row);
         return true;
     }
 
 };
 
+/**
+ * PhoneticKeyMatrix:
+ *
+ * The matrix of the keys and the key rests, indexed by the column
+ * of the raw begin of the keys.
+ *
+ */
 class PhoneticKeyMatrix {
 protected:
     PhoneticTable<ChewingKey> m_keys;
@@ -141,6 +242,12 @@ public:
         return m_keys.set_size(size) && m_key_rests.set_size(size);
     }
 
+    /* keep the columns before the start column, same as PhoneticTable. */
+    bool set_size(size_t size, size_t start) {
+        return m_keys.set_size(size, start) &&
+            m_key_rests.set_size(size, start);
+    }
+
     /* Array of keys and key rests. */
     bool get_items(size_t index, GArray * keys, GArray * key_rests) {
         bool result = m_keys.get_items(index, keys) &&
@@ -150,6 +257,17 @@ public:
         return result;
     }
 
+    /* the views of the keys and key rests, same as PhoneticTable. */
+    bool get_column(size_t index, const ChewingKey * & keys,
+                    const ChewingKeyRest * & key_rests, size_t & len) {
+        size_t key_rests_len = 0;
+        bool result = m_keys.get_column(index, keys, len) &&
+            m_key_rests.get_column(index, key_rests, key_rests_len);
+
+        assert(len == key_rests_len);
+        return result;
+    }
+
     bool append(size_t index, const ChewingKey & key,
                 const ChewingKeyRest & key_rest) {
         return m_keys.append(index, key) &&
@@ -170,6 +288,102 @@ public:
 
 };
 
+/**
+ * MatrixExpansionTable:
+ *
+ * The precomputed resplit and divided items of the keys for the matrix
+ * steps, indexed by the initial, middle and final of the keys.
+ *
+ * Note:
+ *   The items do not depend on the pinyin options, so the matrix steps
+ *   share one table, see get_matrix_expansion_table.
+ *   The resplit and divided items still need to match the tones of
+ *   the keys.
+ *
+ */
+class MatrixExpansionTable {
+private:
+    /* Array of const resplit_table_item_t *, with the offsets,
+       indexed by the first original key. */
+    GArray * m_resplit_items;
+    GArray * m_resplit_offsets;
+
+    /* Array of const divided_table_item_t *, NULL for none. */
+    GArray * m_divided_items;
+
+    static size_t get_key_index(const ChewingKey & key) {
+        return (key.m_initial * CHEWING_NUMBER_OF_MIDDLES + key.m_middle) *
+            CHEWING_NUMBER_OF_FINALS + key.m_final;
+    }
+
+    static size_t get_num_of_key_indexes() {
+        return CHEWING_NUMBER_OF_INITIALS * CHEWING_NUMBER_OF_MIDDLES *
+            CHEWING_NUMBER_OF_FINALS;
+    }
+
+    bool build_special_items();
+
+public:
+    /**
+     * MatrixExpansionTable::MatrixExpansionTable:
+     *
+     * Collect the resplit and divided items of the keys.
+     *
+     */
+    MatrixExpansionTable();
+
+    /**
+     * MatrixExpansionTable::~MatrixExpansionTable:
+     *
+     * The destructor of the MatrixExpansionTable.
+     *
+     */
+    ~MatrixExpansionTable();
+
+    /**
+     * MatrixExpansionTable::get_resplit_items:
+     * @key: the first key.
+     * @items: the resplit items of the first key, in the table order.
+     * @len: the number of the resplit items.
+     *
+     * Get the resplit items whose first original key matches the key.
+     *
+     */
+    void get_resplit_items(const ChewingKey & key,
+                           const resplit_table_item_t * const * & items,
+                           size_t & len) const {
+        const size_t index = get_key_index(key);
+        const guint32 begin = g_array_index
+            (m_resplit_offsets, guint32, index);
+        items = &g_array_index
+            (m_resplit_items, const resplit_table_item_t *, begin);
+        len = g_array_index(m_resplit_offsets, guint32, index + 1) - begin;
+    }
+
+    /**
+     * MatrixExpansionTable::get_divided_item:
+     * @key: the key.
+     * @returns: the divided item of the key, NULL for none.
+     *
+     * Get the first divided item whose original key matches the key.
+     *
+     */
+    const divided_table_item_t * get_divided_item
+    (const ChewingKey & key) const {
+        return g_array_index(m_divided_items, const divided_table_item_t *,
+                             get_key_index(key));
+    }
+};
+
+/**
+ * get_matrix_expansion_table:
+ * @returns: the shared expansion table of the matrix steps.
+ *
+ * Get the shared table, built once when first used.
+ *
+ */
+const MatrixExpansionTable * get_matrix_expansion_table();
+
 /**
  * fill_matrix:
  * Convert ChewingKeyVector and ChewingKeyRestVector
@@ -180,6 +394,16 @@ bool fill_matrix(PhoneticKeyMatrix * matrix,
                  ChewingKeyRestVector key_rests,
                  size_t parsed_len);
 
+/**
+ * fill_matrix:
+ * Same as above, but only refill the columns from the start column,
+ * the columns before the start column are kept.
+ */
+bool fill_matrix(PhoneticKeyMatrix * matrix,
+                 ChewingKeyVector keys,
+                 ChewingKeyRestVector key_rests,
+                 size_t parsed_len, size_t start);
+
 /**
  * resplit_step:
  * For "fa'nan" => "fan'an", add "fan'an" to the matrix for matched "fa'nan".
@@ -188,6 +412,15 @@ bool fill_matrix(PhoneticKeyMatrix * matrix,
 bool resplit_step(pinyin_option_t options,
                   PhoneticKeyMatrix * matrix);
 
+/**
+ * resplit_step:
+ * Same as above, but only resplit the keys from the start column,
+ * and only append the keys to the columns from the stable column.
+ */
+bool resplit_step(pinyin_option_t options,
+                  PhoneticKeyMatrix * matrix,
+                  size_t start, size_t stable);
+
 /**
  * inner_split_step:
  * For "xian" => "xi'an", add "xi'an" to the matrix for matched "xian".
@@ -196,19 +429,54 @@ bool resplit_step(pinyin_option_t options,
 bool inner_split_step(pinyin_option_t options,
                       PhoneticKeyMatrix * matrix);
 
+/**
+ * inner_split_step:
+ * Same as above, but only split the keys from the start column,
+ * and only append the keys to the columns from the stable column.
+ */
+bool inner_split_step(pinyin_option_t options,
+                      PhoneticKeyMatrix * matrix,
+                      size_t start, size_t stable);
+
+
+/**
+ * update_matrix:
+ * Refill the matrix filled by the last keys with the new keys,
+ * only the columns from the key before the first changed key are
+ * refilled, and the resplit and inner split steps are re-run for them.
+ * The last keys are NULL when the matrix is not filled by them.
+ * Returns the first changed column.
+ */
+size_t update_matrix(pinyin_option_t options,
+                     PhoneticKeyMatrix * matrix,
+                     ChewingKeyVector last_keys,
+                     ChewingKeyRestVector last_key_rests,
+                     size_t last_parsed_len,
+                     ChewingKeyVector keys,
+                     ChewingKeyRestVector key_rests,
+                     size_t parsed_len);
 
 /**
  * fuzzy_syllable_step:
  * For "an" <=> "ang", fill the fuzzy pinyins into the matrix.
  * Supported nearly in all pinyin parsers.
  * At most 3 * 2 entries will be added.
+ * The fuzzy pinyins are matched by search_matrix now,
+ * the step is only kept to check the fuzzy search.
  */
 bool fuzzy_syllable_step(pinyin_option_t options,
                          PhoneticKeyMatrix * matrix);
 
 bool dump_matrix(PhoneticKeyMatrix * matrix);
 
-int search_matrix(FacadeChewingTable2 * table,
+/**
+ * search_matrix:
+ * Search the span [start, end] of the matrix in the chewing table,
+ * the fuzzy pinyins in the options are matched by the table search,
+ * instead of being filled into the matrix.
+ */
+int search_matrix(pinyin_option_t options,
+                  FacadeChewingTable2 * table,
                   PhoneticKeyMatrix * matrix,
                   size_t start, size_t end,
                   PhraseIndexRanges ranges);
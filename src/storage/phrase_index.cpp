@@ -19,6 +19,7 @@
  *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
  */
 
+#include <math.h>
 #include "phrase_index.h"
 #include "pinyin_custom2.h"
 
@@ -166,6 +167,7 @@ int SubPhraseIndex::add_unigram_frequency(phrase_token_t token, guint32 delta){
     freq += delta;
     m_total_freq += delta;
     m_phrase_content.set_content(offset + sizeof(guint8) + sizeof(guint8), &freq, sizeof(guint32));
+    mark_dirty(token);
 
     return ERROR_OK;
 }
@@ -206,6 +208,7 @@ int SubPhraseIndex::add_phrase_item(phrase_token_t token, PhraseItem * item){
     m_phrase_index.set_content((token & PHRASE_MASK) 
                                * sizeof(table_offset_t), &offset, sizeof(table_offset_t));
     m_total_freq += item->get_unigram_frequency();
+    mark_dirty(token);
     return ERROR_OK;
 }
 
@@ -224,9 +227,29 @@ int SubPhraseIndex::remove_phrase_item(phrase_token_t token, PhraseItem * & item
     m_phrase_index.set_content((token & PHRASE_MASK)
                                * sizeof(table_offset_t), &zero_const, sizeof(table_offset_t));
     m_total_freq -= item->get_unigram_frequency();
+    mark_dirty(token);
     return ERROR_OK;
 }
 
+bool SubPhraseIndex::mark_dirty(phrase_token_t token){
+    const guint32 offset = token & PHRASE_MASK;
+    const guint32 index = offset / 32;
+
+    if (index >= m_dirty_tokens->len)
+        g_array_set_size(m_dirty_tokens, index + 1);
+
+    g_array_index(m_dirty_tokens, guint32, index) |= 1U << (offset % 32);
+    return true;
+}
+
+bool SubPhraseIndex::copy_dirty_tokens(SubPhraseIndex * oldone){
+    GArray * dirty_tokens = oldone->m_dirty_tokens;
+
+    g_array_set_size(m_dirty_tokens, 0);
+    g_array_append_vals(m_dirty_tokens, dirty_tokens->data, dirty_tokens->len);
+    return true;
+}
+
 bool FacadePhraseIndex::load(guint8 phrase_index, MemoryChunk * chunk){
     SubPhraseIndex * & sub_phrases = m_sub_phrase_indices[phrase_index];
     if ( !sub_phrases ){
@@ -238,6 +261,8 @@ bool FacadePhraseIndex::load(guint8 phrase_index, MemoryChunk * chunk){
     if ( !retval )
         return retval;
     m_total_freq += sub_phrases->get_phrase_index_total_freq();
+    update_total_freq();
+    rebuild_unigram_column(phrase_index);
     return retval;
 }
 
@@ -256,8 +281,10 @@ bool FacadePhraseIndex::unload(guint8 phrase_index){
     if ( !sub_phrases )
         return false;
     m_total_freq -= sub_phrases->get_phrase_index_total_freq();
+    update_total_freq();
     delete sub_phrases;
     sub_phrases = NULL;
+    rebuild_unigram_column(phrase_index);
     return true;
 }
 
@@ -287,6 +314,8 @@ bool FacadePhraseIndex::merge(guint8 phrase_index, MemoryChunk * log){
 
     bool retval = sub_phrases->merge(&logger);
     m_total_freq += sub_phrases->get_phrase_index_total_freq();
+    update_total_freq();
+    rebuild_unigram_column(phrase_index);
 
     return retval;
 }
@@ -319,6 +348,8 @@ bool FacadePhraseIndex::merge_with_mask(guint8 phrase_index,
 
     bool retval = sub_phrases->merge(newlogger);
     m_total_freq += sub_phrases->get_phrase_index_total_freq();
+    update_total_freq();
+    rebuild_unigram_column(phrase_index);
     delete newlogger;
 
     return retval;
@@ -333,6 +364,8 @@ bool SubPhraseIndex::load(MemoryChunk * chunk,
         m_chunk = NULL;
     }
     m_chunk = chunk;
+    /* the loaded content is the base of diff. */
+    g_array_set_size(m_dirty_tokens, 0);
     
     char * buf_begin = (char *)chunk->begin();
     chunk->get_content(offset, &m_total_freq, sizeof(guint32));
@@ -392,43 +425,48 @@ bool SubPhraseIndex::diff(SubPhraseIndex * oldone, PhraseIndexLogger * logger){
     logger->append_record(LOG_MODIFY_HEADER, null_token,
                           &oldheader, &newheader);
 
-    /* diff phrase items */
-    PhraseIndexRange oldrange, currange, range;
-    oldone->get_range(oldrange); get_range(currange);
-    range.m_range_begin = std_lite::min(oldrange.m_range_begin,
-                                        currange.m_range_begin);
-    range.m_range_end = std_lite::max(oldrange.m_range_end,
-                                      currange.m_range_end);
-    PhraseItem olditem, newitem;
+    /* diff the changed phrase items only. */
+    for (size_t index = 0; index < m_dirty_tokens->len; ++index) {
+        const guint32 bits = g_array_index(m_dirty_tokens, guint32, index);
+        if (0 == bits)
+            continue;
 
-    for (phrase_token_t token = range.m_range_begin;
-         token < range.m_range_end; ++token ){
-        bool oldretval = ERROR_OK == oldone->get_phrase_item(token, olditem);
-        bool newretval = ERROR_OK == get_phrase_item(token, newitem);
-
-        if ( oldretval ){
-            if ( newretval ) { /* compare phrase item. */
-                if ( olditem == newitem )
-                    continue;
-                logger->append_record(LOG_MODIFY_RECORD, token,
-                                      &(olditem.m_chunk), &(newitem.m_chunk));
-            } else { /* remove phrase item. */
-                logger->append_record(LOG_REMOVE_RECORD, token,
-                                      &(olditem.m_chunk), NULL);
-            }
-        } else {
-            if ( newretval ){ /* add phrase item. */
-                logger->append_record(LOG_ADD_RECORD, token,
-                                      NULL, &(newitem.m_chunk));
-            } else { /* both empty. */
-                /* do nothing. */
-            }
+        for (size_t bit = 0; bit < 32; ++bit) {
+            if (bits & (1U << bit))
+                diff_phrase_item(oldone, logger, index * 32 + bit);
         }
     }
 
     return true;
 }
 
+void SubPhraseIndex::diff_phrase_item(SubPhraseIndex * oldone,
+                                      PhraseIndexLogger * logger,
+                                      phrase_token_t token){
+    PhraseItem olditem, newitem;
+    bool oldretval = ERROR_OK == oldone->get_phrase_item(token, olditem);
+    bool newretval = ERROR_OK == get_phrase_item(token, newitem);
+
+    if ( oldretval ){
+        if ( newretval ) { /* compare phrase item. */
+            if ( olditem == newitem )
+                return;
+            logger->append_record(LOG_MODIFY_RECORD, token,
+                                  &(olditem.m_chunk), &(newitem.m_chunk));
+        } else { /* remove phrase item. */
+            logger->append_record(LOG_REMOVE_RECORD, token,
+                                  &(olditem.m_chunk), NULL);
+        }
+    } else {
+        if ( newretval ){ /* add phrase item. */
+            logger->append_record(LOG_ADD_RECORD, token,
+                                  NULL, &(newitem.m_chunk));
+        } else { /* both empty. */
+            /* do nothing. */
+        }
+    }
+}
+
 bool SubPhraseIndex::merge(PhraseIndexLogger * logger){
     LOG_TYPE log_type = LOG_INVALID_RECORD;
     phrase_token_t token = null_token;
@@ -490,6 +528,7 @@ bool SubPhraseIndex::merge(PhraseIndexLogger * logger){
                  */
                 memmove(item.m_chunk.begin(), newchunk.begin(),
                         newchunk.size());
+                mark_dirty(token);
             }
             break;
         }
@@ -656,8 +695,12 @@ bool FacadePhraseIndex::compact(){
             new_sub_phrase->add_phrase_item(token, &item);
         }
 
+        /* keep the base of diff, only the changed tokens are dirty. */
+        new_sub_phrase->copy_dirty_tokens(sub_phrase);
+
         delete sub_phrase;
         m_sub_phrase_indices[index] = new_sub_phrase;
+        rebuild_unigram_column(index);
     }
     return true;
 }
@@ -701,10 +744,88 @@ bool FacadePhraseIndex::mask_out(guint8 phrase_index,
     m_total_freq -= sub_phrases->get_phrase_index_total_freq();
     bool retval = sub_phrases->mask_out(mask, value);
     m_total_freq += sub_phrases->get_phrase_index_total_freq();
+    update_total_freq();
+    rebuild_unigram_column(phrase_index);
 
     return retval;
 }
 
+void FacadePhraseIndex::update_total_freq(){
+    /* avoid the division by zero for the empty phrase index. */
+    const guint32 total_freq = m_total_freq ? m_total_freq : 1;
+    m_inverse_total_freq = 1. / total_freq;
+    m_log_total_freq = logf(total_freq);
+}
+
+static void _fill_unigram_item(phrase_unigram_t * unigram,
+                               PhraseItem & item){
+    unigram->m_freq = item.get_unigram_frequency();
+    unigram->m_log_freq = unigram->m_freq ?
+        logf(unigram->m_freq) : -FLT_MAX;
+    unigram->m_phrase_length = item.get_phrase_length();
+}
+
+bool FacadePhraseIndex::update_unigram_item(phrase_token_t token){
+    const guint8 phrase_index = PHRASE_INDEX_LIBRARY_INDEX(token);
+    SubPhraseIndex * sub_phrases = m_sub_phrase_indices[phrase_index];
+    if ( !sub_phrases )
+        return false;
+
+    GArray * & column = m_unigram_columns[phrase_index];
+    if ( NULL == column )
+        column = g_array_new(FALSE, TRUE, sizeof(phrase_unigram_t));
+
+    const guint32 offset = token & PHRASE_MASK;
+    if ( offset >= column->len )
+        g_array_set_size(column, offset + 1);
+
+    phrase_unigram_t * unigram =
+        &g_array_index(column, phrase_unigram_t, offset);
+    memset(unigram, 0, sizeof(phrase_unigram_t));
+
+    PhraseItem item;
+    if ( ERROR_OK != sub_phrases->get_phrase_item(token, item) )
+        return false;
+
+    _fill_unigram_item(unigram, item);
+    return true;
+}
+
+bool FacadePhraseIndex::rebuild_unigram_column(guint8 phrase_index){
+    GArray * & column = m_unigram_columns[phrase_index];
+    SubPhraseIndex * sub_phrases = m_sub_phrase_indices[phrase_index];
+    if ( !sub_phrases ) {
+        if ( column ) {
+            g_array_free(column, TRUE);
+            column = NULL;
+        }
+        return false;
+    }
+
+    if ( NULL == column )
+        column = g_array_new(FALSE, TRUE, sizeof(phrase_unigram_t));
+
+    PhraseIndexRange range;
+    if ( ERROR_OK != sub_phrases->get_range(range) )
+        return false;
+
+    /* the cleared array fills the new slots with zeros. */
+    g_array_set_size(column, 0);
+    g_array_set_size(column, range.m_range_end);
+
+    PhraseItem item;
+    for ( phrase_token_t token = range.m_range_begin;
+          token < range.m_range_end; ++token ) {
+        if ( ERROR_OK != sub_phrases->get_phrase_item(token, item) )
+            continue;
+
+        _fill_unigram_item
+            (&g_array_index(column, phrase_unigram_t, token), item);
+    }
+
+    return true;
+}
+
 
 static bool _peek_header(PhraseIndexLogger * logger,
                          guint32 & old_total_freq){
@@ -23,6 +23,7 @@
 #define PHRASE_INDEX_H
 
 #include <stdio.h>
+#include <float.h>
 #include <glib.h>
 #include "novel_types.h"
 #include "chewing_key.h"
@@ -259,6 +260,10 @@ private:
     MemoryChunk m_phrase_content;
     MemoryChunk * m_chunk;
 
+    /* the bitmap of the tokens changed since loaded,
+       Array of guint32, indexed by (token & PHRASE_MASK). */
+    GArray * m_dirty_tokens;
+
     void reset(){
         m_total_freq = 0;
         m_phrase_index.set_size(0);
@@ -267,8 +272,13 @@ private:
             delete m_chunk;
             m_chunk = NULL;
         }
+        g_array_set_size(m_dirty_tokens, 0);
     }
 
+    void diff_phrase_item(SubPhraseIndex * oldone,
+                          PhraseIndexLogger * logger,
+                          phrase_token_t token);
+
 public:
     /**
      * SubPhraseIndex::SubPhraseIndex:
@@ -278,6 +288,7 @@ public:
      */
     SubPhraseIndex():m_total_freq(0){
         m_chunk = NULL;
+        m_dirty_tokens = g_array_new(FALSE, TRUE, sizeof(guint32));
     }
 
     /**
@@ -288,6 +299,8 @@ public:
      */
     ~SubPhraseIndex(){
         reset();
+        g_array_free(m_dirty_tokens, TRUE);
+        m_dirty_tokens = NULL;
     }
     
     /**
@@ -326,6 +339,8 @@ public:
      * sub phrase index to generate the logger of difference.
      *
      * Note: Switch to logger format to reduce user space storage.
+     * Only the tokens changed since loaded are compared, so the oldone
+     * should be the content loaded into this sub phrase index.
      *
      */
     bool diff(SubPhraseIndex * oldone, PhraseIndexLogger * logger);
@@ -340,6 +355,32 @@ public:
      */
     bool merge(PhraseIndexLogger * logger);
 
+    /**
+     * SubPhraseIndex::mark_dirty:
+     * @token: the phrase token.
+     * @returns: whether the mark operation is successful.
+     *
+     * Mark the phrase item of the token as changed for diff,
+     * the add and remove methods mark the token automatically.
+     *
+     * Note: call it after the phrase item got by get_phrase_item
+     * is modified in place.
+     *
+     */
+    bool mark_dirty(phrase_token_t token);
+
+    /**
+     * SubPhraseIndex::copy_dirty_tokens:
+     * @oldone: the sub phrase index with the same phrase items.
+     * @returns: whether the copy operation is successful.
+     *
+     * Copy the tokens changed since loaded from the old sub phrase index.
+     *
+     * Note: used by compact, the phrase items added back are not changed.
+     *
+     */
+    bool copy_dirty_tokens(SubPhraseIndex * oldone);
+
     /**
      * SubPhraseIndex::get_range:
      * @range: the token range.
@@ -427,6 +468,22 @@ public:
     bool mask_out(phrase_token_t mask, phrase_token_t value);
 };
 
+/**
+ * phrase_unigram_t:
+ *
+ * The uni-gram information of one phrase item,
+ * which is cached in the dense array of the facade phrase index.
+ *
+ */
+struct phrase_unigram_t{
+    /* the uni-gram frequency. */
+    guint32 m_freq;
+    /* the log of the uni-gram frequency, -FLT_MAX for zero frequency. */
+    gfloat m_log_freq;
+    /* the phrase length, zero for the empty slot. */
+    guint8 m_phrase_length;
+};
+
 /**
  * FacadePhraseIndex:
  *
@@ -437,6 +494,32 @@ class FacadePhraseIndex{
 private:
     guint32 m_total_freq;
     SubPhraseIndex * m_sub_phrase_indices[PHRASE_INDEX_LIBRARY_COUNT];
+
+    /* the dense uni-gram columns indexed by token,
+       Array of phrase_unigram_t, NULL if the sub phrase index is absent. */
+    GArray * m_unigram_columns[PHRASE_INDEX_LIBRARY_COUNT];
+    /* the global offsets, updated when m_total_freq is changed,
+       then the columns are not re-scaled. */
+    gdouble m_inverse_total_freq;
+    gfloat m_log_total_freq;
+
+    void update_total_freq();
+    bool update_unigram_item(phrase_token_t token);
+    bool rebuild_unigram_column(guint8 phrase_index);
+
+    const phrase_unigram_t * get_unigram_item(phrase_token_t token) const {
+        const GArray * column =
+            m_unigram_columns[PHRASE_INDEX_LIBRARY_INDEX(token)];
+        if (NULL == column)
+            return NULL;
+
+        const guint32 offset = token & PHRASE_MASK;
+        if (offset >= column->len)
+            return NULL;
+
+        return &g_array_index(column, phrase_unigram_t, offset);
+    }
+
 public:
     /**
      * FacadePhraseIndex::FacadePhraseIndex:
@@ -447,6 +530,8 @@ public:
     FacadePhraseIndex(){
         m_total_freq = 0;
         memset(m_sub_phrase_indices, 0, sizeof(m_sub_phrase_indices));
+        memset(m_unigram_columns, 0, sizeof(m_unigram_columns));
+        update_total_freq();
     }
 
     /**
@@ -461,6 +546,10 @@ public:
                 delete m_sub_phrase_indices[i];
                 m_sub_phrase_indices[i] = NULL;
             }
+            if ( m_unigram_columns[i] ){
+                g_array_free(m_unigram_columns[i], TRUE);
+                m_unigram_columns[i] = NULL;
+            }
         }
     }
 
@@ -627,7 +716,77 @@ public:
         if ( !sub_phrase )
             return ERROR_NO_SUB_PHRASE_INDEX;
         m_total_freq += delta;
-        return sub_phrase->add_unigram_frequency(token, delta);
+        update_total_freq();
+        int result = sub_phrase->add_unigram_frequency(token, delta);
+        if ( ERROR_OK == result )
+            update_unigram_item(token);
+        return result;
+    }
+
+    /**
+     * FacadePhraseIndex::mark_dirty:
+     * @token: the phrase token.
+     * @returns: the status of the mark operation.
+     *
+     * Mark the phrase item modified in place as changed for diff.
+     *
+     */
+    int mark_dirty(phrase_token_t token){
+        guint8 index = PHRASE_INDEX_LIBRARY_INDEX(token);
+        SubPhraseIndex * sub_phrase = m_sub_phrase_indices[index];
+        if ( !sub_phrase )
+            return ERROR_NO_SUB_PHRASE_INDEX;
+        sub_phrase->mark_dirty(token);
+        return ERROR_OK;
+    }
+
+    /**
+     * FacadePhraseIndex::get_unigram_possibility:
+     * @token: the phrase token.
+     * @poss: the uni-gram possibility of the token.
+     * @phrase_length: the phrase length of the token.
+     * @returns: the status of the get operation.
+     *
+     * Get the uni-gram possibility from the dense uni-gram column,
+     * without reading the phrase item.
+     *
+     */
+    int get_unigram_possibility(phrase_token_t token,
+                                /* out */ gdouble & poss,
+                                /* out */ guint8 & phrase_length) const {
+        const phrase_unigram_t * unigram = get_unigram_item(token);
+        if ( NULL == unigram || 0 == unigram->m_phrase_length )
+            return ERROR_NO_ITEM;
+
+        poss = unigram->m_freq * m_inverse_total_freq;
+        phrase_length = unigram->m_phrase_length;
+        return ERROR_OK;
+    }
+
+    /**
+     * FacadePhraseIndex::get_unigram_log_possibility:
+     * @token: the phrase token.
+     * @log_poss: the log of the uni-gram possibility, -FLT_MAX for zero.
+     * @phrase_length: the phrase length of the token.
+     * @returns: the status of the get operation.
+     *
+     * Get the log uni-gram possibility from the dense uni-gram column,
+     * without reading the phrase item.
+     *
+     */
+    int get_unigram_log_possibility(phrase_token_t token,
+                                    /* out */ gfloat & log_poss,
+                                    /* out */ guint8 & phrase_length) const {
+        const phrase_unigram_t * unigram = get_unigram_item(token);
+        if ( NULL == unigram || 0 == unigram->m_phrase_length )
+            return ERROR_NO_ITEM;
+
+        if ( 0 == unigram->m_freq )
+            log_poss = -FLT_MAX;
+        else
+            log_poss = unigram->m_log_freq - m_log_total_freq;
+        phrase_length = unigram->m_phrase_length;
+        return ERROR_OK;
     }
 
     /**
@@ -663,7 +822,11 @@ public:
             sub_phrase = new SubPhraseIndex;
         }   
         m_total_freq += item->get_unigram_frequency();
-        return sub_phrase->add_phrase_item(token, item);
+        update_total_freq();
+        int result = sub_phrase->add_phrase_item(token, item);
+        if ( ERROR_OK == result )
+            update_unigram_item(token);
+        return result;
     }
 
     /**
@@ -685,6 +848,8 @@ public:
         if ( result )
             return result;
         m_total_freq -= item->get_unigram_frequency();
+        update_total_freq();
+        update_unigram_item(token);
         return result;
     }
 
@@ -35,6 +35,8 @@ PhraseLargeTable3::PhraseLargeTable3() {
                      DB_BTREE, DB_CREATE, 0600);
     assert(0 == ret);
 
+    g_mutex_init(&m_mutex);
+
     m_entry = new PhraseTableEntry;
 }
 
@@ -139,6 +141,47 @@ bool PhraseLargeTable3::store_db(const char * new_filename) {
     return true;
 }
 
+bool PhraseLargeTable3::copy_db(PhraseLargeTable3 * new_table) {
+    new_table->reset();
+
+    new_table->m_entry = new PhraseTableEntry;
+
+    /* create in-memory db. */
+    int ret = db_create(&new_table->m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = new_table->m_db->open(new_table->m_db, NULL, NULL, NULL,
+                                DB_BTREE, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return copy_bdb(m_db, new_table->m_db);
+}
+
+bool PhraseLargeTable3::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    m_entry = new PhraseTableEntry;
+
+    /* create in-memory db. */
+    int ret = db_create(&m_db, NULL, 0);
+    assert(0 == ret);
+
+    ret = m_db->open(m_db, NULL, NULL, NULL,
+                     DB_BTREE, DB_CREATE, 0600);
+    if (ret != 0)
+        return false;
+
+    return restore_bdb(chunk, m_db);
+}
+
+bool PhraseLargeTable3::store_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    return dump_bdb(m_db, new_chunk);
+}
+
 /* search method */
 int PhraseLargeTable3::search(int phrase_length,
                               /* in */ const ucs4_t phrase[],
@@ -147,7 +190,9 @@ int PhraseLargeTable3::search(int phrase_length,
 
     if (NULL == m_db)
         return result;
-    assert(NULL != m_entry);
+
+    /* use the local entry, the search is reentrant. */
+    PhraseTableEntry entry;
 
     DBT db_key;
     memset(&db_key, 0, sizeof(DBT));
@@ -156,16 +201,22 @@ int PhraseLargeTable3::search(int phrase_length,
 
     DBT db_data;
     memset(&db_data, 0, sizeof(DBT));
+
+    /* the returned data is owned by the DB handle. */
+    g_mutex_lock(&m_mutex);
     int ret = m_db->get(m_db, NULL, &db_key, &db_data, 0);
-    if (ret != 0)
+    if (ret != 0) {
+        g_mutex_unlock(&m_mutex);
         return result;
+    }
 
     /* continue searching. */
     result |= SEARCH_CONTINUED;
 
-    m_entry->m_chunk.set_chunk(db_data.data, db_data.size, NULL);
+    entry.m_chunk.set_chunk(db_data.data, db_data.size, NULL);
 
-    result = m_entry->search(tokens) | result;
+    result = entry.search(tokens) | result;
+    g_mutex_unlock(&m_mutex);
 
     return result;
 }
@@ -23,6 +23,7 @@
 #define PHRASE_LARGE_TABLE3_BDB_H
 
 #include <db.h>
+#include <glib.h>
 
 namespace pinyin{
 
@@ -32,6 +33,8 @@ class PhraseLargeTable3{
 private:
     /* member variables. */
     DB * m_db;
+    /* the DB handle is not free-threaded, serialize the searches. */
+    mutable GMutex m_mutex;
 
 protected:
     PhraseTableEntry * m_entry;
@@ -43,6 +46,7 @@ public:
 
     ~PhraseLargeTable3(){
         reset();
+        g_mutex_clear(&m_mutex);
     }
 
     /* attach method */
@@ -54,6 +58,14 @@ public:
 
     bool store_db(const char * new_filename);
 
+    /* copy the table into the in-memory DBM of the new table. */
+    bool copy_db(PhraseLargeTable3 * new_table);
+
+    /* load/store the records of the in-memory DBM from/into the chunk. */
+    bool load_chunk(const MemoryChunk * chunk);
+
+    bool store_chunk(MemoryChunk * new_chunk);
+
     bool load_text(FILE * infile);
 
     /* search method */
@@ -114,6 +114,49 @@ bool PhraseLargeTable3::store_db(const char * new_filename){
     return true;
 }
 
+bool PhraseLargeTable3::copy_db(PhraseLargeTable3 * new_table) {
+    new_table->reset();
+
+    new_table->m_entry = new PhraseTableEntry;
+
+    /* create in-memory db. */
+    new_table->m_db = new ProtoTreeDB;
+
+    if (!new_table->m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    CopyVisitor visitor(new_table->m_db);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
+bool PhraseLargeTable3::load_chunk(const MemoryChunk * chunk) {
+    reset();
+
+    m_entry = new PhraseTableEntry;
+
+    /* create in-memory db. */
+    m_db = new ProtoTreeDB;
+
+    if (!m_db->open("-", BasicDB::OREADER|BasicDB::OWRITER|BasicDB::OCREATE))
+        return false;
+
+    return restore_kyotodb(chunk, m_db);
+}
+
+bool PhraseLargeTable3::store_chunk(MemoryChunk * new_chunk) {
+    if (NULL == m_db)
+        return false;
+
+    new_chunk->set_size(0);
+
+    DumpVisitor visitor(new_chunk);
+    m_db->iterate(&visitor, false);
+
+    return true;
+}
+
 /* search method */
 int PhraseLargeTable3::search(int phrase_length,
                               /* in */ const ucs4_t phrase[],
@@ -122,7 +165,9 @@ int PhraseLargeTable3::search(int phrase_length,
 
     if (NULL == m_db)
         return result;
-    assert(NULL != m_entry);
+
+    /* use the local entry, the search is reentrant. */
+    PhraseTableEntry entry;
 
     const char * kbuf = (char *) phrase;
     const int32_t vsiz = m_db->check(kbuf, phrase_length * sizeof(ucs4_t));
@@ -135,13 +180,13 @@ int PhraseLargeTable3::search(int phrase_length,
     if (0 == vsiz)
         return result;
 
-    m_entry->m_chunk.set_size(vsiz);
+    entry.m_chunk.set_size(vsiz);
     /* m_chunk may re-allocate here. */
-    char * vbuf = (char *) m_entry->m_chunk.begin();
+    char * vbuf = (char *) entry.m_chunk.begin();
     assert (vsiz == m_db->get(kbuf, phrase_length * sizeof(ucs4_t),
                               vbuf, vsiz));
 
-    result = m_entry->search(tokens) | result;
+    result = entry.search(tokens) | result;
 
     return result;
 }
@@ -56,6 +56,14 @@ public:
 
     bool store_db(const char * new_filename);
 
+    /* copy the table into the in-memory DBM of the new table. */
+    bool copy_db(PhraseLargeTable3 * new_table);
+
+    /* load/store the records of the in-memory DBM from/into the chunk. */
+    bool load_chunk(const MemoryChunk * chunk);
+
+    bool store_chunk(MemoryChunk * new_chunk);
+
     bool load_text(FILE * infile);
 
     /* search method */
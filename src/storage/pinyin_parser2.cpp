@@ -80,160 +80,306 @@ public:
 
 const guint16 max_full_pinyin_length   = 7;  /* include tone. */
 
+FullPinyinParseState::FullPinyinParseState(){
+    m_input = g_array_new(FALSE, FALSE, sizeof(char));
+    m_parse_steps = g_array_new(TRUE, FALSE, sizeof(parse_value_t));
+
+    m_options = 0;
+    m_trie = NULL;
+}
+
+FullPinyinParseState::~FullPinyinParseState(){
+    g_array_free(m_input, TRUE);
+    m_input = NULL;
+
+    g_array_free(m_parse_steps, TRUE);
+    m_parse_steps = NULL;
+}
+
+void FullPinyinParseState::reset(){
+    g_array_set_size(m_input, 0);
+    g_array_set_size(m_parse_steps, 0);
+
+    m_options = 0;
+    m_trie = NULL;
+}
+
 const guint16 max_double_pinyin_length = 3;  /* include tone. */
 
 const guint16 max_chewing_length       = 4;  /* include tone. */
 
-static bool compare_pinyin_less_than(const pinyin_index_item_t & lhs,
-                                     const pinyin_index_item_t & rhs){
-    return 0 > strcmp(lhs.m_pinyin_input, rhs.m_pinyin_input);
+static inline bool lookup_pinyin_key(pinyin_option_t options,
+                                     const pinyin_index_item_t * item,
+                                     ChewingKey & key){
+    if (NULL == item)
+        return false;
+
+    if (!check_pinyin_options(options, item))
+        return false;
+
+    key = content_table[item->m_table_index].m_chewing_key;
+    assert(key.get_table_index() == item->m_table_index);
+    return true;
 }
 
-static inline bool search_pinyin_index(pinyin_option_t options,
-                                       const char * pinyin,
-                                       ChewingKey & key){
-    pinyin_index_item_t item;
-    memset(&item, 0, sizeof(item));
-    item.m_pinyin_input = pinyin;
-
-    std_lite::pair<const pinyin_index_item_t *,
-                   const pinyin_index_item_t *> range;
-    range = std_lite::equal_range
-        (pinyin_index, pinyin_index + G_N_ELEMENTS(pinyin_index),
-         item, compare_pinyin_less_than);
-
-    guint16 range_len = range.second - range.first;
-    assert(range_len <= 1);
-    if (range_len == 1) {
-        const pinyin_index_item_t * index = range.first;
-
-        if (!check_pinyin_options(options, index))
-            return false;
 
-        key = content_table[index->m_table_index].m_chewing_key;
-        assert(key.get_table_index() == index->m_table_index);
-        return true;
-    }
+/* Pinyin Index Trie */
+PinyinIndexTrie::PinyinIndexTrie(const pinyin_index_item_t * index,
+                                 size_t len){
+    m_nodes = g_array_new(FALSE, TRUE, sizeof(pinyin_trie_node_t));
 
-    return false;
+    /* the root node. */
+    g_array_set_size(m_nodes, 1);
+
+    for (size_t i = 0; i < len; ++i) {
+        const pinyin_index_item_t * item = index + i;
+
+        guint16 node = 0;
+        for (const char * p = item->m_pinyin_input; *p; ++p) {
+            const char ch = *p;
+            assert('a' <= ch && ch <= 'z');
+
+            guint16 next = g_array_index
+                (m_nodes, pinyin_trie_node_t, node).m_next[ch - 'a'];
+            if (0 == next) {
+                assert(m_nodes->len < G_MAXUINT16);
+                next = m_nodes->len;
+                /* the appended node is cleared. */
+                g_array_set_size(m_nodes, m_nodes->len + 1);
+                g_array_index(m_nodes, pinyin_trie_node_t, node).
+                    m_next[ch - 'a'] = next;
+            }
+            node = next;
+        }
+
+        pinyin_trie_node_t * cur = &g_array_index
+            (m_nodes, pinyin_trie_node_t, node);
+        assert(NULL == cur->m_item);
+        cur->m_item = item;
+    }
 }
 
-static inline bool search_pinyin_index2(pinyin_option_t options,
-                                        const pinyin_index_item_t * index,
-                                        size_t len,
-                                        const char * pinyin,
-                                        ChewingKey & key){
-    pinyin_index_item_t item;
-    memset(&item, 0, sizeof(item));
-    item.m_pinyin_input = pinyin;
-
-    std_lite::pair<const pinyin_index_item_t *,
-                   const pinyin_index_item_t *> range;
-    range = std_lite::equal_range
-        (index, index + len,
-         item, compare_pinyin_less_than);
-
-    guint16 range_len = range.second - range.first;
-    assert(range_len <= 1);
-    if (range_len == 1) {
-        const pinyin_index_item_t * index = range.first;
-
-        if (!check_pinyin_options(options, index))
-            return false;
+PinyinIndexTrie::~PinyinIndexTrie(){
+    g_array_free(m_nodes, TRUE);
+    m_nodes = NULL;
+}
 
-        key = content_table[index->m_table_index].m_chewing_key;
-        assert(key.get_table_index() == index->m_table_index);
-        return true;
+static const PinyinIndexTrie * build_trie_once(gsize * location,
+                                               const pinyin_index_item_t * index,
+                                               size_t len){
+    if (g_once_init_enter(location)) {
+        /* the shared trie is never freed. */
+        PinyinIndexTrie * trie = new PinyinIndexTrie(index, len);
+        g_once_init_leave(location, (gsize) trie);
     }
 
-    return false;
+    return (const PinyinIndexTrie *) *location;
 }
 
+const PinyinIndexTrie * get_pinyin_index_trie(FullPinyinScheme scheme){
+    static gsize hanyu_trie = 0;
+    static gsize luoma_trie = 0;
+    static gsize secondary_zhuyin_trie = 0;
 
-/* Full Pinyin Parser */
-FullPinyinParser2::FullPinyinParser2 (){
-    m_pinyin_index = NULL; m_pinyin_index_len = 0;
-    m_parse_steps = g_array_new(TRUE, FALSE, sizeof(parse_value_t));
+    switch(scheme){
+    case FULL_PINYIN_HANYU:
+        return build_trie_once(&hanyu_trie, pinyin_index,
+                               G_N_ELEMENTS(pinyin_index));
+    case FULL_PINYIN_LUOMA:
+        return build_trie_once(&luoma_trie, luoma_pinyin_index,
+                               G_N_ELEMENTS(luoma_pinyin_index));
+    case FULL_PINYIN_SECONDARY_ZHUYIN:
+        return build_trie_once(&secondary_zhuyin_trie, secondary_zhuyin_index,
+                               G_N_ELEMENTS(secondary_zhuyin_index));
+    default:
+        assert(false);
+    }
 
-    set_scheme(FULL_PINYIN_DEFAULT);
+    return NULL;
 }
 
-bool FullPinyinParser2::parse_one_key (pinyin_option_t options,
-                                       ChewingKey & key,
-                                       const char * pinyin, int len) const {
+/* the shared parse_one_key of the full pinyin and the pinyin direct. */
+static bool parse_one_pinyin_key(const PinyinIndexTrie * trie,
+                                 pinyin_option_t options,
+                                 ChewingKey & key,
+                                 const char * pinyin, int len){
     /* "'" are not accepted in parse_one_key. */
-    gchar * input = g_strndup(pinyin, len);
-    assert(NULL == strchr(input, '\''));
+    assert(NULL == memchr(pinyin, '\'', len));
 
-    guint16 tone = CHEWING_ZERO_TONE; guint16 tone_pos = 0;
-    guint16 parsed_len = len;
+    guint16 tone = CHEWING_ZERO_TONE;
+    int core_len = len;
     key = ChewingKey();
 
+    if (0 == len)
+        return false;
+
     if (options & USE_TONE) {
         /* find the tone in the last character. */
-        char chr = input[parsed_len - 1];
+        char chr = pinyin[len - 1];
         if ( '0' < chr && chr <= '5' ) {
             tone = chr - '0';
-            parsed_len --;
-            tone_pos = parsed_len;
+            core_len --;
         }
 
         /* check the force tone option. */
-        if (options & FORCE_TONE && CHEWING_ZERO_TONE == tone) {
-            g_free(input);
+        if (options & FORCE_TONE && CHEWING_ZERO_TONE == tone)
             return false;
-        }
     }
 
     /* parse pinyin core staff here. */
-
-    /* Note: optimize here? */
-    input[parsed_len] = '\0';
-    if (!search_pinyin_index2(options, m_pinyin_index, m_pinyin_index_len,
-                              input, key)) {
-        g_free(input);
+    if (!lookup_pinyin_key(options, trie->search(pinyin, core_len), key))
         return false;
-    }
 
-    if (options & USE_TONE) {
-        /* post processing tone. */
-        if ( parsed_len == tone_pos ) {
-            if (tone != CHEWING_ZERO_TONE) {
-                key.m_tone = tone;
-                parsed_len ++;
-            }
-        }
+    /* post processing tone. */
+    if (tone != CHEWING_ZERO_TONE)
+        key.m_tone = tone;
+
+    return true;
+}
+
+/* save the next step of the dynamic programming. */
+static inline void save_next_step(parse_value_t * nextstep,
+                                  const parse_value_t & value){
+    /* no previous result */
+    if (-1 == nextstep->m_last_step)
+        *nextstep = value;
+    /* prefer the longest pinyin */
+    if (value.m_parsed_len > nextstep->m_parsed_len)
+        *nextstep = value;
+    /* prefer the shortest keys with the same pinyin length */
+    if (value.m_parsed_len == nextstep->m_parsed_len &&
+        value.m_num_keys < nextstep->m_num_keys)
+        *nextstep = value;
+
+    /* handle with the same pinyin length and the number of keys */
+    if (value.m_parsed_len == nextstep->m_parsed_len &&
+        value.m_num_keys == nextstep->m_num_keys) {
+
+#if 0
+        /* prefer the 'a' at the end of clause,
+         * ex: "zheyanga$" -> "zhe'yang'a$".
+         */
+        if (value.m_parsed_len == len &&
+            (nextstep->m_key.m_initial != CHEWING_ZERO_INITIAL &&
+             nextstep->m_key.m_final == CHEWING_A) &&
+            (value.m_key.m_initial == CHEWING_ZERO_INITIAL &&
+             value.m_key.m_middle == CHEWING_ZERO_MIDDLE &&
+             value.m_key.m_final == CHEWING_A))
+            *nextstep = value;
+#endif
     }
+}
+
+
+/* Full Pinyin Parser */
+FullPinyinParser2::FullPinyinParser2 (){
+    m_trie = NULL;
 
-    g_free(input);
-    return parsed_len == len;
+    set_scheme(FULL_PINYIN_DEFAULT);
+}
+
+bool FullPinyinParser2::parse_one_key (pinyin_option_t options,
+                                       ChewingKey & key,
+                                       const char * pinyin, int len) const {
+    return parse_one_pinyin_key(m_trie, options, key, pinyin, len);
 }
 
 
 int FullPinyinParser2::parse (pinyin_option_t options, ChewingKeyVector & keys,
                               ChewingKeyRestVector & key_rests,
                               const char *str, int len) const {
-    int i;
     /* clear arrays. */
     g_array_set_size(keys, 0);
     g_array_set_size(key_rests, 0);
 
-    /* init m_parse_steps, and prepare dynamic programming. */
+    /* the parse steps are local, the parse method is reentrant. */
     int step_len = len + 1;
-    g_array_set_size(m_parse_steps, 0);
+    ParseValueVector parse_steps = g_array_sized_new
+        (TRUE, FALSE, sizeof(parse_value_t), step_len);
+
+    fill_steps(options, parse_steps, str, len, 0);
+
+    /* final step for back tracing. */
+    gint16 parsed_len = final_step(parse_steps, step_len, keys, key_rests);
+
+#if 0
+    /* post processing for re-split table. */
+    if (options & USE_RESPLIT_TABLE) {
+        post_process2(options, keys, key_rests, str, len);
+    }
+#endif
+
+    g_array_free(parse_steps, TRUE);
+    return parsed_len;
+}
+
+int FullPinyinParser2::parse_more(pinyin_option_t options,
+                                  FullPinyinParseState & state,
+                                  ChewingKeyVector & keys,
+                                  ChewingKeyRestVector & key_rests,
+                                  const char *str, int len) const {
+    /* clear arrays. */
+    g_array_set_size(keys, 0);
+    g_array_set_size(key_rests, 0);
+
+    /* the kept steps are only valid with the same options and scheme. */
+    int stable_len = 0;
+    if (options == state.m_options && m_trie == state.m_trie) {
+        const char * input = (const char *) state.m_input->data;
+        const int common_len = std_lite::min((int) state.m_input->len, len);
+        while (stable_len < common_len &&
+               input[stable_len] == str[stable_len])
+            ++stable_len;
+    }
+
+    fill_steps(options, state.m_parse_steps, str, len, stable_len);
+
+    /* remember the input for the next parse. */
+    g_array_set_size(state.m_input, 0);
+    g_array_append_vals(state.m_input, str, len);
+    state.m_options = options;
+    state.m_trie = m_trie;
+
+    /* final step for back tracing. */
+    return final_step(state.m_parse_steps, len + 1, keys, key_rests);
+}
+
+/* the step n only depends on the first n characters of the input,
+ * so the steps of the stable prefix are kept.
+ */
+void FullPinyinParser2::fill_steps(pinyin_option_t options,
+                                   ParseValueVector parse_steps,
+                                   const char * str, int len,
+                                   int stable_len) const {
+    assert(stable_len <= len);
+
+    /* init parse steps, and prepare dynamic programming. */
+    int i;
+    g_array_set_size(parse_steps, std_lite::min
+                     ((int) parse_steps->len, stable_len + 1));
     parse_value_t value;
-    for (i = 0; i < step_len; ++i) {
-        g_array_append_val(m_parse_steps, value);
+    for (i = parse_steps->len; i < len + 1; ++i) {
+        g_array_append_val(parse_steps, value);
     }
 
     size_t next_sep = 0;
-    gchar * input = g_strndup(str, len);
+    const char * input = str;
     parse_value_t * curstep = NULL, * nextstep = NULL;
 
-    for (i = 0; i < len; ++i) {
+    const bool use_tone = options & USE_TONE;
+    const bool force_tone = use_tone && (options & FORCE_TONE);
+
+    /* the longest pinyin ending after the stable prefix. */
+    int begin = std_lite::max(stable_len - (int) max_full_pinyin_length, 0);
+
+    for (i = begin; i < len; ++i) {
         if (input[i] == '\'') {
-            curstep = &g_array_index(m_parse_steps, parse_value_t, i);
-            nextstep = &g_array_index(m_parse_steps, parse_value_t, i + 1);
+            next_sep = 0;
+            if (i < stable_len)
+                continue;
+
+            curstep = &g_array_index(parse_steps, parse_value_t, i);
+            nextstep = &g_array_index(parse_steps, parse_value_t, i + 1);
 
             /* propagate current step into next step. */
             nextstep->m_key = ChewingKey();
@@ -241,7 +387,6 @@ int FullPinyinParser2::parse (pinyin_option_t options, ChewingKeyVector & keys,
             nextstep->m_num_keys = curstep->m_num_keys;
             nextstep->m_parsed_len = curstep->m_parsed_len + 1;
             nextstep->m_last_step = i;
-            next_sep = 0;
             continue;
         }
 
@@ -256,82 +401,57 @@ int FullPinyinParser2::parse (pinyin_option_t options, ChewingKeyVector & keys,
         }
 
         /* dynamic programming here. */
-        /* for (size_t m = i; m < next_sep; ++m) */
+        /* walk the trie forward from the current position,
+         * each matched node gives the pinyin without and with tone.
+         */
         {
             size_t m = i;
-            curstep = &g_array_index(m_parse_steps, parse_value_t, m);
+            curstep = &g_array_index(parse_steps, parse_value_t, m);
             size_t try_len = std_lite::min
                 (m + max_full_pinyin_length, next_sep);
-            for (size_t n = m + 1; n < try_len + 1; ++n) {
-                nextstep = &g_array_index(m_parse_steps, parse_value_t, n);
 
-                /* gen next step */
-                const char * onepinyin = input + m;
-                gint16 onepinyinlen = n - m;
-                value = parse_value_t();
+            guint16 node = 0;
+            for (size_t k = m; k < try_len; ++k) {
+                if (!m_trie->walk(node, input[k]))
+                    break;
 
-                ChewingKey key; ChewingKeyRest rest;
-                bool parsed = parse_one_key
-                    (options, key, onepinyin, onepinyinlen);
-                rest.m_raw_begin = m; rest.m_raw_end = n;
-                if (!parsed)
+                ChewingKey key;
+                if (!lookup_pinyin_key(options, m_trie->get_item(node), key))
                     continue;
 
-                //printf("onepinyin:%s len:%d\n", onepinyin, onepinyinlen);
-
-                value.m_key = key; value.m_key_rest = rest;
+                /* gen next steps */
+                value = parse_value_t();
+                value.m_key = key;
+                value.m_key_rest.m_raw_begin = m;
                 value.m_num_keys = curstep->m_num_keys + 1;
-                value.m_parsed_len = curstep->m_parsed_len + onepinyinlen;
                 value.m_last_step = m;
 
-                /* save next step */
-                /* no previous result */
-                if (-1 == nextstep->m_last_step)
-                    *nextstep = value;
-                /* prefer the longest pinyin */
-                if (value.m_parsed_len > nextstep->m_parsed_len)
-                    *nextstep = value;
-                /* prefer the shortest keys with the same pinyin length */
-                if (value.m_parsed_len == nextstep->m_parsed_len &&
-                    value.m_num_keys < nextstep->m_num_keys)
-                    *nextstep = value;
-
-                /* handle with the same pinyin length and the number of keys */
-                if (value.m_parsed_len == nextstep->m_parsed_len &&
-                    value.m_num_keys == nextstep->m_num_keys) {
+                /* the pinyin without tone. */
+                size_t n = k + 1;
+                if (!force_tone && n > (size_t) stable_len) {
+                    value.m_key_rest.m_raw_end = n;
+                    value.m_parsed_len = curstep->m_parsed_len + (n - m);
+                    nextstep = &g_array_index(parse_steps, parse_value_t, n);
+                    save_next_step(nextstep, value);
+                }
 
-#if 0
-                    /* prefer the 'a' at the end of clause,
-                     * ex: "zheyanga$" -> "zhe'yang'a$".
-                     */
-                    if (value.m_parsed_len == len &&
-                        (nextstep->m_key.m_initial != CHEWING_ZERO_INITIAL &&
-                         nextstep->m_key.m_final == CHEWING_A) &&
-                        (value.m_key.m_initial == CHEWING_ZERO_INITIAL &&
-                         value.m_key.m_middle == CHEWING_ZERO_MIDDLE &&
-                         value.m_key.m_final == CHEWING_A))
-                        *nextstep = value;
-#endif
+                /* the pinyin with tone. */
+                if (use_tone && n < try_len && n + 1 > (size_t) stable_len &&
+                    '0' < input[n] && input[n] <= '5') {
+                    value.m_key.m_tone = input[n] - '0';
+                    value.m_key_rest.m_raw_end = n + 1;
+                    value.m_parsed_len = curstep->m_parsed_len + (n + 1 - m);
+                    nextstep = &g_array_index
+                        (parse_steps, parse_value_t, n + 1);
+                    save_next_step(nextstep, value);
                 }
             }
         }
     }
-
-    /* final step for back tracing. */
-    gint16 parsed_len = final_step(step_len, keys, key_rests);
-
-#if 0
-    /* post processing for re-split table. */
-    if (options & USE_RESPLIT_TABLE) {
-        post_process2(options, keys, key_rests, str, len);
-    }
-#endif
-
-    g_free(input);
-    return parsed_len;
 }
 
-int FullPinyinParser2::final_step(size_t step_len, ChewingKeyVector & keys,
+int FullPinyinParser2::final_step(ParseValueVector parse_steps,
+                                  size_t step_len, ChewingKeyVector & keys,
                                   ChewingKeyRestVector & key_rests) const{
     int i;
     gint16 parsed_len = 0;
@@ -339,7 +459,7 @@ int FullPinyinParser2::final_step(size_t step_len, ChewingKeyVector & keys,
 
     /* find longest match, which starts from the beginning of input. */
     for (i = step_len - 1; i >= 0; --i) {
-        curstep = &g_array_index(m_parse_steps, parse_value_t, i);
+        curstep = &g_array_index(parse_steps, parse_value_t, i);
         if (i == curstep->m_parsed_len)
             break;
     }
@@ -362,7 +482,7 @@ int FullPinyinParser2::final_step(size_t step_len, ChewingKeyVector & keys,
         }
 
         /* back ward */
-        curstep = &g_array_index(m_parse_steps, parse_value_t,
+        curstep = &g_array_index(parse_steps, parse_value_t,
                                  curstep->m_last_step);
     }
     return parsed_len;
@@ -371,16 +491,9 @@ int FullPinyinParser2::final_step(size_t step_len, ChewingKeyVector & keys,
 bool FullPinyinParser2::set_scheme(FullPinyinScheme scheme){
     switch(scheme){
     case FULL_PINYIN_HANYU:
-        m_pinyin_index = pinyin_index;
-        m_pinyin_index_len = G_N_ELEMENTS(pinyin_index);
-        break;
     case FULL_PINYIN_LUOMA:
-        m_pinyin_index = luoma_pinyin_index;
-        m_pinyin_index_len = G_N_ELEMENTS(luoma_pinyin_index);
-        break;
     case FULL_PINYIN_SECONDARY_ZHUYIN:
-        m_pinyin_index = secondary_zhuyin_index;
-        m_pinyin_index_len = G_N_ELEMENTS(secondary_zhuyin_index);
+        m_trie = get_pinyin_index_trie(scheme);
         break;
     default:
         assert(false);
@@ -390,6 +503,25 @@ bool FullPinyinParser2::set_scheme(FullPinyinScheme scheme){
 
 #define IS_KEY(x)   (('a' <= x && x <= 'z') || x == ';')
 
+bool DoublePinyinParser2::search_pinyin(pinyin_option_t options,
+                                        const char * shengmu,
+                                        const char * yunmu,
+                                        ChewingKey & key) const {
+    /* walk the shengmu then the yunmu, without concatenation. */
+    guint16 node = 0;
+    for (const char * p = shengmu; *p; ++p) {
+        if (!m_trie->walk(node, *p))
+            return false;
+    }
+
+    for (const char * p = yunmu; *p; ++p) {
+        if (!m_trie->walk(node, *p))
+            return false;
+    }
+
+    return lookup_pinyin_key(options, m_trie->get_item(node), key);
+}
+
 bool DoublePinyinParser2::parse_one_key(pinyin_option_t options,
                                         ChewingKey & key,
                                         const char *str, int len) const {
@@ -412,7 +544,7 @@ bool DoublePinyinParser2::parse_one_key(pinyin_option_t options,
         if (NULL == sheng || strcmp(sheng, "'") == 0)
             return false;
 
-        if (search_pinyin_index(options, sheng, key))
+        if (search_pinyin(options, sheng, "", key))
             return true;
         else
             return false;
@@ -444,7 +576,6 @@ bool DoublePinyinParser2::parse_one_key(pinyin_option_t options,
 
         int charid = ch == ';' ? 26 : ch - 'a';
         const char * sheng = m_shengmu_table[charid].m_shengmu;
-        gchar * pinyin = NULL;
         if (NULL == sheng)
             goto fallback;
         if (0 == strcmp(sheng, "'"))
@@ -463,50 +594,41 @@ bool DoublePinyinParser2::parse_one_key(pinyin_option_t options,
             if (NULL == yun)
                 break;
 
-            pinyin = g_strdup_printf("%s%s", sheng, yun);
-            if (search_pinyin_index(options, pinyin, key)) {
+            if (search_pinyin(options, sheng, yun, key)) {
                 key.m_tone = tone;
-                g_free(pinyin);
                 return true;
             }
-            g_free(pinyin);
 
             /* second yunmu */
             yun = m_yunmu_table[charid].m_yunmus[1];
             if (NULL == yun)
                 break;
 
-            pinyin = g_strdup_printf("%s%s", sheng, yun);
-            if (search_pinyin_index(options, pinyin, key)) {
+            if (search_pinyin(options, sheng, yun, key)) {
                 key.m_tone = tone;
-                g_free(pinyin);
                 return true;
             }
-            g_free(pinyin);
         } while(0);
 
     fallback:
         /* support fallback table for double pinyin. */
         if (m_fallback_table) {
-            gchar * input = g_strndup(str, 2);
-
             const char * yunmu = NULL;
             const double_pinyin_scheme_fallback_item_t * item =
                 m_fallback_table;
 
             /* as the fallback table is short, just iterate the table. */
             while(NULL != item->m_input) {
-                if (0 == strcmp(item->m_input, input))
+                if (0 == strncmp(item->m_input, str, 2) &&
+                    '\0' == item->m_input[2])
                     yunmu = item->m_yunmu;
                 item++;
             }
 
-            if (NULL != yunmu && search_pinyin_index(options, yunmu, key)) {
+            if (NULL != yunmu && search_pinyin(options, "", yunmu, key)) {
                 key.m_tone = tone;
-                g_free(input);
                 return true;
             }
-            g_free(input);
             return false;
         }
     }
@@ -602,59 +724,13 @@ bool DoublePinyinParser2::set_scheme(DoublePinyinScheme scheme) {
 
 
 PinyinDirectParser2::PinyinDirectParser2 (){
-    m_pinyin_index = pinyin_index;
-    m_pinyin_index_len = G_N_ELEMENTS(pinyin_index);
+    m_trie = get_pinyin_index_trie(FULL_PINYIN_HANYU);
 }
 
 bool PinyinDirectParser2::parse_one_key(pinyin_option_t options,
                                         ChewingKey & key,
                                         const char *str, int len) const {
-    /* "'" are not accepted in parse_one_key. */
-    gchar * input = g_strndup(str, len);
-    assert(NULL == strchr(input, '\''));
-
-    guint16 tone = CHEWING_ZERO_TONE; guint16 tone_pos = 0;
-    guint16 parsed_len = len;
-    key = ChewingKey();
-
-    if (options & USE_TONE) {
-        /* find the tone in the last character. */
-        char chr = input[parsed_len - 1];
-        if ( '0' < chr && chr <= '5' ) {
-            tone = chr - '0';
-            parsed_len --;
-            tone_pos = parsed_len;
-        }
-
-        /* check the force tone option. */
-        if (options & FORCE_TONE && CHEWING_ZERO_TONE == tone) {
-            g_free(input);
-            return false;
-        }
-    }
-
-    /* parse pinyin core staff here. */
-
-    /* Note: optimize here? */
-    input[parsed_len] = '\0';
-    if (!search_pinyin_index2(options, m_pinyin_index, m_pinyin_index_len,
-                              input, key)) {
-        g_free(input);
-        return false;
-    }
-
-    if (options & USE_TONE) {
-        /* post processing tone. */
-        if ( parsed_len == tone_pos ) {
-            if (tone != CHEWING_ZERO_TONE) {
-                key.m_tone = tone;
-                parsed_len ++;
-            }
-        }
-    }
-
-    g_free(input);
-    return parsed_len == len;
+    return parse_one_pinyin_key(m_trie, options, key, str, len);
 }
 
 int PinyinDirectParser2::parse(pinyin_option_t options,
@@ -22,6 +22,7 @@
 #ifndef PINYIN_PARSER2_H
 #define PINYIN_PARSER2_H
 
+#include <string.h>
 #include <glib.h>
 #include "novel_types.h"
 #include "chewing_key.h"
@@ -51,6 +52,58 @@ typedef struct {
     guint16      m_table_index;
 } chewing_index_item_t;
 
+/**
+ * chewing_index_hash_t:
+ *
+ * The minimal perfect hash of the chewing index,
+ * generated by scripts2/perfecthash.py.
+ *
+ */
+typedef struct {
+    /* the index items in the slot order. */
+    const chewing_index_item_t * m_items;
+    /* the displacement of each bucket, the negative one is the slot. */
+    const gint32 * m_displacements;
+    size_t m_len;
+} chewing_index_hash_t;
+
+/* the seeded FNV-1a hash, keep it in sync with perfecthash.py. */
+inline guint32 chewing_index_hash(guint32 seed, const char * str) {
+    guint32 value = 2166136261U ^ seed;
+    for (; *str; ++str) {
+        value ^= (guchar) *str;
+        value *= 16777619U;
+    }
+    return value;
+}
+
+/**
+ * search_chewing_index_hash:
+ * @hash: the minimal perfect hash of the chewing index.
+ * @chewing: the chewing string.
+ * @returns: the index item of the chewing string, NULL for none.
+ *
+ * Search the chewing string in O(1), the options are not checked.
+ *
+ */
+inline const chewing_index_item_t * search_chewing_index_hash
+(const chewing_index_hash_t * hash, const char * chewing) {
+    const gint32 displacement = hash->m_displacements
+        [chewing_index_hash(0, chewing) % hash->m_len];
+
+    size_t slot = 0;
+    if (displacement < 0)
+        slot = - displacement - 1;
+    else
+        slot = chewing_index_hash(displacement, chewing) % hash->m_len;
+
+    const chewing_index_item_t * item = hash->m_items + slot;
+    if (0 != strcmp(item->m_chewing_input, chewing))
+        return NULL;
+
+    return item;
+}
+
 typedef struct {
     const char * m_orig_key;
     ChewingKey m_orig_struct;
@@ -86,6 +139,124 @@ typedef struct {
 typedef GArray * ParseValueVector;
 
 
+/* the trie is keyed by the lower case letters. */
+#define PINYIN_TRIE_ALPHABET_SIZE 26
+
+/**
+ * pinyin_trie_node_t:
+ *
+ * The node of the pinyin index trie.
+ *
+ */
+typedef struct {
+    /* the next nodes index by letter, zero for none. */
+    guint16 m_next[PINYIN_TRIE_ALPHABET_SIZE];
+    /* the index item ends at this node, NULL for none. */
+    const pinyin_index_item_t * m_item;
+} pinyin_trie_node_t;
+
+/**
+ * PinyinIndexTrie:
+ *
+ * The trie of the pinyin index, walked forward one letter at a time.
+ *
+ * Note:
+ *   All index items are kept in the trie, the option-gated items are
+ *   checked by the parsers when matched.
+ *   The tries are built once and shared by all parsers,
+ *   see get_pinyin_index_trie.
+ *
+ */
+class PinyinIndexTrie
+{
+private:
+    /* Array of pinyin_trie_node_t, the root is the first node. */
+    GArray * m_nodes;
+
+public:
+    /**
+     * PinyinIndexTrie::PinyinIndexTrie:
+     * @index: the pinyin index.
+     * @len: the length of the pinyin index.
+     *
+     * Build the trie of the pinyin index.
+     *
+     */
+    PinyinIndexTrie(const pinyin_index_item_t * index, size_t len);
+
+    /**
+     * PinyinIndexTrie::~PinyinIndexTrie:
+     *
+     * The destructor of the PinyinIndexTrie.
+     *
+     */
+    ~PinyinIndexTrie();
+
+    /**
+     * PinyinIndexTrie::walk:
+     * @node: the current node, updated to the next node.
+     * @ch: the next character.
+     * @returns: whether the next node exists.
+     *
+     * Walk one character forward from the node, the root node is zero.
+     *
+     */
+    bool walk(/* inout */ guint16 & node, char ch) const {
+        if (!('a' <= ch && ch <= 'z'))
+            return false;
+
+        const pinyin_trie_node_t * cur = &g_array_index
+            (m_nodes, pinyin_trie_node_t, node);
+        guint16 next = cur->m_next[ch - 'a'];
+        if (0 == next)
+            return false;
+
+        node = next;
+        return true;
+    }
+
+    /**
+     * PinyinIndexTrie::get_item:
+     * @node: the node.
+     * @returns: the index item ends at the node, NULL for none.
+     *
+     * Get the index item ends at the node.
+     *
+     */
+    const pinyin_index_item_t * get_item(guint16 node) const {
+        return g_array_index(m_nodes, pinyin_trie_node_t, node).m_item;
+    }
+
+    /**
+     * PinyinIndexTrie::search:
+     * @str: the pinyin string.
+     * @len: the length of the str.
+     * @returns: the index item of the pinyin string, NULL for none.
+     *
+     * Search the index item of the whole pinyin string.
+     *
+     */
+    const pinyin_index_item_t * search(const char * str, int len) const {
+        guint16 node = 0;
+        for (int i = 0; i < len; ++i) {
+            if (!walk(node, str[i]))
+                return NULL;
+        }
+        return get_item(node);
+    }
+};
+
+/**
+ * get_pinyin_index_trie:
+ * @scheme: the full pinyin scheme.
+ * @returns: the shared trie of the pinyin index of the scheme.
+ *
+ * Get the shared trie, built once when first used.
+ *
+ */
+const PinyinIndexTrie * get_pinyin_index_trie(FullPinyinScheme scheme);
+
+
 /**
  * PhoneticParser2:
  *
@@ -133,6 +304,58 @@ public:
 };
 
 
+/**
+ * FullPinyinParseState:
+ *
+ * The dynamic programming state of the last full pinyin parse.
+ *
+ * Note:
+ *   The parse steps of the common prefix with the last input are
+ *   reused by FullPinyinParser2::parse_more, only the tail is parsed.
+ *   The state is not thread-safe, use one state per instance.
+ *
+ */
+class FullPinyinParseState
+{
+    friend class FullPinyinParser2;
+
+private:
+    /* Array of char, the last parsed input. */
+    GArray * m_input;
+    /* Array of parse_value_t, one step per input position. */
+    ParseValueVector m_parse_steps;
+
+    /* the options and the trie of the last parse. */
+    pinyin_option_t m_options;
+    const PinyinIndexTrie * m_trie;
+
+public:
+    /**
+     * FullPinyinParseState::FullPinyinParseState:
+     *
+     * The constructor of the FullPinyinParseState.
+     *
+     */
+    FullPinyinParseState();
+
+    /**
+     * FullPinyinParseState::~FullPinyinParseState:
+     *
+     * The destructor of the FullPinyinParseState.
+     *
+     */
+    ~FullPinyinParseState();
+
+    /**
+     * FullPinyinParseState::reset:
+     *
+     * Forget the last parse, the next parse starts from the beginning.
+     *
+     */
+    void reset();
+};
+
+
 /**
  * FullPinyinParser2:
  *
@@ -141,21 +364,20 @@ public:
  */
 class FullPinyinParser2 : public PhoneticParser2
 {
-    /* Note: some internal pointers to full pinyin table. */
-    const pinyin_index_item_t * m_pinyin_index;
-    size_t m_pinyin_index_len;
+    /* Note: the shared trie of the full pinyin table. */
+    const PinyinIndexTrie * m_trie;
 
 protected:
-    ParseValueVector m_parse_steps;
+    void fill_steps(pinyin_option_t options, ParseValueVector parse_steps,
+                    const char * str, int len, int stable_len) const;
 
-    int final_step(size_t step_len, ChewingKeyVector & keys,
+    int final_step(ParseValueVector parse_steps,
+                   size_t step_len, ChewingKeyVector & keys,
                    ChewingKeyRestVector & key_rests) const;
 
 public:
     FullPinyinParser2();
-    virtual ~FullPinyinParser2() {
-        g_array_free(m_parse_steps, TRUE);
-    }
+    virtual ~FullPinyinParser2() {}
 
     virtual bool parse_one_key(pinyin_option_t options, ChewingKey & key, const char *str, int len) const;
 
@@ -164,6 +386,24 @@ public:
      */
     virtual int parse(pinyin_option_t options, ChewingKeyVector & keys, ChewingKeyRestVector & key_rests, const char *str, int len) const;
 
+    /**
+     * FullPinyinParser2::parse_more:
+     * @options: the pinyin options.
+     * @state: the state of the last parse, updated by this parse.
+     * @keys: the parsed keys.
+     * @key_rests: the parsed key rests.
+     * @str: the input string.
+     * @len: the length of the str.
+     * @returns: the parsed length of the str.
+     *
+     * Same as parse, but only the steps after the common prefix with
+     * the last input are parsed again.
+     *
+     */
+    int parse_more(pinyin_option_t options, FullPinyinParseState & state,
+                   ChewingKeyVector & keys, ChewingKeyRestVector & key_rests,
+                   const char *str, int len) const;
+
 public:
     bool set_scheme(FullPinyinScheme scheme);
 };
@@ -185,11 +425,18 @@ protected:
     const double_pinyin_scheme_yunmu_item_t    * m_yunmu_table;
     const double_pinyin_scheme_fallback_item_t * m_fallback_table;
 
+    /* the shared trie of the hanyu pinyin table. */
+    const PinyinIndexTrie * m_trie;
+
+    bool search_pinyin(pinyin_option_t options, const char * shengmu,
+                       const char * yunmu, ChewingKey & key) const;
+
 public:
     DoublePinyinParser2() {
         m_shengmu_table = NULL;
         m_yunmu_table = NULL;
         m_fallback_table = NULL;
+        m_trie = get_pinyin_index_trie(FULL_PINYIN_HANYU);
 
         set_scheme(DOUBLE_PINYIN_DEFAULT);
     }
@@ -208,8 +455,7 @@ public:
 class PinyinDirectParser2 : public PhoneticParser2
 {
     /* Only support Hanyu Pinyin now. */
-    const pinyin_index_item_t * m_pinyin_index;
-    size_t m_pinyin_index_len;
+    const PinyinIndexTrie * m_trie;
 
 public:
     PinyinDirectParser2();
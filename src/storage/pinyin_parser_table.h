@@ -3971,6 +3971,4990 @@ const chewing_index_item_t eten26_zhuyin_index[] = {
 {"ㄫ" /* "ng" */, IS_ZHUYIN|IS_PINYIN, 234}
 };
 
+/* the minimal perfect hashes of the zhuyin indexes. */
+const chewing_index_item_t zhuyin_index_hash_items[] = {
+{"ㄊㄨㄥ", IS_ZHUYIN|IS_PINYIN, 353},
+{"ㄎㄨ", IS_ZHUYIN|IS_PINYIN, 168},
+{"ㄢㄘㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 56},
+{"ㄚㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 372},
+{"ㄠㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 308},
+{"ㄢㄨㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 247},
+{"ㄡ", IS_ZHUYIN|IS_PINYIN, 253},
+{"ㄌㄧㄠ", IS_ZHUYIN|IS_PINYIN, 190},
+{"ㄨㄍㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 118},
+{"ㄕㄜ", IS_ZHUYIN|IS_PINYIN, 318},
+{"ㄡㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 243},
+{"ㄋㄨㄥ", IS_ZHUYIN|IS_PINYIN, 244},
+{"ㄧㄌㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 187},
+{"ㄠㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 106},
+{"ㄅㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 16},
+{"ㄧㄝㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 74},
+{"ㄣㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 279},
+{"ㄧㄥㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 352},
+{"ㄌㄨㄣ", IS_ZHUYIN|IS_PINYIN, 200},
+{"ㄆㄡ", IS_ZHUYIN|IS_PINYIN, 270},
+{"ㄩㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 202},
+{"ㄨㄞㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 326},
+{"ㄔㄨㄚ", IS_ZHUYIN, 45},
+{"ㄘㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 58},
+{"ㄨㄗㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 439},
+{"ㄢㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 92},
+{"ㄞㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 158},
+{"ㄓㄚ", IS_ZHUYIN|IS_PINYIN, 413},
+{"ㄧㄅㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 20},
+{"ㄉㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 83},
+{"ㄝㄒㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 383},
+{"ㄚㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 122},
+{"ㄧㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 348},
+{"ㄡㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 167},
+{"ㄣㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 174},
+{"ㄨㄢㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 136},
+{"ㄧㄐㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 149},
+{"ㄊㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 353},
+{"ㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 263},
+{"ㄖㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 301},
+{"ㄧㄅㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 16},
+{"ㄩㄢㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 284},
+{"ㄞㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 427},
+{"ㄎㄨㄚ", IS_ZHUYIN|IS_PINYIN, 169},
+{"ㄚㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 71},
+{"ㄔㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 47},
+{"ㄨㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 271},
+{"ㄧㄡㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 194},
+{"ㄓ", IS_ZHUYIN|IS_PINYIN, 422},
+{"ㄑㄩㄣ", IS_ZHUYIN|IS_PINYIN, 286},
+{"ㄆㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 267},
+{"ㄑㄩㄥ", IS_ZHUYIN|IS_PINYIN, 281},
+{"ㄡㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 112},
+{"ㄣㄩㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 384},
+{"ㄡㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 220},
+{"ㄕㄟ", IS_ZHUYIN|IS_PINYIN, 319},
+{"ㄤㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 105},
+{"ㄡㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 99},
+{"ㄢㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 207},
+{"ㄨㄌㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 199},
+{"ㄌㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 196},
+{"ㄝㄩㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 383},
+{"ㄧㄝㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 278},
+{"ㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 80},
+{"ㄡㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 243},
+{"ㄘㄞ", IS_ZHUYIN|IS_PINYIN, 25},
+{"ㄒㄢㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 382},
+{"ㄏㄟ", IS_ZHUYIN|IS_PINYIN, 128},
+{"ㄨㄟㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 438},
+{"ㄨㄕㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 329},
+{"ㄨㄕㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 331},
+{"ㄘㄨㄢ", IS_ZHUYIN|IS_PINYIN, 56},
+{"ㄌㄣ", IS_ZHUYIN, 184},
+{"ㄧㄑㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 278},
+{"ㄧㄢㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 188},
+{"ㄉㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 76},
+{"ㄐㄧ", IS_ZHUYIN|IS_PINYIN, 142},
+{"ㄥㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 280},
+{"ㄧㄝㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 240},
+{"ㄙㄚ", IS_ZHUYIN|IS_PINYIN, 304},
+{"ㄨㄣㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 119},
+{"ㄅㄧ", IS_ZHUYIN|IS_PINYIN, 15},
+{"ㄆㄣ", IS_ZHUYIN|IS_PINYIN, 261},
+{"ㄒㄣㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 384},
+{"ㄥㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 53},
+{"ㄜㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 29},
+{"ㄤㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 48},
+{"ㄨㄟ", IS_ZHUYIN|IS_PINYIN, 365},
+{"ㄈ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 90},
+{"ㄅㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 18},
+{"ㄨㄚ", IS_ZHUYIN|IS_PINYIN, 361},
+{"ㄧㄒㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 378},
+{"ㄨㄢㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 56},
+{"ㄞㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 342},
+{"ㄚㄨㄔ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 45},
+{"ㄅㄧㄝ", IS_ZHUYIN|IS_PINYIN, 18},
+{"ㄒㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 383},
+{"ㄠㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 259},
+{"ㄓㄠ", IS_ZHUYIN|IS_PINYIN, 417},
+{"ㄞㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 170},
+{"ㄢㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 116},
+{"ㄟㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 173},
+{"ㄣㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 139},
+{"ㄟㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 57},
+{"ㄌㄧㄤ", IS_ZHUYIN|IS_PINYIN, 189},
+{"ㄛㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 120},
+{"ㄧㄉㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 71},
+{"ㄧㄌㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 190},
+{"ㄧㄇㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 219},
+{"ㄨㄤㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 137},
+{"ㄧㄠㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 216},
+{"ㄞㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 226},
+{"ㄧㄚ", IS_ZHUYIN|IS_PINYIN, 386},
+{"ㄙㄨㄢ", IS_ZHUYIN|IS_PINYIN, 336},
+{"ㄏㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 140},
+{"ㄧㄑㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 279},
+{"ㄔㄡ", IS_ZHUYIN|IS_PINYIN, 43},
+{"ㄥㄅㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 20},
+{"ㄋㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 247},
+{"ㄞㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 170},
+{"ㄡㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 354},
+{"ㄆㄟ", IS_ZHUYIN|IS_PINYIN, 260},
+{"ㄧㄇㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 217},
+{"ㄥㄑㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 281},
+{"ㄛㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 395},
+{"ㄐㄣㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 155},
+{"ㄨㄛㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 339},
+{"ㄣㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 30},
+{"ㄏㄜ", IS_ZHUYIN|IS_PINYIN, 127},
+{"ㄥㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 42},
+{"ㄕㄚ", IS_ZHUYIN|IS_PINYIN, 313},
+{"ㄧㄌㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 193},
+{"ㄠㄧㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 350},
+{"ㄨㄟㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 329},
+{"ㄣㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 192},
+{"ㄐㄧㄝ", IS_ZHUYIN|IS_PINYIN, 147},
+{"ㄨㄗㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 434},
+{"ㄇㄧㄝ", IS_ZHUYIN|IS_PINYIN, 217},
+{"ㄓㄟ", IS_ZHUYIN, 419},
+{"ㄡㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 220},
+{"ㄣㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 174},
+{"ㄧㄒㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 377},
+{"ㄡㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 323},
+{"ㄟㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 329},
+{"ㄨㄏㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 134},
+{"ㄥㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 280},
+{"ㄐㄩㄢ", IS_ZHUYIN|IS_PINYIN, 153},
+{"ㄚㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 169},
+{"ㄣㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 164},
+{"ㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 397},
+{"ㄢㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 56},
+{"ㄝㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 217},
+{"ㄈㄟ", IS_ZHUYIN|IS_PINYIN, 95},
+{"ㄕㄨㄢ", IS_ZHUYIN|IS_PINYIN, 327},
+{"ㄐㄩ", IS_ZHUYIN|IS_PINYIN, 152},
+{"ㄆㄧ", IS_ZHUYIN|IS_PINYIN, 263},
+{"ㄒㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 378},
+{"ㄚㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 143},
+{"ㄅㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 19},
+{"ㄋㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 249},
+{"ㄨㄤㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 117},
+{"ㄛㄙㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 339},
+{"ㄧㄐㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 151},
+{"ㄡㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 54},
+{"ㄢㄐㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 153},
+{"ㄍㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 111},
+{"ㄋㄨ", IS_ZHUYIN|IS_PINYIN, 246},
+{"ㄨㄢㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 171},
+{"ㄨㄥㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 111},
+{"ㄡㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 270},
+{"ㄟㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 67},
+{"ㄒㄩㄝ", IS_ZHUYIN|IS_PINYIN, 383},
+{"ㄨㄛㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 440},
+{"ㄕ", IS_ZHUYIN|IS_PINYIN, 322},
+{"ㄗㄥ", IS_ZHUYIN|IS_PINYIN, 411},
+{"ㄥㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 131},
+{"ㄧㄒㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 372},
+{"ㄌㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 194},
+{"ㄏㄨㄛ", IS_ZHUYIN|IS_PINYIN, 140},
+{"ㄤㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 137},
+{"ㄧㄥ", IS_ZHUYIN|IS_PINYIN, 394},
+{"ㄒㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 380},
+{"ㄥㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 411},
+{"ㄓㄨㄣ", IS_ZHUYIN|IS_PINYIN, 431},
+{"ㄓㄨㄢ", IS_ZHUYIN|IS_PINYIN, 428},
+{"ㄓㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 427},
+{"ㄟㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 357},
+{"ㄨㄗㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 440},
+{"ㄟㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 138},
+{"ㄤㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 189},
+{"ㄣㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 261},
+{"ㄨㄟㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 82},
+{"ㄨㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 22},
+{"ㄍㄤ", IS_ZHUYIN|IS_PINYIN, 105},
+{"ㄌㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 187},
+{"ㄥㄋㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 244},
+{"ㄓㄤ", IS_ZHUYIN|IS_PINYIN, 416},
+{"ㄅㄣ", IS_ZHUYIN|IS_PINYIN, 13},
+{"ㄣㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 109},
+{"ㄧㄠㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 239},
+{"ㄛㄌㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 201},
+{"ㄨㄣㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 50},
+{"ㄘㄜ", IS_ZHUYIN|IS_PINYIN, 29},
+{"ㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 394},
+{"ㄨㄣㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 139},
+{"ㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 133},
+{"ㄆㄥ", IS_ZHUYIN|IS_PINYIN, 262},
+{"ㄥㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 31},
+{"ㄣㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 330},
+{"ㄐㄧㄡ", IS_ZHUYIN|IS_PINYIN, 151},
+{"ㄛㄗㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 440},
+{"ㄢㄩㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 382},
+{"ㄍㄨㄤ", IS_ZHUYIN|IS_PINYIN, 117},
+{"ㄨㄛ", IS_ZHUYIN|IS_PINYIN, 368},
+{"ㄝㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 18},
+{"ㄏㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 136},
+{"ㄡㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 296},
+{"ㄧㄒㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 380},
+{"ㄣㄉㄧ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 75},
+{"ㄧㄢㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 16},
+{"ㄢㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 215},
+{"ㄧㄠㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 146},
+{"ㄩㄥ", IS_ZHUYIN|IS_PINYIN, 396},
+{"ㄔㄥ", IS_ZHUYIN|IS_PINYIN, 40},
+{"ㄢㄨㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 199},
+{"ㄆㄧㄥ", IS_ZHUYIN|IS_PINYIN, 268},
+{"ㄣㄌㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 200},
+{"ㄨㄛㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 331},
+{"ㄐㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 147},
+{"ㄐㄩㄝ", IS_ZHUYIN|IS_PINYIN, 154},
+{"ㄑㄢㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 284},
+{"ㄩㄋㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 251},
+{"ㄉㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 72},
+{"ㄟㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 128},
+{"ㄊㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 358},
+{"ㄢㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 144},
+{"ㄛ", IS_ZHUYIN|IS_PINYIN, 252},
+{"ㄨㄢㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 299},
+{"ㄖㄣ", IS_ZHUYIN|IS_PINYIN, 292},
+{"ㄨㄍㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 111},
+{"ㄣㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 358},
+{"ㄢㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 215},
+{"ㄕㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 331},
+{"ㄨㄎㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 174},
+{"ㄎㄢ", IS_ZHUYIN|IS_PINYIN, 159},
+{"ㄟㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 337},
+{"ㄥㄨㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 244},
+{"ㄟㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 49},
+{"ㄩㄐㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 155},
+{"ㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 335},
+{"ㄧㄣㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 148},
+{"ㄢㄊㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 349},
+{"ㄇㄨ", IS_ZHUYIN|IS_PINYIN, 223},
+{"ㄢㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 428},
+{"ㄢㄌㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 199},
+{"ㄒㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 373},
+{"ㄌㄨㄢ", IS_ZHUYIN|IS_PINYIN, 199},
+{"ㄚ", IS_ZHUYIN|IS_PINYIN, 1},
+{"ㄌㄡ", IS_ZHUYIN|IS_PINYIN, 197},
+{"ㄢㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 136},
+{"ㄨㄍㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 119},
+{"ㄧㄉㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 74},
+{"ㄣㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 439},
+{"ㄛㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 84},
+{"ㄨㄟㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 138},
+{"ㄘㄚ", IS_ZHUYIN|IS_PINYIN, 24},
+{"ㄖㄨㄟ", IS_ZHUYIN|IS_PINYIN, 300},
+{"ㄤㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 276},
+{"ㄡㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 334},
+{"ㄗㄠ", IS_ZHUYIN|IS_PINYIN, 407},
+{"ㄢㄙㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 336},
+{"ㄇㄢ", IS_ZHUYIN|IS_PINYIN, 207},
+{"ㄣㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 420},
+{"ㄏㄨㄟ", IS_ZHUYIN|IS_PINYIN, 138},
+{"ㄧㄠㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 17},
+{"ㄩㄑㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 281},
+{"ㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 113},
+{"ㄋㄚㄧ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 236},
+{"ㄝㄌㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 203},
+{"ㄜㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 210},
+{"ㄖㄡ", IS_ZHUYIN|IS_PINYIN, 296},
+{"ㄊㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 350},
+{"ㄧㄢㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 215},
+{"ㄇㄧㄥ", IS_ZHUYIN|IS_PINYIN, 219},
+{"ㄣㄨㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 200},
+{"ㄨㄎㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 172},
+{"ㄧㄇㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 216},
+{"ㄏㄨㄚ", IS_ZHUYIN|IS_PINYIN, 134},
+{"ㄌㄧㄚ", IS_ZHUYIN|IS_PINYIN, 187},
+{"ㄝㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 240},
+{"ㄤㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 48},
+{"ㄨㄥㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 78},
+{"ㄜㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 182},
+{"ㄑㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 275},
+{"ㄆㄧㄢ", IS_ZHUYIN|IS_PINYIN, 264},
+{"ㄠㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 73},
+{"ㄟㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 108},
+{"ㄉㄧㄣ", IS_ZHUYIN, 75},
+{"ㄍㄨㄟ", IS_ZHUYIN|IS_PINYIN, 118},
+{"ㄘㄥ", IS_ZHUYIN|IS_PINYIN, 31},
+{"ㄏㄢ", IS_ZHUYIN|IS_PINYIN, 124},
+{"ㄢㄖㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 299},
+{"ㄨㄚㄔ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 45},
+{"ㄡㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 151},
+{"ㄝㄑㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 285},
+{"ㄉㄟ", IS_ZHUYIN|IS_PINYIN, 67},
+{"ㄨㄛㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 432},
+{"ㄠㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 190},
+{"ㄒㄧㄥ", IS_ZHUYIN|IS_PINYIN, 378},
+{"ㄩㄑㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 285},
+{"ㄧㄚㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 187},
+{"ㄣㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 148},
+{"ㄊㄚ", IS_ZHUYIN|IS_PINYIN, 341},
+{"ㄧㄅㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 17},
+{"ㄝㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 147},
+{"ㄖㄚㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 298},
+{"ㄘㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 57},
+{"ㄨㄔㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 49},
+{"ㄢㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 373},
+{"ㄧㄒㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 376},
+{"ㄧㄝㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 217},
+{"ㄠ", IS_ZHUYIN|IS_PINYIN, 5},
+{"ㄊㄥ", IS_ZHUYIN|IS_PINYIN, 347},
+{"ㄢㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 144},
+{"ㄓㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 432},
+{"ㄥㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 20},
+{"ㄞㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 178},
+{"ㄥㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 421},
+{"ㄨㄣㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 301},
+{"ㄥㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 78},
+{"ㄛㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 175},
+{"ㄧㄣㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 377},
+{"ㄧㄥㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 378},
+{"ㄜ", IS_ZHUYIN|IS_PINYIN, 85},
+{"ㄉㄧㄥ", IS_ZHUYIN|IS_PINYIN, 76},
+{"ㄓㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 426},
+{"ㄨㄗㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 438},
+{"ㄍㄠ", IS_ZHUYIN|IS_PINYIN, 106},
+{"ㄌㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 188},
+{"ㄨㄘㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 59},
+{"ㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 371},
+{"ㄥㄙㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 333},
+{"ㄔㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 50},
+{"ㄧㄚㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 372},
+{"ㄩㄐㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 153},
+{"ㄧㄋㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 240},
+{"ㄉㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 78},
+{"ㄐㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 148},
+{"ㄒㄩㄥ", IS_ZHUYIN|IS_PINYIN, 379},
+{"ㄉㄡ", IS_ZHUYIN|IS_PINYIN, 79},
+{"ㄚㄖㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 298},
+{"ㄨㄔㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 42},
+{"ㄠㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 277},
+{"ㄆㄛ", IS_ZHUYIN|IS_PINYIN, 269},
+{"ㄨㄛㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 359},
+{"ㄉㄨㄣ", IS_ZHUYIN|IS_PINYIN, 83},
+{"ㄨㄢㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 47},
+{"ㄓㄨㄞ", IS_ZHUYIN|IS_PINYIN, 427},
+{"ㄇㄚ", IS_ZHUYIN|IS_PINYIN, 205},
+{"ㄛㄖㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 302},
+{"ㄨㄓㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 427},
+{"ㄑㄧㄠ", IS_ZHUYIN|IS_PINYIN, 277},
+{"ㄘㄣ", IS_ZHUYIN|IS_PINYIN, 30},
+{"ㄠㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 407},
+{"ㄣㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 50},
+{"ㄉㄨ", IS_ZHUYIN|IS_PINYIN, 80},
+{"ㄟㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 118},
+{"ㄋㄢ", IS_ZHUYIN|IS_PINYIN, 227},
+{"ㄧㄐㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 148},
+{"ㄐㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 154},
+{"ㄋㄧㄣ", IS_ZHUYIN|IS_PINYIN, 241},
+{"ㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 186},
+{"ㄥㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 193},
+{"ㄢㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 306},
+{"ㄨㄥㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 244},
+{"ㄏㄠ", IS_ZHUYIN|IS_PINYIN, 126},
+{"ㄘㄨㄟ", IS_ZHUYIN|IS_PINYIN, 57},
+{"ㄟㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 82},
+{"ㄨㄏㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 135},
+{"ㄞㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 115},
+{"ㄩㄥㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 150},
+{"ㄇ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 204},
+{"ㄍㄨㄚ", IS_ZHUYIN|IS_PINYIN, 114},
+{"ㄏㄣ", IS_ZHUYIN|IS_PINYIN, 129},
+{"ㄦ", IS_ZHUYIN|IS_PINYIN, 89},
+{"ㄊㄧ", IS_ZHUYIN|IS_PINYIN, 348},
+{"ㄉㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 77},
+{"ㄨㄓㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 428},
+{"ㄓㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 428},
+{"ㄕㄨㄞ", IS_ZHUYIN|IS_PINYIN, 326},
+{"ㄢㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 356},
+{"ㄨㄣㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 58},
+{"ㄨㄓㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 429},
+{"ㄧㄣㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 192},
+{"ㄣㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 148},
+{"ㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 389},
+{"ㄊㄜ", IS_ZHUYIN|IS_PINYIN, 346},
+{"ㄨㄕㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 330},
+{"ㄧㄣ", IS_ZHUYIN|IS_PINYIN, 393},
+{"ㄑㄣㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 286},
+{"ㄜㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 291},
+{"ㄨㄉㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 84},
+{"ㄖㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 299},
+{"ㄆㄧㄝ", IS_ZHUYIN|IS_PINYIN, 266},
+{"ㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 366},
+{"ㄝㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 217},
+{"ㄧㄚㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 143},
+{"ㄡㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 194},
+{"ㄧㄝㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 18},
+{"ㄋㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 251},
+{"ㄟㄊㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 357},
+{"ㄣㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 410},
+{"ㄣㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 377},
+{"ㄨㄙㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 337},
+{"ㄜㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 107},
+{"ㄟㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 430},
+{"ㄥㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 353},
+{"ㄤㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 117},
+{"ㄧㄥㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 149},
+{"ㄡㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 151},
+{"ㄉㄢ", IS_ZHUYIN|IS_PINYIN, 63},
+{"ㄤㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 416},
+{"ㄣㄑㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 286},
+{"ㄛㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 140},
+{"ㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 355},
+{"ㄝㄆㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 266},
+{"ㄥㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 166},
+{"ㄍㄢ", IS_ZHUYIN|IS_PINYIN, 104},
+{"ㄎㄨㄞ", IS_ZHUYIN|IS_PINYIN, 170},
+{"ㄛㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 432},
+{"ㄈㄚ", IS_ZHUYIN|IS_PINYIN, 91},
+{"ㄇㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 217},
+{"ㄢㄑㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 284},
+{"ㄧㄆㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 267},
+{"ㄤㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 258},
+{"ㄆㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 264},
+{"ㄉㄣ", IS_ZHUYIN, 68},
+{"ㄨㄤㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 328},
+{"ㄍㄥ", IS_ZHUYIN|IS_PINYIN, 110},
+{"ㄢㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 171},
+{"ㄟㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 438},
+{"ㄈㄜ", IS_ZHUYIN, 94},
+{"ㄓㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 431},
+{"ㄜㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 230},
+{"ㄨㄟㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 57},
+{"ㄛㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 51},
+{"ㄏㄡ", IS_ZHUYIN|IS_PINYIN, 132},
+{"ㄠㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 317},
+{"ㄨㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 223},
+{"ㄝㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 74},
+{"ㄋㄠ", IS_ZHUYIN|IS_PINYIN, 229},
+{"ㄥㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 76},
+{"ㄠㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 229},
+{"ㄤㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 189},
+{"ㄣㄘㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 58},
+{"ㄧㄡ", IS_ZHUYIN|IS_PINYIN, 397},
+{"ㄔㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 48},
+{"ㄩㄢㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 153},
+{"ㄢㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 179},
+{"ㄐㄧㄚ", IS_ZHUYIN|IS_PINYIN, 143},
+{"ㄓㄨㄤ", IS_ZHUYIN|IS_PINYIN, 429},
+{"ㄠㄅㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 17},
+{"ㄇㄧ", IS_ZHUYIN|IS_PINYIN, 214},
+{"ㄔㄨㄞ", IS_ZHUYIN|IS_PINYIN, 46},
+{"ㄤㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 276},
+{"ㄢㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 299},
+{"ㄨㄛㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 140},
+{"ㄝㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 191},
+{"ㄥㄖㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 295},
+{"ㄟㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 95},
+{"ㄞㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 135},
+{"ㄚㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 255},
+{"ㄥㄌㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 196},
+{"ㄥㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 149},
+{"ㄥㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 396},
+{"ㄥㄊㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 353},
+{"ㄢㄋㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 247},
+{"ㄌㄟ", IS_ZHUYIN|IS_PINYIN, 183},
+{"ㄣㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 377},
+{"ㄙㄜ", IS_ZHUYIN|IS_PINYIN, 309},
+{"ㄊㄞ", IS_ZHUYIN|IS_PINYIN, 342},
+{"ㄙㄞ", IS_ZHUYIN|IS_PINYIN, 305},
+{"ㄌㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 203},
+{"ㄉㄤ", IS_ZHUYIN|IS_PINYIN, 64},
+{"ㄇㄞ", IS_ZHUYIN|IS_PINYIN, 206},
+{"ㄠㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 239},
+{"ㄜㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 309},
+{"ㄨㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 100},
+{"ㄢㄩㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 284},
+{"ㄥㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 130},
+{"ㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 363},
+{"ㄒㄩㄢ", IS_ZHUYIN|IS_PINYIN, 382},
+{"ㄣㄖㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 301},
+{"ㄨㄢㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 437},
+{"ㄒㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 377},
+{"ㄧㄊㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 349},
+{"ㄨㄥㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 434},
+{"ㄝㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 376},
+{"ㄥㄉㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 78},
+{"ㄢㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 315},
+{"ㄧㄤㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 189},
+{"ㄘ", IS_ZHUYIN|IS_PINYIN, 52},
+{"ㄘㄨㄛ", IS_ZHUYIN|IS_PINYIN, 59},
+{"ㄟㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 329},
+{"ㄌㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 190},
+{"ㄣㄌ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 184},
+{"ㄒㄩ", IS_ZHUYIN|IS_PINYIN, 381},
+{"ㄢㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 327},
+{"ㄤㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 172},
+{"ㄨㄊㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 356},
+{"ㄑㄧㄝ", IS_ZHUYIN|IS_PINYIN, 278},
+{"ㄉㄥ", IS_ZHUYIN|IS_PINYIN, 69},
+{"ㄨ", IS_ZHUYIN|IS_PINYIN, 369},
+{"ㄤㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 406},
+{"ㄥㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 242},
+{"ㄍㄜ", IS_ZHUYIN|IS_PINYIN, 107},
+{"ㄨㄏㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 139},
+{"ㄞㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 46},
+{"ㄨㄖㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 301},
+{"ㄙㄨㄛ", IS_ZHUYIN|IS_PINYIN, 339},
+{"ㄠㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 417},
+{"ㄗㄨㄢ", IS_ZHUYIN|IS_PINYIN, 437},
+{"ㄇㄧㄣ", IS_ZHUYIN|IS_PINYIN, 218},
+{"ㄡㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 380},
+{"ㄨㄖㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 300},
+{"ㄇㄥ", IS_ZHUYIN|IS_PINYIN, 213},
+{"ㄜㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 346},
+{"ㄙㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 336},
+{"ㄢㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 47},
+{"ㄖㄥ", IS_ZHUYIN|IS_PINYIN, 293},
+{"ㄨㄋㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 244},
+{"ㄧㄞ", IS_ZHUYIN, 387},
+{"ㄞㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 404},
+{"ㄥㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 434},
+{"ㄨㄖㄚ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 298},
+{"ㄨㄛㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 120},
+{"ㄧㄠㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 265},
+{"ㄣㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 232},
+{"ㄨㄔㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 50},
+{"ㄥㄨㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 196},
+{"ㄥㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 219},
+{"ㄧㄋㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 239},
+{"ㄙㄣ", IS_ZHUYIN|IS_PINYIN, 310},
+{"ㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 388},
+{"ㄚㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 403},
+{"ㄠㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 265},
+{"ㄅㄟ", IS_ZHUYIN|IS_PINYIN, 12},
+{"ㄇㄜ", IS_ZHUYIN|IS_PINYIN, 210},
+{"ㄞㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 427},
+{"ㄝㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 74},
+{"ㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 297},
+{"ㄒㄧㄚ", IS_ZHUYIN|IS_PINYIN, 372},
+{"ㄞㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 305},
+{"ㄧㄐㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 147},
+{"ㄧㄌㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 194},
+{"ㄋㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 239},
+{"ㄧㄢㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 144},
+{"ㄧㄥㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 20},
+{"ㄝㄐㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 154},
+{"ㄩㄒㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 379},
+{"ㄨㄊㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 353},
+{"ㄧㄠㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 277},
+{"ㄧㄐㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 143},
+{"ㄒㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 374},
+{"ㄋㄧㄥ", IS_ZHUYIN|IS_PINYIN, 242},
+{"ㄕㄥ", IS_ZHUYIN|IS_PINYIN, 321},
+{"ㄟㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 430},
+{"ㄧㄥㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 193},
+{"ㄩㄒㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 384},
+{"ㄘㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 56},
+{"ㄡㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 435},
+{"ㄣㄉㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 83},
+{"ㄏㄥ", IS_ZHUYIN|IS_PINYIN, 130},
+{"ㄕㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 325},
+{"ㄕㄣ", IS_ZHUYIN|IS_PINYIN, 320},
+{"ㄨㄓㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 426},
+{"ㄋㄧㄚ", IS_ZHUYIN, 236},
+{"ㄡㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 282},
+{"ㄧㄆㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 268},
+{"ㄚㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 143},
+{"ㄨㄎㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 170},
+{"ㄏㄨㄥ", IS_ZHUYIN|IS_PINYIN, 131},
+{"ㄧㄣㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 267},
+{"ㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 393},
+{"ㄤㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 344},
+{"ㄥㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 185},
+{"ㄣㄙㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 338},
+{"ㄞㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 256},
+{"ㄟㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 138},
+{"ㄖㄨㄛ", IS_ZHUYIN|IS_PINYIN, 302},
+{"ㄨㄏㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 137},
+{"ㄐㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 149},
+{"ㄔㄚ", IS_ZHUYIN|IS_PINYIN, 33},
+{"ㄗㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 437},
+{"ㄨㄤ", IS_ZHUYIN|IS_PINYIN, 364},
+{"ㄨㄙㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 338},
+{"ㄉㄧ", IS_ZHUYIN|IS_PINYIN, 70},
+{"ㄧㄢㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 72},
+{"ㄨㄕㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 326},
+{"ㄜㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 127},
+{"ㄍㄞ", IS_ZHUYIN|IS_PINYIN, 103},
+{"ㄨㄉㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 78},
+{"ㄧㄆㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 266},
+{"ㄎㄨㄢ", IS_ZHUYIN|IS_PINYIN, 171},
+{"ㄋㄤ", IS_ZHUYIN|IS_PINYIN, 228},
+{"ㄩㄑㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 286},
+{"ㄣㄋㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 248},
+{"ㄚㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 91},
+{"ㄉㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 81},
+{"ㄧㄉㄣ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 75},
+{"ㄨㄛㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 59},
+{"ㄨㄛㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 249},
+{"ㄅㄧㄢ", IS_ZHUYIN|IS_PINYIN, 16},
+{"ㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 44},
+{"ㄞㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 314},
+{"ㄚㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 341},
+{"ㄢㄧㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 349},
+{"ㄔㄨ", IS_ZHUYIN|IS_PINYIN, 44},
+{"ㄧㄌㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 188},
+{"ㄧㄢㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 373},
+{"ㄧㄥㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 268},
+{"ㄔ", IS_ZHUYIN|IS_PINYIN, 41},
+{"ㄨㄥㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 423},
+{"ㄎㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 172},
+{"ㄍㄨ", IS_ZHUYIN|IS_PINYIN, 113},
+{"ㄈㄢ", IS_ZHUYIN|IS_PINYIN, 92},
+{"ㄧㄑㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 275},
+{"ㄓㄨㄚ", IS_ZHUYIN|IS_PINYIN, 426},
+{"ㄤㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 93},
+{"ㄘㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 53},
+{"ㄎㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 174},
+{"ㄣㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 96},
+{"ㄔㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 42},
+{"ㄣㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 310},
+{"ㄨㄙㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 333},
+{"ㄧㄠㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 190},
+{"ㄨㄣㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 174},
+{"ㄒㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 372},
+{"ㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 425},
+{"ㄙㄨㄟ", IS_ZHUYIN|IS_PINYIN, 337},
+{"ㄌㄧㄥ", IS_ZHUYIN|IS_PINYIN, 193},
+{"ㄗㄨㄥ", IS_ZHUYIN|IS_PINYIN, 434},
+{"ㄗㄣ", IS_ZHUYIN|IS_PINYIN, 410},
+{"ㄢㄒㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 382},
+{"ㄊㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 351},
+{"ㄚㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 134},
+{"ㄒㄥㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 379},
+{"ㄢㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 343},
+{"ㄥㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 165},
+{"ㄠㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 126},
+{"ㄨㄤㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 48},
+{"ㄜㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 66},
+{"ㄜㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 162},
+{"ㄝㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 376},
+{"ㄎ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 156},
+{"ㄌㄞ", IS_ZHUYIN|IS_PINYIN, 178},
+{"ㄞㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 414},
+{"ㄨㄢ", IS_ZHUYIN|IS_PINYIN, 363},
+{"ㄞㄧ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 387},
+{"ㄗㄟ", IS_ZHUYIN|IS_PINYIN, 409},
+{"ㄧㄢㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 237},
+{"ㄝㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 240},
+{"ㄣㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 58},
+{"ㄢㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 188},
+{"ㄐㄩㄣ", IS_ZHUYIN|IS_PINYIN, 155},
+{"ㄑㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 279},
+{"ㄨㄢㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 356},
+{"ㄧㄝㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 191},
+{"ㄔㄨㄢ", IS_ZHUYIN|IS_PINYIN, 47},
+{"ㄧㄣㄉ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 75},
+{"ㄅㄢ", IS_ZHUYIN|IS_PINYIN, 9},
+{"ㄠㄆㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 265},
+{"ㄨㄉㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 83},
+{"ㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 142},
+{"ㄏㄨ", IS_ZHUYIN|IS_PINYIN, 133},
+{"ㄠㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 375},
+{"ㄨㄔㄚ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 45},
+{"ㄅ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 6},
+{"ㄏㄨㄢ", IS_ZHUYIN|IS_PINYIN, 136},
+{"ㄚㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 134},
+{"ㄚㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 313},
+{"ㄤㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 238},
+{"ㄨㄢㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 81},
+{"ㄟㄖㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 300},
+{"ㄚㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 177},
+{"ㄩㄒㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 383},
+{"ㄉㄧㄡ", IS_ZHUYIN|IS_PINYIN, 77},
+{"ㄧㄋㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 238},
+{"ㄢㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 415},
+{"ㄧㄑㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 276},
+{"ㄔㄣ", IS_ZHUYIN|IS_PINYIN, 39},
+{"ㄐㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 151},
+{"ㄚㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 274},
+{"ㄩㄢㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 382},
+{"ㄨㄏㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 138},
+{"ㄗㄞ", IS_ZHUYIN|IS_PINYIN, 404},
+{"ㄢㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 188},
+{"ㄧㄇㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 215},
+{"ㄕㄨㄛ", IS_ZHUYIN|IS_PINYIN, 331},
+{"ㄨㄖㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 299},
+{"ㄨㄥㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 42},
+{"ㄌㄥ", IS_ZHUYIN|IS_PINYIN, 185},
+{"ㄤㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 307},
+{"ㄤㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 145},
+{"ㄋㄧㄠ", IS_ZHUYIN|IS_PINYIN, 239},
+{"ㄗㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 439},
+{"ㄧㄣㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 19},
+{"ㄨㄗㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 437},
+{"ㄡㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 77},
+{"ㄩㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 381},
+{"ㄟㄉㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 82},
+{"ㄤㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 160},
+{"ㄝㄩㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 285},
+{"ㄐㄧㄥ", IS_ZHUYIN|IS_PINYIN, 149},
+{"ㄛㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 21},
+{"ㄋㄨㄢ", IS_ZHUYIN|IS_PINYIN, 247},
+{"ㄍㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 120},
+{"ㄨㄊㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 358},
+{"ㄠㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 216},
+{"ㄌㄚ", IS_ZHUYIN|IS_PINYIN, 177},
+{"ㄎㄨㄥ", IS_ZHUYIN|IS_PINYIN, 166},
+{"ㄣㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 279},
+{"ㄨㄣㄋ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 248},
+{"ㄨㄞㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 427},
+{"ㄍㄨㄣ", IS_ZHUYIN|IS_PINYIN, 119},
+{"ㄚㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 157},
+{"ㄓㄢ", IS_ZHUYIN|IS_PINYIN, 415},
+{"ㄋㄨㄛ", IS_ZHUYIN|IS_PINYIN, 249},
+{"ㄠㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 181},
+{"ㄋㄩㄝ", IS_ZHUYIN|IS_PINYIN, 251},
+{"ㄠㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 17},
+{"ㄗㄜ", IS_ZHUYIN|IS_PINYIN, 408},
+{"ㄡㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 132},
+{"ㄌㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 189},
+{"ㄆㄠ", IS_ZHUYIN|IS_PINYIN, 259},
+{"ㄘㄨㄣ", IS_ZHUYIN|IS_PINYIN, 58},
+{"ㄚㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 426},
+{"ㄣㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 13},
+{"ㄗㄨㄛ", IS_ZHUYIN|IS_PINYIN, 440},
+{"ㄨㄢㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 199},
+{"ㄐ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 141},
+{"ㄧㄤㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 145},
+{"ㄍㄨㄛ", IS_ZHUYIN|IS_PINYIN, 120},
+{"ㄤㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 180},
+{"ㄥㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 262},
+{"ㄞㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 206},
+{"ㄊㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 359},
+{"ㄙㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 333},
+{"ㄢㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 16},
+{"ㄧㄝㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 376},
+{"ㄨㄎㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 169},
+{"ㄧㄐㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 145},
+{"ㄝㄊㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 351},
+{"ㄩㄝㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 285},
+{"ㄕㄡ", IS_ZHUYIN|IS_PINYIN, 323},
+{"ㄢㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 275},
+{"ㄙㄨㄥ", IS_ZHUYIN|IS_PINYIN, 333},
+{"ㄒㄩㄣ", IS_ZHUYIN|IS_PINYIN, 384},
+{"ㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 15},
+{"ㄟㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 260},
+{"ㄇㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 219},
+{"ㄣㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 431},
+{"ㄒㄧㄡ", IS_ZHUYIN|IS_PINYIN, 380},
+{"ㄣㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 330},
+{"ㄧㄉㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 73},
+{"ㄎㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 175},
+{"ㄌㄧㄡ", IS_ZHUYIN|IS_PINYIN, 194},
+{"ㄨㄔㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 51},
+{"ㄏㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 139},
+{"ㄧㄤㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 374},
+{"ㄨㄖㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 302},
+{"ㄅㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 20},
+{"ㄡㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 79},
+{"ㄢㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 257},
+{"ㄥㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 347},
+{"ㄨㄟㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 300},
+{"ㄅㄧㄥ", IS_ZHUYIN|IS_PINYIN, 20},
+{"ㄕㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 327},
+{"ㄊㄧㄝ", IS_ZHUYIN|IS_PINYIN, 351},
+{"ㄇㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 215},
+{"ㄨㄞㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 46},
+{"ㄌㄢ", IS_ZHUYIN|IS_PINYIN, 179},
+{"ㄤㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 117},
+{"ㄓㄣ", IS_ZHUYIN|IS_PINYIN, 420},
+{"ㄤㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 208},
+{"ㄤㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 137},
+{"ㄝㄩㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 251},
+{"ㄧㄉㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 72},
+{"ㄑㄩㄝ", IS_ZHUYIN|IS_PINYIN, 285},
+{"ㄔㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 46},
+{"ㄒㄧㄢ", IS_ZHUYIN|IS_PINYIN, 373},
+{"ㄆㄧㄠ", IS_ZHUYIN|IS_PINYIN, 265},
+{"ㄚㄧㄋ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 236},
+{"ㄠㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 216},
+{"ㄧㄉㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 76},
+{"ㄉㄣㄧ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 75},
+{"ㄛㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 59},
+{"ㄆㄢ", IS_ZHUYIN|IS_PINYIN, 257},
+{"ㄣㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 192},
+{"ㄥㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 111},
+{"ㄔㄨㄣ", IS_ZHUYIN|IS_PINYIN, 50},
+{"ㄥㄊㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 352},
+{"ㄨㄞ", IS_ZHUYIN|IS_PINYIN, 362},
+{"ㄢㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 227},
+{"ㄉㄧㄚ", IS_ZHUYIN|IS_PINYIN, 71},
+{"ㄚㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 71},
+{"ㄨㄙㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 339},
+{"ㄓㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 430},
+{"ㄍㄨㄢ", IS_ZHUYIN|IS_PINYIN, 116},
+{"ㄋㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 241},
+{"ㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 70},
+{"ㄗㄚ", IS_ZHUYIN|IS_PINYIN, 403},
+{"ㄞㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 46},
+{"ㄕㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 326},
+{"ㄧㄐㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 144},
+{"ㄊㄡ", IS_ZHUYIN|IS_PINYIN, 354},
+{"ㄠㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 190},
+{"ㄧㄌㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 191},
+{"ㄔㄢ", IS_ZHUYIN|IS_PINYIN, 35},
+{"ㄔㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 51},
+{"ㄨㄏㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 140},
+{"ㄢㄗㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 437},
+{"ㄍㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 115},
+{"ㄌㄧ", IS_ZHUYIN|IS_PINYIN, 186},
+{"ㄕㄨㄟ", IS_ZHUYIN|IS_PINYIN, 329},
+{"ㄨㄏㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 136},
+{"ㄨㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 246},
+{"ㄏㄞ", IS_ZHUYIN|IS_PINYIN, 123},
+{"ㄨㄚㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 426},
+{"ㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 400},
+{"ㄟㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 12},
+{"ㄑㄩㄢ", IS_ZHUYIN|IS_PINYIN, 284},
+{"ㄧㄠ", IS_ZHUYIN|IS_PINYIN, 390},
+{"ㄎㄟ", IS_ZHUYIN, 163},
+{"ㄣㄩㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 286},
+{"ㄡㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 245},
+{"ㄒ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 370},
+{"ㄨㄌㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 200},
+{"ㄊㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 356},
+{"ㄞㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 135},
+{"ㄍㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 114},
+{"ㄝㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 266},
+{"ㄛㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 140},
+{"ㄨㄘㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 53},
+{"ㄟㄓ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 419},
+{"ㄣㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 83},
+{"ㄧㄒㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 374},
+{"ㄨㄊㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 357},
+{"ㄉㄨㄥ", IS_ZHUYIN|IS_PINYIN, 78},
+{"ㄣㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 50},
+{"ㄥㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 311},
+{"ㄨㄋㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 247},
+{"ㄨㄢㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 336},
+{"ㄢㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 428},
+{"ㄚㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 325},
+{"ㄍㄨㄞ", IS_ZHUYIN|IS_PINYIN, 115},
+{"ㄧㄝㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 351},
+{"ㄙㄢ", IS_ZHUYIN|IS_PINYIN, 306},
+{"ㄛㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 120},
+{"ㄚㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 304},
+{"ㄨㄟㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 49},
+{"ㄣㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 401},
+{"ㄩㄝㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 154},
+{"ㄔㄨㄥ", IS_ZHUYIN|IS_PINYIN, 42},
+{"ㄕㄞ", IS_ZHUYIN|IS_PINYIN, 314},
+{"ㄠㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 65},
+{"ㄛㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 175},
+{"ㄌㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 199},
+{"ㄚㄌㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 187},
+{"ㄌㄠ", IS_ZHUYIN|IS_PINYIN, 181},
+{"ㄓㄡ", IS_ZHUYIN|IS_PINYIN, 424},
+{"ㄩㄣ", IS_ZHUYIN|IS_PINYIN, 401},
+{"ㄞㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 62},
+{"ㄣㄨㄋ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 248},
+{"ㄒㄧㄤ", IS_ZHUYIN|IS_PINYIN, 374},
+{"ㄧㄋㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 241},
+{"ㄥㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 333},
+{"ㄧㄐㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 146},
+{"ㄅㄛ", IS_ZHUYIN|IS_PINYIN, 21},
+{"ㄇㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 220},
+{"ㄧㄌㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 192},
+{"ㄡㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 282},
+{"ㄎㄜ", IS_ZHUYIN|IS_PINYIN, 162},
+{"ㄍㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 118},
+{"ㄎㄨㄟ", IS_ZHUYIN|IS_PINYIN, 173},
+{"ㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 367},
+{"ㄛㄋㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 249},
+{"ㄋㄧㄤ", IS_ZHUYIN|IS_PINYIN, 238},
+{"ㄖ", IS_ZHUYIN|IS_PINYIN, 294},
+{"ㄑㄧㄤ", IS_ZHUYIN|IS_PINYIN, 276},
+{"ㄗㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 434},
+{"ㄨㄓㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 431},
+{"ㄎㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 169},
+{"ㄧㄑㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 274},
+{"ㄠㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 277},
+{"ㄡㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 424},
+{"ㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 235},
+{"ㄩㄥㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 379},
+{"ㄝㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 191},
+{"ㄧㄡㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 282},
+{"ㄧㄤㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 276},
+{"ㄩㄝㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 203},
+{"ㄔㄠ", IS_ZHUYIN|IS_PINYIN, 37},
+{"ㄟㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 173},
+{"ㄆㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 266},
+{"ㄆㄞ", IS_ZHUYIN|IS_PINYIN, 256},
+{"ㄉㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 73},
+{"ㄑㄧㄢ", IS_ZHUYIN|IS_PINYIN, 275},
+{"ㄎㄨㄤ", IS_ZHUYIN|IS_PINYIN, 172},
+{"ㄇㄛ", IS_ZHUYIN|IS_PINYIN, 221},
+{"ㄉㄨㄛ", IS_ZHUYIN|IS_PINYIN, 84},
+{"ㄧㄌㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 189},
+{"ㄅㄠ", IS_ZHUYIN|IS_PINYIN, 11},
+{"ㄤㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 374},
+{"ㄧㄠㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 350},
+{"ㄌ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 176},
+{"ㄗㄨ", IS_ZHUYIN|IS_PINYIN, 436},
+{"ㄅㄥ", IS_ZHUYIN|IS_PINYIN, 14},
+{"ㄅㄨ", IS_ZHUYIN|IS_PINYIN, 22},
+{"ㄧㄢ", IS_ZHUYIN|IS_PINYIN, 388},
+{"ㄡㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 43},
+{"ㄥㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 111},
+{"ㄢㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 26},
+{"ㄧㄚㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 71},
+{"ㄆㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 265},
+{"ㄨㄣㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 358},
+{"ㄖㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 295},
+{"ㄢㄅㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 16},
+{"ㄟ", IS_ZHUYIN|IS_PINYIN, 86},
+{"ㄍ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 101},
+{"ㄤㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 10},
+{"ㄕㄨㄣ", IS_ZHUYIN|IS_PINYIN, 330},
+{"ㄤㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 27},
+{"ㄛㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 331},
+{"ㄞㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 103},
+{"ㄢㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 72},
+{"ㄥㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 166},
+{"ㄥㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 378},
+{"ㄨㄣㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 200},
+{"ㄚㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 102},
+{"ㄈㄨ", IS_ZHUYIN|IS_PINYIN, 100},
+{"ㄨㄟㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 357},
+{"ㄥㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 423},
+{"ㄛㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 302},
+{"ㄩㄌㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 203},
+{"ㄥㄩㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 281},
+{"ㄔㄨㄟ", IS_ZHUYIN|IS_PINYIN, 49},
+{"ㄖㄢ", IS_ZHUYIN|IS_PINYIN, 288},
+{"ㄩㄣㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 155},
+{"ㄧㄑㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 277},
+{"ㄇㄠ", IS_ZHUYIN|IS_PINYIN, 209},
+{"ㄆㄨ", IS_ZHUYIN|IS_PINYIN, 271},
+{"ㄟㄘㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 57},
+{"ㄣㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 338},
+{"ㄨㄓㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 423},
+{"ㄨㄤㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 172},
+{"ㄥㄘㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 53},
+{"ㄚㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 187},
+{"ㄧㄤ", IS_ZHUYIN|IS_PINYIN, 389},
+{"ㄢㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 171},
+{"ㄋㄨㄣ", IS_ZHUYIN, 248},
+{"ㄑㄧ", IS_ZHUYIN|IS_PINYIN, 273},
+{"ㄍㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 117},
+{"ㄋㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 238},
+{"ㄋㄩ", IS_ZHUYIN|IS_PINYIN, 250},
+{"ㄥㄗㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 434},
+{"ㄎㄡ", IS_ZHUYIN|IS_PINYIN, 167},
+{"ㄡㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 222},
+{"ㄌㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 191},
+{"ㄘㄤ", IS_ZHUYIN|IS_PINYIN, 27},
+{"ㄖㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 300},
+{"ㄨㄛㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 302},
+{"ㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 365},
+{"ㄣㄧㄉ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 75},
+{"ㄨㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 55},
+{"ㄨㄍㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 116},
+{"ㄍㄚ", IS_ZHUYIN|IS_PINYIN, 102},
+{"ㄣㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 301},
+{"ㄣㄒㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 384},
+{"ㄢㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 373},
+{"ㄨㄣㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 431},
+{"ㄣㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 119},
+{"ㄧㄣㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 279},
+{"ㄠㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 239},
+{"ㄒㄧ", IS_ZHUYIN|IS_PINYIN, 371},
+{"ㄝㄩㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 154},
+{"ㄩㄥㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 281},
+{"ㄘㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 59},
+{"ㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 386},
+{"ㄓㄞ", IS_ZHUYIN|IS_PINYIN, 414},
+{"ㄍㄨㄥ", IS_ZHUYIN|IS_PINYIN, 111},
+{"ㄧㄒㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 375},
+{"ㄧㄝ", IS_ZHUYIN|IS_PINYIN, 391},
+{"ㄐㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 144},
+{"ㄏ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 121},
+{"ㄘㄡ", IS_ZHUYIN|IS_PINYIN, 54},
+{"ㄑㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 282},
+{"ㄉㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 74},
+{"ㄉ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 60},
+{"ㄋㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 244},
+{"ㄓㄥ", IS_ZHUYIN|IS_PINYIN, 421},
+{"ㄞㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 8},
+{"ㄚㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 274},
+{"ㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 168},
+{"ㄊㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 352},
+{"ㄨㄋㄣ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 248},
+{"ㄆㄤ", IS_ZHUYIN|IS_PINYIN, 258},
+{"ㄐㄧㄠ", IS_ZHUYIN|IS_PINYIN, 146},
+{"ㄢㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 264},
+{"ㄆㄧㄣ", IS_ZHUYIN|IS_PINYIN, 267},
+{"ㄖㄤ", IS_ZHUYIN|IS_PINYIN, 289},
+{"ㄩㄣㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 384},
+{"ㄛㄨㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 359},
+{"ㄛㄉㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 84},
+{"ㄔㄤ", IS_ZHUYIN|IS_PINYIN, 36},
+{"ㄉㄚ", IS_ZHUYIN|IS_PINYIN, 61},
+{"ㄨㄛㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 51},
+{"ㄨㄚㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 325},
+{"ㄠㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 73},
+{"ㄏㄨㄞ", IS_ZHUYIN|IS_PINYIN, 135},
+{"ㄤㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 429},
+{"ㄨㄎㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 171},
+{"ㄥㄐㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 150},
+{"ㄐㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 146},
+{"ㄥㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 76},
+{"ㄖㄨㄥ", IS_ZHUYIN|IS_PINYIN, 295},
+{"ㄗㄤ", IS_ZHUYIN|IS_PINYIN, 406},
+{"ㄅㄤ", IS_ZHUYIN|IS_PINYIN, 10},
+{"ㄧㄅㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 19},
+{"ㄝㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 278},
+{"ㄓㄜ", IS_ZHUYIN|IS_PINYIN, 418},
+{"ㄥㄩㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 150},
+{"ㄨㄟㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 118},
+{"ㄟㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 319},
+{"ㄛㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 432},
+{"ㄚㄔㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 45},
+{"ㄐㄧㄣ", IS_ZHUYIN|IS_PINYIN, 148},
+{"ㄊㄤ", IS_ZHUYIN|IS_PINYIN, 344},
+{"ㄚㄋㄧ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 236},
+{"ㄤㄨㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 172},
+{"ㄠㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 209},
+{"ㄓㄨ", IS_ZHUYIN|IS_PINYIN, 425},
+{"ㄐㄩㄥ", IS_ZHUYIN|IS_PINYIN, 150},
+{"ㄨㄣㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 330},
+{"ㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 361},
+{"ㄨㄟㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 173},
+{"ㄎㄨㄛ", IS_ZHUYIN|IS_PINYIN, 175},
+{"ㄗㄡ", IS_ZHUYIN|IS_PINYIN, 435},
+{"ㄥㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 14},
+{"ㄇㄣ", IS_ZHUYIN|IS_PINYIN, 212},
+{"ㄨㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 198},
+{"ㄑㄧㄣ", IS_ZHUYIN|IS_PINYIN, 279},
+{"ㄜㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 418},
+{"ㄖㄠ", IS_ZHUYIN|IS_PINYIN, 290},
+{"ㄧㄚㄋ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 236},
+{"ㄞㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 25},
+{"ㄉㄜ", IS_ZHUYIN|IS_PINYIN, 66},
+{"ㄗㄢ", IS_ZHUYIN|IS_PINYIN, 405},
+{"ㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 362},
+{"ㄢㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 275},
+{"ㄎㄣ", IS_ZHUYIN|IS_PINYIN, 164},
+{"ㄥㄩㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 379},
+{"ㄤㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 145},
+{"ㄏㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 138},
+{"ㄔㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 49},
+{"ㄅㄧㄠ", IS_ZHUYIN|IS_PINYIN, 17},
+{"ㄌㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 201},
+{"ㄠㄧㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 146},
+{"ㄆㄚ", IS_ZHUYIN|IS_PINYIN, 255},
+{"ㄏㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 135},
+{"ㄏㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 137},
+{"ㄚㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 114},
+{"ㄨㄚㄖ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 298},
+{"ㄨㄍㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 117},
+{"ㄟㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 183},
+{"ㄟㄙㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 337},
+{"ㄛㄊㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 359},
+{"ㄘㄢ", IS_ZHUYIN|IS_PINYIN, 26},
+{"ㄨㄥㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 196},
+{"ㄖㄜ", IS_ZHUYIN|IS_PINYIN, 291},
+{"ㄗㄨㄣ", IS_ZHUYIN|IS_PINYIN, 439},
+{"ㄊㄨ", IS_ZHUYIN|IS_PINYIN, 355},
+{"ㄩㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 152},
+{"ㄝㄋㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 251},
+{"ㄧㄊㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 352},
+{"ㄋㄟ", IS_ZHUYIN|IS_PINYIN, 231},
+{"ㄍㄡ", IS_ZHUYIN|IS_PINYIN, 112},
+{"ㄎㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 166},
+{"ㄖㄨㄣ", IS_ZHUYIN|IS_PINYIN, 301},
+{"ㄧㄤㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 238},
+{"ㄧㄚㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 274},
+{"ㄒㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 376},
+{"ㄎㄥ", IS_ZHUYIN|IS_PINYIN, 165},
+{"ㄨㄞㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 170},
+{"ㄡㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 380},
+{"ㄥㄆㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 268},
+{"ㄇㄡ", IS_ZHUYIN|IS_PINYIN, 222},
+{"ㄙㄨㄣ", IS_ZHUYIN|IS_PINYIN, 338},
+{"ㄣㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 218},
+{"ㄧ", IS_ZHUYIN|IS_PINYIN, 392},
+{"ㄢㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 116},
+{"ㄨㄞㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 135},
+{"ㄧㄢㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 264},
+{"ㄨㄘㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 57},
+{"ㄑㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 274},
+{"ㄑㄧㄡ", IS_ZHUYIN|IS_PINYIN, 282},
+{"ㄨㄣㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 439},
+{"ㄨㄥㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 333},
+{"ㄝㄑㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 278},
+{"ㄙㄨ", IS_ZHUYIN|IS_PINYIN, 335},
+{"ㄝㄧㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 351},
+{"ㄥㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 213},
+{"ㄋㄣ", IS_ZHUYIN|IS_PINYIN, 232},
+{"ㄉㄞ", IS_ZHUYIN|IS_PINYIN, 62},
+{"ㄟㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 231},
+{"ㄐㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 145},
+{"ㄛㄨㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 249},
+{"ㄆㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 268},
+{"ㄢㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 9},
+{"ㄕㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 328},
+{"ㄣㄧㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 19},
+{"ㄨㄕㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 327},
+{"ㄧㄝㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 266},
+{"ㄎㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 171},
+{"ㄌㄩ", IS_ZHUYIN|IS_PINYIN, 202},
+{"ㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 214},
+{"ㄥㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 295},
+{"ㄨㄢㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 428},
+{"ㄝㄅㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 18},
+{"ㄧㄥㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 280},
+{"ㄠㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 375},
+{"ㄍㄣ", IS_ZHUYIN|IS_PINYIN, 109},
+{"ㄣㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 241},
+{"ㄒㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 375},
+{"ㄥㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 242},
+{"ㄖㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 302},
+{"ㄖㄨ", IS_ZHUYIN|IS_PINYIN, 297},
+{"ㄟㄎ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 163},
+{"ㄉㄠ", IS_ZHUYIN|IS_PINYIN, 65},
+{"ㄓㄨㄟ", IS_ZHUYIN|IS_PINYIN, 430},
+{"ㄘㄠ", IS_ZHUYIN|IS_PINYIN, 28},
+{"ㄨㄥㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 353},
+{"ㄢㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 136},
+{"ㄧㄊㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 351},
+{"ㄥㄒㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 379},
+{"ㄢㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 405},
+{"ㄧㄥㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 76},
+{"ㄎㄤ", IS_ZHUYIN|IS_PINYIN, 160},
+{"ㄋㄧㄢ", IS_ZHUYIN|IS_PINYIN, 237},
+{"ㄒㄧㄠ", IS_ZHUYIN|IS_PINYIN, 375},
+{"ㄣㄊㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 358},
+{"ㄨㄥㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 53},
+{"ㄍㄢㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 116},
+{"ㄠㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 37},
+{"ㄤㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 328},
+{"ㄟㄨㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 300},
+{"ㄧㄋㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 242},
+{"ㄝㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 147},
+{"ㄊㄨㄣ", IS_ZHUYIN|IS_PINYIN, 358},
+{"ㄥ", IS_ZHUYIN, 88},
+{"ㄛㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 440},
+{"ㄌㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 192},
+{"ㄨㄓㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 432},
+{"ㄨㄕㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 325},
+{"ㄋㄡ", IS_ZHUYIN|IS_PINYIN, 245},
+{"ㄢㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 159},
+{"ㄥㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 268},
+{"ㄞㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 123},
+{"ㄩㄐㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 154},
+{"ㄨㄣㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 338},
+{"ㄨㄔㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 48},
+{"ㄧㄣㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 241},
+{"ㄕㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 329},
+{"ㄞㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 115},
+{"ㄣㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 431},
+{"ㄨㄛㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 175},
+{"ㄚㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 7},
+{"ㄆ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 254},
+{"ㄜㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 408},
+{"ㄨㄍㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 120},
+{"ㄉㄧㄠ", IS_ZHUYIN|IS_PINYIN, 73},
+{"ㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 324},
+{"ㄥㄇㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 219},
+{"ㄥㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 42},
+{"ㄨㄋㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 249},
+{"ㄖㄨㄚ", IS_ZHUYIN, 298},
+{"ㄧㄋㄚ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 236},
+{"ㄨㄥ", IS_ZHUYIN|IS_PINYIN, 367},
+{"ㄕㄨ", IS_ZHUYIN|IS_PINYIN, 324},
+{"ㄊㄧㄥ", IS_ZHUYIN|IS_PINYIN, 352},
+{"ㄨㄢㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 327},
+{"ㄢㄉㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 81},
+{"ㄌㄜ", IS_ZHUYIN|IS_PINYIN, 182},
+{"ㄛㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 51},
+{"ㄙ", IS_ZHUYIN|IS_PINYIN, 332},
+{"ㄇㄣㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 218},
+{"ㄚㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 33},
+{"ㄕㄨㄤ", IS_ZHUYIN|IS_PINYIN, 328},
+{"ㄓㄨㄥ", IS_ZHUYIN|IS_PINYIN, 423},
+{"ㄇㄟ", IS_ZHUYIN|IS_PINYIN, 211},
+{"ㄛㄘㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 59},
+{"ㄢㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 336},
+{"ㄩㄝ", IS_ZHUYIN|IS_PINYIN, 400},
+{"ㄢㄩㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 153},
+{"ㄐㄧㄤ", IS_ZHUYIN|IS_PINYIN, 145},
+{"ㄥㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 321},
+{"ㄈㄛ", IS_ZHUYIN|IS_PINYIN, 98},
+{"ㄚㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 24},
+{"ㄗㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 438},
+{"ㄣㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 292},
+{"ㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 390},
+{"ㄨㄥㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 295},
+{"ㄓㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 423},
+{"ㄢㄨㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 81},
+{"ㄢㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 35},
+{"ㄒㄧㄣ", IS_ZHUYIN|IS_PINYIN, 377},
+{"ㄩ", IS_ZHUYIN|IS_PINYIN, 398},
+{"ㄤㄨㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 429},
+{"ㄟㄨㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 49},
+{"ㄑㄥㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 281},
+{"ㄜㄈ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 94},
+{"ㄠㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 345},
+{"ㄣ", IS_ZHUYIN|IS_PINYIN, 87},
+{"ㄚㄎㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 169},
+{"ㄑㄧㄥ", IS_ZHUYIN|IS_PINYIN, 280},
+{"ㄨㄣㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 83},
+{"ㄌㄤ", IS_ZHUYIN|IS_PINYIN, 180},
+{"ㄍㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 119},
+{"ㄤㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 289},
+{"ㄨㄍㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 115},
+{"ㄥㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 40},
+{"ㄧㄡㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 220},
+{"ㄨㄟㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 337},
+{"ㄇㄧㄠ", IS_ZHUYIN|IS_PINYIN, 216},
+{"ㄩㄢ", IS_ZHUYIN|IS_PINYIN, 399},
+{"ㄗㄨㄟ", IS_ZHUYIN|IS_PINYIN, 438},
+{"ㄢㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 104},
+{"ㄋㄧ", IS_ZHUYIN|IS_PINYIN, 235},
+{"ㄊㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 349},
+{"ㄑㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 280},
+{"ㄨㄛㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 201},
+{"ㄣㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 320},
+{"ㄣㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 39},
+{"ㄢㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 327},
+{"ㄓㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 429},
+{"ㄟㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 409},
+{"ㄊ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 340},
+{"ㄚㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 205},
+{"ㄧㄝㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 147},
+{"ㄧㄋㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 243},
+{"ㄧㄅㄝ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 18},
+{"ㄧㄛ", IS_ZHUYIN|IS_PINYIN, 395},
+{"ㄕㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 330},
+{"ㄤㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 328},
+{"ㄚㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 413},
+{"ㄌㄨ", IS_ZHUYIN|IS_PINYIN, 198},
+{"ㄙㄥ", IS_ZHUYIN|IS_PINYIN, 311},
+{"ㄙㄠ", IS_ZHUYIN|IS_PINYIN, 308},
+{"ㄛㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 98},
+{"ㄚㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 325},
+{"ㄌㄧㄣ", IS_ZHUYIN|IS_PINYIN, 192},
+{"ㄙㄤ", IS_ZHUYIN|IS_PINYIN, 307},
+{"ㄊㄨㄟ", IS_ZHUYIN|IS_PINYIN, 357},
+{"ㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 391},
+{"ㄧㄒㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 373},
+{"ㄢ", IS_ZHUYIN|IS_PINYIN, 3},
+{"ㄊㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 357},
+{"ㄢㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 399},
+{"ㄩㄒㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 382},
+{"ㄇㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 216},
+{"ㄨㄎㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 173},
+{"ㄉㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 71},
+{"ㄧㄑㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 280},
+{"ㄎㄠ", IS_ZHUYIN|IS_PINYIN, 161},
+{"ㄤㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 316},
+{"ㄩㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 250},
+{"ㄨㄙㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 336},
+{"ㄢㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 288},
+{"ㄧㄑㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 282},
+{"ㄓㄨㄛ", IS_ZHUYIN|IS_PINYIN, 432},
+{"ㄫ", IS_ZHUYIN|IS_PINYIN, 234},
+{"ㄍㄟ", IS_ZHUYIN|IS_PINYIN, 108},
+{"ㄋㄞ", IS_ZHUYIN|IS_PINYIN, 226},
+{"ㄎㄨㄣ", IS_ZHUYIN|IS_PINYIN, 174},
+{"ㄎㄞㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 170},
+{"ㄇㄧㄢ", IS_ZHUYIN|IS_PINYIN, 215},
+{"ㄌㄛ", IS_ZHUYIN|IS_PINYIN, 195},
+{"ㄨㄞㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 115},
+{"ㄨㄓㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 430},
+{"ㄣㄧㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 267},
+{"ㄋㄥ", IS_ZHUYIN|IS_PINYIN, 233},
+{"ㄤㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 36},
+{"ㄥㄧㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 352},
+{"ㄛㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 195},
+{"ㄨㄚㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 169},
+{"ㄌㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 200},
+{"ㄏㄨㄤ", IS_ZHUYIN|IS_PINYIN, 137},
+{"ㄧㄣㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 218},
+{"ㄋㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 240},
+{"ㄢㄊㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 356},
+{"ㄥㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 110},
+{"ㄑㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 277},
+{"ㄨㄤㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 429},
+{"ㄇㄤ", IS_ZHUYIN|IS_PINYIN, 208},
+{"ㄘㄨ", IS_ZHUYIN|IS_PINYIN, 55},
+{"ㄅㄧㄣ", IS_ZHUYIN|IS_PINYIN, 19},
+{"ㄋ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 224},
+{"ㄨㄔㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 47},
+{"ㄅㄞ", IS_ZHUYIN|IS_PINYIN, 8},
+{"ㄣㄆㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 267},
+{"ㄢㄧㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 72},
+{"ㄣㄅㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 19},
+{"ㄢㄆㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 264},
+{"ㄙㄣㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 338},
+{"ㄋㄜ", IS_ZHUYIN|IS_PINYIN, 230},
+{"ㄌㄩㄝ", IS_ZHUYIN|IS_PINYIN, 203},
+{"ㄥㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 378},
+{"ㄧㄠㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 375},
+{"ㄑㄝㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 278},
+{"ㄘㄨㄥ", IS_ZHUYIN|IS_PINYIN, 53},
+{"ㄥㄨㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 131},
+{"ㄥㄈ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 97},
+{"ㄧㄆㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 264},
+{"ㄣㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 119},
+{"ㄨㄖㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 295},
+{"ㄡㄉㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 77},
+{"ㄕㄤ", IS_ZHUYIN|IS_PINYIN, 316},
+{"ㄧㄥㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 242},
+{"ㄤ", IS_ZHUYIN|IS_PINYIN, 4},
+{"ㄠㄊㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 350},
+{"ㄉㄧㄝ", IS_ZHUYIN|IS_PINYIN, 74},
+{"ㄥㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 69},
+{"ㄨㄕㄤ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 328},
+{"ㄉㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 82},
+{"ㄧㄢㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 275},
+{"ㄧㄥㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 219},
+{"ㄋㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 242},
+{"ㄩㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 283},
+{"ㄌㄥㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 193},
+{"ㄣㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 129},
+{"ㄈㄥ", IS_ZHUYIN|IS_PINYIN, 97},
+{"ㄤㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 228},
+{"ㄔㄨㄛ", IS_ZHUYIN|IS_PINYIN, 51},
+{"ㄤㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 238},
+{"ㄎㄞ", IS_ZHUYIN|IS_PINYIN, 158},
+{"ㄨㄚㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 134},
+{"ㄣㄉ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 68},
+{"ㄝㄩㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 203},
+{"ㄉㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 84},
+{"ㄛㄨㄙ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 339},
+{"ㄏㄤ", IS_ZHUYIN|IS_PINYIN, 125},
+{"ㄉㄨㄢ", IS_ZHUYIN|IS_PINYIN, 81},
+{"ㄕㄢ", IS_ZHUYIN|IS_PINYIN, 315},
+{"ㄨㄥㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 131},
+{"ㄧㄡㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 243},
+{"ㄥㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 193},
+{"ㄊㄠ", IS_ZHUYIN|IS_PINYIN, 345},
+{"ㄉㄨㄟ", IS_ZHUYIN|IS_PINYIN, 82},
+{"ㄠㄘ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 28},
+{"ㄧㄆㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 265},
+{"ㄡㄧㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 194},
+{"ㄋㄡㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 243},
+{"ㄢㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 63},
+{"ㄚㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 61},
+{"ㄠㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 161},
+{"ㄙㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 339},
+{"ㄔㄜ", IS_ZHUYIN|IS_PINYIN, 38},
+{"ㄐㄥㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 150},
+{"ㄨㄏㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 131},
+{"ㄨㄌㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 196},
+{"ㄣㄧㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 218},
+{"ㄨㄎㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 166},
+{"ㄎㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 173},
+{"ㄞㄕㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 326},
+{"ㄜㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 318},
+{"ㄧㄢㄊ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 349},
+{"ㄠㄅ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 11},
+{"ㄨㄌㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 201},
+{"ㄛㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 331},
+{"ㄊㄧㄢ", IS_ZHUYIN|IS_PINYIN, 349},
+{"ㄧㄡㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 380},
+{"ㄨㄛㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 84},
+{"ㄙㄡ", IS_ZHUYIN|IS_PINYIN, 334},
+{"ㄩㄑㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 284},
+{"ㄜㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 38},
+{"ㄥㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 293},
+{"ㄔㄚㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 45},
+{"ㄨㄉㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 81},
+{"ㄚㄨㄖ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 298},
+{"ㄧㄠㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 73},
+{"ㄢㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 237},
+{"ㄒㄧㄝ", IS_ZHUYIN|IS_PINYIN, 376},
+{"ㄞㄔ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 34},
+{"ㄐㄧㄢ", IS_ZHUYIN|IS_PINYIN, 144},
+{"ㄨㄉㄟ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 82},
+{"ㄑㄝㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 285},
+{"ㄨㄢㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 247},
+{"ㄢㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 124},
+{"ㄚㄒㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 372},
+{"ㄗ", IS_ZHUYIN|IS_PINYIN, 433},
+{"ㄋㄣㄨ", IS_ZHUYIN|ZHUYIN_CORRECT_SHUFFLE, 248},
+{"ㄉㄧㄢ", IS_ZHUYIN|IS_PINYIN, 72},
+{"ㄣㄏㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 139},
+{"ㄈㄣ", IS_ZHUYIN|IS_PINYIN, 96},
+{"ㄢㄔㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 47},
+{"ㄏㄚㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 134},
+{"ㄨㄘㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 56},
+{"ㄤㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 64},
+{"ㄋㄚ", IS_ZHUYIN|IS_PINYIN, 225},
+{"ㄛㄆ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 269},
+{"ㄢㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 437},
+{"ㄏㄥㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 131},
+{"ㄧㄇㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 218},
+{"ㄕㄨㄚ", IS_ZHUYIN|IS_PINYIN, 325},
+{"ㄑㄤㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 276},
+{"ㄤㄧㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 374},
+{"ㄌㄧㄢ", IS_ZHUYIN|IS_PINYIN, 188},
+{"ㄨㄔㄞ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 46},
+{"ㄖㄨㄢ", IS_ZHUYIN|IS_PINYIN, 299},
+{"ㄊㄢ", IS_ZHUYIN|IS_PINYIN, 343},
+{"ㄧㄡㄉ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 77},
+{"ㄠㄖ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 290},
+{"ㄎㄚ", IS_ZHUYIN|IS_PINYIN, 157},
+{"ㄧㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 273},
+{"ㄨㄟㄓ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 430},
+{"ㄐㄚㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 143},
+{"ㄚㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 225},
+{"ㄩㄝㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 251},
+{"ㄞ", IS_ZHUYIN|IS_PINYIN, 2},
+{"ㄊㄨㄛ", IS_ZHUYIN|IS_PINYIN, 359},
+{"ㄊㄨㄢ", IS_ZHUYIN|IS_PINYIN, 356},
+{"ㄣㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 212},
+{"ㄏㄚ", IS_ZHUYIN|IS_PINYIN, 122},
+{"ㄏㄨㄣ", IS_ZHUYIN|IS_PINYIN, 139},
+{"ㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 368},
+{"ㄨㄣ", IS_ZHUYIN|IS_PINYIN, 366},
+{"ㄤㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 364},
+{"ㄅㄠㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 17},
+{"ㄧㄋㄢ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 237},
+{"ㄠㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 146},
+{"ㄨㄚㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 114},
+{"ㄋㄧㄡ", IS_ZHUYIN|IS_PINYIN, 243},
+{"ㄊㄧㄠ", IS_ZHUYIN|IS_PINYIN, 350},
+{"ㄢㄋㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 237},
+{"ㄗㄛㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 440},
+{"ㄣㄧㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 241},
+{"ㄌㄨㄛ", IS_ZHUYIN|IS_PINYIN, 201},
+{"ㄧㄡㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 151},
+{"ㄌㄨㄥ", IS_ZHUYIN|IS_PINYIN, 196},
+{"ㄅㄚ", IS_ZHUYIN|IS_PINYIN, 7},
+{"ㄡㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 197},
+{"ㄙㄟㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 337},
+{"ㄇㄧㄡ", IS_ZHUYIN|IS_PINYIN, 220},
+{"ㄔㄨㄤ", IS_ZHUYIN|IS_PINYIN, 48},
+{"ㄋㄢㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 237},
+{"ㄐㄢㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 153},
+{"ㄩㄐㄥ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 150},
+{"ㄨㄗ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 436},
+{"ㄕㄠ", IS_ZHUYIN|IS_PINYIN, 317},
+{"ㄨㄢㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 116},
+{"ㄚㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 426},
+{"ㄔㄞ", IS_ZHUYIN|IS_PINYIN, 34},
+{"ㄨㄘㄣ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 58},
+{"ㄨㄥㄎ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 166},
+{"ㄟㄨㄍ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 118},
+{"ㄨㄎㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 175},
+{"ㄈㄡ", IS_ZHUYIN|IS_PINYIN, 99},
+{"ㄈㄤ", IS_ZHUYIN|IS_PINYIN, 93},
+{"ㄩㄝㄒ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 383},
+{"ㄑ", IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 272},
+{"ㄋㄧㄝ", IS_ZHUYIN|IS_PINYIN, 240},
+{"ㄨㄊㄛ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 359},
+{"ㄞㄨㄕ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 326},
+{"ㄣㄗㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 439},
+{"ㄟㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 211},
+{"ㄧㄇㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 220},
+{"ㄧㄊㄠ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 350},
+{"ㄑㄧㄚ", IS_ZHUYIN|IS_PINYIN, 274},
+{"ㄥㄐㄧ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 149},
+{"ㄧㄉㄡ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 77},
+{"ㄩㄣㄑ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 286},
+{"ㄤㄏ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 125},
+{"ㄚㄍㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 114},
+{"ㄣㄩㄐ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 155},
+{"ㄑㄩ", IS_ZHUYIN|IS_PINYIN, 283},
+{"ㄥㄓㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 423},
+{"ㄨㄍㄚ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 114},
+{"ㄟㄗㄨ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 438},
+{"ㄌㄧㄝ", IS_ZHUYIN|IS_PINYIN, 191},
+{"ㄥㄋ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 233},
+{"ㄣㄐㄩ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 155},
+{"ㄛㄇ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 221},
+{"ㄛㄨㄌ", IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_SHUFFLE, 201}
+};
+
+const gint32 zhuyin_index_displacements[] = {
+-1483,
+-1482,
+-1477,
+-1474,
+1,
+0,
+-1472,
+0,
+-1470,
+1,
+-1460,
+-1459,
+0,
+1,
+0,
+0,
+0,
+1,
+0,
+-1457,
+0,
+2,
+-1456,
+-1451,
+0,
+-1450,
+-1448,
+-1446,
+-1445,
+-1444,
+0,
+3,
+-1442,
+0,
+0,
+1,
+0,
+-1434,
+-1432,
+0,
+1,
+0,
+4,
+0,
+-1431,
+1,
+-1425,
+0,
+-1421,
+-1418,
+-1417,
+0,
+1,
+-1411,
+2,
+-1410,
+0,
+1,
+0,
+0,
+1,
+0,
+1,
+0,
+-1408,
+1,
+-1407,
+0,
+0,
+-1401,
+0,
+-1400,
+1,
+-1397,
+0,
+0,
+1,
+-1396,
+0,
+-1395,
+1,
+2,
+-1392,
+-1391,
+0,
+2,
+1,
+3,
+-1387,
+-1381,
+2,
+-1375,
+0,
+0,
+1,
+0,
+1,
+-1371,
+2,
+0,
+0,
+0,
+0,
+0,
+-1366,
+1,
+1,
+0,
+-1365,
+0,
+-1360,
+-1355,
+0,
+3,
+0,
+4,
+1,
+0,
+-1352,
+-1349,
+1,
+0,
+0,
+-1348,
+0,
+-1346,
+0,
+-1342,
+0,
+-1338,
+0,
+0,
+0,
+-1334,
+1,
+-1328,
+1,
+-1327,
+-1324,
+-1322,
+-1319,
+0,
+-1318,
+3,
+-1317,
+-1315,
+-1311,
+0,
+0,
+0,
+0,
+-1309,
+0,
+4,
+1,
+0,
+-1308,
+1,
+-1306,
+1,
+3,
+-1305,
+0,
+-1302,
+0,
+0,
+-1299,
+-1291,
+-1287,
+1,
+-1286,
+-1285,
+-1284,
+1,
+-1282,
+0,
+1,
+0,
+-1281,
+2,
+1,
+-1280,
+1,
+2,
+-1277,
+0,
+1,
+0,
+3,
+0,
+-1275,
+-1271,
+0,
+0,
+-1269,
+1,
+0,
+1,
+0,
+1,
+-1268,
+0,
+1,
+-1267,
+0,
+1,
+0,
+-1264,
+1,
+0,
+0,
+-1263,
+-1254,
+0,
+-1253,
+0,
+-1250,
+2,
+0,
+1,
+-1248,
+2,
+-1246,
+-1241,
+-1240,
+0,
+0,
+0,
+0,
+3,
+-1238,
+-1236,
+0,
+-1234,
+0,
+-1233,
+0,
+-1232,
+-1225,
+-1221,
+0,
+-1217,
+-1214,
+1,
+1,
+1,
+0,
+-1213,
+0,
+-1210,
+0,
+-1207,
+0,
+1,
+1,
+-1203,
+0,
+0,
+-1198,
+-1196,
+-1195,
+-1194,
+-1191,
+-1189,
+-1184,
+1,
+0,
+0,
+0,
+0,
+1,
+1,
+-1183,
+-1181,
+0,
+2,
+0,
+2,
+0,
+0,
+1,
+0,
+-1178,
+-1177,
+0,
+1,
+-1176,
+0,
+-1175,
+0,
+-1169,
+0,
+2,
+-1165,
+0,
+-1162,
+0,
+-1154,
+-1153,
+0,
+0,
+0,
+1,
+-1151,
+4,
+-1143,
+1,
+-1140,
+-1139,
+0,
+0,
+0,
+0,
+0,
+-1135,
+0,
+-1134,
+3,
+0,
+-1132,
+0,
+0,
+0,
+2,
+-1130,
+-1128,
+0,
+-1127,
+0,
+-1124,
+0,
+0,
+-1123,
+2,
+1,
+0,
+3,
+0,
+-1122,
+0,
+1,
+-1120,
+2,
+-1118,
+0,
+-1117,
+0,
+0,
+-1115,
+0,
+0,
+0,
+-1114,
+1,
+1,
+3,
+-1113,
+3,
+-1111,
+-1109,
+1,
+1,
+1,
+0,
+-1106,
+0,
+0,
+1,
+-1101,
+1,
+2,
+0,
+0,
+0,
+0,
+1,
+-1097,
+3,
+0,
+6,
+-1094,
+-1088,
+-1087,
+-1077,
+-1074,
+0,
+-1072,
+0,
+0,
+-1071,
+-1067,
+-1065,
+-1064,
+-1063,
+-1062,
+0,
+-1061,
+1,
+-1060,
+-1059,
+0,
+0,
+0,
+0,
+0,
+-1058,
+0,
+0,
+3,
+0,
+0,
+1,
+0,
+1,
+0,
+-1057,
+1,
+1,
+-1056,
+0,
+-1055,
+5,
+0,
+1,
+0,
+-1054,
+0,
+-1052,
+0,
+0,
+1,
+0,
+-1051,
+2,
+0,
+2,
+0,
+3,
+1,
+-1050,
+9,
+0,
+0,
+-1047,
+0,
+6,
+-1046,
+1,
+0,
+3,
+-1045,
+-1043,
+1,
+1,
+1,
+-1040,
+0,
+-1032,
+0,
+1,
+6,
+0,
+1,
+-1031,
+-1029,
+0,
+-1028,
+0,
+-1027,
+0,
+-1024,
+1,
+-1019,
+0,
+1,
+-1017,
+1,
+0,
+-1016,
+1,
+1,
+1,
+-1015,
+-1009,
+1,
+1,
+2,
+0,
+-1008,
+0,
+0,
+-1007,
+0,
+2,
+-1006,
+-1004,
+0,
+0,
+0,
+0,
+-1003,
+2,
+1,
+-1002,
+-1001,
+1,
+5,
+0,
+5,
+0,
+1,
+0,
+3,
+0,
+4,
+1,
+2,
+4,
+10,
+-998,
+1,
+0,
+-992,
+9,
+0,
+1,
+-990,
+2,
+-988,
+-987,
+0,
+-985,
+0,
+0,
+2,
+-984,
+-982,
+-979,
+-972,
+-970,
+0,
+-969,
+-968,
+1,
+2,
+-965,
+-964,
+1,
+-962,
+1,
+0,
+1,
+0,
+0,
+4,
+0,
+1,
+1,
+-960,
+-956,
+3,
+-952,
+0,
+5,
+1,
+1,
+5,
+0,
+1,
+1,
+0,
+4,
+-942,
+0,
+0,
+1,
+0,
+0,
+-938,
+-937,
+1,
+-936,
+1,
+0,
+0,
+1,
+-934,
+0,
+2,
+0,
+0,
+0,
+-919,
+0,
+-917,
+0,
+0,
+-916,
+-914,
+-912,
+-911,
+2,
+3,
+0,
+0,
+-906,
+7,
+1,
+-903,
+0,
+-897,
+0,
+-896,
+0,
+-895,
+-893,
+0,
+-891,
+0,
+1,
+0,
+-888,
+0,
+-887,
+-886,
+-884,
+-883,
+-875,
+0,
+-873,
+-871,
+-870,
+0,
+0,
+-866,
+-861,
+-856,
+3,
+-855,
+0,
+-853,
+2,
+-850,
+1,
+-849,
+0,
+0,
+4,
+-847,
+0,
+0,
+1,
+2,
+0,
+0,
+-844,
+0,
+0,
+1,
+0,
+-837,
+1,
+2,
+-831,
+0,
+2,
+0,
+-823,
+-820,
+1,
+0,
+-819,
+0,
+-816,
+0,
+0,
+-812,
+0,
+-806,
+-799,
+0,
+0,
+-797,
+0,
+3,
+-796,
+0,
+-795,
+0,
+-793,
+-791,
+-790,
+1,
+-784,
+-782,
+-781,
+-778,
+7,
+-776,
+4,
+0,
+-768,
+-767,
+-764,
+1,
+-762,
+1,
+-758,
+0,
+-756,
+-750,
+-748,
+-747,
+0,
+2,
+2,
+-744,
+0,
+0,
+0,
+0,
+0,
+0,
+-741,
+1,
+-740,
+1,
+0,
+1,
+0,
+0,
+0,
+1,
+1,
+0,
+-734,
+14,
+0,
+-733,
+-732,
+0,
+-730,
+0,
+1,
+0,
+0,
+-726,
+1,
+0,
+0,
+1,
+0,
+1,
+1,
+0,
+9,
+0,
+4,
+0,
+0,
+1,
+-719,
+-718,
+1,
+0,
+6,
+0,
+1,
+1,
+1,
+-715,
+0,
+0,
+0,
+0,
+-713,
+0,
+1,
+3,
+-712,
+1,
+-710,
+-708,
+0,
+10,
+0,
+1,
+7,
+4,
+3,
+0,
+1,
+0,
+0,
+0,
+-701,
+-700,
+0,
+-697,
+0,
+2,
+8,
+-696,
+1,
+17,
+-688,
+0,
+0,
+0,
+-685,
+1,
+0,
+1,
+1,
+0,
+-679,
+-675,
+-672,
+-657,
+0,
+-656,
+7,
+2,
+-650,
+-646,
+-640,
+12,
+2,
+2,
+0,
+2,
+1,
+-639,
+3,
+0,
+-636,
+-635,
+0,
+-634,
+0,
+7,
+-631,
+-629,
+1,
+1,
+-625,
+0,
+-624,
+0,
+-622,
+3,
+1,
+0,
+0,
+1,
+4,
+0,
+0,
+-619,
+2,
+-618,
+-617,
+0,
+0,
+0,
+0,
+0,
+0,
+1,
+5,
+0,
+0,
+-616,
+-613,
+0,
+-612,
+-610,
+0,
+0,
+-609,
+0,
+2,
+-605,
+2,
+5,
+0,
+0,
+-604,
+5,
+-601,
+0,
+-600,
+0,
+11,
+3,
+5,
+0,
+-597,
+1,
+-596,
+0,
+0,
+0,
+0,
+-593,
+-585,
+-581,
+0,
+-578,
+-569,
+1,
+0,
+3,
+-568,
+6,
+-566,
+1,
+3,
+0,
+-564,
+-562,
+5,
+-554,
+-552,
+0,
+2,
+0,
+0,
+0,
+-547,
+0,
+-542,
+1,
+0,
+-539,
+13,
+0,
+0,
+-536,
+0,
+0,
+0,
+0,
+0,
+-533,
+0,
+2,
+-532,
+-523,
+-521,
+0,
+-520,
+-516,
+2,
+7,
+0,
+-513,
+0,
+15,
+1,
+-512,
+0,
+-509,
+0,
+2,
+3,
+0,
+0,
+1,
+0,
+1,
+0,
+-507,
+0,
+0,
+-502,
+-495,
+2,
+-491,
+0,
+-490,
+-486,
+-483,
+0,
+0,
+0,
+2,
+0,
+-482,
+0,
+0,
+-481,
+5,
+0,
+-479,
+0,
+-477,
+6,
+-472,
+-471,
+-470,
+-467,
+0,
+0,
+0,
+0,
+0,
+2,
+-451,
+-450,
+0,
+6,
+-448,
+-445,
+0,
+0,
+0,
+-444,
+0,
+3,
+-440,
+2,
+-438,
+-437,
+-433,
+0,
+0,
+5,
+-432,
+-431,
+0,
+1,
+-429,
+0,
+-428,
+0,
+0,
+-423,
+3,
+-419,
+-416,
+0,
+4,
+1,
+-414,
+0,
+-411,
+-409,
+5,
+-405,
+-400,
+3,
+0,
+-398,
+-397,
+1,
+0,
+-395,
+-390,
+0,
+-382,
+0,
+-380,
+-379,
+0,
+0,
+0,
+0,
+-376,
+-375,
+-370,
+-368,
+5,
+1,
+-367,
+-364,
+0,
+2,
+0,
+-362,
+-361,
+-360,
+1,
+9,
+3,
+-358,
+-350,
+-347,
+0,
+0,
+0,
+2,
+15,
+1,
+19,
+0,
+-340,
+-338,
+1,
+4,
+-337,
+-334,
+-333,
+0,
+-332,
+-330,
+-328,
+0,
+0,
+-324,
+-321,
+-320,
+0,
+-319,
+1,
+0,
+-314,
+-313,
+0,
+0,
+2,
+0,
+0,
+1,
+-308,
+0,
+1,
+-307,
+3,
+0,
+-306,
+-301,
+-292,
+5,
+0,
+-291,
+-290,
+-284,
+3,
+1,
+-281,
+0,
+5,
+-280,
+-278,
+2,
+0,
+-277,
+4,
+0,
+0,
+0,
+-274,
+-273,
+-272,
+-271,
+0,
+-267,
+3,
+0,
+0,
+-265,
+0,
+0,
+-257,
+-252,
+0,
+-251,
+-247,
+-246,
+2,
+0,
+0,
+0,
+-245,
+-241,
+-236,
+0,
+0,
+9,
+-235,
+2,
+0,
+4,
+0,
+0,
+2,
+-232,
+-230,
+2,
+-228,
+1,
+0,
+-227,
+1,
+2,
+-226,
+-224,
+-221,
+6,
+-219,
+-217,
+-212,
+-210,
+0,
+0,
+-207,
+0,
+1,
+3,
+-206,
+0,
+0,
+-204,
+0,
+10,
+-199,
+1,
+4,
+-197,
+12,
+7,
+-195,
+-194,
+-192,
+10,
+-188,
+0,
+5,
+-186,
+-185,
+7,
+-183,
+-180,
+0,
+4,
+-178,
+2,
+0,
+0,
+0,
+0,
+5,
+-176,
+8,
+0,
+-175,
+0,
+0,
+23,
+3,
+0,
+1,
+-173,
+1,
+-172,
+0,
+-170,
+-169,
+0,
+-167,
+4,
+0,
+0,
+1,
+0,
+3,
+0,
+0,
+0,
+0,
+3,
+4,
+0,
+-161,
+-160,
+-158,
+0,
+3,
+9,
+-157,
+-155,
+0,
+2,
+3,
+0,
+5,
+0,
+2,
+0,
+3,
+0,
+-147,
+-146,
+1,
+3,
+-144,
+0,
+2,
+0,
+-142,
+-141,
+0,
+19,
+-139,
+0,
+0,
+0,
+-137,
+0,
+-136,
+0,
+12,
+-133,
+-132,
+24,
+-127,
+10,
+-125,
+-124,
+-122,
+1,
+-119,
+-117,
+1,
+1,
+0,
+-116,
+0,
+-115,
+0,
+0,
+0,
+0,
+1,
+0,
+0,
+-110,
+0,
+-107,
+-102,
+-101,
+1,
+3,
+9,
+-99,
+5,
+0,
+0,
+-98,
+8,
+3,
+0,
+-95,
+0,
+-93,
+0,
+0,
+-91,
+0,
+0,
+0,
+0,
+2,
+0,
+0,
+18,
+0,
+0,
+0,
+3,
+-90,
+0,
+8,
+0,
+1,
+0,
+0,
+0,
+-85,
+-81,
+0,
+-78,
+0,
+-75,
+1,
+5,
+3,
+2,
+0,
+-74,
+0,
+0,
+0,
+0,
+0,
+0,
+1,
+0,
+5,
+0,
+0,
+7,
+0,
+7,
+5,
+0,
+0,
+1,
+-73,
+0,
+0,
+-70,
+-69,
+-66,
+0,
+9,
+0,
+0,
+4,
+4,
+2,
+0,
+0,
+0,
+-63,
+0,
+-62,
+0,
+1,
+-61,
+-57,
+-55,
+0,
+0,
+0,
+-51,
+0,
+-49,
+2,
+-36,
+1,
+0,
+15,
+0,
+0,
+0,
+1,
+0,
+0,
+0,
+2,
+0,
+-34,
+0,
+16,
+0,
+0,
+9,
+0,
+0,
+-32,
+3,
+-30,
+0,
+1,
+0,
+1,
+2,
+0,
+-27,
+0,
+-23,
+-22,
+-21,
+2,
+0,
+9,
+-17,
+-12,
+-8,
+0,
+-7,
+0,
+1,
+4,
+-3,
+0,
+0,
+-2,
+6,
+0,
+1
+};
+
+const chewing_index_hash_t zhuyin_index_hash = {
+    zhuyin_index_hash_items, zhuyin_index_displacements,
+    G_N_ELEMENTS(zhuyin_index_hash_items)
+};
+
+const chewing_index_item_t hsu_zhuyin_index_hash_items[] = {
+{"ㄨㄣ" /* "wen" */, IS_ZHUYIN|IS_PINYIN, 366},
+{"ㄈㄢ" /* "fan" */, IS_ZHUYIN|IS_PINYIN, 92},
+{"ㄏㄡ" /* "hou" */, IS_ZHUYIN|IS_PINYIN, 132},
+{"ㄉㄢ" /* "dan" */, IS_ZHUYIN|IS_PINYIN, 63},
+{"ㄈㄟ" /* "fei" */, IS_ZHUYIN|IS_PINYIN, 95},
+{"ㄢ" /* "an" */, IS_ZHUYIN|IS_PINYIN, 3},
+{"ㄋㄧ" /* "ni" */, IS_ZHUYIN|IS_PINYIN, 235},
+{"ㄎㄡ" /* "kou" */, IS_ZHUYIN|IS_PINYIN, 167},
+{"ㄊㄠ" /* "tao" */, IS_ZHUYIN|IS_PINYIN, 345},
+{"ㄍㄧㄡ" /* "jiu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 151},
+{"ㄉ" /* "d" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 60},
+{"ㄒㄣ" /* "shen" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 320},
+{"ㄌㄛ" /* "lo" */, IS_ZHUYIN|IS_PINYIN, 195},
+{"ㄎㄢ" /* "kan" */, IS_ZHUYIN|IS_PINYIN, 159},
+{"ㄏㄢ" /* "han" */, IS_ZHUYIN|IS_PINYIN, 124},
+{"ㄐㄧㄡ" /* "jiu" */, IS_ZHUYIN|IS_PINYIN, 151},
+{"ㄈㄚ" /* "fa" */, IS_ZHUYIN|IS_PINYIN, 91},
+{"ㄒㄧㄝ" /* "xie" */, IS_ZHUYIN|IS_PINYIN, 376},
+{"ㄉㄧㄠ" /* "diao" */, IS_ZHUYIN|IS_PINYIN, 73},
+{"ㄐㄩㄣ" /* "jun" */, IS_ZHUYIN|IS_PINYIN, 155},
+{"ㄍㄧㄝ" /* "jie" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 147},
+{"ㄉㄨㄟ" /* "dui" */, IS_ZHUYIN|IS_PINYIN, 82},
+{"ㄘㄞ" /* "cai" */, IS_ZHUYIN|IS_PINYIN, 25},
+{"ㄏㄞ" /* "hai" */, IS_ZHUYIN|IS_PINYIN, 123},
+{"ㄐㄜ" /* "zhe" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 418},
+{"ㄘㄨ" /* "cu" */, IS_ZHUYIN|IS_PINYIN, 55},
+{"ㄍㄩㄢ" /* "juan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 153},
+{"ㄙㄜ" /* "se" */, IS_ZHUYIN|IS_PINYIN, 309},
+{"ㄎㄨㄣ" /* "kun" */, IS_ZHUYIN|IS_PINYIN, 174},
+{"ㄔㄨㄚ" /* "chua" */, IS_ZHUYIN, 45},
+{"ㄊ" /* "t" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 340},
+{"ㄌㄧ" /* "li" */, IS_ZHUYIN|IS_PINYIN, 186},
+{"ㄊㄤ" /* "tang" */, IS_ZHUYIN|IS_PINYIN, 344},
+{"ㄒㄨ" /* "shu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 324},
+{"ㄍㄨㄢ" /* "guan" */, IS_ZHUYIN|IS_PINYIN, 116},
+{"ㄇㄨ" /* "mu" */, IS_ZHUYIN|IS_PINYIN, 223},
+{"ㄕㄡ" /* "shou" */, IS_ZHUYIN|IS_PINYIN, 323},
+{"ㄕㄨㄟ" /* "shui" */, IS_ZHUYIN|IS_PINYIN, 329},
+{"ㄒㄨㄞ" /* "shuai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 326},
+{"ㄍㄠ" /* "gao" */, IS_ZHUYIN|IS_PINYIN, 106},
+{"ㄐㄣ" /* "zhen" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 420},
+{"ㄑㄜ" /* "che" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 38},
+{"ㄉㄧㄢ" /* "dian" */, IS_ZHUYIN|IS_PINYIN, 72},
+{"ㄏㄨㄛ" /* "huo" */, IS_ZHUYIN|IS_PINYIN, 140},
+{"ㄎㄨㄞ" /* "kuai" */, IS_ZHUYIN|IS_PINYIN, 170},
+{"ㄧㄥ" /* "ying" */, IS_ZHUYIN|IS_PINYIN, 394},
+{"ㄇㄣ" /* "men" */, IS_ZHUYIN|IS_PINYIN, 212},
+{"ㄏㄚ" /* "ha" */, IS_ZHUYIN|IS_PINYIN, 122},
+{"ㄩㄥ" /* "yong" */, IS_ZHUYIN|IS_PINYIN, 396},
+{"ㄒㄩㄣ" /* "xun" */, IS_ZHUYIN|IS_PINYIN, 384},
+{"ㄔㄨㄢ" /* "chuan" */, IS_ZHUYIN|IS_PINYIN, 47},
+{"ㄨㄚ" /* "wa" */, IS_ZHUYIN|IS_PINYIN, 361},
+{"ㄕㄞ" /* "shai" */, IS_ZHUYIN|IS_PINYIN, 314},
+{"ㄐ" /* "zhi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 422},
+{"ㄑㄢ" /* "chan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 35},
+{"ㄓㄤ" /* "zhang" */, IS_ZHUYIN|IS_PINYIN, 416},
+{"ㄌㄞ" /* "lai" */, IS_ZHUYIN|IS_PINYIN, 178},
+{"ㄋㄤ" /* "nang" */, IS_ZHUYIN|IS_PINYIN, 228},
+{"ㄒㄧㄚ" /* "xia" */, IS_ZHUYIN|IS_PINYIN, 372},
+{"ㄍㄟ" /* "gei" */, IS_ZHUYIN|IS_PINYIN, 108},
+{"ㄌㄤ" /* "lang" */, IS_ZHUYIN|IS_PINYIN, 180},
+{"ㄐㄨㄢ" /* "zhuan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 428},
+{"ㄓㄢ" /* "zhan" */, IS_ZHUYIN|IS_PINYIN, 415},
+{"ㄉㄨ" /* "du" */, IS_ZHUYIN|IS_PINYIN, 80},
+{"ㄎㄨㄚ" /* "kua" */, IS_ZHUYIN|IS_PINYIN, 169},
+{"ㄋㄨㄢ" /* "nuan" */, IS_ZHUYIN|IS_PINYIN, 247},
+{"ㄕㄣ" /* "shen" */, IS_ZHUYIN|IS_PINYIN, 320},
+{"ㄌㄩ" /* "lv" */, IS_ZHUYIN|IS_PINYIN, 202},
+{"ㄔㄜ" /* "che" */, IS_ZHUYIN|IS_PINYIN, 38},
+{"ㄑㄣ" /* "chen" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 39},
+{"ㄖㄨ" /* "ru" */, IS_ZHUYIN|IS_PINYIN, 297},
+{"ㄨㄞ" /* "wai" */, IS_ZHUYIN|IS_PINYIN, 362},
+{"ㄑㄨㄥ" /* "chong" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 42},
+{"ㄏㄨ" /* "hu" */, IS_ZHUYIN|IS_PINYIN, 133},
+{"ㄆㄧㄣ" /* "pin" */, IS_ZHUYIN|IS_PINYIN, 267},
+{"ㄐㄠ" /* "zhao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 417},
+{"ㄍㄤ" /* "gang" */, IS_ZHUYIN|IS_PINYIN, 105},
+{"ㄙㄣ" /* "sen" */, IS_ZHUYIN|IS_PINYIN, 310},
+{"ㄋㄟ" /* "nei" */, IS_ZHUYIN|IS_PINYIN, 231},
+{"ㄒㄨㄚ" /* "shua" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 325},
+{"ㄓㄞ" /* "zhai" */, IS_ZHUYIN|IS_PINYIN, 414},
+{"ㄋㄧㄥ" /* "ning" */, IS_ZHUYIN|IS_PINYIN, 242},
+{"ㄏㄤ" /* "hang" */, IS_ZHUYIN|IS_PINYIN, 125},
+{"ㄆㄤ" /* "pang" */, IS_ZHUYIN|IS_PINYIN, 258},
+{"ㄖㄨㄣ" /* "run" */, IS_ZHUYIN|IS_PINYIN, 301},
+{"ㄑㄚ" /* "cha" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 33},
+{"ㄐㄤ" /* "zhang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 416},
+{"ㄆㄞ" /* "pai" */, IS_ZHUYIN|IS_PINYIN, 256},
+{"ㄘㄢ" /* "can" */, IS_ZHUYIN|IS_PINYIN, 26},
+{"ㄕㄨㄣ" /* "shun" */, IS_ZHUYIN|IS_PINYIN, 330},
+{"ㄑㄨㄢ" /* "chuan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 47},
+{"ㄆㄧㄝ" /* "pie" */, IS_ZHUYIN|IS_PINYIN, 266},
+{"ㄅㄞ" /* "bai" */, IS_ZHUYIN|IS_PINYIN, 8},
+{"ㄐㄨㄥ" /* "zhong" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 423},
+{"ㄇ" /* "an" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 3},
+{"ㄘ" /* "ci" */, IS_ZHUYIN|IS_PINYIN, 52},
+{"ㄌㄧㄤ" /* "liang" */, IS_ZHUYIN|IS_PINYIN, 189},
+{"ㄋㄨ" /* "nu" */, IS_ZHUYIN|IS_PINYIN, 246},
+{"ㄑㄧㄢ" /* "qian" */, IS_ZHUYIN|IS_PINYIN, 275},
+{"ㄐㄧㄢ" /* "jian" */, IS_ZHUYIN|IS_PINYIN, 144},
+{"ㄓㄣ" /* "zhen" */, IS_ZHUYIN|IS_PINYIN, 420},
+{"ㄌㄨㄣ" /* "lun" */, IS_ZHUYIN|IS_PINYIN, 200},
+{"ㄒㄨㄢ" /* "shuan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 327},
+{"ㄐㄨㄚ" /* "zhua" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 426},
+{"ㄒㄧㄤ" /* "xiang" */, IS_ZHUYIN|IS_PINYIN, 374},
+{"ㄇㄠ" /* "mao" */, IS_ZHUYIN|IS_PINYIN, 209},
+{"ㄙ" /* "si" */, IS_ZHUYIN|IS_PINYIN, 332},
+{"ㄇㄧㄣ" /* "min" */, IS_ZHUYIN|IS_PINYIN, 218},
+{"ㄖㄠ" /* "rao" */, IS_ZHUYIN|IS_PINYIN, 290},
+{"ㄙㄨㄣ" /* "sun" */, IS_ZHUYIN|IS_PINYIN, 338},
+{"ㄉㄧ" /* "di" */, IS_ZHUYIN|IS_PINYIN, 70},
+{"ㄒㄡ" /* "shou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 323},
+{"ㄍㄢ" /* "gan" */, IS_ZHUYIN|IS_PINYIN, 104},
+{"ㄆㄧ" /* "pi" */, IS_ZHUYIN|IS_PINYIN, 263},
+{"ㄔㄨㄞ" /* "chuai" */, IS_ZHUYIN|IS_PINYIN, 46},
+{"ㄐㄨ" /* "zhu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 425},
+{"ㄑ" /* "chi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 41},
+{"ㄌㄨㄛ" /* "luo" */, IS_ZHUYIN|IS_PINYIN, 201},
+{"ㄒㄜ" /* "she" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 318},
+{"ㄈㄣ" /* "fen" */, IS_ZHUYIN|IS_PINYIN, 96},
+{"ㄋ" /* "en" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 87},
+{"ㄒㄨㄛ" /* "shuo" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 331},
+{"ㄜ" /* "e" */, IS_ZHUYIN|IS_PINYIN, 85},
+{"ㄊㄨㄢ" /* "tuan" */, IS_ZHUYIN|IS_PINYIN, 356},
+{"ㄉㄧㄡ" /* "diu" */, IS_ZHUYIN|IS_PINYIN, 77},
+{"ㄗㄥ" /* "zeng" */, IS_ZHUYIN|IS_PINYIN, 411},
+{"ㄉㄨㄢ" /* "duan" */, IS_ZHUYIN|IS_PINYIN, 81},
+{"ㄑㄩㄣ" /* "qun" */, IS_ZHUYIN|IS_PINYIN, 286},
+{"ㄨ" /* "wu" */, IS_ZHUYIN|IS_PINYIN, 369},
+{"ㄈ" /* "f" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 90},
+{"ㄕ" /* "shi" */, IS_ZHUYIN|IS_PINYIN, 322},
+{"ㄉㄜ" /* "de" */, IS_ZHUYIN|IS_PINYIN, 66},
+{"ㄖㄤ" /* "rang" */, IS_ZHUYIN|IS_PINYIN, 289},
+{"ㄇㄜ" /* "me" */, IS_ZHUYIN|IS_PINYIN, 210},
+{"ㄉㄣ" /* "den" */, IS_ZHUYIN, 68},
+{"ㄈㄛ" /* "fo" */, IS_ZHUYIN|IS_PINYIN, 98},
+{"ㄕㄠ" /* "shao" */, IS_ZHUYIN|IS_PINYIN, 317},
+{"ㄏㄨㄟ" /* "hui" */, IS_ZHUYIN|IS_PINYIN, 138},
+{"ㄡ" /* "ou" */, IS_ZHUYIN|IS_PINYIN, 253},
+{"ㄑㄩ" /* "qu" */, IS_ZHUYIN|IS_PINYIN, 283},
+{"ㄗㄣ" /* "zen" */, IS_ZHUYIN|IS_PINYIN, 410},
+{"ㄓㄥ" /* "zheng" */, IS_ZHUYIN|IS_PINYIN, 421},
+{"ㄇㄧㄝ" /* "mie" */, IS_ZHUYIN|IS_PINYIN, 217},
+{"ㄋㄧㄡ" /* "niu" */, IS_ZHUYIN|IS_PINYIN, 243},
+{"ㄊㄧㄢ" /* "tian" */, IS_ZHUYIN|IS_PINYIN, 349},
+{"ㄧㄤ" /* "yang" */, IS_ZHUYIN|IS_PINYIN, 389},
+{"ㄨㄛ" /* "wo" */, IS_ZHUYIN|IS_PINYIN, 368},
+{"ㄅㄠ" /* "bao" */, IS_ZHUYIN|IS_PINYIN, 11},
+{"ㄆㄚ" /* "pa" */, IS_ZHUYIN|IS_PINYIN, 255},
+{"ㄉㄧㄚ" /* "dia" */, IS_ZHUYIN|IS_PINYIN, 71},
+{"ㄎ" /* "ang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 4},
+{"ㄊㄥ" /* "teng" */, IS_ZHUYIN|IS_PINYIN, 347},
+{"ㄥ" /* "eng" */, IS_ZHUYIN, 88},
+{"ㄍㄨㄣ" /* "gun" */, IS_ZHUYIN|IS_PINYIN, 119},
+{"ㄒㄤ" /* "shang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 316},
+{"ㄑㄥ" /* "cheng" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 40},
+{"ㄗㄨㄥ" /* "zong" */, IS_ZHUYIN|IS_PINYIN, 434},
+{"ㄊㄧㄝ" /* "tie" */, IS_ZHUYIN|IS_PINYIN, 351},
+{"ㄍㄣ" /* "gen" */, IS_ZHUYIN|IS_PINYIN, 109},
+{"ㄗㄨㄟ" /* "zui" */, IS_ZHUYIN|IS_PINYIN, 438},
+{"ㄌㄥ" /* "leng" */, IS_ZHUYIN|IS_PINYIN, 185},
+{"ㄓㄡ" /* "zhou" */, IS_ZHUYIN|IS_PINYIN, 424},
+{"ㄐㄧㄥ" /* "jing" */, IS_ZHUYIN|IS_PINYIN, 149},
+{"ㄎㄞ" /* "kai" */, IS_ZHUYIN|IS_PINYIN, 158},
+{"ㄋㄨㄣ" /* "nun" */, IS_ZHUYIN, 248},
+{"ㄔㄨㄥ" /* "chong" */, IS_ZHUYIN|IS_PINYIN, 42},
+{"ㄨㄟ" /* "wei" */, IS_ZHUYIN|IS_PINYIN, 365},
+{"ㄔㄣ" /* "chen" */, IS_ZHUYIN|IS_PINYIN, 39},
+{"ㄆㄢ" /* "pan" */, IS_ZHUYIN|IS_PINYIN, 257},
+{"ㄇㄧ" /* "mi" */, IS_ZHUYIN|IS_PINYIN, 214},
+{"ㄑㄨㄚ" /* "chua" */, IS_ZHUYIN|ZHUYIN_CORRECT_HSU, 45},
+{"ㄑㄨㄟ" /* "chui" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 49},
+{"ㄐㄡ" /* "zhou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 424},
+{"ㄋㄞ" /* "nai" */, IS_ZHUYIN|IS_PINYIN, 226},
+{"ㄌㄠ" /* "lao" */, IS_ZHUYIN|IS_PINYIN, 181},
+{"ㄌㄟ" /* "lei" */, IS_ZHUYIN|IS_PINYIN, 183},
+{"ㄉㄠ" /* "dao" */, IS_ZHUYIN|IS_PINYIN, 65},
+{"ㄩ" /* "yu" */, IS_ZHUYIN|IS_PINYIN, 398},
+{"ㄊㄨㄣ" /* "tun" */, IS_ZHUYIN|IS_PINYIN, 358},
+{"ㄑㄡ" /* "chou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 43},
+{"ㄌㄡ" /* "lou" */, IS_ZHUYIN|IS_PINYIN, 197},
+{"ㄐㄢ" /* "zhan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 415},
+{"ㄍㄧ" /* "ji" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 142},
+{"ㄋㄧㄤ" /* "niang" */, IS_ZHUYIN|IS_PINYIN, 238},
+{"ㄌㄧㄚ" /* "lia" */, IS_ZHUYIN|IS_PINYIN, 187},
+{"ㄕㄢ" /* "shan" */, IS_ZHUYIN|IS_PINYIN, 315},
+{"ㄍㄩㄥ" /* "jiong" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 150},
+{"ㄑㄧㄥ" /* "qing" */, IS_ZHUYIN|IS_PINYIN, 280},
+{"ㄅ" /* "b" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 6},
+{"ㄍㄧㄤ" /* "jiang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 145},
+{"ㄆㄥ" /* "peng" */, IS_ZHUYIN|IS_PINYIN, 262},
+{"ㄊㄧㄠ" /* "tiao" */, IS_ZHUYIN|IS_PINYIN, 350},
+{"ㄋㄣ" /* "nen" */, IS_ZHUYIN|IS_PINYIN, 232},
+{"ㄍㄩ" /* "ju" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 152},
+{"ㄍㄚ" /* "ga" */, IS_ZHUYIN|IS_PINYIN, 102},
+{"ㄏㄨㄣ" /* "hun" */, IS_ZHUYIN|IS_PINYIN, 139},
+{"ㄊㄜ" /* "te" */, IS_ZHUYIN|IS_PINYIN, 346},
+{"ㄍㄨㄚ" /* "gua" */, IS_ZHUYIN|IS_PINYIN, 114},
+{"ㄖ" /* "ri" */, IS_ZHUYIN|IS_PINYIN, 294},
+{"ㄓㄟ" /* "zhei" */, IS_ZHUYIN, 419},
+{"ㄔㄤ" /* "chang" */, IS_ZHUYIN|IS_PINYIN, 36},
+{"ㄑㄤ" /* "chang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 36},
+{"ㄊㄨ" /* "tu" */, IS_ZHUYIN|IS_PINYIN, 355},
+{"ㄐㄥ" /* "zheng" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 421},
+{"ㄌㄨㄥ" /* "long" */, IS_ZHUYIN|IS_PINYIN, 196},
+{"ㄆㄨ" /* "pu" */, IS_ZHUYIN|IS_PINYIN, 271},
+{"ㄅㄚ" /* "ba" */, IS_ZHUYIN|IS_PINYIN, 7},
+{"ㄘㄣ" /* "cen" */, IS_ZHUYIN|IS_PINYIN, 30},
+{"ㄆ" /* "p" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 254},
+{"ㄒㄟ" /* "shei" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 319},
+{"ㄛ" /* "o" */, IS_ZHUYIN|IS_PINYIN, 252},
+{"ㄍㄜ" /* "ge" */, IS_ZHUYIN|IS_PINYIN, 107},
+{"ㄋㄚ" /* "na" */, IS_ZHUYIN|IS_PINYIN, 225},
+{"ㄍㄧㄠ" /* "jiao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 146},
+{"ㄘㄨㄣ" /* "cun" */, IS_ZHUYIN|IS_PINYIN, 58},
+{"ㄗㄠ" /* "zao" */, IS_ZHUYIN|IS_PINYIN, 407},
+{"ㄈㄜ" /* "fe" */, IS_ZHUYIN, 94},
+{"ㄋㄧㄠ" /* "niao" */, IS_ZHUYIN|IS_PINYIN, 239},
+{"ㄊㄧ" /* "ti" */, IS_ZHUYIN|IS_PINYIN, 348},
+{"ㄑㄧㄡ" /* "qiu" */, IS_ZHUYIN|IS_PINYIN, 282},
+{"ㄕㄚ" /* "sha" */, IS_ZHUYIN|IS_PINYIN, 313},
+{"ㄌㄨㄢ" /* "luan" */, IS_ZHUYIN|IS_PINYIN, 199},
+{"ㄏㄥ" /* "heng" */, IS_ZHUYIN|IS_PINYIN, 130},
+{"ㄇㄧㄢ" /* "mian" */, IS_ZHUYIN|IS_PINYIN, 215},
+{"ㄔㄠ" /* "chao" */, IS_ZHUYIN|IS_PINYIN, 37},
+{"ㄖㄡ" /* "rou" */, IS_ZHUYIN|IS_PINYIN, 296},
+{"ㄎㄚ" /* "ka" */, IS_ZHUYIN|IS_PINYIN, 157},
+{"ㄐㄩ" /* "ju" */, IS_ZHUYIN|IS_PINYIN, 152},
+{"ㄅㄧㄥ" /* "bing" */, IS_ZHUYIN|IS_PINYIN, 20},
+{"ㄕㄨㄤ" /* "shuang" */, IS_ZHUYIN|IS_PINYIN, 328},
+{"ㄈㄤ" /* "fang" */, IS_ZHUYIN|IS_PINYIN, 93},
+{"ㄒㄩㄢ" /* "xuan" */, IS_ZHUYIN|IS_PINYIN, 382},
+{"ㄘㄨㄟ" /* "cui" */, IS_ZHUYIN|IS_PINYIN, 57},
+{"ㄐㄩㄥ" /* "jiong" */, IS_ZHUYIN|IS_PINYIN, 150},
+{"ㄉㄨㄣ" /* "dun" */, IS_ZHUYIN|IS_PINYIN, 83},
+{"ㄙㄨ" /* "su" */, IS_ZHUYIN|IS_PINYIN, 335},
+{"ㄏㄠ" /* "hao" */, IS_ZHUYIN|IS_PINYIN, 126},
+{"ㄑㄩㄢ" /* "quan" */, IS_ZHUYIN|IS_PINYIN, 284},
+{"ㄐㄚ" /* "zha" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 413},
+{"ㄌㄧㄡ" /* "liu" */, IS_ZHUYIN|IS_PINYIN, 194},
+{"ㄉㄟ" /* "dei" */, IS_ZHUYIN|IS_PINYIN, 67},
+{"ㄖㄥ" /* "reng" */, IS_ZHUYIN|IS_PINYIN, 293},
+{"ㄋㄧㄝ" /* "nie" */, IS_ZHUYIN|IS_PINYIN, 240},
+{"ㄐㄧㄚ" /* "jia" */, IS_ZHUYIN|IS_PINYIN, 143},
+{"ㄙㄤ" /* "sang" */, IS_ZHUYIN|IS_PINYIN, 307},
+{"ㄎㄣ" /* "ken" */, IS_ZHUYIN|IS_PINYIN, 164},
+{"ㄊㄢ" /* "tan" */, IS_ZHUYIN|IS_PINYIN, 343},
+{"ㄗㄨ" /* "zu" */, IS_ZHUYIN|IS_PINYIN, 436},
+{"ㄏ" /* "o" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 252},
+{"ㄔ" /* "chi" */, IS_ZHUYIN|IS_PINYIN, 41},
+{"ㄍㄨㄞ" /* "guai" */, IS_ZHUYIN|IS_PINYIN, 115},
+{"ㄙㄞ" /* "sai" */, IS_ZHUYIN|IS_PINYIN, 305},
+{"ㄊㄚ" /* "ta" */, IS_ZHUYIN|IS_PINYIN, 341},
+{"ㄐㄧㄣ" /* "jin" */, IS_ZHUYIN|IS_PINYIN, 148},
+{"ㄕㄟ" /* "shei" */, IS_ZHUYIN|IS_PINYIN, 319},
+{"ㄙㄢ" /* "san" */, IS_ZHUYIN|IS_PINYIN, 306},
+{"ㄗㄨㄢ" /* "zuan" */, IS_ZHUYIN|IS_PINYIN, 437},
+{"ㄐㄨㄞ" /* "zhuai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 427},
+{"ㄇㄛ" /* "mo" */, IS_ZHUYIN|IS_PINYIN, 221},
+{"ㄗㄢ" /* "zan" */, IS_ZHUYIN|IS_PINYIN, 405},
+{"ㄗㄤ" /* "zang" */, IS_ZHUYIN|IS_PINYIN, 406},
+{"ㄏㄜ" /* "he" */, IS_ZHUYIN|IS_PINYIN, 127},
+{"ㄐㄞ" /* "zhai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 414},
+{"ㄨㄥ" /* "weng" */, IS_ZHUYIN|IS_PINYIN, 367},
+{"ㄊㄡ" /* "tou" */, IS_ZHUYIN|IS_PINYIN, 354},
+{"ㄑㄧㄚ" /* "qia" */, IS_ZHUYIN|IS_PINYIN, 274},
+{"ㄠ" /* "ao" */, IS_ZHUYIN|IS_PINYIN, 5},
+{"ㄆㄠ" /* "pao" */, IS_ZHUYIN|IS_PINYIN, 259},
+{"ㄎㄨㄛ" /* "kuo" */, IS_ZHUYIN|IS_PINYIN, 175},
+{"ㄖㄨㄟ" /* "rui" */, IS_ZHUYIN|IS_PINYIN, 300},
+{"ㄑㄨ" /* "chu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 44},
+{"ㄧㄣ" /* "yin" */, IS_ZHUYIN|IS_PINYIN, 393},
+{"ㄍㄨㄤ" /* "guang" */, IS_ZHUYIN|IS_PINYIN, 117},
+{"ㄐㄧㄠ" /* "jiao" */, IS_ZHUYIN|IS_PINYIN, 146},
+{"ㄓㄨㄢ" /* "zhuan" */, IS_ZHUYIN|IS_PINYIN, 428},
+{"ㄎㄥ" /* "keng" */, IS_ZHUYIN|IS_PINYIN, 165},
+{"ㄕㄨㄛ" /* "shuo" */, IS_ZHUYIN|IS_PINYIN, 331},
+{"ㄆㄟ" /* "pei" */, IS_ZHUYIN|IS_PINYIN, 260},
+{"ㄆㄧㄢ" /* "pian" */, IS_ZHUYIN|IS_PINYIN, 264},
+{"ㄙㄚ" /* "sa" */, IS_ZHUYIN|IS_PINYIN, 304},
+{"ㄇㄟ" /* "mei" */, IS_ZHUYIN|IS_PINYIN, 211},
+{"ㄆㄛ" /* "po" */, IS_ZHUYIN|IS_PINYIN, 269},
+{"ㄤ" /* "ang" */, IS_ZHUYIN|IS_PINYIN, 4},
+{"ㄅㄥ" /* "beng" */, IS_ZHUYIN|IS_PINYIN, 14},
+{"ㄖㄨㄛ" /* "ruo" */, IS_ZHUYIN|IS_PINYIN, 302},
+{"ㄧㄢ" /* "yan" */, IS_ZHUYIN|IS_PINYIN, 388},
+{"ㄎㄤ" /* "kang" */, IS_ZHUYIN|IS_PINYIN, 160},
+{"ㄌㄧㄢ" /* "lian" */, IS_ZHUYIN|IS_PINYIN, 188},
+{"ㄎㄟ" /* "kei" */, IS_ZHUYIN, 163},
+{"ㄨㄤ" /* "wang" */, IS_ZHUYIN|IS_PINYIN, 364},
+{"ㄎㄨㄥ" /* "kong" */, IS_ZHUYIN|IS_PINYIN, 166},
+{"ㄊㄧㄥ" /* "ting" */, IS_ZHUYIN|IS_PINYIN, 352},
+{"ㄎㄨㄢ" /* "kuan" */, IS_ZHUYIN|IS_PINYIN, 171},
+{"ㄊㄨㄥ" /* "tong" */, IS_ZHUYIN|IS_PINYIN, 353},
+{"ㄌㄜ" /* "le" */, IS_ZHUYIN|IS_PINYIN, 182},
+{"ㄓㄜ" /* "zhe" */, IS_ZHUYIN|IS_PINYIN, 418},
+{"ㄧㄝ" /* "ye" */, IS_ZHUYIN|IS_PINYIN, 391},
+{"ㄗㄞ" /* "zai" */, IS_ZHUYIN|IS_PINYIN, 404},
+{"ㄐㄨㄛ" /* "zhuo" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 432},
+{"ㄍㄞ" /* "gai" */, IS_ZHUYIN|IS_PINYIN, 103},
+{"ㄓㄨ" /* "zhu" */, IS_ZHUYIN|IS_PINYIN, 425},
+{"ㄌㄧㄠ" /* "liao" */, IS_ZHUYIN|IS_PINYIN, 190},
+{"ㄅㄛ" /* "bo" */, IS_ZHUYIN|IS_PINYIN, 21},
+{"ㄍㄨㄟ" /* "gui" */, IS_ZHUYIN|IS_PINYIN, 118},
+{"ㄍㄧㄢ" /* "jian" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 144},
+{"ㄒㄢ" /* "shan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 315},
+{"ㄑㄨㄛ" /* "chuo" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 51},
+{"ㄋㄨㄛ" /* "nuo" */, IS_ZHUYIN|IS_PINYIN, 249},
+{"ㄇㄡ" /* "mou" */, IS_ZHUYIN|IS_PINYIN, 222},
+{"ㄗㄜ" /* "ze" */, IS_ZHUYIN|IS_PINYIN, 408},
+{"ㄩㄣ" /* "yun" */, IS_ZHUYIN|IS_PINYIN, 401},
+{"ㄋㄢ" /* "nan" */, IS_ZHUYIN|IS_PINYIN, 227},
+{"ㄙㄡ" /* "sou" */, IS_ZHUYIN|IS_PINYIN, 334},
+{"ㄒㄧㄡ" /* "xiu" */, IS_ZHUYIN|IS_PINYIN, 380},
+{"ㄆㄧㄠ" /* "piao" */, IS_ZHUYIN|IS_PINYIN, 265},
+{"ㄔㄨㄤ" /* "chuang" */, IS_ZHUYIN|IS_PINYIN, 48},
+{"ㄉㄧㄝ" /* "die" */, IS_ZHUYIN|IS_PINYIN, 74},
+{"ㄗ" /* "zi" */, IS_ZHUYIN|IS_PINYIN, 433},
+{"ㄒㄧㄢ" /* "xian" */, IS_ZHUYIN|IS_PINYIN, 373},
+{"ㄑㄞ" /* "chai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 34},
+{"ㄑㄠ" /* "chao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 37},
+{"ㄋㄧㄚ" /* "nia" */, IS_ZHUYIN, 236},
+{"ㄗㄚ" /* "za" */, IS_ZHUYIN|IS_PINYIN, 403},
+{"ㄎㄨ" /* "ku" */, IS_ZHUYIN|IS_PINYIN, 168},
+{"ㄑㄧㄤ" /* "qiang" */, IS_ZHUYIN|IS_PINYIN, 276},
+{"ㄔㄡ" /* "chou" */, IS_ZHUYIN|IS_PINYIN, 43},
+{"ㄓㄨㄚ" /* "zhua" */, IS_ZHUYIN|IS_PINYIN, 426},
+{"ㄍㄨ" /* "gu" */, IS_ZHUYIN|IS_PINYIN, 113},
+{"ㄍㄨㄛ" /* "guo" */, IS_ZHUYIN|IS_PINYIN, 120},
+{"ㄚ" /* "a" */, IS_ZHUYIN|IS_PINYIN, 1},
+{"ㄏㄨㄤ" /* "huang" */, IS_ZHUYIN|IS_PINYIN, 137},
+{"ㄉㄨㄥ" /* "dong" */, IS_ZHUYIN|IS_PINYIN, 78},
+{"ㄘㄨㄢ" /* "cuan" */, IS_ZHUYIN|IS_PINYIN, 56},
+{"ㄘㄚ" /* "ca" */, IS_ZHUYIN|IS_PINYIN, 24},
+{"ㄧㄛ" /* "yo" */, IS_ZHUYIN|IS_PINYIN, 395},
+{"ㄘㄠ" /* "cao" */, IS_ZHUYIN|IS_PINYIN, 28},
+{"ㄌㄢ" /* "lan" */, IS_ZHUYIN|IS_PINYIN, 179},
+{"ㄒㄧㄥ" /* "xing" */, IS_ZHUYIN|IS_PINYIN, 378},
+{"ㄋㄧㄣ" /* "nin" */, IS_ZHUYIN|IS_PINYIN, 241},
+{"ㄑㄧㄠ" /* "qiao" */, IS_ZHUYIN|IS_PINYIN, 277},
+{"ㄓㄨㄞ" /* "zhuai" */, IS_ZHUYIN|IS_PINYIN, 427},
+{"ㄆㄣ" /* "pen" */, IS_ZHUYIN|IS_PINYIN, 261},
+{"ㄋㄠ" /* "nao" */, IS_ZHUYIN|IS_PINYIN, 229},
+{"ㄈㄨ" /* "fu" */, IS_ZHUYIN|IS_PINYIN, 100},
+{"ㄟ" /* "ei" */, IS_ZHUYIN|IS_PINYIN, 86},
+{"ㄖㄢ" /* "ran" */, IS_ZHUYIN|IS_PINYIN, 288},
+{"ㄖㄨㄥ" /* "rong" */, IS_ZHUYIN|IS_PINYIN, 295},
+{"ㄐㄨㄤ" /* "zhuang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 429},
+{"ㄔㄞ" /* "chai" */, IS_ZHUYIN|IS_PINYIN, 34},
+{"ㄈㄥ" /* "feng" */, IS_ZHUYIN|IS_PINYIN, 97},
+{"ㄘㄤ" /* "cang" */, IS_ZHUYIN|IS_PINYIN, 27},
+{"ㄕㄨㄞ" /* "shuai" */, IS_ZHUYIN|IS_PINYIN, 326},
+{"ㄕㄥ" /* "sheng" */, IS_ZHUYIN|IS_PINYIN, 321},
+{"ㄈㄡ" /* "fou" */, IS_ZHUYIN|IS_PINYIN, 99},
+{"ㄑㄨㄞ" /* "chuai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 46},
+{"ㄅㄧㄣ" /* "bin" */, IS_ZHUYIN|IS_PINYIN, 19},
+{"ㄒㄚ" /* "sha" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 313},
+{"ㄇㄧㄡ" /* "miu" */, IS_ZHUYIN|IS_PINYIN, 220},
+{"ㄉㄞ" /* "dai" */, IS_ZHUYIN|IS_PINYIN, 62},
+{"ㄌㄧㄝ" /* "lie" */, IS_ZHUYIN|IS_PINYIN, 191},
+{"ㄕㄨ" /* "shu" */, IS_ZHUYIN|IS_PINYIN, 324},
+{"ㄘㄨㄥ" /* "cong" */, IS_ZHUYIN|IS_PINYIN, 53},
+{"ㄓㄨㄣ" /* "zhun" */, IS_ZHUYIN|IS_PINYIN, 431},
+{"ㄔㄚ" /* "cha" */, IS_ZHUYIN|IS_PINYIN, 33},
+{"ㄇㄥ" /* "meng" */, IS_ZHUYIN|IS_PINYIN, 213},
+{"ㄇㄚ" /* "ma" */, IS_ZHUYIN|IS_PINYIN, 205},
+{"ㄨㄢ" /* "wan" */, IS_ZHUYIN|IS_PINYIN, 363},
+{"ㄐㄟ" /* "zhei" */, IS_ZHUYIN|ZHUYIN_CORRECT_HSU, 419},
+{"ㄣ" /* "en" */, IS_ZHUYIN|IS_PINYIN, 87},
+{"ㄌㄚ" /* "la" */, IS_ZHUYIN|IS_PINYIN, 177},
+{"ㄏㄣ" /* "hen" */, IS_ZHUYIN|IS_PINYIN, 129},
+{"ㄅㄧㄠ" /* "biao" */, IS_ZHUYIN|IS_PINYIN, 17},
+{"ㄉㄥ" /* "deng" */, IS_ZHUYIN|IS_PINYIN, 69},
+{"ㄒㄧ" /* "xi" */, IS_ZHUYIN|IS_PINYIN, 371},
+{"ㄇㄧㄥ" /* "ming" */, IS_ZHUYIN|IS_PINYIN, 219},
+{"ㄅㄧㄢ" /* "bian" */, IS_ZHUYIN|IS_PINYIN, 16},
+{"ㄌㄧㄥ" /* "ling" */, IS_ZHUYIN|IS_PINYIN, 193},
+{"ㄉㄚ" /* "da" */, IS_ZHUYIN|IS_PINYIN, 61},
+{"ㄗㄡ" /* "zou" */, IS_ZHUYIN|IS_PINYIN, 435},
+{"ㄔㄨ" /* "chu" */, IS_ZHUYIN|IS_PINYIN, 44},
+{"ㄒㄞ" /* "shai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 314},
+{"ㄔㄥ" /* "cheng" */, IS_ZHUYIN|IS_PINYIN, 40},
+{"ㄑㄩㄝ" /* "que" */, IS_ZHUYIN|IS_PINYIN, 285},
+{"ㄇㄞ" /* "mai" */, IS_ZHUYIN|IS_PINYIN, 206},
+{"ㄗㄨㄣ" /* "zun" */, IS_ZHUYIN|IS_PINYIN, 439},
+{"ㄏㄨㄚ" /* "hua" */, IS_ZHUYIN|IS_PINYIN, 134},
+{"ㄘㄜ" /* "ce" */, IS_ZHUYIN|IS_PINYIN, 29},
+{"ㄧ" /* "yi" */, IS_ZHUYIN|IS_PINYIN, 392},
+{"ㄎㄠ" /* "kao" */, IS_ZHUYIN|IS_PINYIN, 161},
+{"ㄅㄤ" /* "bang" */, IS_ZHUYIN|IS_PINYIN, 10},
+{"ㄖㄨㄚ" /* "rua" */, IS_ZHUYIN, 298},
+{"ㄍㄨㄥ" /* "gong" */, IS_ZHUYIN|IS_PINYIN, 111},
+{"ㄅㄣ" /* "ben" */, IS_ZHUYIN|IS_PINYIN, 13},
+{"ㄑㄧ" /* "qi" */, IS_ZHUYIN|IS_PINYIN, 273},
+{"ㄐㄧㄤ" /* "jiang" */, IS_ZHUYIN|IS_PINYIN, 145},
+{"ㄙㄨㄥ" /* "song" */, IS_ZHUYIN|IS_PINYIN, 333},
+{"ㄉㄡ" /* "dou" */, IS_ZHUYIN|IS_PINYIN, 79},
+{"ㄓㄚ" /* "zha" */, IS_ZHUYIN|IS_PINYIN, 413},
+{"ㄙㄥ" /* "seng" */, IS_ZHUYIN|IS_PINYIN, 311},
+{"ㄆㄡ" /* "pou" */, IS_ZHUYIN|IS_PINYIN, 270},
+{"ㄐㄩㄢ" /* "juan" */, IS_ZHUYIN|IS_PINYIN, 153},
+{"ㄍㄧㄚ" /* "jia" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 143},
+{"ㄉㄧㄣ" /* "din" */, IS_ZHUYIN, 75},
+{"ㄧㄞ" /* "yai" */, IS_ZHUYIN, 387},
+{"ㄏㄟ" /* "hei" */, IS_ZHUYIN|IS_PINYIN, 128},
+{"ㄧㄠ" /* "yao" */, IS_ZHUYIN|IS_PINYIN, 390},
+{"ㄒㄧㄣ" /* "xin" */, IS_ZHUYIN|IS_PINYIN, 377},
+{"ㄖㄨㄢ" /* "ruan" */, IS_ZHUYIN|IS_PINYIN, 299},
+{"ㄎㄨㄟ" /* "kui" */, IS_ZHUYIN|IS_PINYIN, 173},
+{"ㄎㄨㄤ" /* "kuang" */, IS_ZHUYIN|IS_PINYIN, 172},
+{"ㄔㄨㄛ" /* "chuo" */, IS_ZHUYIN|IS_PINYIN, 51},
+{"ㄑㄩㄥ" /* "qiong" */, IS_ZHUYIN|IS_PINYIN, 281},
+{"ㄌ" /* "er" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 89},
+{"ㄒㄧㄠ" /* "xiao" */, IS_ZHUYIN|IS_PINYIN, 375},
+{"ㄒㄩㄥ" /* "xiong" */, IS_ZHUYIN|IS_PINYIN, 379},
+{"ㄐㄧ" /* "ji" */, IS_ZHUYIN|IS_PINYIN, 142},
+{"ㄓ" /* "zhi" */, IS_ZHUYIN|IS_PINYIN, 422},
+{"ㄔㄨㄣ" /* "chun" */, IS_ZHUYIN|IS_PINYIN, 50},
+{"ㄐㄩㄝ" /* "jue" */, IS_ZHUYIN|IS_PINYIN, 154},
+{"ㄅㄨ" /* "bu" */, IS_ZHUYIN|IS_PINYIN, 22},
+{"ㄍㄡ" /* "gou" */, IS_ZHUYIN|IS_PINYIN, 112},
+{"ㄋㄜ" /* "ne" */, IS_ZHUYIN|IS_PINYIN, 230},
+{"ㄐㄧㄝ" /* "jie" */, IS_ZHUYIN|IS_PINYIN, 147},
+{"ㄍㄧㄣ" /* "jin" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 148},
+{"ㄒㄥ" /* "sheng" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 321},
+{"ㄎㄜ" /* "ke" */, IS_ZHUYIN|IS_PINYIN, 162},
+{"ㄌㄨ" /* "lu" */, IS_ZHUYIN|IS_PINYIN, 198},
+{"ㄧㄚ" /* "ya" */, IS_ZHUYIN|IS_PINYIN, 386},
+{"ㄧㄡ" /* "you" */, IS_ZHUYIN|IS_PINYIN, 397},
+{"ㄩㄢ" /* "yuan" */, IS_ZHUYIN|IS_PINYIN, 399},
+{"ㄓㄨㄛ" /* "zhuo" */, IS_ZHUYIN|IS_PINYIN, 432},
+{"ㄙㄠ" /* "sao" */, IS_ZHUYIN|IS_PINYIN, 308},
+{"ㄕㄜ" /* "she" */, IS_ZHUYIN|IS_PINYIN, 318},
+{"ㄓㄨㄤ" /* "zhuang" */, IS_ZHUYIN|IS_PINYIN, 429},
+{"ㄊㄞ" /* "tai" */, IS_ZHUYIN|IS_PINYIN, 342},
+{"ㄑㄨㄣ" /* "chun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 50},
+{"ㄑㄨㄤ" /* "chuang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 48},
+{"ㄗㄨㄛ" /* "zuo" */, IS_ZHUYIN|IS_PINYIN, 440},
+{"ㄊㄨㄛ" /* "tuo" */, IS_ZHUYIN|IS_PINYIN, 359},
+{"ㄆㄧㄥ" /* "ping" */, IS_ZHUYIN|IS_PINYIN, 268},
+{"ㄌㄣ" /* "len" */, IS_ZHUYIN, 184},
+{"ㄑㄧㄝ" /* "qie" */, IS_ZHUYIN|IS_PINYIN, 278},
+{"ㄐㄨㄣ" /* "zhun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 431},
+{"ㄓㄨㄟ" /* "zhui" */, IS_ZHUYIN|IS_PINYIN, 430},
+{"ㄍㄥ" /* "geng" */, IS_ZHUYIN|IS_PINYIN, 110},
+{"ㄘㄡ" /* "cou" */, IS_ZHUYIN|IS_PINYIN, 54},
+{"ㄋㄨㄥ" /* "nong" */, IS_ZHUYIN|IS_PINYIN, 244},
+{"ㄇㄢ" /* "man" */, IS_ZHUYIN|IS_PINYIN, 207},
+{"ㄏㄨㄞ" /* "huai" */, IS_ZHUYIN|IS_PINYIN, 135},
+{"ㄏㄨㄥ" /* "hong" */, IS_ZHUYIN|IS_PINYIN, 131},
+{"ㄖㄣ" /* "ren" */, IS_ZHUYIN|IS_PINYIN, 292},
+{"ㄒㄩㄝ" /* "xue" */, IS_ZHUYIN|IS_PINYIN, 383},
+{"ㄙㄨㄟ" /* "sui" */, IS_ZHUYIN|IS_PINYIN, 337},
+{"ㄕㄨㄢ" /* "shuan" */, IS_ZHUYIN|IS_PINYIN, 327},
+{"ㄋㄥ" /* "neng" */, IS_ZHUYIN|IS_PINYIN, 233},
+{"ㄗㄟ" /* "zei" */, IS_ZHUYIN|IS_PINYIN, 409},
+{"ㄍㄩㄝ" /* "jue" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 154},
+{"ㄓㄠ" /* "zhao" */, IS_ZHUYIN|IS_PINYIN, 417},
+{"ㄅㄟ" /* "bei" */, IS_ZHUYIN|IS_PINYIN, 12},
+{"ㄉㄨㄛ" /* "duo" */, IS_ZHUYIN|IS_PINYIN, 84},
+{"ㄋㄩㄝ" /* "nve" */, IS_ZHUYIN|IS_PINYIN, 251},
+{"ㄋㄡ" /* "nou" */, IS_ZHUYIN|IS_PINYIN, 245},
+{"ㄔㄢ" /* "chan" */, IS_ZHUYIN|IS_PINYIN, 35},
+{"ㄞ" /* "ai" */, IS_ZHUYIN|IS_PINYIN, 2},
+{"ㄫ" /* "ng" */, IS_ZHUYIN|IS_PINYIN, 234},
+{"ㄓㄨㄥ" /* "zhong" */, IS_ZHUYIN|IS_PINYIN, 423},
+{"ㄒㄨㄟ" /* "shui" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 329},
+{"ㄋㄧㄢ" /* "nian" */, IS_ZHUYIN|IS_PINYIN, 237},
+{"ㄅㄧㄝ" /* "bie" */, IS_ZHUYIN|IS_PINYIN, 18},
+{"ㄘㄥ" /* "ceng" */, IS_ZHUYIN|IS_PINYIN, 31},
+{"ㄑㄧㄣ" /* "qin" */, IS_ZHUYIN|IS_PINYIN, 279},
+{"ㄕㄤ" /* "shang" */, IS_ZHUYIN|IS_PINYIN, 316},
+{"ㄍㄩㄣ" /* "jun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 155},
+{"ㄌㄩㄝ" /* "lve" */, IS_ZHUYIN|IS_PINYIN, 203},
+{"ㄒㄨㄣ" /* "shun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 330},
+{"ㄒㄨㄤ" /* "shuang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 328},
+{"ㄇㄧㄠ" /* "miao" */, IS_ZHUYIN|IS_PINYIN, 216},
+{"ㄌㄧㄣ" /* "lin" */, IS_ZHUYIN|IS_PINYIN, 192},
+{"ㄋㄩ" /* "nv" */, IS_ZHUYIN|IS_PINYIN, 250},
+{"ㄊㄨㄟ" /* "tui" */, IS_ZHUYIN|IS_PINYIN, 357},
+{"ㄉㄧㄥ" /* "ding" */, IS_ZHUYIN|IS_PINYIN, 76},
+{"ㄐㄨㄟ" /* "zhui" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 430},
+{"ㄩㄝ" /* "yue" */, IS_ZHUYIN|IS_PINYIN, 400},
+{"ㄘㄨㄛ" /* "cuo" */, IS_ZHUYIN|IS_PINYIN, 59},
+{"ㄦ" /* "er" */, IS_ZHUYIN|IS_PINYIN, 89},
+{"ㄅㄢ" /* "ban" */, IS_ZHUYIN|IS_PINYIN, 9},
+{"ㄍ" /* "e" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 85},
+{"ㄖㄜ" /* "re" */, IS_ZHUYIN|IS_PINYIN, 291},
+{"ㄙㄨㄛ" /* "suo" */, IS_ZHUYIN|IS_PINYIN, 339},
+{"ㄔㄨㄟ" /* "chui" */, IS_ZHUYIN|IS_PINYIN, 49},
+{"ㄙㄨㄢ" /* "suan" */, IS_ZHUYIN|IS_PINYIN, 336},
+{"ㄉㄤ" /* "dang" */, IS_ZHUYIN|IS_PINYIN, 64},
+{"ㄒㄠ" /* "shao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 317},
+{"ㄅㄧ" /* "bi" */, IS_ZHUYIN|IS_PINYIN, 15},
+{"ㄏㄨㄢ" /* "huan" */, IS_ZHUYIN|IS_PINYIN, 136},
+{"ㄒ" /* "shi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 322},
+{"ㄍㄧㄥ" /* "jing" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_HSU, 149},
+{"ㄕㄨㄚ" /* "shua" */, IS_ZHUYIN|IS_PINYIN, 325},
+{"ㄇㄤ" /* "mang" */, IS_ZHUYIN|IS_PINYIN, 208},
+{"ㄒㄩ" /* "xu" */, IS_ZHUYIN|IS_PINYIN, 381}
+};
+
+const gint32 hsu_zhuyin_index_displacements[] = {
+-499,
+-490,
+-489,
+1,
+0,
+-488,
+-477,
+-475,
+0,
+-471,
+-460,
+1,
+0,
+0,
+1,
+0,
+0,
+1,
+0,
+-459,
+0,
+-454,
+1,
+0,
+5,
+1,
+-453,
+0,
+-451,
+0,
+-447,
+0,
+-444,
+0,
+1,
+-442,
+1,
+0,
+-441,
+0,
+0,
+1,
+-440,
+1,
+-438,
+1,
+2,
+-437,
+1,
+3,
+1,
+0,
+0,
+-434,
+0,
+1,
+-431,
+-426,
+0,
+0,
+-423,
+1,
+1,
+2,
+-422,
+3,
+-420,
+1,
+1,
+0,
+-419,
+0,
+0,
+-418,
+0,
+0,
+0,
+-412,
+0,
+-409,
+-407,
+-403,
+5,
+0,
+0,
+0,
+-398,
+-394,
+-391,
+1,
+-390,
+-388,
+-385,
+0,
+-384,
+-380,
+0,
+0,
+2,
+0,
+-378,
+-375,
+3,
+0,
+0,
+-371,
+1,
+0,
+0,
+-370,
+2,
+0,
+0,
+1,
+1,
+-369,
+1,
+-367,
+-366,
+-365,
+0,
+-364,
+1,
+0,
+-359,
+-358,
+0,
+1,
+0,
+0,
+1,
+0,
+0,
+1,
+0,
+0,
+1,
+3,
+1,
+0,
+-354,
+-352,
+3,
+3,
+0,
+-349,
+0,
+-346,
+0,
+0,
+0,
+-341,
+-340,
+2,
+3,
+-339,
+0,
+-337,
+-333,
+0,
+-330,
+0,
+0,
+0,
+1,
+4,
+-329,
+3,
+3,
+1,
+-328,
+0,
+0,
+0,
+0,
+-327,
+-325,
+-324,
+-323,
+0,
+-322,
+0,
+-321,
+0,
+2,
+-315,
+2,
+3,
+1,
+0,
+-307,
+0,
+1,
+0,
+0,
+0,
+-300,
+-294,
+-292,
+3,
+-289,
+-287,
+0,
+0,
+1,
+0,
+3,
+-285,
+5,
+-284,
+-283,
+1,
+-282,
+-281,
+3,
+0,
+-280,
+1,
+0,
+0,
+6,
+-272,
+0,
+0,
+2,
+1,
+0,
+0,
+3,
+2,
+-271,
+-270,
+2,
+-268,
+-267,
+1,
+-264,
+-259,
+-258,
+0,
+-252,
+1,
+-242,
+-241,
+-238,
+0,
+0,
+0,
+-237,
+0,
+-235,
+0,
+8,
+-233,
+0,
+1,
+6,
+-232,
+0,
+-230,
+-228,
+1,
+1,
+0,
+0,
+0,
+-226,
+0,
+-224,
+0,
+-222,
+-220,
+4,
+6,
+-218,
+0,
+-216,
+-215,
+-213,
+-211,
+-209,
+-206,
+0,
+1,
+-204,
+-198,
+0,
+2,
+-196,
+-194,
+0,
+0,
+0,
+-192,
+-191,
+-188,
+1,
+-185,
+-184,
+0,
+-181,
+-180,
+-174,
+2,
+0,
+4,
+2,
+4,
+-173,
+-171,
+-167,
+-166,
+0,
+0,
+0,
+12,
+-165,
+0,
+1,
+-164,
+-163,
+0,
+0,
+-162,
+-161,
+-156,
+0,
+1,
+18,
+-153,
+1,
+-149,
+0,
+1,
+-147,
+0,
+1,
+0,
+0,
+3,
+-146,
+-143,
+1,
+5,
+0,
+0,
+0,
+-142,
+3,
+-140,
+0,
+1,
+1,
+-139,
+6,
+2,
+-134,
+12,
+5,
+0,
+3,
+-133,
+-132,
+-128,
+1,
+0,
+0,
+1,
+1,
+-127,
+0,
+-126,
+3,
+7,
+-123,
+-121,
+9,
+0,
+-120,
+-116,
+0,
+3,
+-115,
+0,
+-113,
+-109,
+0,
+-108,
+-103,
+-102,
+-99,
+1,
+0,
+2,
+0,
+1,
+0,
+0,
+-96,
+-95,
+-93,
+0,
+-90,
+-87,
+0,
+3,
+1,
+3,
+0,
+0,
+0,
+0,
+0,
+-84,
+0,
+6,
+1,
+-82,
+0,
+1,
+0,
+-79,
+1,
+0,
+6,
+0,
+1,
+-76,
+-73,
+-72,
+2,
+0,
+0,
+-71,
+9,
+-66,
+-65,
+4,
+0,
+3,
+0,
+0,
+-63,
+-61,
+-55,
+0,
+-54,
+15,
+-53,
+1,
+0,
+0,
+0,
+-52,
+-51,
+2,
+0,
+0,
+0,
+-46,
+-45,
+7,
+-43,
+0,
+0,
+0,
+-42,
+5,
+0,
+0,
+2,
+6,
+8,
+-37,
+0,
+0,
+-36,
+-34,
+-28,
+1,
+0,
+0,
+0,
+3,
+0,
+-23,
+-15,
+-14,
+0,
+0,
+-13,
+-10,
+0,
+0,
+1,
+7,
+-6,
+-2,
+-1,
+0
+};
+
+const chewing_index_hash_t hsu_zhuyin_index_hash = {
+    hsu_zhuyin_index_hash_items, hsu_zhuyin_index_displacements,
+    G_N_ELEMENTS(hsu_zhuyin_index_hash_items)
+};
+
+const chewing_index_item_t eten26_zhuyin_index_hash_items[] = {
+{"ㄍㄩ" /* "qu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 283},
+{"ㄚ" /* "a" */, IS_ZHUYIN|IS_PINYIN, 1},
+{"ㄅㄛ" /* "bo" */, IS_ZHUYIN|IS_PINYIN, 21},
+{"ㄅㄨ" /* "bu" */, IS_ZHUYIN|IS_PINYIN, 22},
+{"ㄍㄩㄝ" /* "que" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 285},
+{"ㄍㄩㄥ" /* "qiong" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 281},
+{"ㄋ" /* "en" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 87},
+{"ㄅㄣ" /* "ben" */, IS_ZHUYIN|IS_PINYIN, 13},
+{"ㄒㄨㄛ" /* "shuo" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 331},
+{"ㄐㄧㄡ" /* "jiu" */, IS_ZHUYIN|IS_PINYIN, 151},
+{"ㄉㄧㄢ" /* "dian" */, IS_ZHUYIN|IS_PINYIN, 72},
+{"ㄋㄨㄢ" /* "nuan" */, IS_ZHUYIN|IS_PINYIN, 247},
+{"ㄕㄟ" /* "shei" */, IS_ZHUYIN|IS_PINYIN, 319},
+{"ㄊㄜ" /* "te" */, IS_ZHUYIN|IS_PINYIN, 346},
+{"ㄌㄥ" /* "leng" */, IS_ZHUYIN|IS_PINYIN, 185},
+{"ㄌㄩㄝ" /* "lve" */, IS_ZHUYIN|IS_PINYIN, 203},
+{"ㄐㄨㄣ" /* "zhun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 431},
+{"ㄏㄤ" /* "hang" */, IS_ZHUYIN|IS_PINYIN, 125},
+{"ㄘㄡ" /* "cou" */, IS_ZHUYIN|IS_PINYIN, 54},
+{"ㄎㄨㄟ" /* "kui" */, IS_ZHUYIN|IS_PINYIN, 173},
+{"ㄔㄨㄟ" /* "chui" */, IS_ZHUYIN|IS_PINYIN, 49},
+{"ㄍㄠ" /* "gao" */, IS_ZHUYIN|IS_PINYIN, 106},
+{"ㄍㄧㄥ" /* "qing" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 280},
+{"ㄉㄠ" /* "dao" */, IS_ZHUYIN|IS_PINYIN, 65},
+{"ㄒㄩㄝ" /* "xue" */, IS_ZHUYIN|IS_PINYIN, 383},
+{"ㄓㄨㄤ" /* "zhuang" */, IS_ZHUYIN|IS_PINYIN, 429},
+{"ㄌㄣ" /* "len" */, IS_ZHUYIN, 184},
+{"ㄑㄩ" /* "qu" */, IS_ZHUYIN|IS_PINYIN, 283},
+{"ㄓㄨㄥ" /* "zhong" */, IS_ZHUYIN|IS_PINYIN, 423},
+{"ㄌㄧㄝ" /* "lie" */, IS_ZHUYIN|IS_PINYIN, 191},
+{"ㄘㄢ" /* "can" */, IS_ZHUYIN|IS_PINYIN, 26},
+{"ㄈㄛ" /* "fo" */, IS_ZHUYIN|IS_PINYIN, 98},
+{"ㄒㄩㄢ" /* "xuan" */, IS_ZHUYIN|IS_PINYIN, 382},
+{"ㄐㄧㄤ" /* "jiang" */, IS_ZHUYIN|IS_PINYIN, 145},
+{"ㄐㄨㄥ" /* "zhong" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 423},
+{"ㄇㄨ" /* "mu" */, IS_ZHUYIN|IS_PINYIN, 223},
+{"ㄋㄩㄝ" /* "nve" */, IS_ZHUYIN|IS_PINYIN, 251},
+{"ㄋㄨㄛ" /* "nuo" */, IS_ZHUYIN|IS_PINYIN, 249},
+{"ㄒㄣ" /* "shen" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 320},
+{"ㄓㄡ" /* "zhou" */, IS_ZHUYIN|IS_PINYIN, 424},
+{"ㄉㄨㄟ" /* "dui" */, IS_ZHUYIN|IS_PINYIN, 82},
+{"ㄍㄧ" /* "qi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 273},
+{"ㄑㄩㄝ" /* "que" */, IS_ZHUYIN|IS_PINYIN, 285},
+{"ㄔㄨㄥ" /* "chong" */, IS_ZHUYIN|IS_PINYIN, 42},
+{"ㄌㄨㄛ" /* "luo" */, IS_ZHUYIN|IS_PINYIN, 201},
+{"ㄘㄨㄢ" /* "cuan" */, IS_ZHUYIN|IS_PINYIN, 56},
+{"ㄒㄧㄚ" /* "xia" */, IS_ZHUYIN|IS_PINYIN, 372},
+{"ㄏㄨ" /* "hu" */, IS_ZHUYIN|IS_PINYIN, 133},
+{"ㄔㄢ" /* "chan" */, IS_ZHUYIN|IS_PINYIN, 35},
+{"ㄇㄢ" /* "man" */, IS_ZHUYIN|IS_PINYIN, 207},
+{"ㄒㄠ" /* "shao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 317},
+{"ㄔㄡ" /* "chou" */, IS_ZHUYIN|IS_PINYIN, 43},
+{"ㄉㄥ" /* "deng" */, IS_ZHUYIN|IS_PINYIN, 69},
+{"ㄕㄜ" /* "she" */, IS_ZHUYIN|IS_PINYIN, 318},
+{"ㄧㄢ" /* "yan" */, IS_ZHUYIN|IS_PINYIN, 388},
+{"ㄘ" /* "ci" */, IS_ZHUYIN|IS_PINYIN, 52},
+{"ㄌㄨㄢ" /* "luan" */, IS_ZHUYIN|IS_PINYIN, 199},
+{"ㄎㄨㄤ" /* "kuang" */, IS_ZHUYIN|IS_PINYIN, 172},
+{"ㄎㄟ" /* "kei" */, IS_ZHUYIN, 163},
+{"ㄖㄨㄢ" /* "ruan" */, IS_ZHUYIN|IS_PINYIN, 299},
+{"ㄓㄨ" /* "zhu" */, IS_ZHUYIN|IS_PINYIN, 425},
+{"ㄊㄧㄢ" /* "tian" */, IS_ZHUYIN|IS_PINYIN, 349},
+{"ㄌㄨ" /* "lu" */, IS_ZHUYIN|IS_PINYIN, 198},
+{"ㄇㄤ" /* "mang" */, IS_ZHUYIN|IS_PINYIN, 208},
+{"ㄒㄨㄣ" /* "shun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 330},
+{"ㄙㄨㄣ" /* "sun" */, IS_ZHUYIN|IS_PINYIN, 338},
+{"ㄖㄨ" /* "ru" */, IS_ZHUYIN|IS_PINYIN, 297},
+{"ㄒㄨㄤ" /* "shuang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 328},
+{"ㄆㄞ" /* "pai" */, IS_ZHUYIN|IS_PINYIN, 256},
+{"ㄩ" /* "yu" */, IS_ZHUYIN|IS_PINYIN, 398},
+{"ㄧㄝ" /* "ye" */, IS_ZHUYIN|IS_PINYIN, 391},
+{"ㄌㄧㄡ" /* "liu" */, IS_ZHUYIN|IS_PINYIN, 194},
+{"ㄅㄤ" /* "bang" */, IS_ZHUYIN|IS_PINYIN, 10},
+{"ㄇㄧㄥ" /* "ming" */, IS_ZHUYIN|IS_PINYIN, 219},
+{"ㄋㄩ" /* "nv" */, IS_ZHUYIN|IS_PINYIN, 250},
+{"ㄕㄠ" /* "shao" */, IS_ZHUYIN|IS_PINYIN, 317},
+{"ㄐㄠ" /* "zhao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 417},
+{"ㄋㄡ" /* "nou" */, IS_ZHUYIN|IS_PINYIN, 245},
+{"ㄌㄧㄢ" /* "lian" */, IS_ZHUYIN|IS_PINYIN, 188},
+{"ㄧㄚ" /* "ya" */, IS_ZHUYIN|IS_PINYIN, 386},
+{"ㄓㄨㄢ" /* "zhuan" */, IS_ZHUYIN|IS_PINYIN, 428},
+{"ㄕㄨㄣ" /* "shun" */, IS_ZHUYIN|IS_PINYIN, 330},
+{"ㄐㄟ" /* "zhei" */, IS_ZHUYIN|ZHUYIN_CORRECT_ETEN26, 419},
+{"ㄐㄩ" /* "ju" */, IS_ZHUYIN|IS_PINYIN, 152},
+{"ㄅㄟ" /* "bei" */, IS_ZHUYIN|IS_PINYIN, 12},
+{"ㄌㄧㄥ" /* "ling" */, IS_ZHUYIN|IS_PINYIN, 193},
+{"ㄓㄟ" /* "zhei" */, IS_ZHUYIN, 419},
+{"ㄉㄧㄚ" /* "dia" */, IS_ZHUYIN|IS_PINYIN, 71},
+{"ㄋㄣ" /* "nen" */, IS_ZHUYIN|IS_PINYIN, 232},
+{"ㄊㄡ" /* "tou" */, IS_ZHUYIN|IS_PINYIN, 354},
+{"ㄧㄣ" /* "yin" */, IS_ZHUYIN|IS_PINYIN, 393},
+{"ㄎㄣ" /* "ken" */, IS_ZHUYIN|IS_PINYIN, 164},
+{"ㄖㄜ" /* "re" */, IS_ZHUYIN|IS_PINYIN, 291},
+{"ㄏㄟ" /* "hei" */, IS_ZHUYIN|IS_PINYIN, 128},
+{"ㄒㄧㄤ" /* "xiang" */, IS_ZHUYIN|IS_PINYIN, 374},
+{"ㄨㄛ" /* "wo" */, IS_ZHUYIN|IS_PINYIN, 368},
+{"ㄎㄡ" /* "kou" */, IS_ZHUYIN|IS_PINYIN, 167},
+{"ㄐㄣ" /* "zhen" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 420},
+{"ㄑㄩㄥ" /* "qiong" */, IS_ZHUYIN|IS_PINYIN, 281},
+{"ㄆㄧㄢ" /* "pian" */, IS_ZHUYIN|IS_PINYIN, 264},
+{"ㄏㄚ" /* "ha" */, IS_ZHUYIN|IS_PINYIN, 122},
+{"ㄍㄧㄡ" /* "qiu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 282},
+{"ㄏㄨㄞ" /* "huai" */, IS_ZHUYIN|IS_PINYIN, 135},
+{"ㄓㄞ" /* "zhai" */, IS_ZHUYIN|IS_PINYIN, 414},
+{"ㄐㄞ" /* "zhai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 414},
+{"ㄍㄜ" /* "ge" */, IS_ZHUYIN|IS_PINYIN, 107},
+{"ㄊㄤ" /* "tang" */, IS_ZHUYIN|IS_PINYIN, 344},
+{"ㄨㄟ" /* "wei" */, IS_ZHUYIN|IS_PINYIN, 365},
+{"ㄟ" /* "ei" */, IS_ZHUYIN|IS_PINYIN, 86},
+{"ㄆㄧ" /* "pi" */, IS_ZHUYIN|IS_PINYIN, 263},
+{"ㄙㄞ" /* "sai" */, IS_ZHUYIN|IS_PINYIN, 305},
+{"ㄨㄚ" /* "wa" */, IS_ZHUYIN|IS_PINYIN, 361},
+{"ㄎㄜ" /* "ke" */, IS_ZHUYIN|IS_PINYIN, 162},
+{"ㄘㄨㄥ" /* "cong" */, IS_ZHUYIN|IS_PINYIN, 53},
+{"ㄑㄧㄡ" /* "qiu" */, IS_ZHUYIN|IS_PINYIN, 282},
+{"ㄔ" /* "chi" */, IS_ZHUYIN|IS_PINYIN, 41},
+{"ㄋㄧㄣ" /* "nin" */, IS_ZHUYIN|IS_PINYIN, 241},
+{"ㄗㄨㄣ" /* "zun" */, IS_ZHUYIN|IS_PINYIN, 439},
+{"ㄆㄚ" /* "pa" */, IS_ZHUYIN|IS_PINYIN, 255},
+{"ㄍㄚ" /* "ga" */, IS_ZHUYIN|IS_PINYIN, 102},
+{"ㄩㄣ" /* "yun" */, IS_ZHUYIN|IS_PINYIN, 401},
+{"ㄏㄨㄤ" /* "huang" */, IS_ZHUYIN|IS_PINYIN, 137},
+{"ㄧㄡ" /* "you" */, IS_ZHUYIN|IS_PINYIN, 397},
+{"ㄆㄨ" /* "pu" */, IS_ZHUYIN|IS_PINYIN, 271},
+{"ㄊㄨㄥ" /* "tong" */, IS_ZHUYIN|IS_PINYIN, 353},
+{"ㄖ" /* "ri" */, IS_ZHUYIN|IS_PINYIN, 294},
+{"ㄍㄨㄢ" /* "guan" */, IS_ZHUYIN|IS_PINYIN, 116},
+{"ㄎㄥ" /* "keng" */, IS_ZHUYIN|IS_PINYIN, 165},
+{"ㄉㄟ" /* "dei" */, IS_ZHUYIN|IS_PINYIN, 67},
+{"ㄔㄤ" /* "chang" */, IS_ZHUYIN|IS_PINYIN, 36},
+{"ㄅㄧㄢ" /* "bian" */, IS_ZHUYIN|IS_PINYIN, 16},
+{"ㄉㄨㄥ" /* "dong" */, IS_ZHUYIN|IS_PINYIN, 78},
+{"ㄦ" /* "er" */, IS_ZHUYIN|IS_PINYIN, 89},
+{"ㄒㄜ" /* "she" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 318},
+{"ㄎㄠ" /* "kao" */, IS_ZHUYIN|IS_PINYIN, 161},
+{"ㄉㄧㄝ" /* "die" */, IS_ZHUYIN|IS_PINYIN, 74},
+{"ㄅㄢ" /* "ban" */, IS_ZHUYIN|IS_PINYIN, 9},
+{"ㄌ" /* "eng" */, IS_ZHUYIN|ZHUYIN_CORRECT_ETEN26, 88},
+{"ㄨㄢ" /* "wan" */, IS_ZHUYIN|IS_PINYIN, 363},
+{"ㄉ" /* "d" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 60},
+{"ㄍㄧㄝ" /* "qie" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 278},
+{"ㄆㄢ" /* "pan" */, IS_ZHUYIN|IS_PINYIN, 257},
+{"ㄋㄧㄝ" /* "nie" */, IS_ZHUYIN|IS_PINYIN, 240},
+{"ㄊ" /* "ang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 4},
+{"ㄉㄧㄡ" /* "diu" */, IS_ZHUYIN|IS_PINYIN, 77},
+{"ㄍㄧㄚ" /* "qia" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 274},
+{"ㄐㄩㄢ" /* "juan" */, IS_ZHUYIN|IS_PINYIN, 153},
+{"ㄋㄠ" /* "nao" */, IS_ZHUYIN|IS_PINYIN, 229},
+{"ㄇ" /* "an" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 3},
+{"ㄙㄨㄟ" /* "sui" */, IS_ZHUYIN|IS_PINYIN, 337},
+{"ㄖㄨㄛ" /* "ruo" */, IS_ZHUYIN|IS_PINYIN, 302},
+{"ㄑㄧㄠ" /* "qiao" */, IS_ZHUYIN|IS_PINYIN, 277},
+{"ㄖㄨㄣ" /* "run" */, IS_ZHUYIN|IS_PINYIN, 301},
+{"ㄎㄨㄢ" /* "kuan" */, IS_ZHUYIN|IS_PINYIN, 171},
+{"ㄐㄩㄥ" /* "jiong" */, IS_ZHUYIN|IS_PINYIN, 150},
+{"ㄉㄨ" /* "du" */, IS_ZHUYIN|IS_PINYIN, 80},
+{"ㄕㄞ" /* "shai" */, IS_ZHUYIN|IS_PINYIN, 314},
+{"ㄊㄧㄥ" /* "ting" */, IS_ZHUYIN|IS_PINYIN, 352},
+{"ㄑㄧㄥ" /* "qing" */, IS_ZHUYIN|IS_PINYIN, 280},
+{"ㄌㄨㄥ" /* "long" */, IS_ZHUYIN|IS_PINYIN, 196},
+{"ㄐㄨㄢ" /* "zhuan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 428},
+{"ㄏㄣ" /* "hen" */, IS_ZHUYIN|IS_PINYIN, 129},
+{"ㄎㄨㄞ" /* "kuai" */, IS_ZHUYIN|IS_PINYIN, 170},
+{"ㄍㄨ" /* "gu" */, IS_ZHUYIN|IS_PINYIN, 113},
+{"ㄙ" /* "si" */, IS_ZHUYIN|IS_PINYIN, 332},
+{"ㄌㄞ" /* "lai" */, IS_ZHUYIN|IS_PINYIN, 178},
+{"ㄉㄣ" /* "den" */, IS_ZHUYIN, 68},
+{"ㄕㄨㄟ" /* "shui" */, IS_ZHUYIN|IS_PINYIN, 329},
+{"ㄏㄡ" /* "hou" */, IS_ZHUYIN|IS_PINYIN, 132},
+{"ㄐㄨㄤ" /* "zhuang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 429},
+{"ㄓㄣ" /* "zhen" */, IS_ZHUYIN|IS_PINYIN, 420},
+{"ㄔㄨㄚ" /* "chua" */, IS_ZHUYIN, 45},
+{"ㄕㄨㄚ" /* "shua" */, IS_ZHUYIN|IS_PINYIN, 325},
+{"ㄒㄤ" /* "shang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 316},
+{"ㄒㄧㄡ" /* "xiu" */, IS_ZHUYIN|IS_PINYIN, 380},
+{"ㄉㄤ" /* "dang" */, IS_ZHUYIN|IS_PINYIN, 64},
+{"ㄙㄜ" /* "se" */, IS_ZHUYIN|IS_PINYIN, 309},
+{"ㄍㄨㄥ" /* "gong" */, IS_ZHUYIN|IS_PINYIN, 111},
+{"ㄍㄧㄣ" /* "qin" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 279},
+{"ㄍㄥ" /* "geng" */, IS_ZHUYIN|IS_PINYIN, 110},
+{"ㄐㄥ" /* "zheng" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 421},
+{"ㄓㄠ" /* "zhao" */, IS_ZHUYIN|IS_PINYIN, 417},
+{"ㄈㄜ" /* "fe" */, IS_ZHUYIN, 94},
+{"ㄊㄨㄟ" /* "tui" */, IS_ZHUYIN|IS_PINYIN, 357},
+{"ㄍㄣ" /* "gen" */, IS_ZHUYIN|IS_PINYIN, 109},
+{"ㄍㄧㄤ" /* "qiang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 276},
+{"ㄘㄤ" /* "cang" */, IS_ZHUYIN|IS_PINYIN, 27},
+{"ㄌㄠ" /* "lao" */, IS_ZHUYIN|IS_PINYIN, 181},
+{"ㄒㄧ" /* "xi" */, IS_ZHUYIN|IS_PINYIN, 371},
+{"ㄑㄧㄚ" /* "qia" */, IS_ZHUYIN|IS_PINYIN, 274},
+{"ㄙㄚ" /* "sa" */, IS_ZHUYIN|IS_PINYIN, 304},
+{"ㄌㄧ" /* "li" */, IS_ZHUYIN|IS_PINYIN, 186},
+{"ㄓㄥ" /* "zheng" */, IS_ZHUYIN|IS_PINYIN, 421},
+{"ㄘㄣ" /* "cen" */, IS_ZHUYIN|IS_PINYIN, 30},
+{"ㄑㄩㄣ" /* "qun" */, IS_ZHUYIN|IS_PINYIN, 286},
+{"ㄋㄚ" /* "na" */, IS_ZHUYIN|IS_PINYIN, 225},
+{"ㄔㄣ" /* "chen" */, IS_ZHUYIN|IS_PINYIN, 39},
+{"ㄐㄚ" /* "zha" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 413},
+{"ㄕㄨ" /* "shu" */, IS_ZHUYIN|IS_PINYIN, 324},
+{"ㄌㄩ" /* "lv" */, IS_ZHUYIN|IS_PINYIN, 202},
+{"ㄕㄨㄛ" /* "shuo" */, IS_ZHUYIN|IS_PINYIN, 331},
+{"ㄗㄨㄟ" /* "zui" */, IS_ZHUYIN|IS_PINYIN, 438},
+{"ㄘㄨㄣ" /* "cun" */, IS_ZHUYIN|IS_PINYIN, 58},
+{"ㄐㄨㄟ" /* "zhui" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 430},
+{"ㄗㄨ" /* "zu" */, IS_ZHUYIN|IS_PINYIN, 436},
+{"ㄊㄧ" /* "ti" */, IS_ZHUYIN|IS_PINYIN, 348},
+{"ㄏ" /* "er" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 89},
+{"ㄈㄡ" /* "fou" */, IS_ZHUYIN|IS_PINYIN, 99},
+{"ㄈㄢ" /* "fan" */, IS_ZHUYIN|IS_PINYIN, 92},
+{"ㄗㄢ" /* "zan" */, IS_ZHUYIN|IS_PINYIN, 405},
+{"ㄑㄩㄢ" /* "quan" */, IS_ZHUYIN|IS_PINYIN, 284},
+{"ㄕㄥ" /* "sheng" */, IS_ZHUYIN|IS_PINYIN, 321},
+{"ㄇㄡ" /* "mou" */, IS_ZHUYIN|IS_PINYIN, 222},
+{"ㄒㄨㄟ" /* "shui" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 329},
+{"ㄘㄨ" /* "cu" */, IS_ZHUYIN|IS_PINYIN, 55},
+{"ㄨ" /* "wu" */, IS_ZHUYIN|IS_PINYIN, 369},
+{"ㄙㄠ" /* "sao" */, IS_ZHUYIN|IS_PINYIN, 308},
+{"ㄐㄡ" /* "zhou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 424},
+{"ㄎㄨㄛ" /* "kuo" */, IS_ZHUYIN|IS_PINYIN, 175},
+{"ㄩㄝ" /* "yue" */, IS_ZHUYIN|IS_PINYIN, 400},
+{"ㄅㄠ" /* "bao" */, IS_ZHUYIN|IS_PINYIN, 11},
+{"ㄏㄠ" /* "hao" */, IS_ZHUYIN|IS_PINYIN, 126},
+{"ㄎㄞ" /* "kai" */, IS_ZHUYIN|IS_PINYIN, 158},
+{"ㄓㄨㄣ" /* "zhun" */, IS_ZHUYIN|IS_PINYIN, 431},
+{"ㄍㄨㄤ" /* "guang" */, IS_ZHUYIN|IS_PINYIN, 117},
+{"ㄘㄚ" /* "ca" */, IS_ZHUYIN|IS_PINYIN, 24},
+{"ㄖㄢ" /* "ran" */, IS_ZHUYIN|IS_PINYIN, 288},
+{"ㄒㄨㄢ" /* "shuan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 327},
+{"ㄌㄧㄣ" /* "lin" */, IS_ZHUYIN|IS_PINYIN, 192},
+{"ㄇㄧㄢ" /* "mian" */, IS_ZHUYIN|IS_PINYIN, 215},
+{"ㄒㄧㄠ" /* "xiao" */, IS_ZHUYIN|IS_PINYIN, 375},
+{"ㄆㄟ" /* "pei" */, IS_ZHUYIN|IS_PINYIN, 260},
+{"ㄊㄧㄠ" /* "tiao" */, IS_ZHUYIN|IS_PINYIN, 350},
+{"ㄓㄨㄚ" /* "zhua" */, IS_ZHUYIN|IS_PINYIN, 426},
+{"ㄆㄧㄥ" /* "ping" */, IS_ZHUYIN|IS_PINYIN, 268},
+{"ㄅㄞ" /* "bai" */, IS_ZHUYIN|IS_PINYIN, 8},
+{"ㄒㄧㄥ" /* "xing" */, IS_ZHUYIN|IS_PINYIN, 378},
+{"ㄋㄨ" /* "nu" */, IS_ZHUYIN|IS_PINYIN, 246},
+{"ㄗㄡ" /* "zou" */, IS_ZHUYIN|IS_PINYIN, 435},
+{"ㄕㄢ" /* "shan" */, IS_ZHUYIN|IS_PINYIN, 315},
+{"ㄓㄨㄟ" /* "zhui" */, IS_ZHUYIN|IS_PINYIN, 430},
+{"ㄜ" /* "e" */, IS_ZHUYIN|IS_PINYIN, 85},
+{"ㄌㄧㄚ" /* "lia" */, IS_ZHUYIN|IS_PINYIN, 187},
+{"ㄆ" /* "ou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 253},
+{"ㄋㄥ" /* "neng" */, IS_ZHUYIN|IS_PINYIN, 233},
+{"ㄆㄧㄠ" /* "piao" */, IS_ZHUYIN|IS_PINYIN, 265},
+{"ㄗㄚ" /* "za" */, IS_ZHUYIN|IS_PINYIN, 403},
+{"ㄅㄧㄣ" /* "bin" */, IS_ZHUYIN|IS_PINYIN, 19},
+{"ㄘㄨㄛ" /* "cuo" */, IS_ZHUYIN|IS_PINYIN, 59},
+{"ㄇㄟ" /* "mei" */, IS_ZHUYIN|IS_PINYIN, 211},
+{"ㄋㄟ" /* "nei" */, IS_ZHUYIN|IS_PINYIN, 231},
+{"ㄊㄚ" /* "ta" */, IS_ZHUYIN|IS_PINYIN, 341},
+{"ㄊㄢ" /* "tan" */, IS_ZHUYIN|IS_PINYIN, 343},
+{"ㄞ" /* "ai" */, IS_ZHUYIN|IS_PINYIN, 2},
+{"ㄆㄤ" /* "pang" */, IS_ZHUYIN|IS_PINYIN, 258},
+{"ㄔㄨㄤ" /* "chuang" */, IS_ZHUYIN|IS_PINYIN, 48},
+{"ㄋㄧㄤ" /* "niang" */, IS_ZHUYIN|IS_PINYIN, 238},
+{"ㄑㄧㄣ" /* "qin" */, IS_ZHUYIN|IS_PINYIN, 279},
+{"ㄕㄡ" /* "shou" */, IS_ZHUYIN|IS_PINYIN, 323},
+{"ㄐㄨㄞ" /* "zhuai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 427},
+{"ㄇㄜ" /* "me" */, IS_ZHUYIN|IS_PINYIN, 210},
+{"ㄋㄧㄡ" /* "niu" */, IS_ZHUYIN|IS_PINYIN, 243},
+{"ㄋㄧㄢ" /* "nian" */, IS_ZHUYIN|IS_PINYIN, 237},
+{"ㄏㄨㄢ" /* "huan" */, IS_ZHUYIN|IS_PINYIN, 136},
+{"ㄔㄠ" /* "chao" */, IS_ZHUYIN|IS_PINYIN, 37},
+{"ㄒㄩㄥ" /* "xiong" */, IS_ZHUYIN|IS_PINYIN, 379},
+{"ㄊㄨ" /* "tu" */, IS_ZHUYIN|IS_PINYIN, 355},
+{"ㄆㄛ" /* "po" */, IS_ZHUYIN|IS_PINYIN, 269},
+{"ㄍㄟ" /* "gei" */, IS_ZHUYIN|IS_PINYIN, 108},
+{"ㄏㄨㄥ" /* "hong" */, IS_ZHUYIN|IS_PINYIN, 131},
+{"ㄡ" /* "ou" */, IS_ZHUYIN|IS_PINYIN, 253},
+{"ㄠ" /* "ao" */, IS_ZHUYIN|IS_PINYIN, 5},
+{"ㄏㄨㄚ" /* "hua" */, IS_ZHUYIN|IS_PINYIN, 134},
+{"ㄊㄨㄢ" /* "tuan" */, IS_ZHUYIN|IS_PINYIN, 356},
+{"ㄑ" /* "q" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 272},
+{"ㄗㄞ" /* "zai" */, IS_ZHUYIN|IS_PINYIN, 404},
+{"ㄍㄨㄣ" /* "gun" */, IS_ZHUYIN|IS_PINYIN, 119},
+{"ㄧㄥ" /* "ying" */, IS_ZHUYIN|IS_PINYIN, 394},
+{"ㄎㄨ" /* "ku" */, IS_ZHUYIN|IS_PINYIN, 168},
+{"ㄉㄞ" /* "dai" */, IS_ZHUYIN|IS_PINYIN, 62},
+{"ㄉㄨㄣ" /* "dun" */, IS_ZHUYIN|IS_PINYIN, 83},
+{"ㄒㄧㄢ" /* "xian" */, IS_ZHUYIN|IS_PINYIN, 373},
+{"ㄔㄨ" /* "chu" */, IS_ZHUYIN|IS_PINYIN, 44},
+{"ㄩㄢ" /* "yuan" */, IS_ZHUYIN|IS_PINYIN, 399},
+{"ㄌㄚ" /* "la" */, IS_ZHUYIN|IS_PINYIN, 177},
+{"ㄧㄠ" /* "yao" */, IS_ZHUYIN|IS_PINYIN, 390},
+{"ㄘㄨㄟ" /* "cui" */, IS_ZHUYIN|IS_PINYIN, 57},
+{"ㄓ" /* "zhi" */, IS_ZHUYIN|IS_PINYIN, 422},
+{"ㄏㄥ" /* "heng" */, IS_ZHUYIN|IS_PINYIN, 130},
+{"ㄒㄚ" /* "sha" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 313},
+{"ㄕㄨㄤ" /* "shuang" */, IS_ZHUYIN|IS_PINYIN, 328},
+{"ㄒ" /* "shi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 322},
+{"ㄨㄤ" /* "wang" */, IS_ZHUYIN|IS_PINYIN, 364},
+{"ㄙㄤ" /* "sang" */, IS_ZHUYIN|IS_PINYIN, 307},
+{"ㄔㄚ" /* "cha" */, IS_ZHUYIN|IS_PINYIN, 33},
+{"ㄐㄩㄝ" /* "jue" */, IS_ZHUYIN|IS_PINYIN, 154},
+{"ㄍㄨㄞ" /* "guai" */, IS_ZHUYIN|IS_PINYIN, 115},
+{"ㄨㄣ" /* "wen" */, IS_ZHUYIN|IS_PINYIN, 366},
+{"ㄕㄨㄞ" /* "shuai" */, IS_ZHUYIN|IS_PINYIN, 326},
+{"ㄓㄨㄛ" /* "zhuo" */, IS_ZHUYIN|IS_PINYIN, 432},
+{"ㄑㄧㄝ" /* "qie" */, IS_ZHUYIN|IS_PINYIN, 278},
+{"ㄆㄠ" /* "pao" */, IS_ZHUYIN|IS_PINYIN, 259},
+{"ㄙㄥ" /* "seng" */, IS_ZHUYIN|IS_PINYIN, 311},
+{"ㄈ" /* "f" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 90},
+{"ㄉㄧㄣ" /* "din" */, IS_ZHUYIN, 75},
+{"ㄔㄜ" /* "che" */, IS_ZHUYIN|IS_PINYIN, 38},
+{"ㄓㄨㄞ" /* "zhuai" */, IS_ZHUYIN|IS_PINYIN, 427},
+{"ㄓㄜ" /* "zhe" */, IS_ZHUYIN|IS_PINYIN, 418},
+{"ㄖㄨㄥ" /* "rong" */, IS_ZHUYIN|IS_PINYIN, 295},
+{"ㄆㄣ" /* "pen" */, IS_ZHUYIN|IS_PINYIN, 261},
+{"ㄉㄨㄛ" /* "duo" */, IS_ZHUYIN|IS_PINYIN, 84},
+{"ㄋㄢ" /* "nan" */, IS_ZHUYIN|IS_PINYIN, 227},
+{"ㄇㄛ" /* "mo" */, IS_ZHUYIN|IS_PINYIN, 221},
+{"ㄖㄨㄚ" /* "rua" */, IS_ZHUYIN, 298},
+{"ㄐㄧㄚ" /* "jia" */, IS_ZHUYIN|IS_PINYIN, 143},
+{"ㄅ" /* "b" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 6},
+{"ㄉㄧㄠ" /* "diao" */, IS_ZHUYIN|IS_PINYIN, 73},
+{"ㄏㄞ" /* "hai" */, IS_ZHUYIN|IS_PINYIN, 123},
+{"ㄇㄧ" /* "mi" */, IS_ZHUYIN|IS_PINYIN, 214},
+{"ㄙㄨㄛ" /* "suo" */, IS_ZHUYIN|IS_PINYIN, 339},
+{"ㄕㄤ" /* "shang" */, IS_ZHUYIN|IS_PINYIN, 316},
+{"ㄍㄨㄚ" /* "gua" */, IS_ZHUYIN|IS_PINYIN, 114},
+{"ㄐㄩㄣ" /* "jun" */, IS_ZHUYIN|IS_PINYIN, 155},
+{"ㄐㄤ" /* "zhang" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 416},
+{"ㄇㄧㄡ" /* "miu" */, IS_ZHUYIN|IS_PINYIN, 220},
+{"ㄇㄧㄝ" /* "mie" */, IS_ZHUYIN|IS_PINYIN, 217},
+{"ㄖㄡ" /* "rou" */, IS_ZHUYIN|IS_PINYIN, 296},
+{"ㄋㄧ" /* "ni" */, IS_ZHUYIN|IS_PINYIN, 235},
+{"ㄐㄧㄠ" /* "jiao" */, IS_ZHUYIN|IS_PINYIN, 146},
+{"ㄒㄩ" /* "xu" */, IS_ZHUYIN|IS_PINYIN, 381},
+{"ㄌㄨㄣ" /* "lun" */, IS_ZHUYIN|IS_PINYIN, 200},
+{"ㄋㄧㄚ" /* "nia" */, IS_ZHUYIN, 236},
+{"ㄘㄠ" /* "cao" */, IS_ZHUYIN|IS_PINYIN, 28},
+{"ㄍㄤ" /* "gang" */, IS_ZHUYIN|IS_PINYIN, 105},
+{"ㄏㄨㄟ" /* "hui" */, IS_ZHUYIN|IS_PINYIN, 138},
+{"ㄐㄧㄣ" /* "jin" */, IS_ZHUYIN|IS_PINYIN, 148},
+{"ㄫ" /* "ng" */, IS_ZHUYIN|IS_PINYIN, 234},
+{"ㄒㄨㄚ" /* "shua" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 325},
+{"ㄊㄨㄛ" /* "tuo" */, IS_ZHUYIN|IS_PINYIN, 359},
+{"ㄊㄥ" /* "teng" */, IS_ZHUYIN|IS_PINYIN, 347},
+{"ㄌㄢ" /* "lan" */, IS_ZHUYIN|IS_PINYIN, 179},
+{"ㄍㄧㄢ" /* "qian" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 275},
+{"ㄍㄩㄢ" /* "quan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 284},
+{"ㄈㄟ" /* "fei" */, IS_ZHUYIN|IS_PINYIN, 95},
+{"ㄘㄞ" /* "cai" */, IS_ZHUYIN|IS_PINYIN, 25},
+{"ㄖㄠ" /* "rao" */, IS_ZHUYIN|IS_PINYIN, 290},
+{"ㄌㄜ" /* "le" */, IS_ZHUYIN|IS_PINYIN, 182},
+{"ㄍㄢ" /* "gan" */, IS_ZHUYIN|IS_PINYIN, 104},
+{"ㄕㄚ" /* "sha" */, IS_ZHUYIN|IS_PINYIN, 313},
+{"ㄘㄥ" /* "ceng" */, IS_ZHUYIN|IS_PINYIN, 31},
+{"ㄈㄚ" /* "fa" */, IS_ZHUYIN|IS_PINYIN, 91},
+{"ㄋㄜ" /* "ne" */, IS_ZHUYIN|IS_PINYIN, 230},
+{"ㄏㄢ" /* "han" */, IS_ZHUYIN|IS_PINYIN, 124},
+{"ㄉㄡ" /* "dou" */, IS_ZHUYIN|IS_PINYIN, 79},
+{"ㄍㄨㄛ" /* "guo" */, IS_ZHUYIN|IS_PINYIN, 120},
+{"ㄌㄟ" /* "lei" */, IS_ZHUYIN|IS_PINYIN, 183},
+{"ㄐㄧㄥ" /* "jing" */, IS_ZHUYIN|IS_PINYIN, 149},
+{"ㄇㄧㄣ" /* "min" */, IS_ZHUYIN|IS_PINYIN, 218},
+{"ㄙㄨ" /* "su" */, IS_ZHUYIN|IS_PINYIN, 335},
+{"ㄖㄨㄟ" /* "rui" */, IS_ZHUYIN|IS_PINYIN, 300},
+{"ㄔㄨㄛ" /* "chuo" */, IS_ZHUYIN|IS_PINYIN, 51},
+{"ㄏㄜ" /* "he" */, IS_ZHUYIN|IS_PINYIN, 127},
+{"ㄉㄧㄥ" /* "ding" */, IS_ZHUYIN|IS_PINYIN, 76},
+{"ㄐㄧㄢ" /* "jian" */, IS_ZHUYIN|IS_PINYIN, 144},
+{"ㄩㄥ" /* "yong" */, IS_ZHUYIN|IS_PINYIN, 396},
+{"ㄒㄧㄝ" /* "xie" */, IS_ZHUYIN|IS_PINYIN, 376},
+{"ㄒㄢ" /* "shan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 315},
+{"ㄓㄢ" /* "zhan" */, IS_ZHUYIN|IS_PINYIN, 415},
+{"ㄇㄣ" /* "men" */, IS_ZHUYIN|IS_PINYIN, 212},
+{"ㄎ" /* "k" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 156},
+{"ㄒㄥ" /* "sheng" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 321},
+{"ㄗㄨㄛ" /* "zuo" */, IS_ZHUYIN|IS_PINYIN, 440},
+{"ㄉㄧ" /* "di" */, IS_ZHUYIN|IS_PINYIN, 70},
+{"ㄅㄧㄝ" /* "bie" */, IS_ZHUYIN|IS_PINYIN, 18},
+{"ㄌㄡ" /* "lou" */, IS_ZHUYIN|IS_PINYIN, 197},
+{"ㄇㄠ" /* "mao" */, IS_ZHUYIN|IS_PINYIN, 209},
+{"ㄊㄞ" /* "tai" */, IS_ZHUYIN|IS_PINYIN, 342},
+{"ㄋㄨㄣ" /* "nun" */, IS_ZHUYIN, 248},
+{"ㄈㄤ" /* "fang" */, IS_ZHUYIN|IS_PINYIN, 93},
+{"ㄍㄡ" /* "gou" */, IS_ZHUYIN|IS_PINYIN, 112},
+{"ㄔㄨㄣ" /* "chun" */, IS_ZHUYIN|IS_PINYIN, 50},
+{"ㄎㄨㄚ" /* "kua" */, IS_ZHUYIN|IS_PINYIN, 169},
+{"ㄌㄧㄠ" /* "liao" */, IS_ZHUYIN|IS_PINYIN, 190},
+{"ㄓㄤ" /* "zhang" */, IS_ZHUYIN|IS_PINYIN, 416},
+{"ㄙㄨㄢ" /* "suan" */, IS_ZHUYIN|IS_PINYIN, 336},
+{"ㄒㄡ" /* "shou" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 323},
+{"ㄈㄣ" /* "fen" */, IS_ZHUYIN|IS_PINYIN, 96},
+{"ㄎㄨㄥ" /* "kong" */, IS_ZHUYIN|IS_PINYIN, 166},
+{"ㄧㄞ" /* "yai" */, IS_ZHUYIN, 387},
+{"ㄐㄨㄛ" /* "zhuo" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 432},
+{"ㄅㄥ" /* "beng" */, IS_ZHUYIN|IS_PINYIN, 14},
+{"ㄋㄨㄥ" /* "nong" */, IS_ZHUYIN|IS_PINYIN, 244},
+{"ㄈㄨ" /* "fu" */, IS_ZHUYIN|IS_PINYIN, 100},
+{"ㄐㄧㄝ" /* "jie" */, IS_ZHUYIN|IS_PINYIN, 147},
+{"ㄉㄚ" /* "da" */, IS_ZHUYIN|IS_PINYIN, 61},
+{"ㄈㄥ" /* "feng" */, IS_ZHUYIN|IS_PINYIN, 97},
+{"ㄗㄤ" /* "zang" */, IS_ZHUYIN|IS_PINYIN, 406},
+{"ㄒㄨㄞ" /* "shuai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 326},
+{"ㄧㄛ" /* "yo" */, IS_ZHUYIN|IS_PINYIN, 395},
+{"ㄖㄥ" /* "reng" */, IS_ZHUYIN|IS_PINYIN, 293},
+{"ㄕㄨㄢ" /* "shuan" */, IS_ZHUYIN|IS_PINYIN, 327},
+{"ㄗㄠ" /* "zao" */, IS_ZHUYIN|IS_PINYIN, 407},
+{"ㄐㄨ" /* "zhu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 425},
+{"ㄘㄜ" /* "ce" */, IS_ZHUYIN|IS_PINYIN, 29},
+{"ㄌㄧㄤ" /* "liang" */, IS_ZHUYIN|IS_PINYIN, 189},
+{"ㄇㄧㄠ" /* "miao" */, IS_ZHUYIN|IS_PINYIN, 216},
+{"ㄙㄣ" /* "sen" */, IS_ZHUYIN|IS_PINYIN, 310},
+{"ㄋㄤ" /* "nang" */, IS_ZHUYIN|IS_PINYIN, 228},
+{"ㄊㄠ" /* "tao" */, IS_ZHUYIN|IS_PINYIN, 345},
+{"ㄐㄧ" /* "ji" */, IS_ZHUYIN|IS_PINYIN, 142},
+{"ㄎㄢ" /* "kan" */, IS_ZHUYIN|IS_PINYIN, 159},
+{"ㄕㄣ" /* "shen" */, IS_ZHUYIN|IS_PINYIN, 320},
+{"ㄗㄟ" /* "zei" */, IS_ZHUYIN|IS_PINYIN, 409},
+{"ㄙㄨㄥ" /* "song" */, IS_ZHUYIN|IS_PINYIN, 333},
+{"ㄖㄣ" /* "ren" */, IS_ZHUYIN|IS_PINYIN, 292},
+{"ㄥ" /* "eng" */, IS_ZHUYIN, 88},
+{"ㄐㄢ" /* "zhan" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 415},
+{"ㄒㄟ" /* "shei" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 319},
+{"ㄅㄧ" /* "bi" */, IS_ZHUYIN|IS_PINYIN, 15},
+{"ㄋㄧㄥ" /* "ning" */, IS_ZHUYIN|IS_PINYIN, 242},
+{"ㄗㄨㄥ" /* "zong" */, IS_ZHUYIN|IS_PINYIN, 434},
+{"ㄒㄩㄣ" /* "xun" */, IS_ZHUYIN|IS_PINYIN, 384},
+{"ㄎㄚ" /* "ka" */, IS_ZHUYIN|IS_PINYIN, 157},
+{"ㄒㄧㄣ" /* "xin" */, IS_ZHUYIN|IS_PINYIN, 377},
+{"ㄍㄩㄣ" /* "qun" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 286},
+{"ㄊㄧㄝ" /* "tie" */, IS_ZHUYIN|IS_PINYIN, 351},
+{"ㄌㄛ" /* "lo" */, IS_ZHUYIN|IS_PINYIN, 195},
+{"ㄢ" /* "an" */, IS_ZHUYIN|IS_PINYIN, 3},
+{"ㄊㄨㄣ" /* "tun" */, IS_ZHUYIN|IS_PINYIN, 358},
+{"ㄐㄨㄚ" /* "zhua" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 426},
+{"ㄐㄜ" /* "zhe" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 418},
+{"ㄍㄞ" /* "gai" */, IS_ZHUYIN|IS_PINYIN, 103},
+{"ㄓㄚ" /* "zha" */, IS_ZHUYIN|IS_PINYIN, 413},
+{"ㄗㄜ" /* "ze" */, IS_ZHUYIN|IS_PINYIN, 408},
+{"ㄧ" /* "yi" */, IS_ZHUYIN|IS_PINYIN, 392},
+{"ㄏㄨㄛ" /* "huo" */, IS_ZHUYIN|IS_PINYIN, 140},
+{"ㄗㄨㄢ" /* "zuan" */, IS_ZHUYIN|IS_PINYIN, 437},
+{"ㄆㄥ" /* "peng" */, IS_ZHUYIN|IS_PINYIN, 262},
+{"ㄖㄤ" /* "rang" */, IS_ZHUYIN|IS_PINYIN, 289},
+{"ㄔㄨㄞ" /* "chuai" */, IS_ZHUYIN|IS_PINYIN, 46},
+{"ㄅㄧㄥ" /* "bing" */, IS_ZHUYIN|IS_PINYIN, 20},
+{"ㄤ" /* "ang" */, IS_ZHUYIN|IS_PINYIN, 4},
+{"ㄙㄡ" /* "sou" */, IS_ZHUYIN|IS_PINYIN, 334},
+{"ㄉㄨㄢ" /* "duan" */, IS_ZHUYIN|IS_PINYIN, 81},
+{"ㄅㄚ" /* "ba" */, IS_ZHUYIN|IS_PINYIN, 7},
+{"ㄆㄧㄣ" /* "pin" */, IS_ZHUYIN|IS_PINYIN, 267},
+{"ㄌㄤ" /* "lang" */, IS_ZHUYIN|IS_PINYIN, 180},
+{"ㄆㄧㄝ" /* "pie" */, IS_ZHUYIN|IS_PINYIN, 266},
+{"ㄛ" /* "o" */, IS_ZHUYIN|IS_PINYIN, 252},
+{"ㄙㄢ" /* "san" */, IS_ZHUYIN|IS_PINYIN, 306},
+{"ㄉㄢ" /* "dan" */, IS_ZHUYIN|IS_PINYIN, 63},
+{"ㄒㄨ" /* "shu" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 324},
+{"ㄔㄥ" /* "cheng" */, IS_ZHUYIN|IS_PINYIN, 40},
+{"ㄨㄞ" /* "wai" */, IS_ZHUYIN|IS_PINYIN, 362},
+{"ㄇㄞ" /* "mai" */, IS_ZHUYIN|IS_PINYIN, 206},
+{"ㄋㄞ" /* "nai" */, IS_ZHUYIN|IS_PINYIN, 226},
+{"ㄅㄧㄠ" /* "biao" */, IS_ZHUYIN|IS_PINYIN, 17},
+{"ㄑㄧㄢ" /* "qian" */, IS_ZHUYIN|IS_PINYIN, 275},
+{"ㄋㄧㄠ" /* "niao" */, IS_ZHUYIN|IS_PINYIN, 239},
+{"ㄍㄨㄟ" /* "gui" */, IS_ZHUYIN|IS_PINYIN, 118},
+{"ㄏㄨㄣ" /* "hun" */, IS_ZHUYIN|IS_PINYIN, 139},
+{"ㄗ" /* "zi" */, IS_ZHUYIN|IS_PINYIN, 433},
+{"ㄑㄧ" /* "qi" */, IS_ZHUYIN|IS_PINYIN, 273},
+{"ㄑㄧㄤ" /* "qiang" */, IS_ZHUYIN|IS_PINYIN, 276},
+{"ㄎㄤ" /* "kang" */, IS_ZHUYIN|IS_PINYIN, 160},
+{"ㄗㄥ" /* "zeng" */, IS_ZHUYIN|IS_PINYIN, 411},
+{"ㄍㄧㄠ" /* "qiao" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 277},
+{"ㄉㄜ" /* "de" */, IS_ZHUYIN|IS_PINYIN, 66},
+{"ㄔㄨㄢ" /* "chuan" */, IS_ZHUYIN|IS_PINYIN, 47},
+{"ㄐ" /* "zhi" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 422},
+{"ㄧㄤ" /* "yang" */, IS_ZHUYIN|IS_PINYIN, 389},
+{"ㄍ" /* "g" */, IS_ZHUYIN|IS_PINYIN|PINYIN_INCOMPLETE|ZHUYIN_INCOMPLETE, 101},
+{"ㄎㄨㄣ" /* "kun" */, IS_ZHUYIN|IS_PINYIN, 174},
+{"ㄨㄥ" /* "weng" */, IS_ZHUYIN|IS_PINYIN, 367},
+{"ㄒㄞ" /* "shai" */, IS_ZHUYIN|IS_PINYIN|ZHUYIN_CORRECT_ETEN26, 314},
+{"ㄇㄚ" /* "ma" */, IS_ZHUYIN|IS_PINYIN, 205},
+{"ㄕ" /* "shi" */, IS_ZHUYIN|IS_PINYIN, 322},
+{"ㄇㄥ" /* "meng" */, IS_ZHUYIN|IS_PINYIN, 213},
+{"ㄣ" /* "en" */, IS_ZHUYIN|IS_PINYIN, 87},
+{"ㄗㄣ" /* "zen" */, IS_ZHUYIN|IS_PINYIN, 410},
+{"ㄔㄞ" /* "chai" */, IS_ZHUYIN|IS_PINYIN, 34},
+{"ㄆㄡ" /* "pou" */, IS_ZHUYIN|IS_PINYIN, 270}
+};
+
+const gint32 eten26_zhuyin_index_displacements[] = {
+-482,
+-481,
+0,
+0,
+1,
+0,
+0,
+-475,
+0,
+1,
+-474,
+-472,
+0,
+0,
+0,
+0,
+-471,
+0,
+1,
+0,
+0,
+0,
+-468,
+-465,
+3,
+-462,
+-461,
+0,
+0,
+2,
+0,
+0,
+1,
+0,
+0,
+0,
+-459,
+1,
+-458,
+1,
+-456,
+0,
+0,
+0,
+-455,
+0,
+7,
+-454,
+2,
+0,
+0,
+0,
+-445,
+1,
+0,
+-441,
+-434,
+0,
+0,
+0,
+-433,
+0,
+1,
+3,
+-424,
+-423,
+-415,
+0,
+-414,
+5,
+-406,
+1,
+4,
+6,
+0,
+-404,
+1,
+1,
+0,
+1,
+-400,
+-399,
+1,
+3,
+-398,
+0,
+-397,
+-391,
+-389,
+2,
+4,
+0,
+0,
+0,
+1,
+0,
+1,
+-388,
+-387,
+3,
+0,
+15,
+-384,
+-380,
+0,
+-379,
+0,
+0,
+-375,
+0,
+1,
+-374,
+2,
+-373,
+-371,
+1,
+-368,
+0,
+0,
+1,
+2,
+-367,
+-356,
+0,
+0,
+0,
+1,
+-354,
+-353,
+3,
+2,
+0,
+-349,
+-333,
+0,
+5,
+-332,
+1,
+0,
+0,
+1,
+0,
+-330,
+0,
+1,
+1,
+3,
+-328,
+0,
+-326,
+-323,
+-319,
+-317,
+-316,
+-312,
+0,
+-310,
+-306,
+0,
+-305,
+-304,
+1,
+0,
+-302,
+0,
+0,
+-298,
+1,
+1,
+0,
+0,
+-295,
+2,
+-293,
+-292,
+-291,
+0,
+-290,
+-280,
+-278,
+-277,
+-275,
+-270,
+0,
+0,
+0,
+-268,
+1,
+3,
+-264,
+0,
+0,
+-263,
+13,
+3,
+3,
+1,
+0,
+0,
+-262,
+-261,
+-258,
+-254,
+-251,
+2,
+0,
+0,
+-250,
+0,
+-249,
+1,
+-248,
+-247,
+0,
+0,
+5,
+0,
+-246,
+0,
+-243,
+-237,
+0,
+-236,
+0,
+-235,
+3,
+-230,
+2,
+0,
+-227,
+0,
+-226,
+4,
+3,
+-224,
+-223,
+-221,
+0,
+-218,
+2,
+0,
+0,
+9,
+3,
+0,
+1,
+-216,
+-214,
+4,
+4,
+3,
+0,
+1,
+-212,
+-208,
+0,
+-205,
+-204,
+0,
+1,
+-199,
+1,
+-197,
+0,
+1,
+-193,
+-190,
+0,
+11,
+0,
+-189,
+-188,
+-182,
+-180,
+0,
+1,
+-176,
+-174,
+-172,
+-171,
+-170,
+0,
+-168,
+-167,
+1,
+-166,
+-163,
+0,
+0,
+4,
+0,
+-162,
+2,
+4,
+-161,
+0,
+1,
+0,
+0,
+-160,
+1,
+0,
+-157,
+1,
+-156,
+2,
+-155,
+2,
+0,
+-149,
+-148,
+0,
+0,
+-147,
+1,
+-145,
+-144,
+1,
+0,
+-142,
+0,
+-141,
+0,
+-140,
+0,
+0,
+3,
+0,
+1,
+-139,
+-138,
+1,
+0,
+-134,
+-132,
+5,
+0,
+2,
+0,
+0,
+0,
+-129,
+-128,
+-127,
+-126,
+-122,
+0,
+0,
+2,
+-119,
+0,
+1,
+0,
+0,
+0,
+-117,
+1,
+-115,
+11,
+-112,
+-111,
+0,
+0,
+0,
+0,
+-109,
+-108,
+0,
+0,
+0,
+0,
+0,
+-104,
+-100,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+1,
+-95,
+0,
+-85,
+0,
+0,
+1,
+2,
+18,
+0,
+2,
+0,
+0,
+1,
+5,
+-81,
+1,
+0,
+-80,
+-77,
+-76,
+-74,
+0,
+4,
+-73,
+-71,
+6,
+-70,
+0,
+30,
+-68,
+-63,
+-61,
+1,
+-58,
+0,
+-52,
+0,
+2,
+0,
+1,
+0,
+3,
+-49,
+-48,
+6,
+0,
+-42,
+0,
+5,
+-41,
+0,
+6,
+-40,
+0,
+0,
+1,
+1,
+-39,
+9,
+0,
+-35,
+-25,
+5,
+-24,
+7,
+1,
+-20,
+0,
+0,
+-19,
+0,
+-18,
+1,
+1,
+-17,
+0,
+1,
+0,
+-14,
+0,
+1,
+0,
+-13,
+0,
+0,
+0,
+0,
+0,
+0,
+0,
+2,
+0,
+0,
+0,
+-12,
+-11,
+-7,
+12,
+-5
+};
+
+const chewing_index_hash_t eten26_zhuyin_index_hash = {
+    eten26_zhuyin_index_hash_items, eten26_zhuyin_index_displacements,
+    G_N_ELEMENTS(eten26_zhuyin_index_hash_items)
+};
+
 const content_table_item_t content_table[] = {
 {"", "", "", "", "", "", ChewingKey()},
 {"a", "", "a", "ㄚ", "a", "a", ChewingKey(CHEWING_ZERO_INITIAL, CHEWING_ZERO_MIDDLE, CHEWING_A)},
@@ -25,6 +25,7 @@
 #include <assert.h>
 #include "novel_types.h"
 #include "chewing_key.h"
+#include "pinyin_custom2.h"
 
 /* All compare function should be symmetric for the lhs and rhs operands.
    URL: http://en.cppreference.com/w/cpp/algorithm/equal_range . */
@@ -178,6 +179,197 @@ inline void compute_incomplete_chewing_index(const ChewingKey * in_keys,
     }
 }
 
+/* the first initial of the fuzzy initials, such as "z" for "zh". */
+inline ChewingInitial compute_fuzzy_initial(ChewingInitial initial) {
+    switch (initial) {
+    case CHEWING_CH:
+        return CHEWING_C;
+    case CHEWING_ZH:
+        return CHEWING_Z;
+    case CHEWING_SH:
+        return CHEWING_S;
+    case CHEWING_N:
+    case CHEWING_R:
+        return CHEWING_L;
+    case CHEWING_H:
+        return CHEWING_F;
+    case CHEWING_K:
+        return CHEWING_G;
+    default:
+        return initial;
+    }
+}
+
+/* the incomplete chewing index with the fuzzy initials,
+   the chewing table stores the phrases with this index, so that
+   all fuzzy pinyins of the keys are in the same table entry. */
+inline void compute_fuzzy_chewing_index(const ChewingKey * in_keys,
+                                        ChewingKey * out_keys,
+                                        int phrase_length) {
+    for (int i = 0; i < phrase_length; ++i) {
+        ChewingKey key;
+        key.m_initial = compute_fuzzy_initial
+            ((ChewingInitial) in_keys[i].m_initial);
+        out_keys[i] = key;
+    }
+}
+
+/* the maximum number of the fuzzy keys, including the key itself. */
+#define MAX_FUZZY_KEYS 6
+
+/* compute the fuzzy keys of the key, the key itself comes first,
+   the same fuzzy pinyins as fuzzy_syllable_step. */
+inline size_t compute_fuzzy_keys(pinyin_option_t options,
+                                 const ChewingKey & key,
+                                 ChewingKey fuzzy_keys[MAX_FUZZY_KEYS]) {
+    size_t num = 0;
+    fuzzy_keys[num++] = key;
+
+    if (!(options & PINYIN_AMB_ALL))
+        return num;
+
+    /* for pinyin initials. */
+#define MATCH(AMBIGUITY, ORIGIN, ANOTHER) do {                  \
+        if (options & AMBIGUITY) {                              \
+            if (ORIGIN == key.m_initial) {                      \
+                ChewingKey newkey = key;                        \
+                newkey.m_initial = ANOTHER;                     \
+                if (0 != newkey.get_table_index())              \
+                    fuzzy_keys[num++] = newkey;                 \
+            }                                                   \
+        }                                                       \
+    } while (0)
+
+    MATCH(PINYIN_AMB_C_CH, CHEWING_C, CHEWING_CH);
+    MATCH(PINYIN_AMB_C_CH, CHEWING_CH, CHEWING_C);
+    MATCH(PINYIN_AMB_Z_ZH, CHEWING_Z, CHEWING_ZH);
+    MATCH(PINYIN_AMB_Z_ZH, CHEWING_ZH, CHEWING_Z);
+    MATCH(PINYIN_AMB_S_SH, CHEWING_S, CHEWING_SH);
+    MATCH(PINYIN_AMB_S_SH, CHEWING_SH, CHEWING_S);
+    MATCH(PINYIN_AMB_L_R, CHEWING_L, CHEWING_R);
+    MATCH(PINYIN_AMB_L_R, CHEWING_R, CHEWING_L);
+    MATCH(PINYIN_AMB_L_N, CHEWING_L, CHEWING_N);
+    MATCH(PINYIN_AMB_L_N, CHEWING_N, CHEWING_L);
+    MATCH(PINYIN_AMB_F_H, CHEWING_F, CHEWING_H);
+    MATCH(PINYIN_AMB_F_H, CHEWING_H, CHEWING_F);
+    MATCH(PINYIN_AMB_G_K, CHEWING_G, CHEWING_K);
+    MATCH(PINYIN_AMB_G_K, CHEWING_K, CHEWING_G);
+
+#undef MATCH
+
+    /* for pinyin finals. */
+    const size_t ninitial = num;
+    for (size_t i = 0; i < ninitial; ++i) {
+        const ChewingKey cur_key = fuzzy_keys[i];
+
+#define MATCH(AMBIGUITY, ORIGIN, ANOTHER) do {                  \
+            if (options & AMBIGUITY) {                          \
+                if (ORIGIN == cur_key.m_final) {                \
+                    ChewingKey newkey = cur_key;                \
+                    newkey.m_final = ANOTHER;                   \
+                    fuzzy_keys[num++] = newkey;                 \
+                }                                               \
+            }                                                   \
+        } while (0)
+
+        MATCH(PINYIN_AMB_AN_ANG, CHEWING_AN, CHEWING_ANG);
+        MATCH(PINYIN_AMB_AN_ANG, CHEWING_ANG, CHEWING_AN);
+        MATCH(PINYIN_AMB_EN_ENG, CHEWING_EN, CHEWING_ENG);
+        MATCH(PINYIN_AMB_EN_ENG, CHEWING_ENG, CHEWING_EN);
+        MATCH(PINYIN_AMB_IN_ING, PINYIN_IN, PINYIN_ING);
+        MATCH(PINYIN_AMB_IN_ING, PINYIN_ING, PINYIN_IN);
+
+#undef MATCH
+    }
+
+    assert(num <= MAX_FUZZY_KEYS);
+    return num;
+}
+
+/**
+ * ChewingFuzzyKeys:
+ *
+ * The fuzzy keys of one key, used to compare the keys with
+ * the fuzzy pinyins without expanding the phonetic key matrix.
+ *
+ */
+struct ChewingFuzzyKeys{
+    ChewingKey m_keys[MAX_FUZZY_KEYS];
+    size_t m_num;
+};
+
+/* compute the fuzzy keys of the keys,
+   returns whether any key has the fuzzy pinyins. */
+inline bool compute_fuzzy_keys(pinyin_option_t options,
+                               const ChewingKey * keys,
+                               ChewingFuzzyKeys * fuzzy_keys,
+                               int phrase_length) {
+    bool fuzzy = false;
+    for (int i = 0; i < phrase_length; ++i) {
+        ChewingFuzzyKeys & cur_keys = fuzzy_keys[i];
+        cur_keys.m_num = compute_fuzzy_keys
+            (options, keys[i], cur_keys.m_keys);
+        fuzzy = fuzzy || cur_keys.m_num > 1;
+    }
+    return fuzzy;
+}
+
+/* whether any key has the fuzzy pinyins. */
+inline bool contains_fuzzy_pinyin(pinyin_option_t options,
+                                  const ChewingKey * keys,
+                                  int phrase_length) {
+    if (!(options & PINYIN_AMB_ALL))
+        return false;
+
+    ChewingKey fuzzy_keys[MAX_FUZZY_KEYS];
+    for (int i = 0; i < phrase_length; ++i) {
+        if (compute_fuzzy_keys(options, keys[i], fuzzy_keys) > 1)
+            return true;
+    }
+    return false;
+}
+
+/* whether the keys match any fuzzy pinyins with incomplete pinyin
+   and zero tone. */
+inline bool pinyin_match_fuzzy_keys(const ChewingFuzzyKeys * fuzzy_keys,
+                                    const ChewingKey * keys,
+                                    int phrase_length) {
+    for (int i = 0; i < phrase_length; ++i) {
+        const ChewingFuzzyKeys & cur_keys = fuzzy_keys[i];
+
+        size_t k = 0;
+        for (; k < cur_keys.m_num; ++k) {
+            if (0 == pinyin_compare_with_tones
+                (cur_keys.m_keys + k, keys + i, 1))
+                break;
+        }
+
+        if (k == cur_keys.m_num)
+            return false;
+    }
+    return true;
+}
+
+/* compute the chewing index to search the keys,
+   returns the fuzzy pinyin options of the search. */
+inline pinyin_option_t compute_search_chewing_index(pinyin_option_t options,
+                                                    const ChewingKey * keys,
+                                                    ChewingKey * index,
+                                                    int phrase_length) {
+    /* one search of the folded entry for all fuzzy pinyins. */
+    if (contains_fuzzy_pinyin(options, keys, phrase_length)) {
+        compute_fuzzy_chewing_index(keys, index, phrase_length);
+        return options;
+    }
+
+    if (contains_incomplete_pinyin(keys, phrase_length))
+        compute_fuzzy_chewing_index(keys, index, phrase_length);
+    else
+        compute_chewing_index(keys, index, phrase_length);
+
+    return 0;
+}
+
 template<size_t phrase_length>
 struct PinyinIndexItem2{
     phrase_token_t m_token;
@@ -0,0 +1,318 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <assert.h>
+#include "single_gram_cache.h"
+
+using namespace pinyin;
+
+struct SingleGramCacheEntry{
+    /* the references of the cache and the SingleGramCacheRefs. */
+    gint m_ref_count;
+    phrase_token_t m_token;
+    /* whether any single gram exists for the token. */
+    bool m_exists;
+    /* the system and user single grams, own their memory,
+       the missing single gram is empty, never changed once cached. */
+    SingleGram m_system;
+    SingleGram m_user;
+};
+
+static inline void ref_entry(SingleGramCacheEntry * entry){
+    g_atomic_int_inc(&entry->m_ref_count);
+}
+
+static inline void unref_entry(SingleGramCacheEntry * entry){
+    if (g_atomic_int_dec_and_test(&entry->m_ref_count))
+        delete entry;
+}
+
+SingleGramCacheRef::SingleGramCacheRef(){
+    m_entry = NULL;
+}
+
+SingleGramCacheRef::~SingleGramCacheRef(){
+    reset();
+}
+
+void SingleGramCacheRef::reset(){
+    if (m_entry)
+        unref_entry(m_entry);
+    m_entry = NULL;
+}
+
+void SingleGramCacheRef::set_entry(SingleGramCacheEntry * entry){
+    /* take over the reference of the entry. */
+    reset();
+    m_entry = entry;
+}
+
+const SingleGram * SingleGramCacheRef::get_system() const{
+    assert(NULL != m_entry);
+    return &m_entry->m_system;
+}
+
+const SingleGram * SingleGramCacheRef::get_user() const{
+    assert(NULL != m_entry);
+    return &m_entry->m_user;
+}
+
+SingleGramCache::SingleGramCache(Bigram * system_bigram,
+                                 Bigram * user_bigram,
+                                 size_t capacity){
+    m_system_bigram = system_bigram;
+    m_user_bigram = user_bigram;
+    m_compact_bigram = NULL;
+    m_user_buffer = NULL;
+
+    m_shard_capacity = capacity / SINGLE_GRAM_CACHE_SHARDS;
+    if (0 == m_shard_capacity)
+        m_shard_capacity = 1;
+
+    for (size_t i = 0; i < SINGLE_GRAM_CACHE_SHARDS; ++i) {
+        SingleGramCacheShard * shard = m_shards + i;
+
+        g_mutex_init(&shard->m_mutex);
+        shard->m_index = g_hash_table_new(g_direct_hash, g_direct_equal);
+        g_queue_init(&shard->m_lru);
+        shard->m_generation = 0;
+    }
+
+    g_mutex_init(&m_bigram_mutex);
+}
+
+SingleGramCache::~SingleGramCache(){
+    for (size_t i = 0; i < SINGLE_GRAM_CACHE_SHARDS; ++i) {
+        SingleGramCacheShard * shard = m_shards + i;
+
+        clear_shard(shard);
+        g_hash_table_destroy(shard->m_index);
+        shard->m_index = NULL;
+        g_mutex_clear(&shard->m_mutex);
+    }
+
+    g_mutex_clear(&m_bigram_mutex);
+}
+
+void SingleGramCache::clear_shard(SingleGramCacheShard * shard){
+    for (GList * link = shard->m_lru.head; link; link = link->next) {
+        SingleGramCacheEntry * entry = (SingleGramCacheEntry *) link->data;
+        unref_entry(entry);
+    }
+
+    g_queue_clear(&shard->m_lru);
+    g_hash_table_remove_all(shard->m_index);
+}
+
+void SingleGramCache::copy_single_gram(SingleGram * dest,
+                                       const SingleGram * src){
+    const MemoryChunk & chunk = src->m_chunk;
+    dest->m_chunk.set_size(chunk.size());
+    dest->m_chunk.set_content(0, chunk.begin(), chunk.size());
+}
+
+bool SingleGramCache::set_compact_bigram(CompactBigram * compact_bigram){
+    m_compact_bigram = compact_bigram;
+    invalidate_all();
+    return true;
+}
+
+bool SingleGramCache::set_user_buffer(UserBigramBuffer * user_buffer){
+    m_user_buffer = user_buffer;
+    invalidate_all();
+    return true;
+}
+
+bool SingleGramCache::load_user(phrase_token_t index, SingleGram * & user){
+    if (m_user_buffer)
+        return m_user_buffer->load(index, user);
+
+    return m_user_bigram->load(index, user);
+}
+
+bool SingleGramCache::store_user(phrase_token_t index, SingleGram * user){
+    bool retval = false;
+    if (m_user_buffer)
+        retval = m_user_buffer->store(index, user);
+    else
+        retval = m_user_bigram->store(index, user);
+
+    invalidate(index);
+    return retval;
+}
+
+bool SingleGramCache::load(phrase_token_t index, SingleGram * merged){
+    SingleGramCacheRef ref;
+    if (!load(index, ref))
+        return false;
+
+    /* the merged single gram owns its memory. */
+    return merge_single_gram(merged, ref.get_system(), ref.get_user());
+}
+
+bool SingleGramCache::load(phrase_token_t index,
+                           SingleGramCacheRef & ref,
+                           MergedSingleGramView & view){
+    if (!load(index, ref)) {
+        view.reset(NULL, NULL);
+        return false;
+    }
+
+    /* the view walks the arrays of the cached entry. */
+    view.reset(ref.get_system(), ref.get_user());
+    return true;
+}
+
+bool SingleGramCache::load(phrase_token_t index, SingleGramCacheRef & ref){
+    ref.reset();
+
+    SingleGramCacheShard * shard = get_shard(index);
+
+    g_mutex_lock(&shard->m_mutex);
+
+    GList * link = (GList *) g_hash_table_lookup
+        (shard->m_index, GUINT_TO_POINTER(index));
+    if (link) {
+        /* move the entry to the front. */
+        g_queue_unlink(&shard->m_lru, link);
+        g_queue_push_head_link(&shard->m_lru, link);
+
+        /* reference the immutable entry, without copying. */
+        SingleGramCacheEntry * entry = (SingleGramCacheEntry *) link->data;
+        const bool exists = entry->m_exists;
+        if (exists) {
+            ref_entry(entry);
+            ref.set_entry(entry);
+        }
+
+        g_mutex_unlock(&shard->m_mutex);
+        return exists;
+    }
+
+    /* the entry is stale if the shard is invalidated during the load. */
+    const guint32 generation = shard->m_generation;
+    g_mutex_unlock(&shard->m_mutex);
+
+    /* cache miss, load the system and user single grams. */
+    SingleGramCacheEntry * entry = new SingleGramCacheEntry;
+    entry->m_ref_count = 1;
+    entry->m_token = index;
+
+    bool has_system = false;
+    if (m_compact_bigram) {
+        /* decode the view of the mapped file once, when it is cached. */
+        CompactSingleGram compact_system;
+        has_system = m_compact_bigram->load(index, compact_system);
+        if (has_system)
+            merge_single_gram(&entry->m_system, &compact_system, NULL);
+    }
+
+    g_mutex_lock(&m_bigram_mutex);
+    SingleGram * system_gram = NULL, * user_gram = NULL;
+    if (NULL == m_compact_bigram) {
+        m_system_bigram->load(index, system_gram);
+        has_system = NULL != system_gram;
+        if (has_system)
+            copy_single_gram(&entry->m_system, system_gram);
+    }
+
+    if (m_user_buffer)
+        m_user_buffer->load(index, user_gram);
+    else
+        m_user_bigram->load(index, user_gram);
+    const bool has_user = NULL != user_gram;
+    if (has_user)
+        copy_single_gram(&entry->m_user, user_gram);
+
+    if (system_gram)
+        delete system_gram;
+    if (user_gram)
+        delete user_gram;
+    g_mutex_unlock(&m_bigram_mutex);
+
+    entry->m_exists = has_system || has_user;
+
+    const bool exists = entry->m_exists;
+
+    g_mutex_lock(&shard->m_mutex);
+
+    /* skip the stale entry, or another thread cached the token. */
+    if (generation == shard->m_generation &&
+        NULL == g_hash_table_lookup(shard->m_index,
+                                    GUINT_TO_POINTER(index))) {
+        /* the reference of the cache. */
+        ref_entry(entry);
+        g_queue_push_head(&shard->m_lru, entry);
+        g_hash_table_insert(shard->m_index, GUINT_TO_POINTER(index),
+                            shard->m_lru.head);
+
+        /* evict the least recently used entries. */
+        while (shard->m_lru.length > m_shard_capacity) {
+            SingleGramCacheEntry * last = (SingleGramCacheEntry *)
+                g_queue_pop_tail(&shard->m_lru);
+            g_hash_table_remove(shard->m_index,
+                                GUINT_TO_POINTER(last->m_token));
+            unref_entry(last);
+        }
+    }
+
+    g_mutex_unlock(&shard->m_mutex);
+
+    /* the reference of the caller. */
+    if (exists)
+        ref.set_entry(entry);
+    else
+        unref_entry(entry);
+    return exists;
+}
+
+bool SingleGramCache::invalidate(phrase_token_t index){
+    SingleGramCacheShard * shard = get_shard(index);
+
+    g_mutex_lock(&shard->m_mutex);
+    ++shard->m_generation;
+
+    GList * link = (GList *) g_hash_table_lookup
+        (shard->m_index, GUINT_TO_POINTER(index));
+    if (link) {
+        SingleGramCacheEntry * entry = (SingleGramCacheEntry *) link->data;
+
+        g_hash_table_remove(shard->m_index, GUINT_TO_POINTER(index));
+        g_queue_delete_link(&shard->m_lru, link);
+        unref_entry(entry);
+    }
+
+    g_mutex_unlock(&shard->m_mutex);
+    return true;
+}
+
+bool SingleGramCache::invalidate_all(){
+    for (size_t i = 0; i < SINGLE_GRAM_CACHE_SHARDS; ++i) {
+        SingleGramCacheShard * shard = m_shards + i;
+
+        g_mutex_lock(&shard->m_mutex);
+        ++shard->m_generation;
+        clear_shard(shard);
+        g_mutex_unlock(&shard->m_mutex);
+    }
+
+    return true;
+}
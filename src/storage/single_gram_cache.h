@@ -0,0 +1,295 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef SINGLE_GRAM_CACHE_H
+#define SINGLE_GRAM_CACHE_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "memory_chunk.h"
+#include "ngram.h"
+#include "ngram_compact.h"
+#include "user_bigram_buffer.h"
+
+namespace pinyin{
+
+/* the number of the shards, must be power of two. */
+#define SINGLE_GRAM_CACHE_SHARDS 16
+
+/**
+ * SingleGramCacheShard:
+ *
+ * One shard of the single gram cache, guarded by its own mutex.
+ *
+ */
+struct SingleGramCacheShard{
+    GMutex m_mutex;
+    /* Key: phrase_token_t, Value: GList * link in m_lru */
+    GHashTable * m_index;
+    /* the most recently used entry comes first. */
+    GQueue m_lru;
+    /* increased when the shard is invalidated. */
+    guint32 m_generation;
+};
+
+struct SingleGramCacheEntry;
+
+/**
+ * SingleGramCacheRef:
+ *
+ * The reference to one cached entry, keeps the single grams of the entry
+ * alive after the entry is evicted or invalidated from the cache.
+ *
+ * Note:
+ *   The cached single grams are immutable, read them without copying.
+ *   The reference is not copyable, use one reference per lookup.
+ *
+ */
+class SingleGramCacheRef{
+    friend class SingleGramCache;
+private:
+    SingleGramCacheEntry * m_entry;
+
+    void set_entry(SingleGramCacheEntry * entry);
+
+    /* disallow the copy. */
+    SingleGramCacheRef(const SingleGramCacheRef & other);
+    SingleGramCacheRef & operator=(const SingleGramCacheRef & other);
+
+public:
+    /**
+     * SingleGramCacheRef::SingleGramCacheRef:
+     *
+     * The constructor of the SingleGramCacheRef.
+     *
+     */
+    SingleGramCacheRef();
+
+    /**
+     * SingleGramCacheRef::~SingleGramCacheRef:
+     *
+     * The destructor of the SingleGramCacheRef, releases the entry.
+     *
+     */
+    ~SingleGramCacheRef();
+
+    /**
+     * SingleGramCacheRef::reset:
+     *
+     * Release the referenced entry.
+     *
+     */
+    void reset();
+
+    /**
+     * SingleGramCacheRef::get_system:
+     * @returns: the system single gram, empty when it is missing.
+     *
+     */
+    const SingleGram * get_system() const;
+
+    /**
+     * SingleGramCacheRef::get_user:
+     * @returns: the user single gram, empty when it is missing.
+     *
+     */
+    const SingleGram * get_user() const;
+};
+
+/**
+ * SingleGramCache:
+ *
+ * The least recently used cache of the merged single grams,
+ * shared by all lookups of one pinyin context.
+ *
+ * Note:
+ *   The cache is keyed by the previous token, and the system and user
+ *   single grams are stored in the immutable reference counted entries.
+ *   The tokens without any single gram are cached too.
+ *   The cache is thread-safe, the shards are locked separately, and
+ *   the cache misses are serialized to protect the bi-gram databases.
+ *   Please invalidate the token after the user bi-gram is changed.
+ *
+ */
+class SingleGramCache{
+private:
+    Bigram * m_system_bigram;
+    Bigram * m_user_bigram;
+    /* the optional compact system bi-gram, used instead of the DB. */
+    CompactBigram * m_compact_bigram;
+    /* the optional write-behind buffer of the user bi-gram. */
+    UserBigramBuffer * m_user_buffer;
+
+    /* the maximum number of the entries in one shard. */
+    size_t m_shard_capacity;
+    SingleGramCacheShard m_shards[SINGLE_GRAM_CACHE_SHARDS];
+
+    /* serialize the loads of the bi-gram databases. */
+    GMutex m_bigram_mutex;
+
+    SingleGramCacheShard * get_shard(phrase_token_t index) {
+        /* Fibonacci hashing, use the high bits. */
+        const guint32 hash = index * 2654435761U;
+        return m_shards + (hash >> 28) % SINGLE_GRAM_CACHE_SHARDS;
+    }
+
+    static void clear_shard(SingleGramCacheShard * shard);
+    static void copy_single_gram(SingleGram * dest, const SingleGram * src);
+
+public:
+    /**
+     * SingleGramCache::SingleGramCache:
+     * @system_bigram: the system bi-gram.
+     * @user_bigram: the user bi-gram.
+     * @capacity: the maximum number of the cached single grams.
+     *
+     * The constructor of the SingleGramCache.
+     *
+     */
+    SingleGramCache(Bigram * system_bigram, Bigram * user_bigram,
+                    size_t capacity = 4096);
+
+    /**
+     * SingleGramCache::~SingleGramCache:
+     *
+     * The destructor of the SingleGramCache.
+     *
+     */
+    ~SingleGramCache();
+
+    /**
+     * SingleGramCache::set_compact_bigram:
+     * @compact_bigram: the compact system bi-gram, or NULL.
+     * @returns: whether the set operation is successful.
+     *
+     * Load the system single grams from the compact bi-gram instead of
+     * the system bi-gram, the views are read without the bi-gram lock.
+     *
+     */
+    bool set_compact_bigram(CompactBigram * compact_bigram);
+
+    /**
+     * SingleGramCache::set_user_buffer:
+     * @user_buffer: the write-behind buffer of the user bi-gram, or NULL.
+     * @returns: whether the set operation is successful.
+     *
+     * Load and store the user single grams through the buffer
+     * instead of the user bi-gram.
+     *
+     */
+    bool set_user_buffer(UserBigramBuffer * user_buffer);
+
+    /**
+     * SingleGramCache::load_user:
+     * @index: the previous token in the bi-gram.
+     * @user: the user single gram of the previous token.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the user single gram for training, the content is copied.
+     *
+     */
+    bool load_user(/* in */ phrase_token_t index,
+                   /* out */ SingleGram * & user);
+
+    /**
+     * SingleGramCache::store_user:
+     * @index: the previous token in the bi-gram.
+     * @user: the trained user single gram of the previous token.
+     * @returns: whether the store operation is successful.
+     *
+     * Store the trained user single gram, and invalidate the cached
+     * single gram of the previous token.
+     *
+     */
+    bool store_user(/* in */ phrase_token_t index,
+                    /* in */ SingleGram * user);
+
+    /**
+     * SingleGramCache::load:
+     * @index: the previous token in the bi-gram.
+     * @ref: the reference to the cached single grams of the previous token.
+     * @returns: whether the single gram exists.
+     *
+     * Load the system and user single gram into the cache,
+     * and reference the cached entry without copying.
+     *
+     */
+    bool load(/* in */ phrase_token_t index,
+              /* out */ SingleGramCacheRef & ref);
+
+    /**
+     * SingleGramCache::load:
+     * @index: the previous token in the bi-gram.
+     * @merged: the merged single gram of the previous token.
+     * @returns: whether the single gram exists.
+     *
+     * Load the merged single gram of the system and user bi-gram,
+     * the content is copied into the merged single gram.
+     *
+     * Note: the merged single gram should own its memory,
+     * for example, a default constructed SingleGram.
+     *
+     */
+    bool load(/* in */ phrase_token_t index,
+              /* out */ SingleGram * merged);
+
+    /**
+     * SingleGramCache::load:
+     * @index: the previous token in the bi-gram.
+     * @ref: the reference to the cached single grams of the previous token.
+     * @view: the merged view of the system and user single gram.
+     * @returns: whether the single gram exists.
+     *
+     * Load the system and user single gram without merging them,
+     * the view is reset to the cached single grams without copying.
+     *
+     * Note: keep the reference when using the view.
+     *
+     */
+    bool load(/* in */ phrase_token_t index,
+              /* out */ SingleGramCacheRef & ref,
+              /* out */ MergedSingleGramView & view);
+
+    /**
+     * SingleGramCache::invalidate:
+     * @index: the previous token in the bi-gram.
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate the cached single gram of the previous token,
+     * call it after the user bi-gram of the token is stored.
+     *
+     */
+    bool invalidate(/* in */ phrase_token_t index);
+
+    /**
+     * SingleGramCache::invalidate_all:
+     * @returns: whether the invalidate operation is successful.
+     *
+     * Invalidate all cached single grams, call it after the user bi-gram
+     * is changed in bulk, such as mask out.
+     *
+     */
+    bool invalidate_all();
+};
+
+};
+
+#endif
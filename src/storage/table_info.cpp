@@ -272,11 +272,13 @@ gfloat SystemTableInfo2::get_lambda() {
 UserTableInfo::UserTableInfo() {
     m_binary_format_version = 0;
     m_model_data_version = 0;
+    m_user_table_revision = 0;
 }
 
 void UserTableInfo::reset() {
     m_binary_format_version = 0;
     m_model_data_version = 0;
+    m_user_table_revision = 0;
 }
 
 bool UserTableInfo::load(const char * filename) {
@@ -304,12 +306,20 @@ bool UserTableInfo::load(const char * filename) {
         return false;
     }
 
+    /* the old user table info has no revision. */
+    int revision = 0;
+    num = fscanf(input, "user table revision:%d\n", &revision);
+    if (1 != num)
+        revision = 0;
+
 #if 0
-    printf("binver:%d modelver:%d\n", binver, modelver);
+    printf("binver:%d modelver:%d revision:%d\n",
+           binver, modelver, revision);
 #endif
 
     m_binary_format_version = binver;
     m_model_data_version = modelver;
+    m_user_table_revision = revision;
 
     fclose(input);
 
@@ -329,6 +339,7 @@ bool UserTableInfo::save(const char * filename) {
 
     fprintf(output, "binary format version:%d\n", m_binary_format_version);
     fprintf(output, "model data version:%d\n", m_model_data_version);
+    fprintf(output, "user table revision:%d\n", m_user_table_revision);
 
     fclose(output);
 
@@ -337,6 +348,47 @@ bool UserTableInfo::save(const char * filename) {
     return true;
 }
 
+bool UserTableInfo::load(const MemoryChunk * chunk) {
+    reset();
+
+    gchar * content = g_strndup((const gchar *) chunk->begin(),
+                                chunk->size());
+
+    int binver = 0, modelver = 0, revision = 0;
+    int num = sscanf(content, "binary format version:%d\n"
+                     "model data version:%d\n"
+                     "user table revision:%d\n",
+                     &binver, &modelver, &revision);
+    g_free(content);
+
+    if (num < 2)
+        return false;
+
+    /* the old user table info has no revision. */
+    if (2 == num)
+        revision = 0;
+
+    m_binary_format_version = binver;
+    m_model_data_version = modelver;
+    m_user_table_revision = revision;
+
+    return true;
+}
+
+bool UserTableInfo::save(MemoryChunk * chunk) {
+    gchar * content = g_strdup_printf
+        ("binary format version:%d\nmodel data version:%d\n"
+         "user table revision:%d\n",
+         m_binary_format_version, m_model_data_version,
+         m_user_table_revision);
+
+    chunk->set_size(0);
+    chunk->set_content(0, content, strlen(content));
+    g_free(content);
+
+    return true;
+}
+
 bool UserTableInfo::is_conform(const SystemTableInfo2 * sysinfo) {
     if (sysinfo->m_binary_format_version != m_binary_format_version)
         return false;
@@ -347,8 +399,13 @@ bool UserTableInfo::is_conform(const SystemTableInfo2 * sysinfo) {
     return true;
 }
 
+bool UserTableInfo::is_revision_conform() {
+    return USER_TABLE_REVISION == m_user_table_revision;
+}
+
 bool UserTableInfo::make_conform(const SystemTableInfo2 * sysinfo) {
     m_binary_format_version = sysinfo->m_binary_format_version;
     m_model_data_version = sysinfo->m_model_data_version;
+    m_user_table_revision = USER_TABLE_REVISION;
     return true;
 }
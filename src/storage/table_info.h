@@ -23,6 +23,7 @@
 #define TABLE_INFO_H
 
 #include "novel_types.h"
+#include "memory_chunk.h"
 
 
 namespace pinyin{
@@ -53,6 +54,11 @@ typedef struct {
 } pinyin_table_info_t;
 
 
+/* the revision of the user tables layout, bumped when the user tables
+   written by the old library need to be upgraded, such as the in-complete
+   chewing index folded by the fuzzy initials. */
+#define USER_TABLE_REVISION 1
+
 class UserTableInfo;
 
 class SystemTableInfo2{
@@ -91,6 +97,8 @@ class UserTableInfo{
 private:
     int m_binary_format_version;
     int m_model_data_version;
+    /* zero for the user tables written before the revisions. */
+    int m_user_table_revision;
 
 private:
     void reset();
@@ -102,8 +110,16 @@ public:
 
     bool save(const char * filename);
 
+    /* the same content as the file, kept in the user manifest. */
+    bool load(const MemoryChunk * chunk);
+
+    bool save(MemoryChunk * chunk);
+
     bool is_conform(const SystemTableInfo2 * sysinfo);
 
+    /* the user tables of the old revision are upgraded, not dropped. */
+    bool is_revision_conform();
+
     bool make_conform(const SystemTableInfo2 * sysinfo);
 };
 
@@ -0,0 +1,162 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <string.h>
+#include "user_bigram_buffer.h"
+
+using namespace pinyin;
+
+static void free_single_gram(gpointer data){
+    SingleGram * single_gram = (SingleGram *) data;
+    delete single_gram;
+}
+
+UserBigramBuffer::UserBigramBuffer(Bigram * bigram, size_t capacity,
+                                   guint32 flush_interval){
+    m_bigram = bigram;
+    m_dirty = g_hash_table_new_full
+        (g_direct_hash, g_direct_equal, NULL, free_single_gram);
+
+    m_capacity = capacity;
+    m_flush_interval = (gint64) flush_interval * G_USEC_PER_SEC;
+    m_last_flush_time = g_get_monotonic_time();
+
+    memset(&m_stats, 0, sizeof(m_stats));
+
+    g_mutex_init(&m_mutex);
+}
+
+UserBigramBuffer::~UserBigramBuffer(){
+    g_hash_table_destroy(m_dirty);
+    m_dirty = NULL;
+
+    g_mutex_clear(&m_mutex);
+}
+
+bool UserBigramBuffer::load(phrase_token_t index,
+                            SingleGram * & single_gram){
+    single_gram = NULL;
+
+    g_mutex_lock(&m_mutex);
+
+    SingleGram * dirty = (SingleGram *) g_hash_table_lookup
+        (m_dirty, GUINT_TO_POINTER(index));
+    if (dirty) {
+        const MemoryChunk & chunk = dirty->m_chunk;
+        single_gram = new SingleGram((void *) chunk.begin(),
+                                     chunk.size(), true);
+        g_mutex_unlock(&m_mutex);
+        return true;
+    }
+
+    /* the loaded single gram owns its memory. */
+    const bool retval = m_bigram->load(index, single_gram);
+
+    g_mutex_unlock(&m_mutex);
+    return retval;
+}
+
+bool UserBigramBuffer::store(phrase_token_t index,
+                             SingleGram * single_gram){
+    const MemoryChunk & chunk = single_gram->m_chunk;
+    SingleGram * dirty = new SingleGram((void *) chunk.begin(),
+                                        chunk.size(), true);
+
+    g_mutex_lock(&m_mutex);
+
+    g_hash_table_replace(m_dirty, GUINT_TO_POINTER(index), dirty);
+
+    bool retval = true;
+    const gint64 now = g_get_monotonic_time();
+    if (g_hash_table_size(m_dirty) >= m_capacity ||
+        now - m_last_flush_time >= m_flush_interval)
+        retval = flush_internal();
+
+    g_mutex_unlock(&m_mutex);
+    return retval;
+}
+
+bool UserBigramBuffer::flush_internal(){
+    m_last_flush_time = g_get_monotonic_time();
+
+    const guint32 size = g_hash_table_size(m_dirty);
+    if (0 == size)
+        return true;
+
+    bool retval = true;
+
+    GHashTableIter iter;
+    gpointer key = NULL, value = NULL;
+    g_hash_table_iter_init(&iter, m_dirty);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        const phrase_token_t index = GPOINTER_TO_UINT(key);
+        SingleGram * single_gram = (SingleGram *) value;
+
+        retval = m_bigram->store(index, single_gram) && retval;
+    }
+
+    g_hash_table_remove_all(m_dirty);
+
+    ++m_stats.m_flushes;
+    m_stats.m_flushed_items += size;
+    m_stats.m_last_flush_size = size;
+    if (size > m_stats.m_max_flush_size)
+        m_stats.m_max_flush_size = size;
+
+    return retval;
+}
+
+bool UserBigramBuffer::flush(){
+    g_mutex_lock(&m_mutex);
+    const bool retval = flush_internal();
+    g_mutex_unlock(&m_mutex);
+    return retval;
+}
+
+bool UserBigramBuffer::mask_out(phrase_token_t mask, phrase_token_t value){
+    g_mutex_lock(&m_mutex);
+    bool retval = flush_internal();
+    retval = m_bigram->mask_out(mask, value) && retval;
+    g_mutex_unlock(&m_mutex);
+    return retval;
+}
+
+bool UserBigramBuffer::copy_db(Bigram * new_bigram){
+    g_mutex_lock(&m_mutex);
+    bool retval = flush_internal();
+    retval = m_bigram->copy_db(new_bigram) && retval;
+    g_mutex_unlock(&m_mutex);
+    return retval;
+}
+
+guint32 UserBigramBuffer::get_length(){
+    g_mutex_lock(&m_mutex);
+    const guint32 length = g_hash_table_size(m_dirty);
+    g_mutex_unlock(&m_mutex);
+    return length;
+}
+
+bool UserBigramBuffer::get_flush_stats(user_bigram_flush_stats_t & stats){
+    g_mutex_lock(&m_mutex);
+    stats = m_stats;
+    g_mutex_unlock(&m_mutex);
+    return true;
+}
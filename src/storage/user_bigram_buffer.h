@@ -0,0 +1,182 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef USER_BIGRAM_BUFFER_H
+#define USER_BIGRAM_BUFFER_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "memory_chunk.h"
+#include "ngram.h"
+
+namespace pinyin{
+
+/**
+ * user_bigram_flush_stats_t:
+ *
+ * The statistics of the flushes of the user bi-gram buffer.
+ *
+ */
+struct user_bigram_flush_stats_t{
+    /* the number of the non-empty flushes. */
+    guint32 m_flushes;
+    /* the total number of the flushed single grams. */
+    guint32 m_flushed_items;
+    /* the most single grams flushed at once. */
+    guint32 m_max_flush_size;
+    /* the single grams flushed by the last flush. */
+    guint32 m_last_flush_size;
+};
+
+/**
+ * UserBigramBuffer:
+ *
+ * The write-behind buffer of the user bi-gram, keeps the trained
+ * single grams in memory and stores them into the bi-gram in batches.
+ *
+ * Note:
+ *   The loads read the buffered single grams first, then the bi-gram.
+ *   The buffer is flushed when it holds too many single grams,
+ *   when the flush interval elapsed, or by flush explicitly,
+ *   please flush it before the bi-gram is saved or changed directly.
+ *   The buffer is thread-safe.
+ *
+ */
+class UserBigramBuffer{
+private:
+    Bigram * m_bigram;
+
+    /* Key: phrase_token_t, Value: SingleGram * owned by the buffer. */
+    GHashTable * m_dirty;
+
+    /* the flush thresholds. */
+    size_t m_capacity;
+    gint64 m_flush_interval;
+    gint64 m_last_flush_time;
+
+    user_bigram_flush_stats_t m_stats;
+
+    GMutex m_mutex;
+
+    bool flush_internal();
+
+public:
+    /**
+     * UserBigramBuffer::UserBigramBuffer:
+     * @bigram: the user bi-gram.
+     * @capacity: the maximum number of the buffered single grams.
+     * @flush_interval: the maximum seconds between the flushes.
+     *
+     * The constructor of the UserBigramBuffer.
+     *
+     */
+    UserBigramBuffer(Bigram * bigram, size_t capacity = 256,
+                     guint32 flush_interval = 30);
+
+    /**
+     * UserBigramBuffer::~UserBigramBuffer:
+     *
+     * The destructor of the UserBigramBuffer, the buffered single grams
+     * are discarded without flush.
+     *
+     */
+    ~UserBigramBuffer();
+
+    /**
+     * UserBigramBuffer::load:
+     * @index: the previous token in the bi-gram.
+     * @single_gram: the single gram of the previous token.
+     * @returns: whether the load operation is successful.
+     *
+     * Load the single gram of the previous token, the buffered one
+     * comes first, the content is always copied.
+     *
+     */
+    bool load(/* in */ phrase_token_t index,
+              /* out */ SingleGram * & single_gram);
+
+    /**
+     * UserBigramBuffer::store:
+     * @index: the previous token in the bi-gram.
+     * @single_gram: the single gram of the previous token.
+     * @returns: whether the store operation is successful.
+     *
+     * Buffer the single gram of the previous token, the content is
+     * copied, and the buffer is flushed when the thresholds are reached.
+     *
+     */
+    bool store(/* in */ phrase_token_t index,
+               /* in */ SingleGram * single_gram);
+
+    /**
+     * UserBigramBuffer::flush:
+     * @returns: whether the flush operation is successful.
+     *
+     * Store all buffered single grams into the bi-gram.
+     *
+     */
+    bool flush();
+
+    /**
+     * UserBigramBuffer::mask_out:
+     * @mask: the mask.
+     * @value: the value.
+     * @returns: whether the mask out operation is successful.
+     *
+     * Flush the buffer, then mask out the matched items in the bi-gram.
+     *
+     */
+    bool mask_out(phrase_token_t mask, phrase_token_t value);
+
+    /**
+     * UserBigramBuffer::copy_db:
+     * @new_bigram: the bi-gram to store the copied items.
+     * @returns: whether the copy operation is successful.
+     *
+     * Flush the buffer, then copy the bi-gram into the new bi-gram,
+     * used to take the snapshot of the user bi-gram.
+     *
+     */
+    bool copy_db(Bigram * new_bigram);
+
+    /**
+     * UserBigramBuffer::get_length:
+     * @returns: the number of the buffered single grams.
+     *
+     * Get the number of the buffered single grams.
+     *
+     */
+    guint32 get_length();
+
+    /**
+     * UserBigramBuffer::get_flush_stats:
+     * @stats: the statistics of the flushes.
+     * @returns: whether the get operation is successful.
+     *
+     * Get the statistics of the flush sizes.
+     *
+     */
+    bool get_flush_stats(/* out */ user_bigram_flush_stats_t & stats);
+};
+
+};
+
+#endif
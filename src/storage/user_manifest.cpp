@@ -0,0 +1,435 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <unistd.h>
+#include "user_manifest.h"
+
+using namespace pinyin;
+
+/* the files of the generation are "user_data.<generation><suffix>". */
+static const char * user_data_prefix = "user_data.";
+static const char * manifest_suffix = ".manifest";
+static const char * segment_suffix = ".segment";
+static const char * tmp_suffix = ".tmp";
+
+/* the Adler-32 checksum. */
+static guint32 compute_checksum(const void * data, size_t size,
+                                guint32 checksum = 1) {
+    const guint32 modulo = 65521;
+    const guint8 * cur = (const guint8 *) data;
+
+    guint32 low = checksum & 0xffff, high = checksum >> 16;
+    for (size_t i = 0; i < size; ++i) {
+        low = (low + cur[i]) % modulo;
+        high = (high + low) % modulo;
+    }
+
+    return (high << 16) | low;
+}
+
+/* the checksum of the manifest skips the checksum field. */
+static guint32 compute_manifest_checksum(const MemoryChunk * chunk) {
+    const char * begin = (const char *) chunk->begin();
+
+    guint32 checksum = compute_checksum
+        (begin, offsetof(user_manifest_header_t, m_checksum));
+    return compute_checksum(begin + sizeof(user_manifest_header_t),
+                            chunk->size() - sizeof(user_manifest_header_t),
+                            checksum);
+}
+
+static gchar * build_generation_filename(const char * userdir,
+                                         guint32 generation,
+                                         const char * suffix) {
+    gchar * basename = g_strdup_printf
+        ("%s%u%s", user_data_prefix, generation, suffix);
+    gchar * filename = g_build_filename(userdir, basename, NULL);
+    g_free(basename);
+    return filename;
+}
+
+static bool parse_generation(const char * basename, const char * suffix,
+                             guint32 & generation) {
+    if (!g_str_has_prefix(basename, user_data_prefix))
+        return false;
+
+    const char * begin = basename + strlen(user_data_prefix);
+    gchar * end = NULL;
+    guint64 value = g_ascii_strtoull(begin, &end, 10);
+    if (end == begin || 0 != strcmp(end, suffix))
+        return false;
+
+    if (value > G_MAXUINT32)
+        return false;
+
+    generation = value;
+    return true;
+}
+
+static void free_chunk(gpointer data) {
+    MemoryChunk * chunk = (MemoryChunk *) data;
+    delete chunk;
+}
+
+static gint compare_name(gconstpointer lhs, gconstpointer rhs) {
+    const char * name_lhs = *(const char **) lhs;
+    const char * name_rhs = *(const char **) rhs;
+    return strcmp(name_lhs, name_rhs);
+}
+
+static gint compare_generation(gconstpointer lhs, gconstpointer rhs) {
+    const guint32 generation_lhs = *(const guint32 *) lhs;
+    const guint32 generation_rhs = *(const guint32 *) rhs;
+
+    /* the newest first. */
+    if (generation_lhs > generation_rhs)
+        return -1;
+    if (generation_lhs < generation_rhs)
+        return 1;
+    return 0;
+}
+
+UserManifest::UserManifest() {
+    m_generation = 0;
+    m_entries = g_hash_table_new_full
+        (g_str_hash, g_str_equal, g_free, free_chunk);
+}
+
+UserManifest::~UserManifest() {
+    g_hash_table_destroy(m_entries);
+    m_entries = NULL;
+}
+
+void UserManifest::clear() {
+    g_hash_table_remove_all(m_entries);
+}
+
+bool UserManifest::has_entry(const char * name) const {
+    return NULL != g_hash_table_lookup(m_entries, name);
+}
+
+bool UserManifest::get_entry(const char * name, MemoryChunk * chunk) const {
+    MemoryChunk * content = (MemoryChunk *)
+        g_hash_table_lookup(m_entries, name);
+    if (NULL == content)
+        return false;
+
+    chunk->set_size(0);
+    chunk->set_content(0, content->begin(), content->size());
+    return true;
+}
+
+bool UserManifest::set_entry(const char * name, const MemoryChunk * chunk) {
+    /* the name is stored with the trailing zero. */
+    if (strlen(name) >= USER_MANIFEST_NAME_LENGTH)
+        return false;
+
+    MemoryChunk * content = new MemoryChunk;
+    content->set_content(0, chunk->begin(), chunk->size());
+
+    g_hash_table_replace(m_entries, g_strdup(name), content);
+    return true;
+}
+
+bool UserManifest::remove_entry(const char * name) {
+    return g_hash_table_remove(m_entries, name);
+}
+
+bool UserManifest::copy(UserManifest * new_manifest) const {
+    new_manifest->clear();
+    new_manifest->m_generation = m_generation;
+
+    GHashTableIter iter;
+    gpointer key = NULL, value = NULL;
+    g_hash_table_iter_init(&iter, m_entries);
+    while (g_hash_table_iter_next(&iter, &key, &value)) {
+        const char * name = (const char *) key;
+        const MemoryChunk * chunk = (const MemoryChunk *) value;
+
+        new_manifest->set_entry(name, chunk);
+    }
+
+    return true;
+}
+
+bool UserManifest::get_generations(const char * userdir,
+                                   GArray * generations) {
+    g_array_set_size(generations, 0);
+
+    GDir * dir = g_dir_open(userdir, 0, NULL);
+    if (NULL == dir)
+        return false;
+
+    const gchar * basename = NULL;
+    while (NULL != (basename = g_dir_read_name(dir))) {
+        guint32 generation = 0;
+        if (parse_generation(basename, manifest_suffix, generation))
+            g_array_append_val(generations, generation);
+    }
+
+    g_dir_close(dir);
+
+    g_array_sort(generations, compare_generation);
+    return true;
+}
+
+bool UserManifest::load_generation(const char * userdir,
+                                   guint32 generation) {
+    MemoryChunk manifest;
+    gchar * filename = build_generation_filename
+        (userdir, generation, manifest_suffix);
+    bool retval = manifest.load(filename);
+    g_free(filename);
+
+    if (!retval)
+        return false;
+
+    if (manifest.size() < sizeof(user_manifest_header_t))
+        return false;
+
+    user_manifest_header_t header;
+    manifest.get_content(0, &header, sizeof(header));
+
+    if (USER_MANIFEST_MAGIC != header.m_magic ||
+        USER_MANIFEST_VERSION != header.m_version ||
+        generation != header.m_generation)
+        return false;
+
+    if (manifest.size() != sizeof(header) +
+        (size_t) header.m_num_entries * sizeof(UserManifestEntry))
+        return false;
+
+    if (header.m_checksum != compute_manifest_checksum(&manifest))
+        return false;
+
+    /* the segment is written before the manifest. */
+    MemoryChunk segment;
+    filename = build_generation_filename
+        (userdir, generation, segment_suffix);
+    retval = segment.load(filename);
+    g_free(filename);
+
+    if (!retval)
+        return false;
+
+    if (segment.size() != header.m_segment_size ||
+        header.m_segment_checksum !=
+        compute_checksum(segment.begin(), segment.size()))
+        return false;
+
+    const UserManifestEntry * begin = (const UserManifestEntry *)
+        ((const char *) manifest.begin() + sizeof(header));
+    const UserManifestEntry * end = begin + header.m_num_entries;
+
+    for (const UserManifestEntry * cur = begin; cur != end; ++cur) {
+        if (cur->m_offset > segment.size() ||
+            cur->m_size > segment.size() - cur->m_offset)
+            return false;
+
+        if (NULL == memchr(cur->m_name, 0, USER_MANIFEST_NAME_LENGTH))
+            return false;
+    }
+
+    clear();
+
+    for (const UserManifestEntry * cur = begin; cur != end; ++cur) {
+        MemoryChunk * content = new MemoryChunk;
+        content->set_content
+            (0, (const char *) segment.begin() + cur->m_offset, cur->m_size);
+
+        g_hash_table_replace(m_entries, g_strdup(cur->m_name), content);
+    }
+
+    m_generation = generation;
+    return true;
+}
+
+bool UserManifest::load(const char * userdir) {
+    clear();
+
+    GArray * generations = g_array_new(FALSE, FALSE, sizeof(guint32));
+    get_generations(userdir, generations);
+
+    bool retval = false;
+    for (size_t i = 0; i < generations->len; ++i) {
+        guint32 generation = g_array_index(generations, guint32, i);
+
+        retval = load_generation(userdir, generation);
+        if (retval)
+            break;
+
+        fprintf(stderr, "skip the incomplete user manifest %u.\n",
+                generation);
+    }
+
+    g_array_free(generations, TRUE);
+    return retval;
+}
+
+bool UserManifest::save(const char * userdir) {
+    /* sort the entries by name, the same content gives the same files. */
+    GPtrArray * names = g_ptr_array_new();
+
+    GHashTableIter iter;
+    gpointer key = NULL, value = NULL;
+    g_hash_table_iter_init(&iter, m_entries);
+    while (g_hash_table_iter_next(&iter, &key, &value))
+        g_ptr_array_add(names, key);
+
+    g_ptr_array_sort(names, compare_name);
+
+    MemoryChunk segment;
+    GArray * entries = g_array_new(FALSE, TRUE, sizeof(UserManifestEntry));
+
+    for (size_t i = 0; i < names->len; ++i) {
+        const char * name = (const char *) g_ptr_array_index(names, i);
+        const MemoryChunk * content = (const MemoryChunk *)
+            g_hash_table_lookup(m_entries, name);
+
+        UserManifestEntry entry;
+        memset(&entry, 0, sizeof(entry));
+        strncpy(entry.m_name, name, USER_MANIFEST_NAME_LENGTH - 1);
+        entry.m_offset = segment.size();
+        entry.m_size = content->size();
+        g_array_append_val(entries, entry);
+
+        segment.append_content(content->begin(), content->size());
+    }
+
+    g_ptr_array_free(names, TRUE);
+
+    user_manifest_header_t header;
+    memset(&header, 0, sizeof(header));
+    header.m_magic = USER_MANIFEST_MAGIC;
+    header.m_version = USER_MANIFEST_VERSION;
+    header.m_generation = m_generation;
+    header.m_num_entries = entries->len;
+    header.m_segment_size = segment.size();
+    header.m_segment_checksum = compute_checksum
+        (segment.begin(), segment.size());
+
+    MemoryChunk manifest;
+    manifest.set_content(0, &header, sizeof(header));
+    manifest.set_content(sizeof(header), entries->data,
+                         entries->len * sizeof(UserManifestEntry));
+    header.m_checksum = compute_manifest_checksum(&manifest);
+    manifest.set_content(0, &header, sizeof(header));
+
+    g_array_free(entries, TRUE);
+
+    /* write the segment, then swap in the manifest. */
+    gchar * segmentfilename = build_generation_filename
+        (userdir, m_generation, segment_suffix);
+    gchar * filename = build_generation_filename
+        (userdir, m_generation, manifest_suffix);
+    gchar * tmpfilename = g_strconcat(filename, tmp_suffix, NULL);
+
+    bool retval = segment.save(segmentfilename) &&
+        manifest.save(tmpfilename);
+
+    if (retval && 0 != rename(tmpfilename, filename)) {
+        fprintf(stderr, "rename %s to %s failed.\n",
+                tmpfilename, filename);
+        retval = false;
+    }
+
+    g_free(tmpfilename);
+    g_free(filename);
+    g_free(segmentfilename);
+
+    if (!retval)
+        return false;
+
+    /* keep the newest complete older generation as the fall back,
+       the generations of the coalesced or failed saves are skipped. */
+    GArray * generations = g_array_new(FALSE, FALSE, sizeof(guint32));
+    get_generations(userdir, generations);
+
+    bool kept = false;
+    for (size_t i = 0; i < generations->len; ++i) {
+        guint32 generation = g_array_index(generations, guint32, i);
+        if (generation == m_generation)
+            continue;
+
+        if (!kept && generation < m_generation) {
+            UserManifest previous;
+            kept = previous.load_generation(userdir, generation);
+            if (kept)
+                continue;
+        }
+
+        remove_generation(userdir, generation);
+    }
+
+    g_array_free(generations, TRUE);
+    return true;
+}
+
+bool UserManifest::remove_generation(const char * userdir,
+                                     guint32 generation) {
+    /* remove the manifest first, the segment is useless without it. */
+    gchar * filename = build_generation_filename
+        (userdir, generation, manifest_suffix);
+    int ret = unlink(filename);
+    g_free(filename);
+
+    if (ret != 0 && errno != ENOENT)
+        return false;
+
+    filename = build_generation_filename
+        (userdir, generation, segment_suffix);
+    ret = unlink(filename);
+    g_free(filename);
+
+    return ret == 0 || errno == ENOENT;
+}
+
+bool UserManifest::remove_all(const char * userdir) {
+    GDir * dir = g_dir_open(userdir, 0, NULL);
+    if (NULL == dir)
+        return false;
+
+    bool retval = true;
+
+    const gchar * basename = NULL;
+    while (NULL != (basename = g_dir_read_name(dir))) {
+        guint32 generation = 0;
+        if (!parse_generation(basename, manifest_suffix, generation) &&
+            !parse_generation(basename, segment_suffix, generation)) {
+            /* the manifest which is not swapped in. */
+            if (!g_str_has_prefix(basename, user_data_prefix) ||
+                !g_str_has_suffix(basename, tmp_suffix))
+                continue;
+        }
+
+        gchar * filename = g_build_filename(userdir, basename, NULL);
+        if (0 != unlink(filename) && errno != ENOENT)
+            retval = false;
+        g_free(filename);
+    }
+
+    g_dir_close(dir);
+    return retval;
+}
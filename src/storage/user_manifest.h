@@ -0,0 +1,231 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef USER_MANIFEST_H
+#define USER_MANIFEST_H
+
+#include <glib.h>
+#include "novel_types.h"
+#include "memory_chunk.h"
+
+namespace pinyin{
+
+/* "UMF1" in little endian. */
+#define USER_MANIFEST_MAGIC 0x31464D55
+#define USER_MANIFEST_VERSION 1
+
+#define USER_MANIFEST_NAME_LENGTH 64
+
+/**
+ * user_manifest_header_t:
+ *
+ * The file header of the user manifest.
+ *
+ * Note:
+ *   The header is followed by m_num_entries UserManifestEntry items,
+ *   the checksum covers the header before it and the entries.
+ *   The segment of the same generation holds the content of the entries.
+ *
+ */
+struct user_manifest_header_t{
+    guint32 m_magic;
+    guint32 m_version;
+    guint32 m_generation;
+    guint32 m_num_entries;
+    guint32 m_segment_size;
+    guint32 m_segment_checksum;
+    guint32 m_checksum;
+};
+
+/**
+ * UserManifestEntry:
+ *
+ * The entry of the user manifest, points to the content in the segment.
+ *
+ */
+struct UserManifestEntry{
+    char m_name[USER_MANIFEST_NAME_LENGTH];
+    table_offset_t m_offset;
+    guint32 m_size;
+};
+
+/**
+ * UserManifest:
+ *
+ * The user data files saved together, as the named entries of one
+ * manifest and one segment of the same generation.
+ *
+ * Note:
+ *   Each save writes a new segment and a new manifest, then renames the
+ *   manifest into place, the written segments are never changed.
+ *   The load picks the newest manifest whose checksums are verified,
+ *   the newest verified older generation is kept as the fall back.
+ *
+ */
+class UserManifest{
+private:
+    guint32 m_generation;
+
+    /* Key: gchar * name, Value: MemoryChunk * content. */
+    GHashTable * m_entries;
+
+    bool load_generation(const char * userdir, guint32 generation);
+
+    static bool get_generations(const char * userdir,
+                                /* out */ GArray * generations);
+
+    static bool remove_generation(const char * userdir, guint32 generation);
+
+public:
+    /**
+     * UserManifest::UserManifest:
+     *
+     * The constructor of the UserManifest.
+     *
+     */
+    UserManifest();
+
+    /**
+     * UserManifest::~UserManifest:
+     *
+     * The destructor of the UserManifest.
+     *
+     */
+    ~UserManifest();
+
+    /**
+     * UserManifest::clear:
+     *
+     * Remove all entries, the generation is kept.
+     *
+     */
+    void clear();
+
+    /**
+     * UserManifest::load:
+     * @userdir: the user directory.
+     * @returns: whether a complete manifest is found.
+     *
+     * Load the entries of the newest complete manifest.
+     *
+     */
+    bool load(const char * userdir);
+
+    /**
+     * UserManifest::save:
+     * @userdir: the user directory.
+     * @returns: whether the save operation is successful.
+     *
+     * Write all entries into the segment of the current generation,
+     * then swap in the manifest, and remove the older generations
+     * except the newest complete one.
+     *
+     */
+    bool save(const char * userdir);
+
+    /**
+     * UserManifest::get_generation:
+     * @returns: the generation of the manifest.
+     *
+     * Get the generation of the manifest, zero if never saved.
+     *
+     */
+    guint32 get_generation() const {
+        return m_generation;
+    }
+
+    /**
+     * UserManifest::set_generation:
+     * @generation: the generation to be saved.
+     *
+     * Set the generation of the manifest.
+     *
+     */
+    void set_generation(guint32 generation) {
+        m_generation = generation;
+    }
+
+    /**
+     * UserManifest::has_entry:
+     * @name: the name of the entry.
+     * @returns: whether the entry exists.
+     *
+     * Check whether the entry exists.
+     *
+     */
+    bool has_entry(const char * name) const;
+
+    /**
+     * UserManifest::get_entry:
+     * @name: the name of the entry.
+     * @chunk: the memory chunk to store the content.
+     * @returns: whether the entry exists.
+     *
+     * Get the content of the entry, the content is copied.
+     *
+     */
+    bool get_entry(const char * name, /* out */ MemoryChunk * chunk) const;
+
+    /**
+     * UserManifest::set_entry:
+     * @name: the name of the entry.
+     * @chunk: the content of the entry.
+     * @returns: whether the set operation is successful.
+     *
+     * Add or replace the entry, the content is copied.
+     *
+     */
+    bool set_entry(const char * name, /* in */ const MemoryChunk * chunk);
+
+    /**
+     * UserManifest::remove_entry:
+     * @name: the name of the entry.
+     * @returns: whether the entry existed.
+     *
+     * Remove the entry.
+     *
+     */
+    bool remove_entry(const char * name);
+
+    /**
+     * UserManifest::copy:
+     * @new_manifest: the manifest to store the copied entries.
+     * @returns: whether the copy operation is successful.
+     *
+     * Copy the generation and all entries into the new manifest.
+     *
+     */
+    bool copy(/* out */ UserManifest * new_manifest) const;
+
+    /**
+     * UserManifest::remove_all:
+     * @userdir: the user directory.
+     * @returns: whether the remove operation is successful.
+     *
+     * Remove all manifests and segments in the user directory.
+     *
+     */
+    static bool remove_all(const char * userdir);
+};
+
+};
+
+#endif
@@ -63,41 +63,22 @@ static bool check_chewing_options(pinyin_option_t options, const chewing_index_i
     return true;
 }
 
-static bool compare_chewing_less_than(const chewing_index_item_t & lhs,
-                                      const chewing_index_item_t & rhs){
-    return 0 > strcmp(lhs.m_chewing_input, rhs.m_chewing_input);
-}
-
 static inline bool search_chewing_index(pinyin_option_t options,
-                                        const chewing_index_item_t * chewing_index,
-                                        size_t len,
+                                        const chewing_index_hash_t * hash,
                                         const char * chewing,
                                         ChewingKey & key){
-    chewing_index_item_t item;
-    memset(&item, 0, sizeof(item));
-    item.m_chewing_input = chewing;
-
-    std_lite::pair<const chewing_index_item_t *,
-                   const chewing_index_item_t *> range;
-    range = std_lite::equal_range
-        (chewing_index, chewing_index + len,
-         item, compare_chewing_less_than);
+    const chewing_index_item_t * index =
+        search_chewing_index_hash(hash, chewing);
 
-    guint16 range_len = range.second - range.first;
-    assert (range_len <= 1);
-
-    if (range_len == 1) {
-        const chewing_index_item_t * index = range.first;
-
-        if (!check_chewing_options(options, index))
-            return false;
+    if (NULL == index)
+        return false;
 
-        key = content_table[index->m_table_index].m_chewing_key;
-        assert(key.get_table_index() == index->m_table_index);
-        return true;
-    }
+    if (!check_chewing_options(options, index))
+        return false;
 
-    return false;
+    key = content_table[index->m_table_index].m_chewing_key;
+    assert(key.get_table_index() == index->m_table_index);
+    return true;
 }
 
 
@@ -198,8 +179,7 @@ bool ZhuyinSimpleParser2::parse_one_key(pinyin_option_t options,
     }
 
     /* search the chewing in the chewing index table. */
-    if (chewing && search_chewing_index(options, zhuyin_index,
-                                        G_N_ELEMENTS(zhuyin_index),
+    if (chewing && search_chewing_index(options, &zhuyin_index_hash,
                                         chewing, key)) {
         /* save back tone if available. */
         key.m_tone = tone;
@@ -385,8 +365,7 @@ probe:
     gchar * chewing = g_strconcat(initial, middle, final, NULL);
 
     /* search the chewing in the chewing index table. */
-    if (index == len && search_chewing_index(options, m_chewing_index,
-                                             m_chewing_index_len,
+    if (index == len && search_chewing_index(options, m_chewing_index_hash,
                                              chewing, key)) {
         /* save back tone if available. */
         key.m_tone = tone;
@@ -453,8 +432,7 @@ bool ZhuyinDiscreteParser2::set_scheme(ZhuyinScheme scheme) {
     m_options = 0;
 
 #define INIT_PARSER(index, table) {                     \
-        m_chewing_index = index;                        \
-        m_chewing_index_len = G_N_ELEMENTS(index);      \
+        m_chewing_index_hash = &index##_hash;           \
         m_initial_table = chewing_##table##_initials;   \
         m_middle_table  = chewing_##table##_middles;    \
         m_final_table   = chewing_##table##_finals;     \
@@ -535,8 +513,7 @@ end:
 }
 
 ZhuyinDaChenCP26Parser2::ZhuyinDaChenCP26Parser2() {
-    m_chewing_index = zhuyin_index;
-    m_chewing_index_len = G_N_ELEMENTS(zhuyin_index);
+    m_chewing_index_hash = &zhuyin_index_hash;
 
     m_initial_table = chewing_dachen_cp26_initials;
     m_middle_table  = chewing_dachen_cp26_middles;
@@ -689,8 +666,7 @@ probe:
     gchar * chewing = g_strconcat(initial, middle, final, NULL);
 
     /* search the chewing in the chewing index table. */
-    if (index == len && search_chewing_index(options, m_chewing_index,
-                                             m_chewing_index_len,
+    if (index == len && search_chewing_index(options, m_chewing_index_hash,
                                              chewing, key)) {
         /* save back tone if available. */
         key.m_tone = tone;
@@ -834,8 +810,7 @@ end:
 }
 
 ZhuyinDirectParser2::ZhuyinDirectParser2 (){
-    m_chewing_index = zhuyin_index;
-    m_chewing_index_len = G_N_ELEMENTS(zhuyin_index);
+    m_chewing_index_hash = &zhuyin_index_hash;
 }
 
 bool ZhuyinDirectParser2::parse_one_key(pinyin_option_t options,
@@ -878,8 +853,8 @@ bool ZhuyinDirectParser2::parse_one_key(pinyin_option_t options,
 
     gchar * chewing = g_strndup(str, len);
     /* search the chewing in the chewing index table. */
-    if (len && search_chewing_index(options, m_chewing_index,
-                                    m_chewing_index_len, chewing, key)) {
+    if (len && search_chewing_index(options, m_chewing_index_hash,
+                                    chewing, key)) {
         /* save back tone if available. */
         key.m_tone = tone;
         g_free(chewing);
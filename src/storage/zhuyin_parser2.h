@@ -125,8 +125,7 @@ protected:
     pinyin_option_t m_options;
 
     /* some internal pointers to chewing scheme table. */
-    const chewing_index_item_t * m_chewing_index;
-    size_t m_chewing_index_len;
+    const chewing_index_hash_t * m_chewing_index_hash;
     const zhuyin_symbol_item_t * m_initial_table;
     const zhuyin_symbol_item_t * m_middle_table;
     const zhuyin_symbol_item_t * m_final_table;
@@ -135,7 +134,7 @@ protected:
 public:
     ZhuyinDiscreteParser2() {
         m_options = 0;
-        m_chewing_index = NULL; m_chewing_index_len = 0;
+        m_chewing_index_hash = NULL;
         m_initial_table = NULL; m_middle_table = NULL;
         m_final_table   = NULL; m_tone_table = NULL;
         set_scheme(ZHUYIN_HSU);
@@ -156,8 +155,7 @@ public:
 class ZhuyinDaChenCP26Parser2 : public ZhuyinParser2
 {
     /* some internal pointers to chewing scheme table. */
-    const chewing_index_item_t * m_chewing_index;
-    size_t m_chewing_index_len;
+    const chewing_index_hash_t * m_chewing_index_hash;
     const zhuyin_symbol_item_t * m_initial_table;
     const zhuyin_symbol_item_t * m_middle_table;
     const zhuyin_symbol_item_t * m_final_table;
@@ -180,8 +178,7 @@ public:
 /* Direct Parser for Zhuyin table load. */
 class ZhuyinDirectParser2 : public PhoneticParser2
 {
-    const chewing_index_item_t * m_chewing_index;
-    size_t m_chewing_index_len;
+    const chewing_index_hash_t * m_chewing_index_hash;
 
 public:
     ZhuyinDirectParser2();
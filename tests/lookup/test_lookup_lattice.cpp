@@ -0,0 +1,153 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timer.h"
+#include <assert.h>
+#include <string.h>
+#include "pinyin_internal.h"
+#include "tests_helper.h"
+
+size_t bench_times = 1000;
+
+static const char * inputs[] = {
+    "nihao", "zhongguo", "xi'an", "zhonghuarenmingongheguo",
+    "woaibeijingtiananmen", "jianshezhongguotesedeshehuizhuyi",
+    NULL
+};
+
+static bool compare_results(MatchResults lhs, MatchResults rhs) {
+    if (lhs->len != rhs->len)
+        return false;
+
+    return 0 == memcmp(lhs->data, rhs->data,
+                       lhs->len * sizeof(phrase_token_t));
+}
+
+int main(int argc, char * argv[]) {
+    SystemTableInfo2 system_table_info;
+
+    bool retval = system_table_info.load("../../data/table.conf");
+    if (!retval) {
+        fprintf(stderr, "load table.conf failed.\n");
+        exit(ENOENT);
+    }
+
+    pinyin_option_t options = USE_TONE | PINYIN_CORRECT_ALL |
+        USE_RESPLIT_TABLE | USE_DIVIDED_TABLE;
+    FacadeChewingTable2 largetable;
+
+    largetable.load("../../data/pinyin_index.bin", NULL);
+
+    const pinyin_table_info_t * phrase_files =
+        system_table_info.get_default_tables();
+
+    FacadePhraseIndex phrase_index;
+    if (!load_phrase_index(phrase_files, &phrase_index))
+        exit(ENOENT);
+
+    Bigram system_bigram;
+    system_bigram.attach("../../data/bigram.db", ATTACH_READONLY);
+    Bigram user_bigram;
+    user_bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE);
+
+    SingleGramCache single_gram_cache(&system_bigram, &user_bigram);
+
+    gfloat lambda = system_table_info.get_lambda();
+
+    PinyinLookup2 pinyin_lookup(lambda, &largetable, &phrase_index,
+                                &system_bigram, &user_bigram,
+                                &single_gram_cache);
+
+    TokenVector prefixes = g_array_new
+        (FALSE, FALSE, sizeof(phrase_token_t));
+    g_array_append_val(prefixes, sentence_start);
+
+    CandidateConstraints constraints = g_array_new
+        (TRUE, FALSE, sizeof(lookup_constraint_t));
+
+    MatchResults results = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    MatchResults last_results =
+        g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+
+    FullPinyinParser2 parser;
+    ChewingKeyVector keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    ChewingKeyRestVector key_rests =
+        g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
+
+    for (size_t n = 0; NULL != inputs[n]; ++n) {
+        const char * input = inputs[n];
+
+        int parsed_len = parser.parse(options, keys, key_rests,
+                                      input, strlen(input));
+        assert(keys->len > 0);
+
+        PhoneticKeyMatrix matrix;
+        fill_matrix(&matrix, keys, key_rests, parsed_len);
+        resplit_step(options, &matrix);
+        inner_split_step(options, &matrix);
+
+        g_array_set_size(constraints, matrix.size());
+        for (size_t i = 0; i < constraints->len; ++i) {
+            lookup_constraint_t * constraint = &g_array_index
+                (constraints, lookup_constraint_t, i);
+            constraint->m_type = NO_CONSTRAINT;
+        }
+
+        /* the lattice columns of the last input are reused. */
+        pinyin_lookup.invalidate_steps(0);
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, last_results));
+
+        /* decode the same input again from scratch. */
+        pinyin_lookup.invalidate_steps(0);
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, results));
+        assert(compare_results(results, last_results));
+
+        /* decode the same input again with the cached steps. */
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, results));
+        assert(compare_results(results, last_results));
+
+        printf("%s:\n", input);
+        guint32 start_time = record_time();
+        for (size_t i = 0; i < bench_times; ++i) {
+            /* benchmark the full search. */
+            pinyin_lookup.invalidate_steps(0);
+            pinyin_lookup.get_best_match
+                (prefixes, &matrix, constraints, results);
+        }
+        print_time(start_time, bench_times);
+
+        assert(compare_results(results, last_results));
+    }
+
+    g_array_free(keys, TRUE);
+    g_array_free(key_rests, TRUE);
+
+    g_array_free(prefixes, TRUE);
+    g_array_free(constraints, TRUE);
+    g_array_free(results, TRUE);
+    g_array_free(last_results, TRUE);
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <assert.h>
+#include <string.h>
+#include <unistd.h>
+#include "pinyin_internal.h"
+#include "tests_helper.h"
+
+static const char * inputs[] = {
+    "woaibeijingtiananmen", "zhonghuarenmingongheguo",
+    "jianshezhongguotesedeshehuizhuyi", "women'xuexi'zhongwen",
+    NULL
+};
+
+static const char * trigram_file = "/tmp/test_lookup_trigram.db";
+
+/* the last phrase and its two previous tokens in the guessed sentence. */
+static bool find_last_phrase(TokenVector prefixes, MatchResults results,
+                             /* out */ size_t & start,
+                             /* out */ TrigramKey & history) {
+    phrase_token_t tokens[3] = {null_token, null_token, null_token};
+    size_t last = results->len;
+
+    for (size_t i = 0; i < results->len; ++i) {
+        phrase_token_t token = g_array_index(results, phrase_token_t, i);
+        if (null_token == token)
+            continue;
+
+        tokens[0] = tokens[1]; tokens[1] = tokens[2]; tokens[2] = token;
+        last = i;
+    }
+
+    /* the last prefix is the history of the first phrase. */
+    if (null_token == tokens[0])
+        tokens[0] = g_array_index(prefixes, phrase_token_t,
+                                  prefixes->len - 1);
+
+    if (results->len == last || null_token == tokens[1])
+        return false;
+
+    start = last;
+    history.m_tokens[0] = tokens[0];
+    history.m_tokens[1] = tokens[1];
+    return true;
+}
+
+int main(int argc, char * argv[]) {
+    SystemTableInfo2 system_table_info;
+
+    bool retval = system_table_info.load("../../data/table.conf");
+    if (!retval) {
+        fprintf(stderr, "load table.conf failed.\n");
+        exit(ENOENT);
+    }
+
+    pinyin_option_t options = USE_TONE | PINYIN_CORRECT_ALL |
+        USE_RESPLIT_TABLE | USE_DIVIDED_TABLE;
+    FacadeChewingTable2 largetable;
+
+    largetable.load("../../data/pinyin_index.bin", NULL);
+
+    const pinyin_table_info_t * phrase_files =
+        system_table_info.get_default_tables();
+
+    FacadePhraseIndex phrase_index;
+    if (!load_phrase_index(phrase_files, &phrase_index))
+        exit(ENOENT);
+
+    Bigram system_bigram;
+    system_bigram.attach("../../data/bigram.db", ATTACH_READONLY);
+    Bigram user_bigram;
+    user_bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE);
+
+    unlink(trigram_file);
+    Trigram system_trigram;
+    assert(system_trigram.attach(trigram_file,
+                                 ATTACH_CREATE|ATTACH_READWRITE));
+
+    SingleGramCache single_gram_cache(&system_bigram, &user_bigram);
+
+    gfloat lambda = system_table_info.get_lambda();
+
+    PinyinLookup2 pinyin_lookup(lambda, &largetable, &phrase_index,
+                                &system_bigram, &user_bigram,
+                                &single_gram_cache);
+
+    TokenVector prefixes = g_array_new
+        (FALSE, FALSE, sizeof(phrase_token_t));
+    g_array_append_val(prefixes, sentence_start);
+
+    CandidateConstraints constraints = g_array_new
+        (TRUE, FALSE, sizeof(lookup_constraint_t));
+
+    MatchResults results = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    MatchResults bigram_results =
+        g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+
+    TrigramKeyArray histories = g_array_new(FALSE, FALSE, sizeof(TrigramKey));
+    BigramPhraseArray items = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItem));
+
+    PhraseIndexRanges ranges;
+    memset(ranges, 0, sizeof(PhraseIndexRanges));
+    phrase_index.prepare_ranges(ranges);
+
+    FullPinyinParser2 parser;
+    ChewingKeyVector keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    ChewingKeyRestVector key_rests =
+        g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
+
+    size_t tested = 0;
+    for (size_t n = 0; NULL != inputs[n]; ++n) {
+        const char * input = inputs[n];
+
+        int parsed_len = parser.parse(options, keys, key_rests,
+                                      input, strlen(input));
+        assert(keys->len > 0);
+
+        PhoneticKeyMatrix matrix;
+        fill_matrix(&matrix, keys, key_rests, parsed_len);
+        resplit_step(options, &matrix);
+        inner_split_step(options, &matrix);
+
+        g_array_set_size(constraints, matrix.size());
+        for (size_t i = 0; i < constraints->len; ++i) {
+            lookup_constraint_t * constraint = &g_array_index
+                (constraints, lookup_constraint_t, i);
+            constraint->m_type = NO_CONSTRAINT;
+        }
+
+        /* the bi-gram only sentence. */
+        assert(pinyin_lookup.set_trigram(NULL, NULL, 0.));
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, bigram_results));
+
+        size_t start = 0; TrigramKey history;
+        if (!find_last_phrase(prefixes, bigram_results, start, history))
+            continue;
+
+        const phrase_token_t best_token = g_array_index
+            (bigram_results, phrase_token_t, start);
+
+        /* find the other phrase of the last span in the bi-gram
+           of the previous token, as the tri-gram only re-scores
+           the bi-gram phrase items. */
+        phrase_index.clear_ranges(ranges);
+        int result = search_matrix(0, &largetable, &matrix,
+                                   start, matrix.size() - 1, ranges);
+        if (!(result & SEARCH_OK))
+            continue;
+
+        SingleGram * gram = NULL;
+        if (!system_bigram.load(history.m_tokens[1], gram))
+            continue;
+
+        g_array_set_size(items, 0);
+        gram->search_ranges(ranges, items);
+        delete gram;
+
+        phrase_token_t other_token = null_token;
+        for (size_t i = 0; i < items->len; ++i) {
+            const BigramPhraseItem * item =
+                &g_array_index(items, BigramPhraseItem, i);
+            if (best_token != item->m_token) {
+                other_token = item->m_token;
+                break;
+            }
+        }
+
+        if (null_token == other_token)
+            continue;
+
+        /* prefer the other phrase after the last two tokens. */
+        SingleGram trigram;
+        assert(trigram.insert_freq(other_token, 1000));
+        assert(trigram.set_total_freq(1000));
+        assert(system_trigram.store(history, &trigram));
+
+        assert(PinyinLookup2::load_trigram_histories
+               (&system_trigram, histories));
+        assert(pinyin_lookup.set_trigram(&system_trigram, histories, 0.9));
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, results));
+
+        /* the tri-gram preferred sentence beats the bi-gram one. */
+        assert(other_token == g_array_index
+               (results, phrase_token_t, start));
+        assert(results->len == bigram_results->len);
+        assert(0 != memcmp(results->data, bigram_results->data,
+                           results->len * sizeof(phrase_token_t)));
+
+        /* the bi-gram only sentence is back without the tri-gram. */
+        assert(pinyin_lookup.set_trigram(NULL, NULL, 0.));
+        assert(pinyin_lookup.get_best_match
+               (prefixes, &matrix, constraints, results));
+        assert(0 == memcmp(results->data, bigram_results->data,
+                           results->len * sizeof(phrase_token_t)));
+
+        assert(system_trigram.remove(history));
+        ++tested;
+    }
+
+    /* at least one sentence is re-scored by the tri-gram. */
+    assert(tested > 0);
+
+    phrase_index.destroy_ranges(ranges);
+
+    g_array_free(keys, TRUE);
+    g_array_free(key_rests, TRUE);
+
+    g_array_free(histories, TRUE);
+    g_array_free(items, TRUE);
+    g_array_free(prefixes, TRUE);
+    g_array_free(constraints, TRUE);
+    g_array_free(results, TRUE);
+    g_array_free(bigram_results, TRUE);
+
+    return 0;
+}
@@ -78,12 +78,15 @@ int main(int argc, char * argv[]){
     system_bigram.attach("../../data/bigram.db", ATTACH_READONLY);
     Bigram user_bigram;
 
+    SingleGramCache single_gram_cache(&system_bigram, &user_bigram);
+
     gfloat lambda = system_table_info.get_lambda();
 
     /* init phrase lookup */
     PhraseLookup phrase_lookup(lambda,
                                &phrase_table, &phrase_index,
-                               &system_bigram, &user_bigram);
+                               &system_bigram, &user_bigram,
+                               &single_gram_cache);
 
     /* try one sentence */
     char * linebuf = NULL;
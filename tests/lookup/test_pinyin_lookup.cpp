@@ -54,10 +54,13 @@ int main( int argc, char * argv[]){
     Bigram user_bigram;
     user_bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE);
 
+    SingleGramCache single_gram_cache(&system_bigram, &user_bigram);
+
     gfloat lambda = system_table_info.get_lambda();
 
     PinyinLookup2 pinyin_lookup(lambda, &largetable, &phrase_index,
-                                &system_bigram, &user_bigram);
+                                &system_bigram, &user_bigram,
+                                &single_gram_cache);
 
     /* prepare the prefixes for get_best_match. */
     TokenVector prefixes = g_array_new
@@ -109,10 +112,20 @@ int main( int argc, char * argv[]){
         }
 
         guint32 start_time = record_time();
-        for (size_t i = 0; i < bench_times; ++i)
+        for (size_t i = 0; i < bench_times; ++i) {
+            /* benchmark the full search. */
+            pinyin_lookup.invalidate_steps(0);
             pinyin_lookup.get_best_match(prefixes, &matrix, constraints, results);
+        }
         print_time(start_time, bench_times);
 
+        lookup_beam_stats_t stats;
+        pinyin_lookup.get_beam_stats(stats);
+        printf("beam candidates:%d\tpruned by width:%d\tpruned by margin:%d\t"
+               "pruned by history:%d\n",
+               stats.m_candidates, stats.m_pruned_by_width,
+               stats.m_pruned_by_margin, stats.m_pruned_by_history);
+
         for (size_t i = 0; i < results->len; ++i){
             phrase_token_t * token = &g_array_index(results, phrase_token_t, i);
             if ( null_token == *token)
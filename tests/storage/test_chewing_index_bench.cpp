@@ -0,0 +1,100 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timer.h"
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "pinyin_internal.h"
+#include "pinyin_parser_table.h"
+
+
+size_t bench_times = 100;
+
+using namespace pinyin;
+
+static bool compare_chewing_less_than(const chewing_index_item_t & lhs,
+                                      const chewing_index_item_t & rhs){
+    return 0 > strcmp(lhs.m_chewing_input, rhs.m_chewing_input);
+}
+
+/* the binary search of the sorted chewing index. */
+static const chewing_index_item_t * search_chewing_index_sorted
+(const chewing_index_item_t * chewing_index, size_t len,
+ const char * chewing) {
+    chewing_index_item_t item;
+    memset(&item, 0, sizeof(item));
+    item.m_chewing_input = chewing;
+
+    std_lite::pair<const chewing_index_item_t *,
+                   const chewing_index_item_t *> range;
+    range = std_lite::equal_range
+        (chewing_index, chewing_index + len,
+         item, compare_chewing_less_than);
+
+    if (range.second - range.first != 1)
+        return NULL;
+
+    return range.first;
+}
+
+static void bench_index(const char * name,
+                        const chewing_index_item_t * chewing_index,
+                        size_t len, const chewing_index_hash_t * hash) {
+    size_t found = 0;
+
+    printf("%s bsearch:\n", name);
+    guint32 start_time = record_time();
+    for (size_t n = 0; n < bench_times; ++n) {
+        for (size_t i = 0; i < len; ++i) {
+            const char * chewing = chewing_index[i].m_chewing_input;
+            if (search_chewing_index_sorted(chewing_index, len, chewing))
+                ++found;
+        }
+    }
+    print_time(start_time, bench_times * len);
+
+    printf("%s perfect hash:\n", name);
+    start_time = record_time();
+    for (size_t n = 0; n < bench_times; ++n) {
+        for (size_t i = 0; i < len; ++i) {
+            const char * chewing = chewing_index[i].m_chewing_input;
+            if (search_chewing_index_hash(hash, chewing))
+                ++found;
+        }
+    }
+    print_time(start_time, bench_times * len);
+
+    assert(2 * bench_times * len == found);
+}
+
+int main(int argc, char * argv[]) {
+    /* the hashes are checked in test_parser2_index. */
+    bench_index("zhuyin", zhuyin_index, G_N_ELEMENTS(zhuyin_index),
+                &zhuyin_index_hash);
+    bench_index("hsu zhuyin", hsu_zhuyin_index,
+                G_N_ELEMENTS(hsu_zhuyin_index), &hsu_zhuyin_index_hash);
+    bench_index("eten26 zhuyin", eten26_zhuyin_index,
+                G_N_ELEMENTS(eten26_zhuyin_index), &eten26_zhuyin_index_hash);
+
+    return 0;
+}
@@ -26,6 +26,45 @@
 
 size_t bench_times = 1000;
 
+/* the memory mapped table should return the same ranges. */
+bool test_mmap_table(ChewingLargeTable2 * largetable,
+                     ChewingMmapTable2 * mmaptable,
+                     FacadePhraseIndex * phrase_index,
+                     ChewingKeyVector keys) {
+    PhraseIndexRanges ranges, mmap_ranges;
+    memset(ranges, 0, sizeof(PhraseIndexRanges));
+    memset(mmap_ranges, 0, sizeof(PhraseIndexRanges));
+
+    phrase_index->prepare_ranges(ranges);
+    phrase_index->prepare_ranges(mmap_ranges);
+
+    for (size_t len = 1; len <= keys->len; ++len) {
+        phrase_index->clear_ranges(ranges);
+        phrase_index->clear_ranges(mmap_ranges);
+
+        int retval = largetable->search
+            (len, (ChewingKey *)keys->data, ranges);
+        int mmap_retval = mmaptable->search
+            (len, (ChewingKey *)keys->data, mmap_ranges);
+        assert(retval == mmap_retval);
+
+        for (size_t k = 0; k < PHRASE_INDEX_LIBRARY_COUNT; ++k) {
+            GArray * range = ranges[k];
+            GArray * mmap_range = mmap_ranges[k];
+            if (!range)
+                continue;
+
+            assert(range->len == mmap_range->len);
+            assert(0 == memcmp(range->data, mmap_range->data,
+                               range->len * sizeof(PhraseIndexRange)));
+        }
+    }
+
+    phrase_index->destroy_ranges(ranges);
+    phrase_index->destroy_ranges(mmap_ranges);
+    return true;
+}
+
 int main(int argc, char * argv[]) {
     SystemTableInfo2 system_table_info;
 
@@ -45,6 +84,12 @@ int main(int argc, char * argv[]) {
     if (!load_phrase_table(phrase_files, &largetable, NULL, &phrase_index))
         exit(ENOENT);
 
+    const char * mmap_filename = "/tmp/test_pinyin_index.bin";
+    assert(largetable.store_mmap(mmap_filename));
+
+    ChewingMmapTable2 mmaptable;
+    assert(mmaptable.load(mmap_filename));
+
 #if 0
     MemoryChunk * new_chunk = new MemoryChunk;
     largetable.store(new_chunk);
@@ -84,6 +129,15 @@ int main(int argc, char * argv[]) {
         }
         print_time(start, bench_times);
 
+        start = record_time();
+        for (i = 0; i < bench_times; ++i) {
+            phrase_index.clear_ranges(ranges);
+            mmaptable.search(keys->len, (ChewingKey *)keys->data, ranges);
+        }
+        print_time(start, bench_times);
+
+        test_mmap_table(&largetable, &mmaptable, &phrase_index, keys);
+
         /* test search continued information. */
         int retval = SEARCH_NONE;
         for (i = 1; i < keys->len; ++i) {
@@ -21,6 +21,7 @@
 
 #include "timer.h"
 #include <stdlib.h>
+#include <math.h>
 #include "pinyin_internal.h"
 #include "tests_helper.h"
 
@@ -79,6 +80,194 @@ bool test_pronunciation_possibility(PhoneticKeyMatrix * matrix,
     return true;
 }
 
+bool test_pronunciation_cache(MatrixPronunciationCache * cache,
+                             PhoneticKeyMatrix * matrix,
+                             size_t start, size_t end,
+                             FacadePhraseIndex * phrase_index,
+                             PhraseIndexRanges ranges) {
+    GArray * cached_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+
+    for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
+        GArray * & range = ranges[i];
+        if (!range)
+            continue;
+
+        for (size_t k = 0; k < range->len; ++k) {
+            PhraseIndexRange * onerange =
+                &g_array_index(range, PhraseIndexRange, k);
+
+            PhraseItem item;
+            for (phrase_token_t token = onerange->m_range_begin;
+                  token != onerange->m_range_end; ++token){
+
+                if (phrase_index->get_phrase_item(token, item))
+                    continue;
+
+                gfloat origin = compute_pronunciation_possibility
+                    (matrix, start, end, cached_keys, item);
+
+                gfloat cached = cache->compute_pronunciation_possibility
+                    (matrix, start, end, item);
+
+                assert(fabs(origin - cached) < 1e-5);
+            }
+        }
+    }
+
+    g_array_free(cached_keys, TRUE);
+    return true;
+}
+
+bool test_search_cache(MatrixSearchCache * search_cache,
+                       MatrixPronunciationCache * pronunciation_cache,
+                       MatrixSnapshot * snapshot,
+                       PhoneticKeyMatrix * matrix,
+                       FacadePhraseIndex * phrase_index) {
+    PhraseIndexRanges ranges, cached_ranges;
+    memset(ranges, 0, sizeof(PhraseIndexRanges));
+    memset(cached_ranges, 0, sizeof(PhraseIndexRanges));
+
+    phrase_index->prepare_ranges(ranges);
+    phrase_index->prepare_ranges(cached_ranges);
+
+    /* only drop the spans touching the changed columns. */
+    size_t column = 0;
+    if (snapshot->update(matrix, column)) {
+        search_cache->invalidate(column);
+        pronunciation_cache->invalidate(column);
+    }
+
+    /* the second round is served by the cache. */
+    for (size_t round = 0; round < 2; ++round) {
+        for (size_t i = 0; i < matrix->size(); ++i) {
+            for (size_t j = i + 1; j < matrix->size(); ++j) {
+                phrase_index->clear_ranges(ranges);
+                phrase_index->clear_ranges(cached_ranges);
+
+                int retval = search_matrix(0, search_cache->get_table(),
+                                           matrix, i, j, ranges);
+                int cached_retval = search_cache->search
+                    (matrix, i, j, cached_ranges);
+                assert(retval == cached_retval);
+
+                for (size_t k = 0; k < PHRASE_INDEX_LIBRARY_COUNT; ++k) {
+                    GArray * range = ranges[k];
+                    GArray * cached_range = cached_ranges[k];
+                    if (!range)
+                        continue;
+
+                    assert(range->len == cached_range->len);
+                    assert(0 == memcmp(range->data, cached_range->data,
+                                       range->len *
+                                       sizeof(PhraseIndexRange)));
+                }
+
+                if (retval & SEARCH_OK)
+                    test_pronunciation_cache
+                        (pronunciation_cache, matrix, i, j,
+                         phrase_index, ranges);
+
+                if (!(retval & SEARCH_CONTINUED))
+                    break;
+            }
+        }
+    }
+
+    phrase_index->destroy_ranges(ranges);
+    phrase_index->destroy_ranges(cached_ranges);
+    return true;
+}
+
+static gint compare_token(gconstpointer lhs, gconstpointer rhs) {
+    phrase_token_t lhs_token = *(const phrase_token_t *) lhs;
+    phrase_token_t rhs_token = *(const phrase_token_t *) rhs;
+    return lhs_token < rhs_token ? -1 : (lhs_token > rhs_token ? 1 : 0);
+}
+
+/* collect the distinct tokens of the ranges. */
+static bool collect_tokens(PhraseIndexRanges ranges, GArray * tokens) {
+    g_array_set_size(tokens, 0);
+
+    for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
+        GArray * range = ranges[i];
+        if (!range)
+            continue;
+
+        for (size_t k = 0; k < range->len; ++k) {
+            PhraseIndexRange * onerange =
+                &g_array_index(range, PhraseIndexRange, k);
+            for (phrase_token_t token = onerange->m_range_begin;
+                 token != onerange->m_range_end; ++token)
+                g_array_append_val(tokens, token);
+        }
+    }
+
+    g_array_sort(tokens, compare_token);
+
+    size_t last = 0;
+    for (size_t i = 1; i < tokens->len; ++i) {
+        phrase_token_t token = g_array_index(tokens, phrase_token_t, i);
+        if (token == g_array_index(tokens, phrase_token_t, last))
+            continue;
+        g_array_index(tokens, phrase_token_t, ++last) = token;
+    }
+    if (tokens->len)
+        g_array_set_size(tokens, last + 1);
+
+    return true;
+}
+
+/* the fuzzy search of the matrix without the fuzzy pinyins should
+   find the same phrases as the matrix filled with the fuzzy pinyins. */
+bool test_fuzzy_search(pinyin_option_t options,
+                       FacadeChewingTable2 * table,
+                       PhoneticKeyMatrix * fuzzy_matrix,
+                       PhoneticKeyMatrix * matrix,
+                       FacadePhraseIndex * phrase_index) {
+    assert(fuzzy_matrix->size() == matrix->size());
+
+    PhraseIndexRanges ranges, fuzzy_ranges;
+    memset(ranges, 0, sizeof(PhraseIndexRanges));
+    memset(fuzzy_ranges, 0, sizeof(PhraseIndexRanges));
+
+    phrase_index->prepare_ranges(ranges);
+    phrase_index->prepare_ranges(fuzzy_ranges);
+
+    GArray * tokens = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    GArray * fuzzy_tokens = g_array_new
+        (FALSE, FALSE, sizeof(phrase_token_t));
+
+    for (size_t i = 0; i < matrix->size(); ++i) {
+        for (size_t j = i + 1; j < matrix->size(); ++j) {
+            phrase_index->clear_ranges(ranges);
+            phrase_index->clear_ranges(fuzzy_ranges);
+
+            int retval = search_matrix
+                (options, table, matrix, i, j, ranges);
+            int fuzzy_retval = search_matrix
+                (0, table, fuzzy_matrix, i, j, fuzzy_ranges);
+            assert((retval & SEARCH_OK) == (fuzzy_retval & SEARCH_OK));
+
+            collect_tokens(ranges, tokens);
+            collect_tokens(fuzzy_ranges, fuzzy_tokens);
+            assert(tokens->len == fuzzy_tokens->len);
+            assert(0 == memcmp(tokens->data, fuzzy_tokens->data,
+                               tokens->len * sizeof(phrase_token_t)));
+
+            if (!(retval & SEARCH_CONTINUED) &&
+                !(fuzzy_retval & SEARCH_CONTINUED))
+                break;
+        }
+    }
+
+    g_array_free(tokens, TRUE);
+    g_array_free(fuzzy_tokens, TRUE);
+
+    phrase_index->destroy_ranges(ranges);
+    phrase_index->destroy_ranges(fuzzy_ranges);
+    return true;
+}
+
 int main(int argc, char * argv[]) {
     SystemTableInfo2 system_table_info;
 
@@ -105,7 +294,10 @@ int main(int argc, char * argv[]) {
     ChewingKeyRestVector key_rests =
         g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
 
-    PhoneticKeyMatrix matrix;
+    PhoneticKeyMatrix matrix, unfuzzy_matrix;
+    MatrixSearchCache search_cache(&largetable);
+    MatrixPronunciationCache pronunciation_cache;
+    MatrixSnapshot snapshot;
 
     char* linebuf = NULL; size_t size = 0; ssize_t read;
     while( (read = getline(&linebuf, &size, stdin)) != -1 ){
@@ -134,6 +326,22 @@ int main(int argc, char * argv[]) {
         }
         print_time(start_time, bench_times);
 
+        /* the fuzzy pinyins are matched by the search instead. */
+        start_time = record_time();
+        for (size_t i = 0; i < bench_times; ++i) {
+            unfuzzy_matrix.clear_all();
+
+            len = parser->parse(options, keys, key_rests,
+                                linebuf, strlen(linebuf));
+
+            fill_matrix(&unfuzzy_matrix, keys, key_rests, len);
+
+            resplit_step(options, &unfuzzy_matrix);
+
+            inner_split_step(options, &unfuzzy_matrix);
+        }
+        print_time(start_time, bench_times);
+
         printf("parsed %d chars, %d keys.\n", len, keys->len);
 
         dump_matrix(&matrix);
@@ -148,7 +356,8 @@ int main(int argc, char * argv[]) {
                 phrase_index.clear_ranges(ranges);
 
                 printf("search index: start %ld\t end %ld\n", i, j);
-                int retval = search_matrix(&largetable, &matrix, i, j, ranges);
+                int retval = search_matrix(0, &largetable, &matrix,
+                                           i, j, ranges);
 
 #if 0
                 if (retval & SEARCH_OK) {
@@ -164,6 +373,14 @@ int main(int argc, char * argv[]) {
         }
 
         phrase_index.destroy_ranges(ranges);
+
+        /* the cache is kept between the lines,
+           only the changed spans are searched again. */
+        test_search_cache(&search_cache, &pronunciation_cache,
+                          &snapshot, &matrix, &phrase_index);
+
+        test_fuzzy_search(options, &largetable, &matrix,
+                          &unfuzzy_matrix, &phrase_index);
     }
 
     if (linebuf)
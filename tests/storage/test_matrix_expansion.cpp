@@ -0,0 +1,101 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "pinyin_internal.h"
+#include "special_table.h"
+
+using namespace pinyin;
+
+static bool has_key(const ChewingKey * keys, size_t len,
+                    const ChewingKey & key) {
+    for (size_t i = 0; i < len; ++i) {
+        if (keys[i] == key)
+            return true;
+    }
+    return false;
+}
+
+int main(int argc, char * argv[]) {
+    const MatrixExpansionTable * table = get_matrix_expansion_table();
+
+    /* the table is shared by the matrix steps. */
+    assert(table == get_matrix_expansion_table());
+
+    /* every divided item is found by its original key. */
+    size_t k;
+    for (k = 0; k < G_N_ELEMENTS(divided_table); ++k) {
+        const divided_table_item_t * item = divided_table + k;
+        const divided_table_item_t * found =
+            table->get_divided_item(item->m_orig_struct);
+        assert(NULL != found);
+        assert(found->m_orig_struct == item->m_orig_struct);
+    }
+
+    /* every resplit item is found by its first original key. */
+    for (k = 0; k < G_N_ELEMENTS(resplit_table); ++k) {
+        const resplit_table_item_t * item = resplit_table + k;
+
+        const resplit_table_item_t * const * items = NULL;
+        size_t len = 0;
+        table->get_resplit_items(item->m_orig_structs[0], items, len);
+
+        bool found = false;
+        for (size_t i = 0; i < len; ++i) {
+            assert(items[i]->m_orig_structs[0] == item->m_orig_structs[0]);
+            found = found || items[i] == item;
+        }
+        assert(found);
+    }
+
+    ChewingKey zhang(CHEWING_ZH, CHEWING_ZERO_MIDDLE, CHEWING_ANG);
+
+    /* the fuzzy step appends the keys with the same tone. */
+    PhoneticKeyMatrix matrix;
+    matrix.set_size(6);
+
+    ChewingKey key = zhang;
+    key.m_tone = CHEWING_1;
+    ChewingKeyRest key_rest;
+    key_rest.m_raw_begin = 0; key_rest.m_raw_end = 5;
+    matrix.append(0, key, key_rest);
+
+    assert(fuzzy_syllable_step(PINYIN_AMB_Z_ZH | PINYIN_AMB_AN_ANG,
+                               &matrix));
+
+    /* zhang, zang, then zhan and zan. */
+    const ChewingKey * keys = NULL;
+    const ChewingKeyRest * key_rests = NULL;
+    size_t len = 0;
+    matrix.get_column(0, keys, key_rests, len);
+    assert(4 == len);
+
+    ChewingKey zan(CHEWING_Z, CHEWING_ZERO_MIDDLE, CHEWING_AN);
+    zan.m_tone = CHEWING_1;
+    assert(has_key(keys, len, zan));
+
+    for (size_t i = 0; i < len; ++i)
+        assert(CHEWING_1 == keys[i].m_tone);
+
+    return 0;
+}
@@ -83,5 +83,265 @@ int main(int argc, char * argv[]){
     /* mask out all index items. */
     bigram.mask_out(0x0, 0x0);
 
+    printf("----------------------trigram---------------------------\n");
+    Trigram trigram;
+    assert(trigram.attach("/tmp/test_trigram.db",
+                          ATTACH_CREATE|ATTACH_READWRITE));
+
+    TrigramKey index;
+    index.m_tokens[0] = 1; index.m_tokens[1] = 2;
+    assert(trigram.store(index, &single_gram));
+
+    assert(trigram.load(index, gram));
+    assert(gram->get_freq(5, freq));
+    assert(freq == 8);
+    delete gram;
+
+    index.m_tokens[0] = 2; index.m_tokens[1] = 1;
+    assert(!trigram.load(index, gram));
+    assert(NULL == gram);
+
+    TrigramKeyArray histories = g_array_new(FALSE, FALSE, sizeof(TrigramKey));
+    assert(trigram.get_all_items(histories));
+    assert(1 == histories->len);
+    g_array_free(histories, TRUE);
+
+    /* mask out the items with the token 2 in the history. */
+    assert(trigram.mask_out(0xFFFFFFFF, 2));
+    index.m_tokens[0] = 1; index.m_tokens[1] = 2;
+    assert(!trigram.load(index, gram));
+
+    printf("----------------------cache-----------------------------\n");
+    Bigram user_bigram;
+    assert(user_bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE));
+
+    SingleGramCache cache(&bigram, &user_bigram, 16);
+    SingleGram merged;
+    /* all items are masked out above. */
+    assert(!cache.load(1, &merged));
+
+    /* the missing single gram is cached until invalidated. */
+    assert(bigram.store(1, &single_gram));
+    assert(!cache.load(1, &merged));
+    assert(cache.invalidate(1));
+    assert(cache.load(1, &merged));
+    assert(merged.get_freq(5, freq));
+    assert(freq == 8);
+
+    SingleGram user_gram;
+    assert(user_gram.insert_freq(5, 2));
+    assert(user_gram.set_total_freq(2));
+    assert(user_bigram.store(1, &user_gram));
+    assert(cache.invalidate(1));
+
+    assert(cache.load(1, &merged));
+    assert(merged.get_freq(5, freq));
+    assert(freq == 10);
+    assert(merged.get_total_freq(freq));
+    assert(freq == 32 + 2);
+
+    /* evict the entries beyond the capacity. */
+    for (phrase_token_t token = 2; token < 64; ++token)
+        assert(!cache.load(token, &merged));
+    assert(cache.load(1, &merged));
+
+    assert(cache.invalidate_all());
+    assert(user_bigram.mask_out(0x0, 0x0));
+    assert(cache.load(1, &merged));
+    assert(merged.get_freq(5, freq));
+    assert(freq == 8);
+
+    /* the referenced entry outlives the invalidation. */
+    SingleGramCacheRef ref;
+    assert(cache.load(1, ref));
+    assert(cache.invalidate(1));
+    assert(ref.get_system()->get_freq(5, freq));
+    assert(freq == 8);
+    assert(ref.get_user()->get_total_freq(freq));
+    assert(0 == freq);
+    ref.reset();
+
+    printf("----------------------compact---------------------------\n");
+    /* record the identity of the flushed bi-gram file. */
+    assert(bigram.save_db("/tmp/test_source.db"));
+    assert(bigram.attach("/tmp/test_source.db", ATTACH_READONLY));
+    assert(CompactBigram::save(&bigram, "/tmp/test_source.db",
+                               "/tmp/test_bigram.bin"));
+
+    CompactBigram compact_bigram;
+    /* the stale compact bi-gram is rejected. */
+    assert(!compact_bigram.attach("/tmp/test_bigram.bin", "/tmp/test.db"));
+    assert(compact_bigram.attach("/tmp/test_bigram.bin",
+                                 "/tmp/test_source.db"));
+
+    CompactSingleGram compact_gram;
+    assert(!compact_bigram.load(2, compact_gram));
+    assert(compact_bigram.load(1, compact_gram));
+    assert(compact_gram.get_length() == single_gram.get_length());
+    assert(compact_gram.get_total_freq(freq));
+    assert(freq == 32);
+    assert(compact_gram.get_freq(5, freq));
+    assert(freq == 8);
+    assert(!compact_gram.get_freq(1, freq));
+
+    /* the same results as the single gram. */
+    BigramPhraseArray expected = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItem));
+    BigramPhraseArray results = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItem));
+    range.m_range_begin = 3; range.m_range_end = 6;
+    single_gram.search(&range, expected);
+    compact_gram.search(&range, results);
+    assert(expected->len == results->len);
+    for (size_t i = 0; i < expected->len; ++i) {
+        BigramPhraseItem * lhs = &g_array_index(expected, BigramPhraseItem, i);
+        BigramPhraseItem * rhs = &g_array_index(results, BigramPhraseItem, i);
+        assert(lhs->m_token == rhs->m_token);
+        assert(lhs->m_freq == rhs->m_freq);
+    }
+    g_array_free(expected, TRUE);
+    g_array_free(results, TRUE);
+
+    assert(user_bigram.store(1, &user_gram));
+    assert(cache.set_compact_bigram(&compact_bigram));
+    assert(cache.load(1, &merged));
+    assert(merged.get_freq(5, freq));
+    assert(freq == 10);
+    assert(merged.get_total_freq(freq));
+    assert(freq == 32 + 2);
+
+    printf("----------------------view------------------------------\n");
+    SingleGramCacheRef view_ref;
+    MergedSingleGramView view;
+    assert(cache.load(1, view_ref, view));
+    assert(view.get_total_freq(freq));
+    assert(freq == 32 + 2);
+
+    /* the same results as the merged single gram. */
+    for (phrase_token_t token = 0; token < 8; ++token) {
+        guint32 view_freq = 0;
+        const bool found = merged.get_freq(token, freq);
+        assert(found == view.get_freq(token, view_freq));
+        if (found)
+            assert(freq == view_freq);
+    }
+    /* gallop backwards. */
+    assert(view.get_freq(2, freq));
+
+    expected = g_array_new(FALSE, FALSE, sizeof(BigramPhraseItem));
+    results = g_array_new(FALSE, FALSE, sizeof(BigramPhraseItem));
+    range.m_range_begin = 2; range.m_range_end = 6;
+    merged.search(&range, expected);
+    view.search(&range, results);
+    assert(expected->len == results->len);
+    for (size_t i = 0; i < expected->len; ++i) {
+        BigramPhraseItem * lhs = &g_array_index(expected, BigramPhraseItem, i);
+        BigramPhraseItem * rhs = &g_array_index(results, BigramPhraseItem, i);
+        assert(lhs->m_token == rhs->m_token);
+        assert(lhs->m_freq == rhs->m_freq);
+    }
+    g_array_free(expected, TRUE);
+    g_array_free(results, TRUE);
+
+    BigramPhraseWithCountArray counts = g_array_new
+        (FALSE, FALSE, sizeof(BigramPhraseItemWithCount));
+    assert(view.retrieve_all(counts));
+    assert(counts->len == merged.get_length());
+    g_array_free(counts, TRUE);
+
+    printf("----------------------ranges----------------------------\n");
+    PhraseIndexRanges ranges;
+    memset(ranges, 0, sizeof(ranges));
+    ranges[0] = g_array_new(FALSE, FALSE, sizeof(PhraseIndexRange));
+    /* the ranges are not sorted. */
+    range.m_range_begin = 4; range.m_range_end = 7;
+    g_array_append_val(ranges[0], range);
+    range.m_range_begin = 0; range.m_range_end = 3;
+    g_array_append_val(ranges[0], range);
+    range.m_range_begin = 5; range.m_range_end = 6;
+    g_array_append_val(ranges[0], range);
+
+    expected = g_array_new(FALSE, FALSE, sizeof(BigramPhraseItem));
+    results = g_array_new(FALSE, FALSE, sizeof(BigramPhraseItem));
+    for (size_t i = 0; i < ranges[0]->len; ++i)
+        merged.search(&g_array_index(ranges[0], PhraseIndexRange, i),
+                      expected);
+
+    merged.search_ranges(ranges, results);
+    assert(expected->len == results->len);
+    for (size_t i = 0; i < expected->len; ++i) {
+        BigramPhraseItem * lhs = &g_array_index(expected, BigramPhraseItem, i);
+        BigramPhraseItem * rhs = &g_array_index(results, BigramPhraseItem, i);
+        assert(lhs->m_token == rhs->m_token);
+    }
+
+    g_array_set_size(results, 0);
+    view.search_ranges(ranges, results);
+    assert(expected->len == results->len);
+    for (size_t i = 0; i < expected->len; ++i) {
+        BigramPhraseItem * lhs = &g_array_index(expected, BigramPhraseItem, i);
+        BigramPhraseItem * rhs = &g_array_index(results, BigramPhraseItem, i);
+        assert(lhs->m_token == rhs->m_token);
+        assert(lhs->m_freq == rhs->m_freq);
+    }
+
+    g_array_free(expected, TRUE);
+    g_array_free(results, TRUE);
+    g_array_free(ranges[0], TRUE);
+
+    printf("----------------------buffer----------------------------\n");
+    UserBigramBuffer buffer(&user_bigram, 2, 3600);
+    assert(cache.set_user_buffer(&buffer));
+
+    SingleGram * user = NULL;
+    assert(cache.load_user(1, user));
+    assert(user->get_freq(5, freq));
+    assert(freq == 2);
+    assert(user->set_freq(5, 6));
+    assert(user->set_total_freq(6));
+    assert(cache.store_user(1, user));
+    delete user;
+
+    /* the buffered single gram is read before flush. */
+    assert(1 == buffer.get_length());
+    assert(cache.load(1, &merged));
+    assert(merged.get_freq(5, freq));
+    assert(freq == 8 + 6);
+
+    user = NULL;
+    assert(user_bigram.load(1, user));
+    assert(user->get_freq(5, freq));
+    assert(freq == 2);
+
+    /* flush when the buffer is full. */
+    assert(cache.store_user(2, user));
+    delete user;
+    assert(0 == buffer.get_length());
+
+    user_bigram_flush_stats_t stats;
+    assert(buffer.get_flush_stats(stats));
+    assert(1 == stats.m_flushes);
+    assert(2 == stats.m_max_flush_size);
+
+    user = NULL;
+    assert(user_bigram.load(1, user));
+    assert(user->get_freq(5, freq));
+    assert(freq == 6);
+    delete user;
+
+    /* the snapshot of the user bi-gram is not changed by the later stores. */
+    assert(cache.store_user(3, &user_gram));
+    Bigram snapshot;
+    assert(buffer.copy_db(&snapshot));
+    assert(0 == buffer.get_length());
+
+    user = NULL;
+    assert(snapshot.load(3, user));
+    delete user;
+
+    assert(user_bigram.store(4, &user_gram));
+    user = NULL;
+    assert(!snapshot.load(4, user));
+
     return 0;
 }
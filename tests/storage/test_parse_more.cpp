@@ -0,0 +1,174 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "pinyin_internal.h"
+
+using namespace pinyin;
+
+static const char * inputs[] = {
+    "nihao", "xi'an", "xianren", "fananganggai", "jianganjin'ge",
+    "zhong1guo2ren2", "minganxiang'", "shuangxiangzuoyong", NULL
+};
+
+static bool compare_keys(ChewingKeyVector lhs_keys,
+                         ChewingKeyRestVector lhs_key_rests,
+                         ChewingKeyVector rhs_keys,
+                         ChewingKeyRestVector rhs_key_rests) {
+    if (lhs_keys->len != rhs_keys->len)
+        return false;
+
+    for (size_t i = 0; i < lhs_keys->len; ++i) {
+        ChewingKeyRest lhs_rest =
+            g_array_index(lhs_key_rests, ChewingKeyRest, i);
+        ChewingKeyRest rhs_rest =
+            g_array_index(rhs_key_rests, ChewingKeyRest, i);
+
+        if (g_array_index(lhs_keys, ChewingKey, i) !=
+            g_array_index(rhs_keys, ChewingKey, i))
+            return false;
+        if (lhs_rest.m_raw_begin != rhs_rest.m_raw_begin ||
+            lhs_rest.m_raw_end != rhs_rest.m_raw_end)
+            return false;
+    }
+
+    return true;
+}
+
+/* the columns are compared as the sets of the keys. */
+static bool compare_matrix(PhoneticKeyMatrix * lhs, PhoneticKeyMatrix * rhs) {
+    if (lhs->size() != rhs->size())
+        return false;
+
+    for (size_t index = 0; index < lhs->size(); ++index) {
+        const size_t size = lhs->get_column_size(index);
+        if (size != rhs->get_column_size(index))
+            return false;
+
+        /* the views of the columns are the same as the items. */
+        const ChewingKey * rhs_keys = NULL;
+        const ChewingKeyRest * rhs_key_rests = NULL;
+        size_t rhs_size = 0;
+        assert(rhs->get_column(index, rhs_keys, rhs_key_rests, rhs_size));
+        assert(size == rhs_size);
+
+        for (size_t i = 0; i < size; ++i) {
+            ChewingKey lhs_key; ChewingKeyRest lhs_rest;
+            lhs->get_item(index, i, lhs_key, lhs_rest);
+
+            bool found = false;
+            for (size_t j = 0; j < size && !found; ++j) {
+                const ChewingKey & rhs_key = rhs_keys[j];
+                const ChewingKeyRest & rhs_rest = rhs_key_rests[j];
+
+                found = lhs_key == rhs_key &&
+                    lhs_rest.m_raw_begin == rhs_rest.m_raw_begin &&
+                    lhs_rest.m_raw_end == rhs_rest.m_raw_end;
+            }
+
+            if (!found)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+int main(int argc, char * argv[]) {
+    pinyin_option_t options = PINYIN_CORRECT_ALL | USE_TONE |
+        USE_RESPLIT_TABLE | USE_DIVIDED_TABLE;
+
+    FullPinyinParser2 parser;
+    FullPinyinParseState state;
+
+    ChewingKeyVector keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+    ChewingKeyRestVector key_rests =
+        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+    ChewingKeyVector last_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+    ChewingKeyRestVector last_key_rests =
+        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+    ChewingKeyVector full_keys = g_array_new(TRUE, TRUE, sizeof(ChewingKey));
+    ChewingKeyRestVector full_key_rests =
+        g_array_new(TRUE, TRUE, sizeof(ChewingKeyRest));
+
+    PhoneticKeyMatrix matrix, full_matrix;
+    size_t last_parsed_len = 0;
+
+    for (size_t n = 0; NULL != inputs[n]; ++n) {
+        const char * input = inputs[n];
+        const int len = strlen(input);
+
+        /* type the input, then delete it, one character at a time. */
+        for (int step = 1; step < 2 * len; ++step) {
+            const int cur_len = step <= len ? step : 2 * len - step;
+
+            int parsed_len = parser.parse_more
+                (options, state, keys, key_rests, input, cur_len);
+            int full_parsed_len = parser.parse
+                (options, full_keys, full_key_rests, input, cur_len);
+
+            assert(parsed_len == full_parsed_len);
+            assert(compare_keys(keys, key_rests, full_keys, full_key_rests));
+
+            size_t column = update_matrix
+                (options, &matrix, last_keys, last_key_rests,
+                 last_parsed_len, keys, key_rests, parsed_len);
+            assert(column <= matrix.size());
+
+            fill_matrix(&full_matrix, full_keys, full_key_rests,
+                        full_parsed_len);
+            resplit_step(options, &full_matrix);
+            inner_split_step(options, &full_matrix);
+
+            assert(compare_matrix(&matrix, &full_matrix));
+
+            /* keep the keys for the next parse. */
+            g_array_set_size(last_keys, 0);
+            g_array_append_vals(last_keys, keys->data, keys->len);
+            g_array_set_size(last_key_rests, 0);
+            g_array_append_vals(last_key_rests, key_rests->data,
+                                key_rests->len);
+            last_parsed_len = parsed_len;
+        }
+    }
+
+    /* the same keys change nothing. */
+    assert(matrix.size() == update_matrix
+           (options, &matrix, last_keys, last_key_rests, last_parsed_len,
+            last_keys, last_key_rests, last_parsed_len));
+
+    /* the kept steps are dropped when the options are changed. */
+    assert(5 == parser.parse_more
+           (options, state, keys, key_rests, "nihao", 5));
+    assert(0 == parser.parse_more
+           (options | FORCE_TONE, state, keys, key_rests, "nihao", 5));
+
+    g_array_free(full_key_rests, TRUE);
+    g_array_free(full_keys, TRUE);
+    g_array_free(last_key_rests, TRUE);
+    g_array_free(last_keys, TRUE);
+    g_array_free(key_rests, TRUE);
+    g_array_free(keys, TRUE);
+
+    return 0;
+}
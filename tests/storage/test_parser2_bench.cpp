@@ -0,0 +1,81 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timer.h"
+#include <stdio.h>
+#include <string.h>
+#include "pinyin_internal.h"
+
+
+size_t bench_times = 10000;
+
+using namespace pinyin;
+
+static const char * full_pinyins[] = {
+    "nihao", "zhongguo", "xi'an", "zhonghuarenmingongheguo",
+    "woaibeijingtiananmen", "zhuangzhuang", "shuangxiang",
+    "zhong1guo2", "jianshezhongguotesedeshehuizhuyi", "fangan",
+    NULL
+};
+
+static const char * double_pinyins[] = {
+    "nihk", "vsgo", "woll", "uihk", "jmwf", NULL
+};
+
+static void bench_parser(const char * name, PhoneticParser2 & parser,
+                         pinyin_option_t options, const char * inputs[]) {
+    ChewingKeyVector keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    ChewingKeyRestVector key_rests =
+        g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
+
+    size_t num_inputs = 0;
+    while (NULL != inputs[num_inputs])
+        ++num_inputs;
+
+    printf("%s:\n", name);
+    guint32 start_time = record_time();
+    for (size_t i = 0; i < bench_times; ++i) {
+        const char * input = inputs[i % num_inputs];
+        parser.parse(options, keys, key_rests, input, strlen(input));
+    }
+    print_time(start_time, bench_times);
+
+    g_array_free(key_rests, TRUE);
+    g_array_free(keys, TRUE);
+}
+
+int main(int argc, char * argv[]) {
+    pinyin_option_t options = PINYIN_CORRECT_ALL | USE_TONE;
+
+    /* the parse results are checked in test_parser2_index. */
+    FullPinyinParser2 full;
+    bench_parser("full pinyin", full, options, full_pinyins);
+
+    DoublePinyinParser2 double_parser;
+    double_parser.set_scheme(DOUBLE_PINYIN_MS);
+    bench_parser("double pinyin", double_parser, options, double_pinyins);
+
+    PinyinDirectParser2 direct;
+    bench_parser("pinyin direct", direct, options, full_pinyins);
+
+    return 0;
+}
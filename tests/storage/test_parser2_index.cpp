@@ -0,0 +1,137 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+
+#include <stdio.h>
+#include <assert.h>
+#include <string.h>
+#include "pinyin_internal.h"
+#include "pinyin_parser_table.h"
+
+
+using namespace pinyin;
+
+/* every index item is parsed back to its key, with all options. */
+static void check_pinyin_index(FullPinyinParser2 & parser,
+                               const pinyin_index_item_t * index,
+                               size_t len) {
+    pinyin_option_t options = PINYIN_INCOMPLETE | PINYIN_CORRECT_ALL;
+
+    for (size_t i = 0; i < len; ++i) {
+        const pinyin_index_item_t * item = index + i;
+
+        ChewingKey key;
+        assert(parser.parse_one_key(options, key, item->m_pinyin_input,
+                                    strlen(item->m_pinyin_input)));
+        assert(key.get_table_index() == item->m_table_index);
+    }
+}
+
+/* every item of the sorted index is found in the hash, and only them. */
+static void check_chewing_index(const chewing_index_item_t * chewing_index,
+                                size_t len,
+                                const chewing_index_hash_t * hash) {
+    assert(len == hash->m_len);
+
+    for (size_t i = 0; i < len; ++i) {
+        const chewing_index_item_t * item = chewing_index + i;
+        const chewing_index_item_t * found =
+            search_chewing_index_hash(hash, item->m_chewing_input);
+
+        assert(NULL != found);
+        assert(0 == strcmp(item->m_chewing_input, found->m_chewing_input));
+        assert(item->m_flags == found->m_flags);
+        assert(item->m_table_index == found->m_table_index);
+    }
+
+    /* the missed chewings. */
+    assert(NULL == search_chewing_index_hash(hash, ""));
+    assert(NULL == search_chewing_index_hash(hash, "a"));
+    assert(NULL == search_chewing_index_hash(hash, "ㄅㄅㄅ"));
+}
+
+int main(int argc, char * argv[]) {
+    pinyin_option_t options = PINYIN_CORRECT_ALL | USE_TONE;
+
+    ChewingKeyVector keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    ChewingKeyRestVector key_rests =
+        g_array_new(FALSE, FALSE, sizeof(ChewingKeyRest));
+
+    FullPinyinParser2 full;
+    check_pinyin_index(full, pinyin_index, G_N_ELEMENTS(pinyin_index));
+
+    assert(5 == full.parse(options, keys, key_rests, "nihao", 5));
+    assert(2 == keys->len);
+
+    assert(5 == full.parse(options, keys, key_rests, "xi'an", 5));
+    assert(2 == keys->len);
+
+    /* the tones are parsed with the pinyins. */
+    assert(10 == full.parse(options, keys, key_rests, "zhong1guo2", 10));
+    assert(2 == keys->len);
+    assert(1 == g_array_index(keys, ChewingKey, 0).m_tone);
+    assert(2 == g_array_index(keys, ChewingKey, 1).m_tone);
+    assert(6 == g_array_index(key_rests, ChewingKeyRest, 0).m_raw_end);
+
+    /* the force tone rejects the pinyins without tone. */
+    assert(0 == full.parse(options | FORCE_TONE, keys, key_rests,
+                           "nihao", 5));
+
+    full.set_scheme(FULL_PINYIN_LUOMA);
+    check_pinyin_index(full, luoma_pinyin_index,
+                       G_N_ELEMENTS(luoma_pinyin_index));
+
+    full.set_scheme(FULL_PINYIN_SECONDARY_ZHUYIN);
+    check_pinyin_index(full, secondary_zhuyin_index,
+                       G_N_ELEMENTS(secondary_zhuyin_index));
+
+    DoublePinyinParser2 double_parser;
+    double_parser.set_scheme(DOUBLE_PINYIN_MS);
+
+    assert(4 == double_parser.parse(options, keys, key_rests, "nihk", 4));
+    assert(2 == keys->len);
+
+    check_chewing_index(zhuyin_index, G_N_ELEMENTS(zhuyin_index),
+                        &zhuyin_index_hash);
+    check_chewing_index(hsu_zhuyin_index, G_N_ELEMENTS(hsu_zhuyin_index),
+                        &hsu_zhuyin_index_hash);
+    check_chewing_index(eten26_zhuyin_index,
+                        G_N_ELEMENTS(eten26_zhuyin_index),
+                        &eten26_zhuyin_index_hash);
+
+    /* the parsers find the keys through the hash,
+       then check the options stored in the items. */
+    options = USE_TONE | ZHUYIN_INCOMPLETE;
+    ZhuyinDirectParser2 direct;
+    ChewingKey key;
+    assert(direct.parse_one_key(options, key, "ㄅㄚ", strlen("ㄅㄚ")));
+    assert(7 == key.get_table_index());
+    assert(!direct.parse_one_key(options, key, "ㄚㄅ", strlen("ㄚㄅ")));
+    assert(direct.parse_one_key(options | ZHUYIN_CORRECT_SHUFFLE, key,
+                                "ㄚㄅ", strlen("ㄚㄅ")));
+    assert(7 == key.get_table_index());
+
+    g_array_free(key_rests, TRUE);
+    g_array_free(keys, TRUE);
+
+    return 0;
+}
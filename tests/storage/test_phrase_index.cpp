@@ -1,6 +1,7 @@
 #include "timer.h"
 #include <stdio.h>
 #include <errno.h>
+#include <math.h>
 #include "pinyin_internal.h"
 #include "tests_helper.h"
 
@@ -113,6 +114,19 @@ int main(int argc, char * argv[]){
     phrase_index.get_phrase_item(16870553, item2);
     assert( item2.get_unigram_frequency() == 3);
 
+    /* the dense uni-gram column follows the frequency update. */
+    gdouble unigram_poss = 0; guint8 unigram_length = 0;
+    assert(!phrase_index.get_unigram_possibility
+           (16870553, unigram_poss, unigram_length));
+    assert(unigram_length == 14);
+    assert(fabs(unigram_poss - 3. /
+                phrase_index.get_phrase_index_total_freq()) < DBL_EPSILON);
+
+    gfloat unigram_log_poss = 0;
+    assert(!phrase_index.get_unigram_log_possibility
+           (16870553, unigram_log_poss, unigram_length));
+    assert(fabs(unigram_log_poss - log(unigram_poss)) < 1e-4);
+
     phrase_index.get_phrase_item(16777222, item2);
     assert(item2.get_phrase_length() == 1);
     assert(item2.get_n_pronunciation() == 2);
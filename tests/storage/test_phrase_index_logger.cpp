@@ -24,6 +24,25 @@
 
 /* TODO: check whether gb_char.bin and gb_char2.bin should be the same. */
 
+/* the number of the records in the logger, only the token is modified. */
+static size_t count_records(MemoryChunk * chunk, phrase_token_t token){
+    PhraseIndexLogger logger;
+    logger.load(chunk);
+
+    LOG_TYPE log_type = LOG_INVALID_RECORD;
+    phrase_token_t log_token = null_token;
+    MemoryChunk oldchunk, newchunk;
+    size_t num = 0;
+    while (logger.has_next_record()) {
+        assert(logger.next_record(log_type, log_token, &oldchunk, &newchunk));
+        if (LOG_MODIFY_RECORD == log_type)
+            assert(log_token == (token & PHRASE_MASK));
+        ++num;
+    }
+
+    return num;
+}
+
 int main(int argc, char * argv[]){
     FacadePhraseIndex phrase_index;
     MemoryChunk * chunk = new MemoryChunk;
@@ -63,5 +82,31 @@ int main(int argc, char * argv[]){
 
     printf("total freq:%d\n", phrase_index.get_phrase_index_total_freq());
 
+    /* only the changed phrase items are logged. */
+    chunk = new MemoryChunk;
+    chunk->load("../../data/gb_char.bin");
+    phrase_index.load(1, chunk);
+    assert(ERROR_OK == phrase_index.get_range(1, range));
+
+    const phrase_token_t token = PHRASE_INDEX_MAKE_TOKEN
+        (1, range.m_range_begin);
+    assert(ERROR_OK == phrase_index.add_unigram_frequency(token, 1));
+
+    chunk = new MemoryChunk;
+    chunk->load("../../data/gb_char.bin");
+    new_chunk = new MemoryChunk;
+    assert(phrase_index.diff(1, chunk, new_chunk));
+    /* the header and the modified record. */
+    assert(2 == count_records(new_chunk, token));
+
+    /* the compact keeps the changed phrase items only. */
+    assert(phrase_index.compact());
+
+    chunk = new MemoryChunk;
+    chunk->load("../../data/gb_char.bin");
+    new_chunk = new MemoryChunk;
+    assert(phrase_index.diff(1, chunk, new_chunk));
+    assert(2 == count_records(new_chunk, token));
+
     return 0;
 }
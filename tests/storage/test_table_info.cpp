@@ -96,6 +96,26 @@ int main(int argc, char * argv[]) {
 
     retval = user_table_info.is_conform(&system_table_info);
     assert(retval);
+    assert(user_table_info.is_revision_conform());
+
+    /* the user tables written before the revisions are upgraded. */
+    char lines[2][256];
+    FILE * input = fopen("/tmp/user.conf", "r");
+    assert(input);
+    assert(fgets(lines[0], sizeof(lines[0]), input));
+    assert(fgets(lines[1], sizeof(lines[1]), input));
+    fclose(input);
+
+    FILE * output = fopen("/tmp/user.conf", "w");
+    assert(output);
+    fputs(lines[0], output);
+    fputs(lines[1], output);
+    fclose(output);
+
+    assert(user_table_info.load("/tmp/user.conf"));
+    retval = user_table_info.is_conform(&system_table_info);
+    assert(retval);
+    assert(!user_table_info.is_revision_conform());
 
     return 0;
 }
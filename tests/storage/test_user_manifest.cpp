@@ -0,0 +1,131 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <glib/gstdio.h>
+#include "pinyin_internal.h"
+
+
+int main(int argc, char * argv[]){
+    gchar * userdir = g_dir_make_tmp("test_user_manifest_XXXXXX", NULL);
+    assert(userdir);
+
+    UserManifest manifest;
+    assert(!manifest.load(userdir));
+
+    MemoryChunk chunk;
+    const char * content = "binary format version:1\nmodel data version:1\n";
+    chunk.set_content(0, content, strlen(content));
+    assert(manifest.set_entry(USER_TABLE_INFO, &chunk));
+
+    /* the user bi-gram is dumped into the manifest. */
+    Bigram bigram;
+    assert(bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE));
+
+    SingleGram single_gram;
+    single_gram.set_total_freq(3);
+    single_gram.insert_freq(2, 1);
+    single_gram.insert_freq(5, 2);
+    assert(bigram.store(1, &single_gram));
+
+    assert(bigram.save_chunk(&chunk));
+    assert(manifest.set_entry(USER_BIGRAM, &chunk));
+
+    manifest.set_generation(1);
+    assert(manifest.save(userdir));
+
+    UserManifest loaded;
+    assert(loaded.load(userdir));
+    assert(1 == loaded.get_generation());
+    assert(loaded.has_entry(USER_TABLE_INFO));
+
+    UserTableInfo user_table_info;
+    assert(loaded.get_entry(USER_TABLE_INFO, &chunk));
+    assert(user_table_info.load(&chunk));
+
+    Bigram loaded_bigram;
+    assert(loaded.get_entry(USER_BIGRAM, &chunk));
+    assert(loaded_bigram.load_chunk(&chunk));
+
+    SingleGram * gram = NULL;
+    guint32 freq = 0;
+    assert(loaded_bigram.load(1, gram));
+    assert(gram->get_freq(5, freq));
+    assert(2 == freq);
+    delete gram;
+
+    /* the incomplete manifest is skipped. */
+    assert(manifest.remove_entry(USER_BIGRAM));
+    manifest.set_generation(2);
+    assert(manifest.save(userdir));
+
+    gchar * filename = g_build_filename
+        (userdir, "user_data.2.segment", NULL);
+    FILE * segment = fopen(filename, "a");
+    assert(segment);
+    fputs("garbage", segment);
+    fclose(segment);
+    g_free(filename);
+
+    assert(loaded.load(userdir));
+    assert(1 == loaded.get_generation());
+    assert(loaded.has_entry(USER_BIGRAM));
+
+    /* only the newest complete older generation is kept. */
+    manifest.set_generation(3);
+    assert(manifest.save(userdir));
+
+    filename = g_build_filename(userdir, "user_data.2.manifest", NULL);
+    assert(!g_file_test(filename, G_FILE_TEST_EXISTS));
+    g_free(filename);
+
+    filename = g_build_filename(userdir, "user_data.1.manifest", NULL);
+    assert(g_file_test(filename, G_FILE_TEST_EXISTS));
+    g_free(filename);
+
+    assert(loaded.load(userdir));
+    assert(3 == loaded.get_generation());
+    assert(!loaded.has_entry(USER_BIGRAM));
+
+    /* the generation of the coalesced save is never written. */
+    manifest.set_generation(5);
+    assert(manifest.save(userdir));
+
+    filename = g_build_filename(userdir, "user_data.3.manifest", NULL);
+    assert(g_file_test(filename, G_FILE_TEST_EXISTS));
+    g_free(filename);
+
+    filename = g_build_filename(userdir, "user_data.1.manifest", NULL);
+    assert(!g_file_test(filename, G_FILE_TEST_EXISTS));
+    g_free(filename);
+
+    assert(loaded.load(userdir));
+    assert(5 == loaded.get_generation());
+
+    assert(UserManifest::remove_all(userdir));
+    assert(!loaded.load(userdir));
+
+    g_rmdir(userdir);
+    g_free(userdir);
+
+    return 0;
+}
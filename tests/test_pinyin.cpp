@@ -22,6 +22,7 @@
 
 #include "pinyin.h"
 #include <stdio.h>
+#include <assert.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -65,10 +66,45 @@ int main(int argc, char * argv[]){
             break;
 
         size_t len = pinyin_parse_more_full_pinyins(instance, linebuf);
+
+        size_t i = 0;
+        guint num = 0;
+
+        if (pinyin_guess_sentences_nbest(instance, 5)) {
+            pinyin_get_n_sentence(instance, &num);
+            assert(0 < num && num <= 5);
+
+            /* the best sentence is also the guessed sentence. */
+            char * best = NULL;
+            assert(pinyin_get_sentence(instance, &best));
+
+            pinyin_guess_sentence(instance);
+            char * sentence = NULL;
+            assert(pinyin_get_sentence(instance, &sentence));
+            assert(0 == strcmp(best, sentence));
+            g_free(sentence);
+
+            char * sentences[5] = {NULL};
+            for (i = 0; i < num; ++i) {
+                assert(pinyin_get_nth_sentence(instance, i, &sentences[i]));
+                assert(NULL != sentences[i]);
+
+                /* the sentences only differ in the segmentation
+                   are merged. */
+                for (size_t k = 0; k < i; ++k)
+                    assert(0 != strcmp(sentences[k], sentences[i]));
+            }
+            assert(0 == strcmp(best, sentences[0]));
+            assert(!pinyin_get_nth_sentence(instance, num, &sentence));
+
+            for (i = 0; i < num; ++i)
+                g_free(sentences[i]);
+            g_free(best);
+        }
+
         pinyin_guess_sentence_with_prefix(instance, prefixbuf);
         pinyin_guess_candidates(instance, 0);
 
-        size_t i = 0;
         for (i = 0; i <= len; ++i) {
             gchar * aux_text = NULL;
             pinyin_get_full_pinyin_auxiliary_text(instance, i, &aux_text);
@@ -76,7 +112,6 @@ int main(int argc, char * argv[]){
             g_free(aux_text);
         }
 
-        guint num = 0;
         pinyin_get_n_candidate(instance, &num);
         for (i = 0; i < num; ++i) {
             lookup_candidate_t * candidate = NULL;
@@ -0,0 +1,168 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "pinyin.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static const char * inputs[] = {
+    "nihao", "zhongguo", "beijing", "nihao", "wohenxihuanni", "nihao",
+};
+
+static const char * phrase = "你好";
+
+struct save_data_t{
+    GMutex m_mutex;
+    GCond m_cond;
+    size_t m_finished;
+    size_t m_succeeded;
+};
+
+static void save_callback(pinyin_context_t * context, gboolean success,
+                          gpointer user_data){
+    save_data_t * data = (save_data_t *) user_data;
+
+    g_mutex_lock(&data->m_mutex);
+    ++data->m_finished;
+    if (success)
+        ++data->m_succeeded;
+    g_cond_signal(&data->m_cond);
+    g_mutex_unlock(&data->m_mutex);
+}
+
+static pinyin_context_t * init_context(const char * userdir){
+    pinyin_context_t * context = pinyin_init("../data", userdir);
+    assert(NULL != context);
+
+    pinyin_option_t options = PINYIN_INCOMPLETE |
+        PINYIN_CORRECT_ALL | USE_DIVIDED_TABLE | USE_RESPLIT_TABLE |
+        DYNAMIC_ADJUST;
+    pinyin_set_options(context, options);
+    return context;
+}
+
+static void train(pinyin_instance_t * instance, const char * input){
+    pinyin_parse_more_full_pinyins(instance, input);
+    pinyin_guess_sentence(instance);
+    pinyin_train(instance);
+    pinyin_reset(instance);
+}
+
+/* the unigram frequency of the phrase, and the guessed sentence. */
+static void get_state(pinyin_context_t * context,
+                      guint * freq, char ** sentence){
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+
+    GArray * tokens = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    assert(pinyin_lookup_tokens(instance, phrase, tokens));
+    assert(tokens->len > 0);
+
+    phrase_token_t token = g_array_index(tokens, phrase_token_t, 0);
+    assert(pinyin_token_get_unigram_frequency(instance, token, freq));
+    g_array_free(tokens, TRUE);
+
+    pinyin_parse_more_full_pinyins(instance, "nihao");
+    pinyin_guess_sentence(instance);
+    assert(pinyin_get_sentence(instance, sentence));
+    pinyin_reset(instance);
+
+    pinyin_free_instance(instance);
+}
+
+int main(int argc, char * argv[]){
+    gchar * async_dir = g_strdup("/tmp/test_save_async_XXXXXX");
+    gchar * sync_dir = g_strdup("/tmp/test_save_sync_XXXXXX");
+    assert(NULL != g_mkdtemp(async_dir));
+    assert(NULL != g_mkdtemp(sync_dir));
+
+    save_data_t data;
+    g_mutex_init(&data.m_mutex);
+    g_cond_init(&data.m_cond);
+    data.m_finished = data.m_succeeded = 0;
+
+    /* the back to back saves in background. */
+    pinyin_context_t * context = init_context(async_dir);
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+
+    size_t scheduled = 0;
+    for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i) {
+        train(instance, inputs[i]);
+        assert(pinyin_save_async(context, save_callback, &data));
+        ++scheduled;
+    }
+    pinyin_free_instance(instance);
+
+    /* wait for the coalesced saves, all callbacks are called. */
+    g_mutex_lock(&data.m_mutex);
+    while (data.m_finished < scheduled)
+        g_cond_wait(&data.m_cond, &data.m_mutex);
+    assert(data.m_succeeded == scheduled);
+    g_mutex_unlock(&data.m_mutex);
+
+    /* the state of the last snapshot. */
+    guint last_freq = 0; char * last_sentence = NULL;
+    get_state(context, &last_freq, &last_sentence);
+    pinyin_fini(context);
+
+    /* the same trainings with the synchronous saves. */
+    context = init_context(sync_dir);
+    instance = pinyin_alloc_instance(context);
+    for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i) {
+        train(instance, inputs[i]);
+        assert(pinyin_save(context));
+    }
+    pinyin_free_instance(instance);
+    pinyin_fini(context);
+
+    /* the reload sees the last snapshot. */
+    guint async_freq = 0; char * async_sentence = NULL;
+    context = init_context(async_dir);
+    get_state(context, &async_freq, &async_sentence);
+    pinyin_fini(context);
+
+    assert(last_freq == async_freq);
+    assert(0 == strcmp(last_sentence, async_sentence));
+
+    /* the same as the synchronous saves. */
+    guint sync_freq = 0; char * sync_sentence = NULL;
+    context = init_context(sync_dir);
+    get_state(context, &sync_freq, &sync_sentence);
+    pinyin_fini(context);
+
+    assert(sync_freq == async_freq);
+    assert(0 == strcmp(sync_sentence, async_sentence));
+
+    printf("frequency:%d\tsentence:%s\n", async_freq, async_sentence);
+
+    g_free(last_sentence);
+    g_free(async_sentence);
+    g_free(sync_sentence);
+
+    g_mutex_clear(&data.m_mutex);
+    g_cond_clear(&data.m_cond);
+
+    g_free(async_dir);
+    g_free(sync_dir);
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timer.h"
+#include "pinyin.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static const char * inputs[] = {
+    "nihao",
+    "zhongguo",
+    "beijing",
+    "xiangshan",
+    "wohenxihuanni",
+    "zhonghuarenmingongheguo",
+    "jintiantianqihenhao",
+    "pinyinshurufa",
+    "jisuanjiyuyan",
+    "shuxuejiaoxue",
+};
+
+static const size_t bench_rounds = 50;
+
+struct thread_data_t{
+    pinyin_instance_t * m_instance;
+    /* the expected sentences from the single-threaded run. */
+    char ** m_expected;
+    size_t m_mismatches;
+};
+
+static char * convert(pinyin_instance_t * instance, const char * input){
+    pinyin_parse_more_full_pinyins(instance, input);
+    pinyin_guess_sentence(instance);
+
+    char * sentence = NULL;
+    pinyin_get_sentence(instance, &sentence);
+    pinyin_reset(instance);
+    return sentence;
+}
+
+static gpointer run_thread(gpointer user_data){
+    thread_data_t * data = (thread_data_t *) user_data;
+
+    for (size_t round = 0; round < bench_rounds; ++round) {
+        for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i) {
+            char * sentence = convert(data->m_instance, inputs[i]);
+
+            if (NULL == sentence || 0 != strcmp(sentence, data->m_expected[i]))
+                ++data->m_mismatches;
+
+            g_free(sentence);
+        }
+    }
+
+    return NULL;
+}
+
+int main(int argc, char * argv[]){
+    size_t nthreads = 4;
+    if (argc > 1)
+        nthreads = atoi(argv[1]);
+
+    pinyin_context_t * context =
+        pinyin_init("../data", "../data");
+
+    pinyin_option_t options = PINYIN_INCOMPLETE |
+        PINYIN_CORRECT_ALL | USE_DIVIDED_TABLE | USE_RESPLIT_TABLE |
+        DYNAMIC_ADJUST;
+    pinyin_set_options(context, options);
+
+    /* compute the expected sentences in one thread. */
+    char * expected[G_N_ELEMENTS(inputs)];
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+    for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i) {
+        expected[i] = convert(instance, inputs[i]);
+        assert(NULL != expected[i]);
+        printf("%s\t%s\n", inputs[i], expected[i]);
+    }
+    pinyin_free_instance(instance);
+
+    /* run the same inputs over one context from many threads. */
+    thread_data_t * datas = g_new0(thread_data_t, nthreads);
+    GThread ** threads = g_new0(GThread *, nthreads);
+
+    for (size_t i = 0; i < nthreads; ++i) {
+        datas[i].m_instance = pinyin_alloc_instance(context);
+        datas[i].m_expected = expected;
+        datas[i].m_mismatches = 0;
+    }
+
+    for (size_t i = 0; i < nthreads; ++i)
+        threads[i] = g_thread_new("test_thread", run_thread, datas + i);
+
+    size_t mismatches = 0;
+    for (size_t i = 0; i < nthreads; ++i) {
+        g_thread_join(threads[i]);
+        mismatches += datas[i].m_mismatches;
+        pinyin_free_instance(datas[i].m_instance);
+    }
+
+    printf("threads:%ld\tconversions:%ld\tmismatches:%ld\n",
+           nthreads, nthreads * bench_rounds * G_N_ELEMENTS(inputs),
+           mismatches);
+    assert(0 == mismatches);
+
+    g_free(threads);
+    g_free(datas);
+
+    /* convert the inputs in batch, the results keep the input order. */
+    const size_t num = bench_rounds * G_N_ELEMENTS(inputs);
+    const char ** batch_inputs = g_new0(const char *, num);
+    char ** batch_results = g_new0(char *, num);
+    for (size_t i = 0; i < num; ++i)
+        batch_inputs[i] = inputs[i % G_N_ELEMENTS(inputs)];
+
+    for (size_t n = 1; n <= nthreads; n *= 2) {
+        printf("batch threads:%ld\n", n);
+        guint32 start_time = record_time();
+        bool retval = pinyin_convert_batch
+            (context, batch_inputs, num, batch_results, n);
+        print_time(start_time, num);
+        assert(retval);
+
+        for (size_t i = 0; i < num; ++i) {
+            const char * sentence = expected[i % G_N_ELEMENTS(inputs)];
+            assert(0 == strcmp(batch_results[i], sentence));
+            g_free(batch_results[i]);
+        }
+    }
+
+    g_free(batch_inputs);
+    g_free(batch_results);
+    for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i)
+        g_free(expected[i]);
+
+    pinyin_fini(context);
+    return 0;
+}
@@ -0,0 +1,279 @@
+/*
+ *  libpinyin
+ *  Library to deal with pinyin.
+ *
+ *  Copyright (C) 2016 Peng Wu <alexepico@gmail.com>
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "pinyin_internal.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+static const char * inputs[] = {
+    "nihao", "zhongguo", "beijing", "nihao", "wohenxihuanni", "nihao",
+};
+
+static const char * phrase = "你好";
+
+/* the user phrase with the fuzzy initials. */
+static const char * user_phrase = "竹猪虾";
+static const char * user_pinyin = "zhu'zhu'xia";
+static const char * user_incomplete = "zh'zh'x";
+
+/* the user pinyin index written before the user table revision,
+   the in-complete chewing index keeps the fuzzy initials. */
+class OldChewingLargeTable2 : public ChewingLargeTable2 {
+public:
+    int add_old_index(int phrase_length,
+                      /* in */ const ChewingKey keys[],
+                      /* in */ phrase_token_t token) {
+        ChewingKey index[MAX_PHRASE_LENGTH];
+
+        compute_incomplete_chewing_index(keys, index, phrase_length);
+        int result = add_index_internal(phrase_length, index, keys, token);
+        if (ERROR_OK != result)
+            return result;
+
+        compute_chewing_index(keys, index, phrase_length);
+        return add_index_internal(phrase_length, index, keys, token);
+    }
+};
+
+static pinyin_context_t * init_context(const char * userdir){
+    pinyin_context_t * context = pinyin_init("../data", userdir);
+    assert(NULL != context);
+
+    pinyin_option_t options = PINYIN_INCOMPLETE |
+        PINYIN_CORRECT_ALL | USE_DIVIDED_TABLE | USE_RESPLIT_TABLE |
+        DYNAMIC_ADJUST;
+    pinyin_set_options(context, options);
+    return context;
+}
+
+static void train(pinyin_instance_t * instance, const char * input){
+    pinyin_parse_more_full_pinyins(instance, input);
+    pinyin_guess_sentence(instance);
+    pinyin_train(instance);
+    pinyin_reset(instance);
+}
+
+/* the token of the phrase in the phrase library. */
+static phrase_token_t lookup_token(pinyin_instance_t * instance,
+                                   const char * phrase, guint8 index){
+    GArray * tokens = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    assert(pinyin_lookup_tokens(instance, phrase, tokens));
+
+    phrase_token_t token = null_token;
+    for (size_t i = 0; i < tokens->len; ++i) {
+        phrase_token_t cur = g_array_index(tokens, phrase_token_t, i);
+        if (PHRASE_INDEX_LIBRARY_INDEX(cur) == index)
+            token = cur;
+    }
+    g_array_free(tokens, TRUE);
+
+    return token;
+}
+
+/* the unigram frequency of the phrase, and the guessed sentence. */
+static void get_state(pinyin_context_t * context,
+                      guint * freq, char ** sentence){
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+
+    GArray * tokens = g_array_new(FALSE, FALSE, sizeof(phrase_token_t));
+    assert(pinyin_lookup_tokens(instance, phrase, tokens));
+    assert(tokens->len > 0);
+
+    phrase_token_t token = g_array_index(tokens, phrase_token_t, 0);
+    assert(pinyin_token_get_unigram_frequency(instance, token, freq));
+    g_array_free(tokens, TRUE);
+
+    pinyin_parse_more_full_pinyins(instance, "nihao");
+    pinyin_guess_sentence(instance);
+    assert(pinyin_get_sentence(instance, sentence));
+    pinyin_reset(instance);
+
+    pinyin_free_instance(instance);
+}
+
+/* whether the in-complete pinyin finds the user phrase. */
+static bool has_user_candidate(pinyin_context_t * context){
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+
+    pinyin_parse_more_full_pinyins(instance, user_incomplete);
+    pinyin_guess_candidates(instance, 0);
+
+    bool found = false;
+    guint num = 0;
+    pinyin_get_n_candidate(instance, &num);
+    for (guint i = 0; i < num; ++i) {
+        lookup_candidate_t * candidate = NULL;
+        pinyin_get_candidate(instance, i, &candidate);
+
+        const gchar * word = NULL;
+        pinyin_get_candidate_string(instance, candidate, &word);
+        if (0 == strcmp(word, user_phrase))
+            found = true;
+    }
+    pinyin_reset(instance);
+
+    pinyin_free_instance(instance);
+    return found;
+}
+
+static void save_user_file(const char * userdir, const char * filename,
+                           MemoryChunk * chunk){
+    gchar * path = g_build_filename(userdir, filename, NULL);
+    assert(chunk->save(path));
+    g_free(path);
+}
+
+/* rewrite the user tables into the files of the old revision. */
+static void downgrade_user_tables(const char * userdir,
+                                  phrase_token_t token,
+                                  ChewingKeyVector keys){
+    UserManifest manifest;
+    assert(manifest.load(userdir));
+
+    MemoryChunk chunk;
+    gchar * filename = NULL;
+
+    /* the user table info without the revision. */
+    assert(manifest.get_entry(USER_TABLE_INFO, &chunk));
+    const char * content = (const char *) chunk.begin();
+    const char * revision = g_strstr_len
+        (content, chunk.size(), "user table revision:");
+    assert(NULL != revision);
+
+    MemoryChunk info;
+    info.set_content(0, content, revision - content);
+    save_user_file(userdir, USER_TABLE_INFO, &info);
+
+    /* the phrase logs and the user phrase files. */
+    SystemTableInfo2 system_table_info;
+    filename = g_build_filename("../data", SYSTEM_TABLE_INFO, NULL);
+    assert(system_table_info.load(filename));
+    g_free(filename);
+
+    const pinyin_table_info_t * phrase_files =
+        system_table_info.get_default_tables();
+    for (size_t i = 0; i < PHRASE_INDEX_LIBRARY_COUNT; ++i) {
+        const char * userfilename = phrase_files[i].m_user_filename;
+        if (NULL == userfilename)
+            continue;
+
+        if (!manifest.get_entry(userfilename, &chunk))
+            continue;
+
+        save_user_file(userdir, userfilename, &chunk);
+    }
+
+    /* the user phrase index. */
+    assert(manifest.get_entry(USER_PHRASE_INDEX, &chunk));
+    PhraseLargeTable3 phrase_table;
+    assert(phrase_table.load_chunk(&chunk));
+    filename = g_build_filename(userdir, USER_PHRASE_INDEX, NULL);
+    assert(phrase_table.store_db(filename));
+    g_free(filename);
+
+    /* the user bi-gram. */
+    assert(manifest.get_entry(USER_BIGRAM, &chunk));
+    Bigram bigram;
+    assert(bigram.load_chunk(&chunk));
+    filename = g_build_filename(userdir, USER_BIGRAM, NULL);
+    assert(bigram.save_db(filename));
+    g_free(filename);
+
+    /* the user pinyin index with the old in-complete chewing index. */
+    MemoryChunk empty;
+    OldChewingLargeTable2 pinyin_table;
+    assert(pinyin_table.load_chunk(&empty));
+    assert(ERROR_OK == pinyin_table.add_old_index
+           (keys->len, (ChewingKey *) keys->data, token));
+    filename = g_build_filename(userdir, USER_PINYIN_INDEX, NULL);
+    assert(pinyin_table.store_db(filename));
+    g_free(filename);
+
+    assert(UserManifest::remove_all(userdir));
+}
+
+int main(int argc, char * argv[]){
+    gchar * userdir = g_strdup("/tmp/test_user_upgrade_XXXXXX");
+    assert(NULL != g_mkdtemp(userdir));
+
+    pinyin_context_t * context = init_context(userdir);
+    pinyin_instance_t * instance = pinyin_alloc_instance(context);
+
+    for (size_t i = 0; i < G_N_ELEMENTS(inputs); ++i)
+        train(instance, inputs[i]);
+
+    import_iterator_t * iter = pinyin_begin_add_phrases
+        (context, USER_DICTIONARY);
+    assert(pinyin_iterator_add_phrase(iter, user_phrase, user_pinyin, -1));
+    pinyin_end_add_phrases(iter);
+
+    phrase_token_t token = lookup_token
+        (instance, user_phrase, USER_DICTIONARY);
+    assert(null_token != token);
+
+    ChewingKeyVector keys = g_array_new(FALSE, FALSE, sizeof(ChewingKey));
+    assert(pinyin_token_get_nth_pronunciation(instance, token, 0, keys));
+    pinyin_free_instance(instance);
+
+    assert(pinyin_save(context));
+
+    guint trained_freq = 0; char * trained_sentence = NULL;
+    get_state(context, &trained_freq, &trained_sentence);
+    assert(has_user_candidate(context));
+    pinyin_fini(context);
+
+    /* the profile written before the user table revision. */
+    downgrade_user_tables(userdir, token, keys);
+    g_array_free(keys, TRUE);
+
+    /* the trained frequencies and the user phrase survive the upgrade. */
+    context = init_context(userdir);
+    guint upgraded_freq = 0; char * upgraded_sentence = NULL;
+    get_state(context, &upgraded_freq, &upgraded_sentence);
+
+    assert(trained_freq == upgraded_freq);
+    assert(0 == strcmp(trained_sentence, upgraded_sentence));
+
+    instance = pinyin_alloc_instance(context);
+    assert(token == lookup_token(instance, user_phrase, USER_DICTIONARY));
+    pinyin_free_instance(instance);
+
+    assert(has_user_candidate(context));
+
+    /* the upgraded user pinyin index is kept by the save. */
+    assert(pinyin_save(context));
+    pinyin_fini(context);
+
+    context = init_context(userdir);
+    assert(has_user_candidate(context));
+    pinyin_fini(context);
+
+    printf("frequency:%d\tsentence:%s\n", upgraded_freq, upgraded_sentence);
+
+    g_free(trained_sentence);
+    g_free(upgraded_sentence);
+    g_free(userdir);
+
+    return 0;
+}
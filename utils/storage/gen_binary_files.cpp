@@ -35,9 +35,8 @@ static GOptionEntry entries[] =
 bool generate_binary_files(const char * pinyin_table_filename,
                            const char * phrase_table_filename,
                            const pinyin_table_info_t * phrase_files) {
-    /* generate pinyin index*/
+    /* generate pinyin index in memory, then store it in the native format. */
     ChewingLargeTable2 pinyin_table;
-    pinyin_table.attach(pinyin_table_filename, ATTACH_READWRITE|ATTACH_CREATE);
 
     PhraseLargeTable3 phrase_table;
     phrase_table.attach(phrase_table_filename, ATTACH_READWRITE|ATTACH_CREATE);
@@ -72,6 +71,11 @@ bool generate_binary_files(const char * pinyin_table_filename,
         g_free(filename);
     }
 
+    if (!pinyin_table.store_mmap(pinyin_table_filename)) {
+        fprintf(stderr, "store %s failed!\n", pinyin_table_filename);
+        exit(ENOENT);
+    }
+
     phrase_index.compact();
 
     if (!save_phrase_index(phrase_files, &phrase_index))
@@ -307,5 +307,19 @@ int main(int argc, char * argv[]){
     if (!save_phrase_index(phrase_files, &phrase_index))
         exit(ENOENT);
 
+    /* flush the bi-gram into the file, before computing its identity. */
+    retval = bigram.attach(bigram_filename, ATTACH_READONLY);
+    if (!retval) {
+        fprintf(stderr, "open %s failed!\n", bigram_filename);
+        exit(ENOENT);
+    }
+
+    /* the compact bi-gram is loaded instead of bigram.db. */
+    if (!CompactBigram::save(&bigram, bigram_filename,
+                             SYSTEM_COMPACT_BIGRAM)) {
+        fprintf(stderr, "save %s failed!\n", SYSTEM_COMPACT_BIGRAM);
+        exit(ENOENT);
+    }
+
     return 0;
 }
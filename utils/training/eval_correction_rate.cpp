@@ -155,11 +155,14 @@ int main(int argc, char * argv[]){
     Bigram user_bigram;
     user_bigram.attach(NULL, ATTACH_CREATE|ATTACH_READWRITE);
 
+    SingleGramCache single_gram_cache(&system_bigram, &user_bigram);
+
     gfloat lambda = system_table_info.get_lambda();
 
     PinyinLookup2 pinyin_lookup(lambda,
                                 &largetable, &phrase_index,
-                                &system_bigram, &user_bigram);
+                                &system_bigram, &user_bigram,
+                                &single_gram_cache);
 
     /* open evals text. */
     FILE * evals_file = fopen(evals_text, "r");
@@ -29,14 +29,29 @@
 
 static gboolean train_pi_gram = TRUE;
 static const gchar * bigram_filename = SYSTEM_BIGRAM;
+static const gchar * trigram_filename = NULL;
 
 static GOptionEntry entries[] =
 {
     {"skip-pi-gram-training", 0, G_OPTION_FLAG_REVERSE, G_OPTION_ARG_NONE, &train_pi_gram, "skip pi-gram training", NULL},
     {"bigram-file", 0, 0, G_OPTION_ARG_FILENAME, &bigram_filename, "bi-gram file", NULL},
+    {"trigram-file", 0, 0, G_OPTION_ARG_FILENAME, &trigram_filename, "tri-gram file, skip tri-gram training if not specified", NULL},
     {NULL}
 };
 
+static bool increase_freq(SingleGram * single_gram, phrase_token_t token){
+    guint32 freq, total_freq;
+    /* increase freq */
+    if (single_gram->get_freq(token, freq))
+        assert(single_gram->set_freq(token, freq + 1));
+    else
+        assert(single_gram->insert_freq(token, 1));
+    /* increase total freq */
+    single_gram->get_total_freq(total_freq);
+    single_gram->set_total_freq(total_freq + 1);
+    return true;
+}
+
 int main(int argc, char * argv[]){
     FILE * input = stdin;
 
@@ -71,8 +86,14 @@ int main(int argc, char * argv[]){
     Bigram bigram;
     bigram.attach(bigram_filename, ATTACH_CREATE|ATTACH_READWRITE);
 
+    Trigram trigram;
+    if (trigram_filename)
+        trigram.attach(trigram_filename, ATTACH_CREATE|ATTACH_READWRITE);
+
     char* linebuf = NULL; size_t size = 0;
     phrase_token_t last_token, cur_token = last_token = 0;
+    /* the token before last_token, null_token if not available. */
+    phrase_token_t history_token = null_token;
     while( getline(&linebuf, &size, input) ){
 	if ( feof(input) )
 	    break;
@@ -87,14 +108,17 @@ int main(int argc, char * argv[]){
 	cur_token = token;
 
         /* skip null_token in second word. */
-        if ( null_token == cur_token )
+        if ( null_token == cur_token ) {
+            history_token = null_token;
             continue;
+        }
 
         /* training uni-gram */
         phrase_index.add_unigram_frequency(cur_token, 1);
 
         /* skip pi-gram training. */
         if ( null_token == last_token ){
+            history_token = null_token;
             if ( !train_pi_gram )
                 continue;
             last_token = sentence_start;
@@ -107,18 +131,30 @@ int main(int argc, char * argv[]){
         if ( NULL == single_gram ){
             single_gram = new SingleGram;
         }
-        guint32 freq, total_freq;
-        /* increase freq */
-        if (single_gram->get_freq(cur_token, freq))
-            assert(single_gram->set_freq(cur_token, freq + 1));
-        else
-            assert(single_gram->insert_freq(cur_token, 1));
-        /* increase total freq */
-        single_gram->get_total_freq(total_freq);
-        single_gram->set_total_freq(total_freq + 1);
+        increase_freq(single_gram, cur_token);
 
         bigram.store(last_token, single_gram);
         delete single_gram;
+
+        /* train tri-gram */
+        if ( trigram_filename && null_token != history_token ){
+            TrigramKey index;
+            index.m_tokens[0] = history_token;
+            index.m_tokens[1] = last_token;
+
+            single_gram = NULL;
+            trigram.load(index, single_gram);
+
+            if ( NULL == single_gram ){
+                single_gram = new SingleGram;
+            }
+            increase_freq(single_gram, cur_token);
+
+            trigram.store(index, single_gram);
+            delete single_gram;
+        }
+
+        history_token = last_token;
     }
 
     free(linebuf);